@@ -15,11 +15,15 @@ include(${CMAKE_SOURCE_DIR}/cmake/external_libs/json.cmake)
 include(${CMAKE_SOURCE_DIR}/cmake/dependency_securec.cmake)
 include(${CMAKE_SOURCE_DIR}/cmake/external_libs/protobuf.cmake)
 
+# zlib is used by gRPC and by the compressed pages of mindrecord
+if (MS_BUILD_GRPC OR ENABLE_MINDDATA)
+    include(${CMAKE_SOURCE_DIR}/cmake/external_libs/zlib.cmake)
+endif()
+
 if (MS_BUILD_GRPC)
     # build dependencies of gRPC
     include(${CMAKE_SOURCE_DIR}/cmake/external_libs/absl.cmake)
     include(${CMAKE_SOURCE_DIR}/cmake/external_libs/c-ares.cmake)
-    include(${CMAKE_SOURCE_DIR}/cmake/external_libs/zlib.cmake)
     # build gRPC
     include(${CMAKE_SOURCE_DIR}/cmake/external_libs/grpc.cmake)
     # build event
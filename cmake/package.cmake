@@ -44,6 +44,7 @@ if (CMAKE_SYSTEM_NAME MATCHES "Windows")
     set(opencv_LIBPATH ${opencv_LIBPATH}/../bin/)
     set(jpeg_turbo_LIBPATH ${jpeg_turbo_LIBPATH}/../bin/)
     set(sqlite_LIBPATH ${sqlite_LIBPATH}/../bin/)
+    set(zlib_LIBPATH ${zlib_LIBPATH}/../bin/)
     set(tinyxml2_LIBPATH ${tinyxml2_LIBPATH}/../bin/)
     set(sentencepiece_LIBPATH ${sentencepiece_LIBPATH}/../bin/)
 else ()
@@ -105,6 +106,14 @@ if (ENABLE_MINDDATA)
         DESTINATION ${INSTALL_LIB_DIR}
         COMPONENT mindspore
     )
+    file(GLOB_RECURSE ZLIB_LIB_LIST
+        ${zlib_LIBPATH}/libz*
+    )
+    install(
+        FILES ${ZLIB_LIB_LIST}
+        DESTINATION ${INSTALL_LIB_DIR}
+        COMPONENT mindspore
+    )
     if (CMAKE_SYSTEM_NAME MATCHES "Windows")
         message("icu4c does not support windows system temporarily")
     else()
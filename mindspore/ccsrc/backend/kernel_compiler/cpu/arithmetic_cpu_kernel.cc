@@ -14,13 +14,18 @@
  * limitations under the License.
  */
 #include "backend/kernel_compiler/cpu/arithmetic_cpu_kernel.h"
-#include <thread>
+#include <algorithm>
 #include <string>
+#include "backend/kernel_compiler/cpu/cpu_thread_pool.h"
+#include "backend/kernel_compiler/cpu/simd/simd_kernels.h"
 #include "runtime/device/cpu/cpu_device_address.h"
 
 namespace mindspore {
 namespace kernel {
 namespace {
+// elements computed by one task at least, smaller tensors are computed by the launching thread only
+constexpr size_t kArithmeticGrainSize = 16384;
+
 template <typename T>
 void Add(const T *input1, const T *input2, T *out, size_t start, size_t end, bool is_number) {
   for (size_t i = start; i < end; i++) {
@@ -67,25 +72,19 @@ void ArithmeticCPUKernel::InitKernel(const CNodePtr &kernel_node) {
     operate_type_ = DIV;
   }
 
-  auto shape0 = AnfAlgo::GetPrevNodeOutputInferShape(kernel_node, 0);
-  auto shape1 = AnfAlgo::GetPrevNodeOutputInferShape(kernel_node, 1);
-  if (shape1.size() == 0) {
-    is_number_ = true;
-  } else {
-    is_number_ = false;
-    if (shape0.size() != shape1.size()) {
-      MS_LOG(EXCEPTION) << "Input0 and input1 must has the same shape";
-    }
-    for (size_t i = 0; i < shape0.size(); ++i) {
-      if (shape0[i] != shape1[i]) {
-        MS_LOG(EXCEPTION) << "Input0 and input1 must has the same shape";
-      }
-    }
-  }
   dtype_ = AnfAlgo::GetPrevNodeOutputInferDataType(kernel_node, 0);
   if (dtype_ != AnfAlgo::GetPrevNodeOutputInferDataType(kernel_node, 1)) {
     MS_LOG(EXCEPTION) << "Input0 and input1 must has the same data type";
   }
+  input_shape0_ = AnfAlgo::GetPrevNodeOutputInferShape(kernel_node, 0);
+  input_shape1_ = AnfAlgo::GetPrevNodeOutputInferShape(kernel_node, 1);
+  is_number_ = input_shape1_.empty();
+  if (dtype_ == kNumberTypeFloat32) {
+    // float32 inputs are computed by the simd kernels, which broadcast any compatible shapes
+    (void)simd::BroadcastShape(input_shape0_, input_shape1_);
+  } else if (!is_number_ && input_shape0_ != input_shape1_) {
+    MS_LOG(EXCEPTION) << "Input0 and input1 must has the same shape";
+  }
 }
 
 bool ArithmeticCPUKernel::Launch(const std::vector<kernel::AddressPtr> &inputs,
@@ -94,7 +93,7 @@ bool ArithmeticCPUKernel::Launch(const std::vector<kernel::AddressPtr> &inputs,
   if (dtype_ == kNumberTypeInt32) {
     LaunchKernel<int>(inputs, outputs);
   } else if (dtype_ == kNumberTypeFloat32) {
-    LaunchKernel<float>(inputs, outputs);
+    LaunchFloatKernel(inputs, outputs);
   } else if (dtype_ == kNumberTypeInt64) {
     LaunchKernel<int64_t>(inputs, outputs);
   } else {
@@ -103,6 +102,26 @@ bool ArithmeticCPUKernel::Launch(const std::vector<kernel::AddressPtr> &inputs,
   return true;
 }
 
+void ArithmeticCPUKernel::LaunchFloatKernel(const std::vector<AddressPtr> &inputs,
+                                            const std::vector<AddressPtr> &outputs) {
+  auto input1 = reinterpret_cast<float *>(inputs[0]->addr);
+  auto input2 = reinterpret_cast<float *>(inputs[1]->addr);
+  auto output = reinterpret_cast<float *>(outputs[0]->addr);
+  simd::BinaryType type = simd::BinaryType::kAdd;
+  if (operate_type_ == SUB) {
+    type = simd::BinaryType::kSub;
+  } else if (operate_type_ == MUL) {
+    type = simd::BinaryType::kMul;
+  } else if (operate_type_ == DIV) {
+    type = simd::BinaryType::kDiv;
+    auto input2_end = input2 + inputs[1]->size / sizeof(float);
+    if (std::find(input2, input2_end, 0.0f) != input2_end) {
+      MS_LOG(EXCEPTION) << "Cannot divided by 0!";
+    }
+  }
+  simd::BroadcastBinary(input1, input_shape0_, input2, input_shape1_, type, output);
+}
+
 template <typename T>
 void ArithmeticCPUKernel::LaunchKernel(const std::vector<AddressPtr> &inputs, const std::vector<AddressPtr> &outputs) {
   T *input1 = reinterpret_cast<T *>(inputs[0]->addr);
@@ -111,27 +130,18 @@ void ArithmeticCPUKernel::LaunchKernel(const std::vector<AddressPtr> &inputs, co
   auto lens = inputs[0]->size / sizeof(T);
   MS_LOG(INFO) << "lens=" << lens;
 
-  const size_t thread_num = 24;
-  std::vector<std::thread> threads;
-  threads.reserve(thread_num);
-  size_t start = 0;
-  size_t once_compute_size = (lens + thread_num - 1) / thread_num;
-  while (start < lens) {
-    size_t end = (start + once_compute_size) > lens ? lens : (start + once_compute_size);
+  auto task = [this, input1, input2, output](size_t start, size_t end) {
     if (operate_type_ == ADD) {
-      threads.emplace_back(std::thread(Add<T>, input1, input2, output, start, end, is_number_));
+      Add<T>(input1, input2, output, start, end, is_number_);
     } else if (operate_type_ == SUB) {
-      threads.emplace_back(std::thread(Sub<T>, input1, input2, output, start, end, is_number_));
+      Sub<T>(input1, input2, output, start, end, is_number_);
     } else if (operate_type_ == MUL) {
-      threads.emplace_back(std::thread(Mul<T>, input1, input2, output, start, end, is_number_));
+      Mul<T>(input1, input2, output, start, end, is_number_);
     } else if (operate_type_ == DIV) {
-      threads.emplace_back(std::thread(Div<T>, input1, input2, output, start, end, is_number_));
+      Div<T>(input1, input2, output, start, end, is_number_);
     }
-    start += once_compute_size;
-  }
-  for (size_t i = 0; i < threads.size(); ++i) {
-    threads[i].join();
-  }
+  };
+  CPUThreadPool::GetInstance().ParallelFor(lens, kArithmeticGrainSize, task);
 }
 }  // namespace kernel
 }  // namespace mindspore
@@ -36,7 +36,10 @@ class ArithmeticCPUKernel : public CPUKernel {
   void LaunchKernel(const std::vector<AddressPtr> &inputs, const std::vector<AddressPtr> &outputs);
 
  private:
+  void LaunchFloatKernel(const std::vector<AddressPtr> &inputs, const std::vector<AddressPtr> &outputs);
   bool is_number_{false};
+  std::vector<size_t> input_shape0_;
+  std::vector<size_t> input_shape1_;
   OperateType operate_type_{ADD};
   TypeId dtype_{kTypeUnknown};
 };
@@ -15,13 +15,16 @@
  */
 #include "backend/kernel_compiler/cpu/arithmetic_self_cpu_kernel.h"
 #include <cmath>
-#include <thread>
 #include <string>
+#include "backend/kernel_compiler/cpu/cpu_thread_pool.h"
 #include "runtime/device/cpu/cpu_device_address.h"
 
 namespace mindspore {
 namespace kernel {
 namespace {
+// elements computed by one task at least, smaller tensors are computed by the launching thread only
+constexpr size_t kArithmeticSelfGrainSize = 16384;
+
 template <typename T>
 void Square(const T *in, T *out, size_t start, size_t end) {
   for (size_t i = start; i < end; i++) {
@@ -69,23 +72,14 @@ void ArithmeticSelfCPUKernel::LaunchKernel(const std::vector<AddressPtr> &inputs
   auto lens = inputs[0]->size / sizeof(T);
   MS_LOG(INFO) << "lens=" << lens;
 
-  const size_t thread_num = 24;
-  std::vector<std::thread> threads;
-  threads.reserve(thread_num);
-  size_t start = 0;
-  size_t once_compute_size = (lens + thread_num - 1) / thread_num;
-  while (start < lens) {
-    size_t end = (start + once_compute_size) > lens ? lens : (start + once_compute_size);
+  auto task = [this, input, output](size_t start, size_t end) {
     if (operate_type_ == SQUARE) {
-      threads.emplace_back(std::thread(Square<T>, input, output, start, end));
+      Square<T>(input, output, start, end);
     } else if (operate_type_ == SQRT) {
-      threads.emplace_back(std::thread(Sqrt<T>, input, output, start, end));
+      Sqrt<T>(input, output, start, end);
     }
-    start += once_compute_size;
-  }
-  for (size_t i = 0; i < threads.size(); ++i) {
-    threads[i].join();
-  }
+  };
+  CPUThreadPool::GetInstance().ParallelFor(lens, kArithmeticSelfGrainSize, task);
 }
 }  // namespace kernel
 }  // namespace mindspore
@@ -0,0 +1,285 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_BACKEND_KERNEL_COMPILER_CPU_BUCKET_UNIQUE_H_
+#define MINDSPORE_CCSRC_BACKEND_KERNEL_COMPILER_CPU_BUCKET_UNIQUE_H_
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+#include "backend/kernel_compiler/cpu/cpu_thread_pool.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace kernel {
+template <typename T, typename IndexType>
+struct BucketUniqueParam {
+  const T *input_{nullptr};
+  size_t input_size_{0};
+  // Keys out of [0, max_key_) are dropped and get -1 as inverse index, 0 keeps all keys.
+  size_t max_key_{0};
+  // The unique keys in the order of their first occurrence, at most input_size_ keys.
+  T *output_{nullptr};
+  // The index in output_ of each input key.
+  IndexType *inverse_{nullptr};
+  // Set by BucketUnique::Run.
+  size_t output_size_{0};
+  // At least BucketUniqueWorkspaceSize(input_size_) bytes, the hash tables are allocated on the heap otherwise.
+  void *workspace_{nullptr};
+  size_t workspace_size_{0};
+};
+
+// Bucket positions, first occurrences and hash tables of twice the bucket size.
+constexpr size_t kBucketUniqueWorkspaceFactor = 4;
+inline size_t BucketUniqueWorkspaceSize(size_t input_size) {
+  return kBucketUniqueWorkspaceFactor * input_size * sizeof(size_t);
+}
+
+// Parallel unique in the bucket style of SparseOptimizerCPUKernel::BucketReduceSparseGradient. The input is split
+// into one segment per thread, each segment scatters its positions into buckets by the hash of the key, then each
+// bucket is deduplicated by a linear probing hash table living in the workspace. Equal keys always fall into the same
+// bucket, so the buckets are independent and ForEachBucket can accumulate per unique key without any lock.
+template <typename T, typename IndexType>
+class BucketUnique {
+ public:
+  explicit BucketUnique(BucketUniqueParam<T, IndexType> *param) : param_(param) {
+    MS_EXCEPTION_IF_NULL(param_);
+    size_t size = param_->input_size_;
+    size_t *buffer = reinterpret_cast<size_t *>(param_->workspace_);
+    size_t workspace_size = BucketUniqueWorkspaceSize(size);
+    if (buffer == nullptr || param_->workspace_size_ < workspace_size) {
+      MS_LOG(DEBUG) << "Workspace size " << param_->workspace_size_ << " is less than " << workspace_size
+                    << ", allocate it on the heap.";
+      heap_buffer_.resize(kBucketUniqueWorkspaceFactor * size);
+      buffer = heap_buffer_.data();
+    }
+    positions_ = buffer;
+    firsts_ = positions_ + size;
+    tables_ = firsts_ + size;
+    size_t bucket_num = std::min(CPUThreadPool::GetInstance().thread_num(), size / kMinBucketSize);
+    bucket_num_ = std::max(bucket_num, static_cast<size_t>(1));
+  }
+  ~BucketUnique() = default;
+
+  void Run() {
+    param_->output_size_ = 0;
+    if (param_->input_size_ == 0) {
+      return;
+    }
+    MS_EXCEPTION_IF_NULL(param_->input_);
+    MS_EXCEPTION_IF_NULL(param_->output_);
+    MS_EXCEPTION_IF_NULL(param_->inverse_);
+    ScatterToBuckets();
+    CPUThreadPool::GetInstance().ParallelLaunch(bucket_num_, [this](size_t start, size_t end) {
+      for (size_t i = start; i < end; ++i) {
+        UniqueBucket(i);
+      }
+    });
+    RankFirstOccurrences();
+    CPUThreadPool::GetInstance().ParallelLaunch(bucket_num_, [this](size_t start, size_t end) {
+      for (size_t i = start; i < end; ++i) {
+        WriteBucketOutput(i);
+      }
+    });
+  }
+
+  // Call func(positions, size) for the input positions of each bucket in parallel, must be called after Run.
+  template <typename Func>
+  void ForEachBucket(const Func &func) const {
+    if (bucket_offsets_.empty()) {
+      return;
+    }
+    CPUThreadPool::GetInstance().ParallelLaunch(bucket_num_, [this, &func](size_t start, size_t end) {
+      for (size_t i = start; i < end; ++i) {
+        func(positions_ + bucket_offsets_[i], bucket_offsets_[i + 1] - bucket_offsets_[i]);
+      }
+    });
+  }
+
+ private:
+  static constexpr size_t kMinBucketSize = 4096;
+  static constexpr size_t kEmptySlot = std::numeric_limits<size_t>::max();
+
+  static uint64_t Hash(T key) {
+    uint64_t bits = 0;
+    if constexpr (std::is_floating_point<T>::value) {
+      // -0.0 equals 0.0, so both must hash to the same bucket.
+      if (key == 0) {
+        key = 0;
+      }
+      (void)std::memcpy(&bits, &key, sizeof(T));
+    } else {
+      bits = static_cast<uint64_t>(key);
+    }
+    // The finalizer of MurmurHash3, the raw ids are often strided which is bad for the ranges below.
+    bits ^= bits >> 33;
+    bits *= 0xff51afd7ed558ccdULL;
+    bits ^= bits >> 33;
+    bits *= 0xc4ceb9fe1a85ec53ULL;
+    bits ^= bits >> 33;
+    return bits;
+  }
+
+  // Map 32 bits of the hash to [0, range) by multiplication, the buckets use the high bits and the tables the low.
+  static size_t HighRange(uint64_t hash, size_t range) { return static_cast<size_t>(((hash >> 32) * range) >> 32); }
+  static size_t LowRange(uint64_t hash, size_t range) {
+    return static_cast<size_t>(((hash & 0xffffffffULL) * range) >> 32);
+  }
+
+  bool IsValid(T key) const {
+    if constexpr (std::is_integral<T>::value) {
+      return param_->max_key_ == 0 || (key >= 0 && static_cast<size_t>(key) < param_->max_key_);
+    } else {
+      return true;
+    }
+  }
+
+  size_t SegmentBegin(size_t segment) const { return param_->input_size_ * segment / bucket_num_; }
+
+  void ScatterToBuckets() {
+    // Each segment counts its keys of each bucket, then writes its positions behind those of the previous segments,
+    // so the positions of a bucket stay in ascending order.
+    std::vector<std::vector<size_t>> segment_bucket_sizes(bucket_num_, std::vector<size_t>(bucket_num_, 0));
+    auto input = param_->input_;
+    CPUThreadPool::GetInstance().ParallelLaunch(bucket_num_, [&](size_t start, size_t end) {
+      for (size_t segment = start; segment < end; ++segment) {
+        auto &bucket_sizes = segment_bucket_sizes[segment];
+        for (size_t i = SegmentBegin(segment); i < SegmentBegin(segment + 1); ++i) {
+          if (IsValid(input[i])) {
+            bucket_sizes[HighRange(Hash(input[i]), bucket_num_)]++;
+          }
+        }
+      }
+    });
+    bucket_offsets_.assign(bucket_num_ + 1, 0);
+    for (size_t bucket = 0; bucket < bucket_num_; ++bucket) {
+      size_t offset = bucket_offsets_[bucket];
+      for (size_t segment = 0; segment < bucket_num_; ++segment) {
+        size_t bucket_size = segment_bucket_sizes[segment][bucket];
+        segment_bucket_sizes[segment][bucket] = offset;
+        offset += bucket_size;
+      }
+      bucket_offsets_[bucket + 1] = offset;
+    }
+    CPUThreadPool::GetInstance().ParallelLaunch(bucket_num_, [&](size_t start, size_t end) {
+      for (size_t segment = start; segment < end; ++segment) {
+        auto &bucket_offsets = segment_bucket_sizes[segment];
+        for (size_t i = SegmentBegin(segment); i < SegmentBegin(segment + 1); ++i) {
+          if (IsValid(input[i])) {
+            positions_[bucket_offsets[HighRange(Hash(input[i]), bucket_num_)]++] = i;
+          } else {
+            param_->inverse_[i] = static_cast<IndexType>(-1);
+          }
+        }
+      }
+    });
+    unique_sizes_.assign(bucket_num_, 0);
+  }
+
+  void UniqueBucket(size_t bucket) {
+    // The table of a bucket starts at twice its offset, so a load factor of 1/2 needs no extra bookkeeping.
+    size_t offset = bucket_offsets_[bucket];
+    size_t size = bucket_offsets_[bucket + 1] - offset;
+    size_t capacity = 2 * size;
+    size_t *table = tables_ + 2 * offset;
+    size_t *firsts = firsts_ + offset;
+    std::fill(table, table + capacity, kEmptySlot);
+    auto input = param_->input_;
+    size_t unique_size = 0;
+    for (size_t i = offset; i < offset + size; ++i) {
+      size_t position = positions_[i];
+      T key = input[position];
+      size_t slot = LowRange(Hash(key), capacity);
+      while (table[slot] != kEmptySlot && !(input[firsts[table[slot]]] == key)) {
+        slot = slot + 1 == capacity ? 0 : slot + 1;
+      }
+      if (table[slot] == kEmptySlot) {
+        table[slot] = unique_size;
+        firsts[unique_size++] = position;
+      }
+      param_->inverse_[position] = static_cast<IndexType>(table[slot]);
+    }
+    unique_sizes_[bucket] = unique_size;
+  }
+
+  void RankFirstOccurrences() {
+    // Number the first occurrences in input order, the hash tables are free again and hold a rank per position.
+    size_t *ranks = tables_;
+    size_t size = param_->input_size_;
+    std::fill(ranks, ranks + size, 0);
+    CPUThreadPool::GetInstance().ParallelLaunch(bucket_num_, [&](size_t start, size_t end) {
+      for (size_t bucket = start; bucket < end; ++bucket) {
+        size_t *firsts = firsts_ + bucket_offsets_[bucket];
+        for (size_t i = 0; i < unique_sizes_[bucket]; ++i) {
+          ranks[firsts[i]] = 1;
+        }
+      }
+    });
+    std::vector<size_t> segment_ranks(bucket_num_ + 1, 0);
+    CPUThreadPool::GetInstance().ParallelLaunch(bucket_num_, [&](size_t start, size_t end) {
+      for (size_t segment = start; segment < end; ++segment) {
+        size_t count = 0;
+        for (size_t i = SegmentBegin(segment); i < SegmentBegin(segment + 1); ++i) {
+          count += ranks[i];
+        }
+        segment_ranks[segment + 1] = count;
+      }
+    });
+    for (size_t segment = 0; segment < bucket_num_; ++segment) {
+      segment_ranks[segment + 1] += segment_ranks[segment];
+    }
+    CPUThreadPool::GetInstance().ParallelLaunch(bucket_num_, [&](size_t start, size_t end) {
+      for (size_t segment = start; segment < end; ++segment) {
+        size_t rank = segment_ranks[segment];
+        for (size_t i = SegmentBegin(segment); i < SegmentBegin(segment + 1); ++i) {
+          if (ranks[i] != 0) {
+            ranks[i] = rank++;
+          }
+        }
+      }
+    });
+    param_->output_size_ = segment_ranks[bucket_num_];
+  }
+
+  void WriteBucketOutput(size_t bucket) {
+    size_t *ranks = tables_;
+    size_t offset = bucket_offsets_[bucket];
+    size_t *firsts = firsts_ + offset;
+    for (size_t i = 0; i < unique_sizes_[bucket]; ++i) {
+      size_t rank = ranks[firsts[i]];
+      param_->output_[rank] = param_->input_[firsts[i]];
+      firsts[i] = rank;
+    }
+    for (size_t i = offset; i < bucket_offsets_[bucket + 1]; ++i) {
+      auto &index = param_->inverse_[positions_[i]];
+      index = static_cast<IndexType>(firsts[static_cast<size_t>(index)]);
+    }
+  }
+
+  BucketUniqueParam<T, IndexType> *param_;
+  size_t bucket_num_{1};
+  size_t *positions_{nullptr};
+  size_t *firsts_{nullptr};
+  size_t *tables_{nullptr};
+  std::vector<size_t> bucket_offsets_;
+  std::vector<size_t> unique_sizes_;
+  std::vector<size_t> heap_buffer_;
+};
+}  // namespace kernel
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_BACKEND_KERNEL_COMPILER_CPU_BUCKET_UNIQUE_H_
@@ -0,0 +1,244 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "backend/kernel_compiler/cpu/cpu_thread_pool.h"
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <utility>
+#include "utils/log_adapter.h"
+#include "utils/ms_context.h"
+
+namespace mindspore {
+namespace kernel {
+namespace {
+// the calling thread of ParallelFor thread id, it never owns a queue of the pool
+constexpr size_t kCallerThreadId = SIZE_MAX;
+thread_local size_t g_worker_id = kCallerThreadId;
+
+struct ParallelForSync {
+  std::atomic<size_t> left_task_num{0};
+  std::mutex mutex;
+  std::condition_variable cond_var;
+  std::exception_ptr exception{nullptr};
+};
+
+void RunParallelTask(const ParallelTask &task, size_t start, size_t end, ParallelForSync *sync) {
+  try {
+    task(start, end);
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(sync->mutex);
+    if (sync->exception == nullptr) {
+      sync->exception = std::current_exception();
+    }
+  }
+}
+}  // namespace
+
+CPUThreadPool &CPUThreadPool::GetInstance() {
+  static CPUThreadPool instance;
+  return instance;
+}
+
+CPUThreadPool::CPUThreadPool() {
+  size_t thread_num = std::thread::hardware_concurrency();
+  bool enable_affinity = false;
+  auto context_ptr = MsContext::GetInstance();
+  if (context_ptr != nullptr) {
+    auto context_thread_num = context_ptr->get_param<uint32_t>(MS_CTX_CPU_THREAD_NUM);
+    if (context_thread_num > 0) {
+      thread_num = context_thread_num;
+    }
+    enable_affinity = context_ptr->get_param<bool>(MS_CTX_ENABLE_CPU_AFFINITY);
+  }
+  thread_num = std::max(thread_num, static_cast<size_t>(1));
+  MS_LOG(INFO) << "Cpu kernel thread pool thread num: " << thread_num << ", bind core: " << enable_affinity;
+  if (enable_affinity) {
+    BindCore(0);
+  }
+  for (size_t i = 0; i + 1 < thread_num; ++i) {
+    queues_.emplace_back(std::make_unique<WorkQueue>());
+  }
+  workers_.reserve(queues_.size());
+  for (size_t i = 0; i < queues_.size(); ++i) {
+    workers_.emplace_back([this, i, enable_affinity]() {
+      g_worker_id = i;
+      if (enable_affinity) {
+        BindCore(i + 1);
+      }
+      WorkerLoop(i);
+    });
+  }
+}
+
+CPUThreadPool::~CPUThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    exit_ = true;
+  }
+  cond_var_.notify_all();
+  for (auto &worker : workers_) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+}
+
+void CPUThreadPool::BindCore(size_t core_id) {
+#if defined(__linux__)
+  size_t core_num = std::thread::hardware_concurrency();
+  if (core_num == 0) {
+    return;
+  }
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  CPU_SET(core_id % core_num, &cpu_set);
+  if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpu_set) != 0) {
+    MS_LOG(WARNING) << "Bind thread to core " << core_id << " failed.";
+  }
+#endif
+}
+
+void CPUThreadPool::Push(size_t worker_id, Closure &&closure) {
+  auto &queue = queues_[worker_id];
+  {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    queue->tasks.emplace_back(std::move(closure));
+  }
+  pending_task_num_++;
+}
+
+bool CPUThreadPool::RunOneTask(size_t worker_id) {
+  size_t queue_num = queues_.size();
+  if (queue_num == 0) {
+    return false;
+  }
+  size_t first = worker_id == kCallerThreadId ? 0 : worker_id;
+  for (size_t i = 0; i < queue_num; ++i) {
+    size_t victim = (first + i) % queue_num;
+    auto &queue = queues_[victim];
+    Closure closure;
+    {
+      std::lock_guard<std::mutex> lock(queue->mutex);
+      if (queue->tasks.empty()) {
+        continue;
+      }
+      // the owner takes the oldest task, thieves take from the other end to limit contention
+      if (victim == worker_id) {
+        closure = std::move(queue->tasks.front());
+        queue->tasks.pop_front();
+      } else {
+        closure = std::move(queue->tasks.back());
+        queue->tasks.pop_back();
+      }
+      pending_task_num_--;
+    }
+    closure();
+    return true;
+  }
+  return false;
+}
+
+void CPUThreadPool::WorkerLoop(size_t worker_id) {
+  while (true) {
+    if (RunOneTask(worker_id)) {
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    cond_var_.wait(lock, [this]() { return exit_ || pending_task_num_ > 0; });
+    if (exit_) {
+      return;
+    }
+  }
+}
+
+void CPUThreadPool::Schedule(std::function<void()> &&closure) {
+  if (queues_.empty()) {
+    closure();
+    return;
+  }
+  Push(next_queue_++ % queues_.size(), std::move(closure));
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+  }
+  cond_var_.notify_one();
+}
+
+void CPUThreadPool::RunUntil(const std::function<bool()> &done) {
+  while (!done()) {
+    if (RunOneTask(g_worker_id)) {
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    (void)cond_var_.wait_for(lock, std::chrono::microseconds(100), [this]() { return pending_task_num_ > 0; });
+  }
+}
+
+void CPUThreadPool::ParallelFor(size_t total, size_t grain_size, const ParallelTask &task, size_t max_task_num) {
+  if (total == 0) {
+    return;
+  }
+  grain_size = std::max(grain_size, static_cast<size_t>(1));
+  size_t task_num = std::min((total + grain_size - 1) / grain_size, thread_num());
+  if (max_task_num > 0) {
+    task_num = std::min(task_num, max_task_num);
+  }
+  if (task_num <= 1) {
+    task(0, total);
+    return;
+  }
+
+  auto sync = std::make_shared<ParallelForSync>();
+  sync->left_task_num = task_num - 1;
+  size_t once_compute_size = total / task_num;
+  size_t left_size = total % task_num;
+  size_t caller_end = once_compute_size + (left_size > 0 ? 1 : 0);
+  size_t start = caller_end;
+  for (size_t i = 1; i < task_num; ++i) {
+    size_t end = start + once_compute_size + (i < left_size ? 1 : 0);
+    Push(next_queue_++ % queues_.size(), [&task, sync, start, end]() {
+      RunParallelTask(task, start, end, sync.get());
+      if (--sync->left_task_num == 0) {
+        std::lock_guard<std::mutex> lock(sync->mutex);
+        sync->cond_var.notify_all();
+      }
+    });
+    start = end;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+  }
+  cond_var_.notify_all();
+
+  RunParallelTask(task, 0, caller_end, sync.get());
+  // help the pool until all the chunks of this loop are done, so nested loops can not dead lock
+  while (sync->left_task_num > 0) {
+    if (RunOneTask(g_worker_id)) {
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(sync->mutex);
+    (void)sync->cond_var.wait_for(lock, std::chrono::microseconds(100),
+                                  [&sync]() { return sync->left_task_num == 0; });
+  }
+  if (sync->exception != nullptr) {
+    std::rethrow_exception(sync->exception);
+  }
+}
+}  // namespace kernel
+}  // namespace mindspore
@@ -0,0 +1,81 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_BACKEND_KERNEL_COMPILER_CPU_CPU_THREAD_POOL_H_
+#define MINDSPORE_CCSRC_BACKEND_KERNEL_COMPILER_CPU_CPU_THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mindspore {
+namespace kernel {
+// Compute [start, end) of a parallel for loop.
+using ParallelTask = std::function<void(size_t start, size_t end)>;
+
+// Process wide intra-op thread pool shared by all cpu kernels. The workers are created once with the
+// thread number and affinity of the context, each worker owns a task queue and steals from the others
+// when its own queue is empty. The context is read only by the first GetInstance, later changes of
+// cpu_thread_num or enable_cpu_affinity have no effect on the pool.
+class CPUThreadPool {
+ public:
+  static CPUThreadPool &GetInstance();
+  ~CPUThreadPool();
+  CPUThreadPool(const CPUThreadPool &) = delete;
+  CPUThreadPool &operator=(const CPUThreadPool &) = delete;
+
+  // Split [0, total) into at most max_task_num chunks of at least grain_size and run them on the pool.
+  // The calling thread runs tasks too, so small loops are computed inline without any hand-off.
+  void ParallelFor(size_t total, size_t grain_size, const ParallelTask &task, size_t max_task_num = 0);
+  // Run task(i, i + 1) for each i in [0, task_num).
+  void ParallelLaunch(size_t task_num, const ParallelTask &task) { ParallelFor(task_num, 1, task, task_num); }
+  // Queue closure on the pool and return at once. A closure may schedule more closures, it runs inline when the
+  // pool has no worker.
+  void Schedule(std::function<void()> &&closure);
+  // Run the queued tasks on the calling thread too until done() returns true.
+  void RunUntil(const std::function<bool()> &done);
+  // The number of threads computing a parallel for, including the calling thread.
+  size_t thread_num() const { return workers_.size() + 1; }
+
+ private:
+  using Closure = std::function<void()>;
+  struct WorkQueue {
+    std::mutex mutex;
+    std::deque<Closure> tasks;
+  };
+
+  CPUThreadPool();
+  void WorkerLoop(size_t worker_id);
+  void Push(size_t worker_id, Closure &&closure);
+  bool RunOneTask(size_t worker_id);
+  void BindCore(size_t core_id);
+
+  std::vector<std::thread> workers_;
+  std::vector<std::unique_ptr<WorkQueue>> queues_;
+  std::mutex mutex_;
+  std::condition_variable cond_var_;
+  std::atomic<size_t> pending_task_num_{0};
+  std::atomic<size_t> next_queue_{0};
+  bool exit_{false};
+};
+}  // namespace kernel
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_BACKEND_KERNEL_COMPILER_CPU_CPU_THREAD_POOL_H_
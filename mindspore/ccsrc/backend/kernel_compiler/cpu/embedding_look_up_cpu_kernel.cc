@@ -13,15 +13,18 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
-#include <thread>
 #include <string>
 #include "backend/kernel_compiler/cpu/embedding_look_up_cpu_kernel.h"
+#include "backend/kernel_compiler/cpu/cpu_thread_pool.h"
 #include "runtime/device/cpu/cpu_device_address.h"
 #include "ir/primitive.h"
 
 namespace mindspore {
 namespace kernel {
 namespace {
+// bytes copied by one task at least
+constexpr size_t kLookUpGrainBytes = 64 * 1024;
+
 template <typename T>
 void LookUpTableTask(const float *input_addr, const T *indices_addr, float *output_addr, size_t indices_lens,
                      size_t outer_dim_size, T offset, size_t first_dim_size) {
@@ -72,28 +75,14 @@ void EmbeddingLookUpCPUKernel::LaunchKernel(const std::vector<kernel::AddressPtr
   auto input_addr = reinterpret_cast<float *>(inputs[0]->addr);
   auto indices_addr = reinterpret_cast<T *>(inputs[1]->addr);
   auto output_addr = reinterpret_cast<float *>(outputs[0]->addr);
-  const size_t thread_num = 16;
-  std::thread threads[16];
-  size_t task_proc_lens = (indices_lens_ + thread_num - 1) / thread_num;
-  size_t i;
-  size_t task_offset = 0;
-  MS_LOG(DEBUG) << "indices_lens_: " << indices_lens_ << " one task proc lens:" << task_proc_lens;
-  for (i = 0; i < thread_num; i++) {
-    if (task_offset >= indices_lens_) {
-      break;
-    }
-    MS_LOG(DEBUG) << "task_offset: " << task_offset << " task_proc_lenss:" << task_proc_lens;
-    threads[i] = std::thread(LookUpTableTask<T>, input_addr, indices_addr + task_offset,
-                             output_addr + task_offset * outer_dim_size_, task_proc_lens, outer_dim_size_, offset_,
-                             first_dim_size_);
-    task_offset += task_proc_lens;
-    if (task_offset + task_proc_lens > indices_lens_) {
-      task_proc_lens = indices_lens_ - task_offset;
-    }
-  }
-  for (size_t j = 0; j < i; j++) {
-    threads[j].join();
-  }
+  size_t row_bytes = outer_dim_size_ * sizeof(float);
+  size_t grain_size = row_bytes == 0 ? indices_lens_ : (kLookUpGrainBytes + row_bytes - 1) / row_bytes;
+  MS_LOG(DEBUG) << "indices_lens_: " << indices_lens_ << " grain size:" << grain_size;
+  auto task = [this, input_addr, indices_addr, output_addr](size_t start, size_t end) {
+    LookUpTableTask<T>(input_addr, indices_addr + start, output_addr + start * outer_dim_size_, end - start,
+                       outer_dim_size_, offset_, first_dim_size_);
+  };
+  CPUThreadPool::GetInstance().ParallelFor(indices_lens_, grain_size, task);
 }
 
 bool EmbeddingLookUpCPUKernel::Launch(const std::vector<kernel::AddressPtr> &inputs,
@@ -38,9 +38,6 @@ void Conv2dCPUKernel::InitKernel(const CNodePtr &kernel_node) {
     weight_shape.insert(weight_shape.begin(), group);
     weight_shape[1] = weight_shape[1] / group;
   }
-  dnnl::memory::desc src_desc = GetDefaultMemDesc(src_shape);
-  dnnl::memory::desc weights_desc = GetDefaultMemDesc(weight_shape);
-  dnnl::memory::desc dst_desc = GetDefaultMemDesc(dst_shape);
   auto stride_ori = AnfAlgo::GetNodeAttr<std::vector<int>>(kernel_node, STRIDE);
   auto dilation_ori = AnfAlgo::GetNodeAttr<std::vector<int>>(kernel_node, DILATION);
   if (stride_ori.size() != 4 || stride_ori[2] != stride_ori[3]) {
@@ -68,15 +65,33 @@ void Conv2dCPUKernel::InitKernel(const CNodePtr &kernel_node) {
   }
   dnnl::memory::dims padding_l{int_padding_l[0], int_padding_l[1]};
   dnnl::memory::dims padding_r{int_padding_r[0], int_padding_r[1]};
+  // let the primitive pick its preferred layouts, plain tensors are reordered at the mkldnn subgraph boundaries
+  auto prop_kind = IsInference(kernel_node) ? dnnl::prop_kind::forward_inference : dnnl::prop_kind::forward_training;
+  // FusedConv2D carries the bias of a fused BiasAdd as input 2
+  bool has_bias = AnfAlgo::GetInputTensorNum(kernel_node) > 2;
+  dnnl::memory::desc bias_desc = GetDefaultMemDesc({dst_shape[1]});
   dnnl::convolution_forward::desc desc =
-    dnnl::convolution_forward::desc(dnnl::prop_kind::forward_training, dnnl::algorithm::convolution_auto, src_desc,
-                                    weights_desc, dst_desc, strides, dilates, padding_l, padding_r);
+    has_bias ? dnnl::convolution_forward::desc(prop_kind, dnnl::algorithm::convolution_auto, GetAnyMemDesc(src_shape),
+                                               GetAnyMemDesc(weight_shape), bias_desc, GetAnyMemDesc(dst_shape),
+                                               strides, dilates, padding_l, padding_r)
+             : dnnl::convolution_forward::desc(prop_kind, dnnl::algorithm::convolution_auto, GetAnyMemDesc(src_shape),
+                                               GetAnyMemDesc(weight_shape), GetAnyMemDesc(dst_shape), strides,
+                                               dilates, padding_l, padding_r);
 
-  auto prim_desc = dnnl::convolution_forward::primitive_desc(desc, MKLKernelEngine::Get().engine());
-  primitive_ = std::make_shared<dnnl::convolution_forward>(prim_desc);
-  AddArgument(DNNL_ARG_SRC, src_desc);
-  AddArgument(DNNL_ARG_WEIGHTS, weights_desc);
-  AddArgument(DNNL_ARG_DST, dst_desc);
+  auto activation = GetFusedActivation(kernel_node);
+  auto prim_desc =
+    dnnl::convolution_forward::primitive_desc(desc, CreateActivationAttr(activation), MKLKernelEngine::Get().engine());
+  auto key = GetPrimitiveKey(kernel_node, {prim_desc.src_desc(), prim_desc.weights_desc(), prim_desc.dst_desc()},
+                             {static_cast<int>(prop_kind), static_cast<int>(has_bias), stride, dilation,
+                              int_padding_l[0], int_padding_l[1], int_padding_r[0], int_padding_r[1]});
+  (void)key.append(activation);
+  CreatePrimitive<dnnl::convolution_forward>(key, prim_desc);
+  AddArgument(DNNL_ARG_SRC, prim_desc.src_desc(), GetInputMemDesc(kernel_node, 0), true);
+  AddArgument(DNNL_ARG_WEIGHTS, prim_desc.weights_desc(), GetDefaultMemDesc(weight_shape), true);
+  if (has_bias) {
+    AddArgument(DNNL_ARG_BIAS, bias_desc);
+  }
+  AddArgument(DNNL_ARG_DST, prim_desc.dst_desc(), GetUserOutputMemDesc(kernel_node, 0, prim_desc.dst_desc()), false);
 }
 
 bool Conv2dCPUKernel::Launch(const std::vector<kernel::AddressPtr> &inputs,
@@ -87,6 +102,9 @@ bool Conv2dCPUKernel::Launch(const std::vector<kernel::AddressPtr> &inputs,
   }
   SetArgumentHandle(DNNL_ARG_SRC, inputs[0]->addr);
   SetArgumentHandle(DNNL_ARG_WEIGHTS, inputs[1]->addr);
+  if (inputs.size() > 2) {
+    SetArgumentHandle(DNNL_ARG_BIAS, inputs[2]->addr);
+  }
   SetArgumentHandle(DNNL_ARG_DST, outputs[0]->addr);
   ExecutePrimitive();
   return true;
@@ -37,6 +37,17 @@ MS_REG_CPU_KERNEL(
   Conv2D,
   KernelAttr().AddInputAttr(kNumberTypeFloat32).AddInputAttr(kNumberTypeFloat32).AddOutputAttr(kNumberTypeFloat32),
   Conv2dCPUKernel);
+MS_REG_CPU_KERNEL(
+  FusedConv2D,
+  KernelAttr().AddInputAttr(kNumberTypeFloat32).AddInputAttr(kNumberTypeFloat32).AddOutputAttr(kNumberTypeFloat32),
+  Conv2dCPUKernel);
+MS_REG_CPU_KERNEL(FusedConv2D,
+                  KernelAttr()
+                    .AddInputAttr(kNumberTypeFloat32)
+                    .AddInputAttr(kNumberTypeFloat32)
+                    .AddInputAttr(kNumberTypeFloat32)
+                    .AddOutputAttr(kNumberTypeFloat32),
+                  Conv2dCPUKernel);
 }  // namespace kernel
 }  // namespace mindspore
 
@@ -17,13 +17,14 @@
 #include <string>
 #include "backend/kernel_compiler/cpu/mkldnn/fused_batch_norm_cpu_kernel.h"
 #include "utils/ms_utils.h"
+#include "utils/utils.h"
 #include "backend/kernel_compiler/cpu/mkldnn/mkl_kernel_engine.h"
 #include "runtime/device/cpu/cpu_device_address.h"
 
 namespace mindspore {
 namespace kernel {
 void FusedBatchNormCPUKernel::InitInputOutputSize(const CNodePtr &kernel_node) {
-  CPUKernel::InitInputOutputSize(kernel_node);
+  MKLCPUKernel::InitInputOutputSize(kernel_node);
   MS_EXCEPTION_IF_NULL(kernel_node);
   size_t type_size = sizeof(float);
   std::vector<size_t> shape = AnfAlgo::GetInputDeviceShape(kernel_node, 0);
@@ -35,8 +36,12 @@ void FusedBatchNormCPUKernel::InitKernel(const CNodePtr &kernel_node) {
   MS_EXCEPTION_IF_NULL(kernel_node);
   auto node_name = AnfAlgo::GetCNodeName(kernel_node);
   if (node_name == "FusedBatchNorm") {
-    momentum = AnfAlgo::GetNodeAttr<float>(kernel_node, "momentum");
     is_train = true;
+  } else if (node_name == kFusedBatchNormWithActivationOpName) {
+    is_train = AnfAlgo::GetNodeAttr<bool>(kernel_node, kAttrIsTraining);
+  }
+  if (is_train) {
+    momentum = AnfAlgo::GetNodeAttr<float>(kernel_node, "momentum");
   }
   std::vector<size_t> x_shape = AnfAlgo::GetInputDeviceShape(kernel_node, 0);
   if (x_shape.size() != 4) {
@@ -46,7 +51,7 @@ void FusedBatchNormCPUKernel::InitKernel(const CNodePtr &kernel_node) {
   channel = x_shape[1];
   hw_size = x_shape[2] * x_shape[3];
   nhw_size = x_shape[0] * hw_size;
-  dnnl::memory::desc x_desc = GetDefaultMemDesc(x_shape);
+  dnnl::memory::desc x_desc = GetInputMemDesc(kernel_node, 0);
   dnnl::memory::desc scale_bias_desc = GetDefaultMemDesc({2, channel});
   auto epsilon = AnfAlgo::GetNodeAttr<float>(kernel_node, "epsilon");
   auto prop_kind = dnnl::prop_kind::forward_inference;
@@ -55,16 +60,22 @@ void FusedBatchNormCPUKernel::InitKernel(const CNodePtr &kernel_node) {
     prop_kind = dnnl::prop_kind::forward_training;
     normalization_flags = dnnl::normalization_flags::use_scale_shift;
   }
+  auto activation = GetFusedActivation(kernel_node);
+  if (!activation.empty()) {
+    normalization_flags = normalization_flags | dnnl::normalization_flags::fuse_norm_relu;
+  }
   dnnl::batch_normalization_forward::desc desc =
     dnnl::batch_normalization_forward::desc(prop_kind, x_desc, epsilon, normalization_flags);
   auto prim_desc = dnnl::batch_normalization_forward::primitive_desc(desc, MKLKernelEngine::Get().engine());
-  primitive_ = std::make_shared<dnnl::batch_normalization_forward>(prim_desc);
+  auto key = GetPrimitiveKey(kernel_node, {x_desc}, {static_cast<int>(prop_kind), static_cast<int>(is_train)});
+  (void)key.append(std::to_string(epsilon)).append(activation);
+  CreatePrimitive<dnnl::batch_normalization_forward>(key, prim_desc);
   AddArgument(DNNL_ARG_SRC, x_desc);
   AddArgument(DNNL_ARG_MEAN, prim_desc.mean_desc());
   AddArgument(DNNL_ARG_VARIANCE, prim_desc.variance_desc());
   AddArgument(DNNL_ARG_SCALE_SHIFT, scale_bias_desc);
-  AddArgument(DNNL_ARG_WORKSPACE, prim_desc.workspace_desc());
-  AddArgument(DNNL_ARG_DST, x_desc);
+  AddArgument(DNNL_ARG_WORKSPACE, prim_desc.workspace_desc(), true);
+  AddArgument(DNNL_ARG_DST, x_desc, GetUserOutputMemDesc(kernel_node, 0, x_desc), false);
 }
 
 bool FusedBatchNormCPUKernel::Launch(const std::vector<kernel::AddressPtr> &inputs,
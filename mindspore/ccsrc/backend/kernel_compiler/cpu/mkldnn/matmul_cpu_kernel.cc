@@ -17,6 +17,7 @@
 #include <utility>
 #include "backend/kernel_compiler/cpu/mkldnn/mkl_kernel_engine.h"
 #include "utils/ms_utils.h"
+#include "utils/utils.h"
 #include "runtime/device/cpu/cpu_device_address.h"
 
 namespace mindspore {
@@ -44,6 +45,30 @@ void MatMulCPUKernel::InitKernel(const CNodePtr &kernel_node) {
     trans_b_ = TRANSPOSE_YES;
   }
   dim_n_ = static_cast<dnnl_dim_t>(dst_shape[1]);
+  if (AnfAlgo::GetCNodeName(kernel_node) == kFusedMatMulOpName) {
+    InitFusedKernel(kernel_node);
+  }
+}
+
+void MatMulCPUKernel::InitFusedKernel(const CNodePtr &kernel_node) {
+  // a transposed input is read in place through the strides of its memory desc
+  auto src_tag = trans_a_ == TRANSPOSE_YES ? dnnl::memory::format_tag::ba : dnnl::memory::format_tag::ab;
+  auto weights_tag = trans_b_ == TRANSPOSE_YES ? dnnl::memory::format_tag::ba : dnnl::memory::format_tag::ab;
+  dnnl::memory::desc src_desc = formatted_md({dim_m_, dim_k_}, src_tag);
+  dnnl::memory::desc weights_desc = formatted_md({dim_k_, dim_n_}, weights_tag);
+  dnnl::memory::desc bias_desc = formatted_md({1, dim_n_}, dnnl::memory::format_tag::ab);
+  dnnl::memory::desc dst_desc = formatted_md({dim_m_, dim_n_}, dnnl::memory::format_tag::ab);
+  dnnl::matmul::desc desc = dnnl::matmul::desc(src_desc, weights_desc, bias_desc, dst_desc);
+  auto activation = GetFusedActivation(kernel_node);
+  auto prim_desc =
+    dnnl::matmul::primitive_desc(desc, CreateActivationAttr(activation), MKLKernelEngine::Get().engine());
+  auto key = GetPrimitiveKey(kernel_node, {src_desc, weights_desc, dst_desc}, {});
+  (void)key.append(activation);
+  CreatePrimitive<dnnl::matmul>(key, prim_desc);
+  AddArgument(DNNL_ARG_SRC, src_desc);
+  AddArgument(DNNL_ARG_WEIGHTS, weights_desc);
+  AddArgument(DNNL_ARG_BIAS, bias_desc);
+  AddArgument(DNNL_ARG_DST, dst_desc);
 }
 
 bool MatMulCPUKernel::Launch(const std::vector<kernel::AddressPtr> &inputs,
@@ -52,6 +77,17 @@ bool MatMulCPUKernel::Launch(const std::vector<kernel::AddressPtr> &inputs,
   if (inputs.size() < 2 || outputs.empty()) {
     MS_LOG(EXCEPTION) << "matmul error input output size!";
   }
+  if (primitive_ != nullptr) {
+    if (inputs.size() < 3) {
+      MS_LOG(EXCEPTION) << "fused matmul error input size!";
+    }
+    SetArgumentHandle(DNNL_ARG_SRC, inputs[0]->addr);
+    SetArgumentHandle(DNNL_ARG_WEIGHTS, inputs[1]->addr);
+    SetArgumentHandle(DNNL_ARG_BIAS, inputs[2]->addr);
+    SetArgumentHandle(DNNL_ARG_DST, outputs[0]->addr);
+    ExecutePrimitive();
+    return true;
+  }
   dnnl_dim_t lda = dim_m_;
   if (trans_a_ == TRANSPOSE_NO) {
     lda = dim_k_;
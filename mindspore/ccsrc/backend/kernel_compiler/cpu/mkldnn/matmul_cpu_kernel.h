@@ -33,6 +33,7 @@ class MatMulCPUKernel : public MKLCPUKernel {
               const std::vector<AddressPtr> &outputs) override;
 
  private:
+  void InitFusedKernel(const CNodePtr &kernel_node);
   char trans_a_{TRANSPOSE_NO};
   char trans_b_{TRANSPOSE_NO};
   dnnl_dim_t dim_m_{0};
@@ -44,6 +45,13 @@ MS_REG_CPU_KERNEL(
   MatMul,
   KernelAttr().AddInputAttr(kNumberTypeFloat32).AddInputAttr(kNumberTypeFloat32).AddOutputAttr(kNumberTypeFloat32),
   MatMulCPUKernel);
+MS_REG_CPU_KERNEL(FusedMatMul,
+                  KernelAttr()
+                    .AddInputAttr(kNumberTypeFloat32)
+                    .AddInputAttr(kNumberTypeFloat32)
+                    .AddInputAttr(kNumberTypeFloat32)
+                    .AddOutputAttr(kNumberTypeFloat32),
+                  MatMulCPUKernel);
 }  // namespace kernel
 }  // namespace mindspore
 
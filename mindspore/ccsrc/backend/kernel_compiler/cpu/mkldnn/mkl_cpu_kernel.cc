@@ -17,8 +17,12 @@
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <sstream>
 #include "utils/ms_utils.h"
+#include "utils/utils.h"
+#include "base/core_ops.h"
 #include "backend/kernel_compiler/cpu/mkldnn/mkl_kernel_engine.h"
+#include "backend/kernel_compiler/cpu/mkldnn/mkl_layout_info.h"
 
 namespace mindspore {
 namespace kernel {
@@ -87,18 +91,189 @@ dnnl::memory::desc MKLCPUKernel::GetDefaultMemDesc(const std::vector<size_t> &sh
   return mem_desc;
 }
 
+dnnl::memory::desc MKLCPUKernel::GetAnyMemDesc(const std::vector<size_t> &shape) {
+  dnnl::memory::dims dims;
+  dims.insert(dims.end(), shape.begin(), shape.end());
+  return dnnl::memory::desc(dims, dnnl::memory::data_type::f32, dnnl::memory::format_tag::any);
+}
+
+std::string MKLCPUKernel::GetFusedActivation(const CNodePtr &kernel_node) const {
+  MS_EXCEPTION_IF_NULL(kernel_node);
+  if (!AnfAlgo::HasNodeAttr(kAttrActivationType, kernel_node)) {
+    return "";
+  }
+  return AnfAlgo::GetNodeAttr<std::string>(kernel_node, kAttrActivationType);
+}
+
+dnnl::primitive_attr MKLCPUKernel::CreateActivationAttr(const std::string &activation) const {
+  dnnl::primitive_attr attr;
+  if (activation.empty()) {
+    return attr;
+  }
+  dnnl::post_ops ops;
+  if (activation == prim::kPrimRelu->name()) {
+    ops.append_eltwise(1.0, dnnl::algorithm::eltwise_relu, 0.0, 0.0);
+  } else if (activation == prim::kPrimGelu->name()) {
+    ops.append_eltwise(1.0, dnnl::algorithm::eltwise_gelu, 0.0, 0.0);
+  } else {
+    MS_LOG(EXCEPTION) << "Unsupported fused activation " << activation;
+  }
+  attr.set_post_ops(ops);
+  return attr;
+}
+
+bool MKLCPUKernel::IsBlockedOutput(const AnfNodePtr &node, size_t index) const {
+  MS_EXCEPTION_IF_NULL(node);
+  auto layout_info = node->user_data<MKLLayoutInfo>();
+  return layout_info != nullptr && index < layout_info->blocked_outputs.size() && layout_info->blocked_outputs[index];
+}
+
+bool MKLCPUKernel::IsInference(const CNodePtr &kernel_node) const {
+  MS_EXCEPTION_IF_NULL(kernel_node);
+  auto layout_info = kernel_node->user_data<MKLLayoutInfo>();
+  return layout_info != nullptr && layout_info->inference;
+}
+
+dnnl::memory::desc MKLCPUKernel::GetInputMemDesc(const CNodePtr &kernel_node, size_t index) {
+  auto prev_output = AnfAlgo::GetPrevNodeOutput(kernel_node, index);
+  if (!IsBlockedOutput(prev_output.first, prev_output.second)) {
+    return GetDefaultMemDesc(AnfAlgo::GetInputDeviceShape(kernel_node, index));
+  }
+  auto prev_kernel = dynamic_cast<MKLCPUKernel *>(AnfAlgo::GetKernelMod(prev_output.first));
+  if (prev_kernel == nullptr) {
+    MS_LOG(EXCEPTION) << "The blocked input " << index << " of " << kernel_node->fullname_with_scope()
+                      << " is not produced by a built mkldnn kernel.";
+  }
+  auto desc = prev_kernel->GetOutputMemDesc(prev_output.second);
+  input_mem_descs_[index] = desc;
+  return desc;
+}
+
+dnnl::memory::desc MKLCPUKernel::GetUserOutputMemDesc(const CNodePtr &kernel_node, size_t index,
+                                                      const dnnl::memory::desc &dst_desc) {
+  if (!IsBlockedOutput(kernel_node, index)) {
+    return GetDefaultMemDesc(AnfAlgo::GetOutputDeviceShape(kernel_node, index));
+  }
+  output_mem_descs_[index] = dst_desc;
+  return dst_desc;
+}
+
+dnnl::memory::desc MKLCPUKernel::GetOutputMemDesc(size_t index) const {
+  auto iter = output_mem_descs_.find(index);
+  if (iter == output_mem_descs_.end()) {
+    MS_LOG(EXCEPTION) << "Output " << index << " of the mkldnn kernel is not blocked.";
+  }
+  return iter->second;
+}
+
+void MKLCPUKernel::InitInputOutputSize(const CNodePtr &kernel_node) {
+  CPUKernel::InitInputOutputSize(kernel_node);
+  // blocked layouts pad the channel dim up to the block size
+  for (const auto &input_desc : input_mem_descs_) {
+    if (input_desc.first < input_size_list_.size()) {
+      input_size_list_[input_desc.first] = std::max(input_size_list_[input_desc.first], input_desc.second.get_size());
+    }
+  }
+  for (const auto &output_desc : output_mem_descs_) {
+    if (output_desc.first < output_size_list_.size()) {
+      output_size_list_[output_desc.first] =
+        std::max(output_size_list_[output_desc.first], output_desc.second.get_size());
+    }
+  }
+}
+
+std::string MKLCPUKernel::GetMemDescKey(const dnnl::memory::desc &desc) {
+  std::ostringstream key;
+  const auto &md = desc.data;
+  key << md.data_type << ":" << md.format_kind << ":";
+  for (int i = 0; i < md.ndims; ++i) {
+    key << md.dims[i] << ",";
+  }
+  if (md.format_kind == dnnl_blocked) {
+    const auto &blocking = md.format_desc.blocking;
+    key << ":";
+    for (int i = 0; i < md.ndims; ++i) {
+      key << blocking.strides[i] << ",";
+    }
+    key << ":";
+    for (int i = 0; i < blocking.inner_nblks; ++i) {
+      key << blocking.inner_blks[i] << "x" << blocking.inner_idxs[i] << ",";
+    }
+  }
+  return key.str();
+}
+
+std::string MKLCPUKernel::GetPrimitiveKey(const CNodePtr &kernel_node, const std::vector<dnnl::memory::desc> &descs,
+                                          const std::vector<int> &attrs) const {
+  std::ostringstream key;
+  key << AnfAlgo::GetCNodeName(kernel_node);
+  for (const auto &desc : descs) {
+    key << "|" << GetMemDescKey(desc);
+  }
+  key << "|";
+  for (auto attr : attrs) {
+    key << attr << ",";
+  }
+  return key.str();
+}
+
 void MKLCPUKernel::AddArgument(int arg_key, const dnnl::memory::desc &mem_desc, bool alloc) {
   arguments_[arg_key] = MKLKernelEngine::Get().CreateMemory(mem_desc, alloc);
 }
 
+void MKLCPUKernel::AddArgument(int arg_key, const dnnl::memory::desc &mem_desc, const dnnl::memory::desc &user_desc,
+                               bool is_input) {
+  if (mem_desc == user_desc) {
+    AddArgument(arg_key, mem_desc);
+    return;
+  }
+  auto &engine = MKLKernelEngine::Get();
+  ArgumentReorder reorder;
+  reorder.user_mem = engine.CreateMemory(user_desc);
+  arguments_[arg_key] = engine.CreateMemory(mem_desc, true);
+  const auto &src_desc = is_input ? user_desc : mem_desc;
+  const auto &dst_desc = is_input ? mem_desc : user_desc;
+  auto key = "Reorder|" + GetMemDescKey(src_desc) + "|" + GetMemDescKey(dst_desc);
+  reorder.primitive = engine.GetPrimitive(key, [&engine, &src_desc, &dst_desc]() -> std::shared_ptr<dnnl::primitive> {
+    auto prim_desc = dnnl::reorder::primitive_desc(engine.engine(), src_desc, engine.engine(), dst_desc);
+    return std::make_shared<dnnl::reorder>(prim_desc);
+  });
+  reorder.arguments[DNNL_ARG_FROM] = is_input ? reorder.user_mem : arguments_[arg_key];
+  reorder.arguments[DNNL_ARG_TO] = is_input ? arguments_[arg_key] : reorder.user_mem;
+  if (is_input) {
+    input_reorders_[arg_key] = reorder;
+  } else {
+    output_reorders_[arg_key] = reorder;
+  }
+}
+
 void MKLCPUKernel::SetArgumentHandle(int arg_key, void *ptr) {
+  auto input_iter = input_reorders_.find(arg_key);
+  if (input_iter != input_reorders_.end()) {
+    input_iter->second.user_mem.set_data_handle(ptr);
+    return;
+  }
+  auto output_iter = output_reorders_.find(arg_key);
+  if (output_iter != output_reorders_.end()) {
+    output_iter->second.user_mem.set_data_handle(ptr);
+    return;
+  }
   auto arg_iter = arguments_.find(arg_key);
   if (arg_iter != arguments_.end()) {
     arg_iter->second.set_data_handle(ptr);
   }
 }
 
-void MKLCPUKernel::ExecutePrimitive() { MKLKernelEngine::Get().Execute(primitive_, arguments_); }
+void MKLCPUKernel::ExecutePrimitive() {
+  auto &engine = MKLKernelEngine::Get();
+  for (const auto &reorder : input_reorders_) {
+    engine.Execute(reorder.second.primitive, reorder.second.arguments);
+  }
+  engine.Execute(primitive_, arguments_);
+  for (const auto &reorder : output_reorders_) {
+    engine.Execute(reorder.second.primitive, reorder.second.arguments);
+  }
+}
 
 void MKLCPUKernel::Reorder(dnnl::memory *src_mem, dnnl::memory *dst_mem) {
   MKLKernelEngine::Get().Reorder(src_mem, dst_mem);
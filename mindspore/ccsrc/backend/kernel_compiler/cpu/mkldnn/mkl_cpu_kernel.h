@@ -23,6 +23,7 @@
 #include "dnnl.hpp"
 #include "backend/kernel_compiler/cpu/cpu_kernel.h"
 #include "backend/kernel_compiler/cpu/cpu_kernel_factory.h"
+#include "backend/kernel_compiler/cpu/mkldnn/mkl_kernel_engine.h"
 
 namespace mindspore {
 namespace kernel {
@@ -31,21 +32,59 @@ class MKLCPUKernel : public CPUKernel {
   MKLCPUKernel() = default;
   ~MKLCPUKernel() override = default;
 
+  // layout of the output as written by this kernel, blocked outputs are read by the next mkldnn kernel as is
+  dnnl::memory::desc GetOutputMemDesc(size_t index) const;
+
  protected:
+  void InitInputOutputSize(const CNodePtr &kernel_node) override;
   void GetPadding(const CNodePtr &kernel_node, const std::string &pad_mode, const std::vector<size_t> &src_shape,
                   const std::vector<size_t> &kernel_size, int stride, std::vector<int> *padding_l,
                   std::vector<int> *padding_r);
   void AddArgument(int arg_key, const dnnl::memory::desc &mem_desc, bool alloc = false);
+  // The primitive works on mem_desc while the launch buffer is laid out as user_desc, the data is reordered
+  // through a kernel owned buffer before (input) or after (output) the primitive when the two differ.
+  void AddArgument(int arg_key, const dnnl::memory::desc &mem_desc, const dnnl::memory::desc &user_desc,
+                   bool is_input);
   void SetArgumentHandle(int arg_key, void *ptr);
   dnnl::memory::format_tag GetDefaultFormatTag(const dnnl::memory::dims &dims) const;
   dnnl::memory::desc GetDefaultMemDesc(const std::vector<size_t> &shape);
+  dnnl::memory::desc GetAnyMemDesc(const std::vector<size_t> &shape);
+  // layout of the input as produced by the previous kernel
+  dnnl::memory::desc GetInputMemDesc(const CNodePtr &kernel_node, size_t index);
+  // layout the output is written in, dst_desc is the one chosen by the primitive
+  dnnl::memory::desc GetUserOutputMemDesc(const CNodePtr &kernel_node, size_t index,
+                                          const dnnl::memory::desc &dst_desc);
+  // activation fused into the kernel by the cpu fusion passes, empty if none
+  std::string GetFusedActivation(const CNodePtr &kernel_node) const;
+  dnnl::primitive_attr CreateActivationAttr(const std::string &activation) const;
+  bool IsBlockedOutput(const AnfNodePtr &node, size_t index) const;
+  bool IsInference(const CNodePtr &kernel_node) const;
+  std::string GetPrimitiveKey(const CNodePtr &kernel_node, const std::vector<dnnl::memory::desc> &descs,
+                              const std::vector<int> &attrs) const;
+  template <typename PrimitiveT, typename PrimitiveDescT>
+  void CreatePrimitive(const std::string &key, const PrimitiveDescT &prim_desc) {
+    primitive_ = MKLKernelEngine::Get().GetPrimitive(
+      key, [&prim_desc]() -> std::shared_ptr<dnnl::primitive> { return std::make_shared<PrimitiveT>(prim_desc); });
+  }
   void ExecutePrimitive();
   std::unordered_map<int, dnnl::memory> arguments_;
   std::shared_ptr<dnnl::primitive> primitive_{nullptr};
+  std::unordered_map<size_t, dnnl::memory::desc> input_mem_descs_;
+  std::unordered_map<size_t, dnnl::memory::desc> output_mem_descs_;
   inline dnnl::memory::desc formatted_md(const dnnl::memory::dims &dimensions, dnnl::memory::format_tag layout) {
     return dnnl::memory::desc{{dimensions}, dnnl::memory::data_type::f32, layout};
   }
   void Reorder(dnnl::memory *src_mem, dnnl::memory *dst_mem);
+
+ private:
+  struct ArgumentReorder {
+    dnnl::memory user_mem;
+    std::shared_ptr<dnnl::primitive> primitive{nullptr};
+    std::unordered_map<int, dnnl::memory> arguments;
+  };
+  static std::string GetMemDescKey(const dnnl::memory::desc &desc);
+  std::unordered_map<int, ArgumentReorder> input_reorders_;
+  std::unordered_map<int, ArgumentReorder> output_reorders_;
 };
 }  // namespace kernel
 }  // namespace mindspore
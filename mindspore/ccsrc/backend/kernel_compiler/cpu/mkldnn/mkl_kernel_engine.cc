@@ -36,5 +36,35 @@ dnnl::memory MKLKernelEngine::CreateMemory(const dnnl::memory::desc &mem_desc, b
 void MKLKernelEngine::Reorder(dnnl::memory *src_mem, dnnl::memory *dst_mem) {
   dnnl::reorder(*src_mem, *dst_mem).execute(stream_, *src_mem, *dst_mem);
 }
+
+std::shared_ptr<dnnl::primitive> MKLKernelEngine::GetPrimitive(const std::string &key,
+                                                               const MKLPrimitiveCreator &creator) {
+  std::lock_guard<std::mutex> lock(primitive_cache_mutex_);
+  auto iter = primitive_cache_index_.find(key);
+  if (iter != primitive_cache_index_.end()) {
+    primitive_cache_.splice(primitive_cache_.begin(), primitive_cache_, iter->second);
+    return iter->second->second;
+  }
+  auto primitive = creator();
+  MS_EXCEPTION_IF_NULL(primitive);
+  if (primitive_cache_.size() >= kMKLPrimitiveCacheCapacity) {
+    (void)primitive_cache_index_.erase(primitive_cache_.back().first);
+    primitive_cache_.pop_back();
+  }
+  primitive_cache_.emplace_front(key, primitive);
+  primitive_cache_index_[key] = primitive_cache_.begin();
+  return primitive;
+}
+
+size_t MKLKernelEngine::primitive_cache_size() {
+  std::lock_guard<std::mutex> lock(primitive_cache_mutex_);
+  return primitive_cache_.size();
+}
+
+void MKLKernelEngine::ClearPrimitiveCache() {
+  std::lock_guard<std::mutex> lock(primitive_cache_mutex_);
+  primitive_cache_index_.clear();
+  primitive_cache_.clear();
+}
 }  // namespace kernel
 }  // namespace mindspore
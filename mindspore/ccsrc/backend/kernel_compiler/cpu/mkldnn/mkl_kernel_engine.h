@@ -22,11 +22,18 @@
 #include <unordered_map>
 #include <vector>
 #include <memory>
+#include <list>
+#include <mutex>
+#include <functional>
+#include <utility>
 #include "dnnl.hpp"
 #include "utils/ms_utils.h"
 
 namespace mindspore {
 namespace kernel {
+constexpr size_t kMKLPrimitiveCacheCapacity = 1024;
+using MKLPrimitiveCreator = std::function<std::shared_ptr<dnnl::primitive>()>;
+
 class MKLKernelEngine {
  public:
   static MKLKernelEngine &Get() {
@@ -43,11 +50,21 @@ class MKLKernelEngine {
                const std::unordered_map<int, dnnl::memory> &arguments);
   void Reorder(dnnl::memory *src_mem, dnnl::memory *dst_mem);
 
+  // Primitives are immutable once created, kernels with the same key share one primitive so that recompiled
+  // graphs skip the jit code generation. The least recently used primitive is dropped when the cache is full.
+  std::shared_ptr<dnnl::primitive> GetPrimitive(const std::string &key, const MKLPrimitiveCreator &creator);
+  size_t primitive_cache_size();
+  void ClearPrimitiveCache();
+
  private:
   MKLKernelEngine() : engine_(dnnl::engine::kind::cpu, 0), stream_(engine_) {}
   ~MKLKernelEngine() = default;
   dnnl::engine engine_;
   dnnl::stream stream_;
+  using PrimitiveCacheList = std::list<std::pair<std::string, std::shared_ptr<dnnl::primitive>>>;
+  PrimitiveCacheList primitive_cache_;
+  std::unordered_map<std::string, PrimitiveCacheList::iterator> primitive_cache_index_;
+  std::mutex primitive_cache_mutex_;
 };
 }  // namespace kernel
 }  // namespace mindspore
@@ -0,0 +1,41 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_BACKEND_KERNEL_COMPILER_CPU_MKL_LAYOUT_INFO_H_
+#define MINDSPORE_CCSRC_BACKEND_KERNEL_COMPILER_CPU_MKL_LAYOUT_INFO_H_
+
+#include <set>
+#include <string>
+#include <vector>
+
+namespace mindspore {
+namespace kernel {
+// mkldnn kernels which accept any memory layout on input 0 and may produce a blocked layout on output 0
+const std::set<std::string> kMKLLayoutAwareOps = {"Conv2D",    "FusedConv2D",    "MaxPool",
+                                                  "ReLU",      "ReLU6",          "FusedBatchNorm",
+                                                  "BatchNorm", "FusedBatchNormWithActivation"};
+
+// Attached to mkldnn kernel nodes by the layout propagation pass before the kernels are built.
+struct MKLLayoutInfo {
+  static constexpr char key[] = "mkl_layout_info";
+  // output i keeps the layout chosen by the primitive, it is only read by layout aware mkldnn kernels
+  std::vector<bool> blocked_outputs;
+  // no backward or optimizer kernel in the graph, primitives are created for inference
+  bool inference{false};
+};
+}  // namespace kernel
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_BACKEND_KERNEL_COMPILER_CPU_MKL_LAYOUT_INFO_H_
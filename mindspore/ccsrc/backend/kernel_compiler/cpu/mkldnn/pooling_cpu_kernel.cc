@@ -26,8 +26,7 @@ void PoolingCPUKernel::InitKernel(const CNodePtr &kernel_node) {
   MS_EXCEPTION_IF_NULL(kernel_node);
   std::vector<size_t> src_shape = AnfAlgo::GetInputDeviceShape(kernel_node, 0);
   std::vector<size_t> dst_shape = AnfAlgo::GetOutputDeviceShape(kernel_node, 0);
-  dnnl::memory::desc src_desc = GetDefaultMemDesc(src_shape);
-  dnnl::memory::desc dst_desc = GetDefaultMemDesc(dst_shape);
+  dnnl::memory::desc src_desc = GetInputMemDesc(kernel_node, 0);
   std::vector<int> origin_kernel_sizes = AnfAlgo::GetNodeAttr<std::vector<int>>(kernel_node, KSIZE);
   std::vector<int> strides = AnfAlgo::GetNodeAttr<std::vector<int>>(kernel_node, STRIDES);
   if (origin_kernel_sizes.size() != 4 || strides.size() != 4) {
@@ -45,14 +44,21 @@ void PoolingCPUKernel::InitKernel(const CNodePtr &kernel_node) {
   }
   dnnl::memory::dims padding_l{int_padding_l[0], int_padding_l[1]};
   dnnl::memory::dims padding_r{int_padding_r[0], int_padding_r[1]};
+  auto prop_kind = IsInference(kernel_node) ? dnnl::prop_kind::forward_inference : dnnl::prop_kind::forward_training;
   dnnl::pooling_forward::desc desc =
-    dnnl::pooling_forward::desc(dnnl::prop_kind::forward_training, dnnl::algorithm::pooling_max, src_desc, dst_desc,
+    dnnl::pooling_forward::desc(prop_kind, dnnl::algorithm::pooling_max, src_desc, GetAnyMemDesc(dst_shape),
                                 strides_dims, kernels_dims, padding_l, padding_r);
   auto prim_desc = dnnl::pooling_forward::primitive_desc(desc, MKLKernelEngine::Get().engine());
-  primitive_ = std::make_shared<dnnl::pooling_forward>(prim_desc);
+  auto key = GetPrimitiveKey(kernel_node, {prim_desc.src_desc(), prim_desc.dst_desc()},
+                             {static_cast<int>(prop_kind), strides[2], strides[3], origin_kernel_sizes[2],
+                              origin_kernel_sizes[3], int_padding_l[0], int_padding_l[1], int_padding_r[0],
+                              int_padding_r[1]});
+  CreatePrimitive<dnnl::pooling_forward>(key, prim_desc);
   AddArgument(DNNL_ARG_SRC, src_desc);
-  AddArgument(DNNL_ARG_DST, dst_desc);
-  AddArgument(DNNL_ARG_WORKSPACE, prim_desc.workspace_desc());
+  AddArgument(DNNL_ARG_DST, prim_desc.dst_desc(), GetUserOutputMemDesc(kernel_node, 0, prim_desc.dst_desc()), false);
+  if (prop_kind == dnnl::prop_kind::forward_training) {
+    AddArgument(DNNL_ARG_WORKSPACE, prim_desc.workspace_desc(), true);
+  }
 }
 
 bool PoolingCPUKernel::Launch(const std::vector<kernel::AddressPtr> &inputs,
@@ -27,21 +27,22 @@ void ReluCPUKernel::InitKernel(const CNodePtr &kernel_node) {
   if (src_shape.size() != 4 && src_shape.size() != 2) {
     MS_LOG(EXCEPTION) << "relu kernel dims invalid " << src_shape.size();
   }
-  dnnl::memory::desc src_desc = GetDefaultMemDesc(src_shape);
+  dnnl::memory::desc src_desc = GetInputMemDesc(kernel_node, 0);
 
+  auto prop_kind = IsInference(kernel_node) ? dnnl::prop_kind::forward_inference : dnnl::prop_kind::forward_training;
   dnnl::eltwise_forward::desc desc =
-    dnnl::eltwise_forward::desc(dnnl::prop_kind::forward_training, dnnl::algorithm::eltwise_relu, src_desc, 0.0);
+    dnnl::eltwise_forward::desc(prop_kind, dnnl::algorithm::eltwise_relu, src_desc, 0.0);
   std::string kernel_name = AnfAlgo::GetCNodeName(kernel_node);
   if (kernel_name == "ReLU6") {
-    desc =
-      dnnl::eltwise_forward::desc(dnnl::prop_kind::forward_training, dnnl::algorithm::eltwise_clip, src_desc, 0.0, 6.0);
+    desc = dnnl::eltwise_forward::desc(prop_kind, dnnl::algorithm::eltwise_clip, src_desc, 0.0, 6.0);
   }
 
   auto prim_desc = dnnl::eltwise_forward::primitive_desc(desc, MKLKernelEngine::Get().engine());
-  primitive_ = std::make_shared<dnnl::eltwise_forward>(prim_desc);
+  CreatePrimitive<dnnl::eltwise_forward>(GetPrimitiveKey(kernel_node, {src_desc}, {static_cast<int>(prop_kind)}),
+                                         prim_desc);
 
   AddArgument(DNNL_ARG_SRC, src_desc);
-  AddArgument(DNNL_ARG_DST, src_desc);
+  AddArgument(DNNL_ARG_DST, src_desc, GetUserOutputMemDesc(kernel_node, 0, src_desc), false);
 }
 
 bool ReluCPUKernel::Launch(const std::vector<kernel::AddressPtr> &inputs,
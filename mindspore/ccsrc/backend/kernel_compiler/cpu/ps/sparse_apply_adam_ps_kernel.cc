@@ -60,7 +60,7 @@ void SparseApplyAdamPSKernel::InitKernel(
   }
   workspace_size_list_.emplace_back(indices_size_ * var_outer_dim_size_ * sizeof(float) * worker_num_);
   workspace_size_list_.emplace_back(indices_size_ * sizeof(int) * worker_num_);
-  workspace_size_list_.emplace_back(indices_size_ * var_outer_dim_size_ * sizeof(float) * worker_num_);
+  workspace_size_list_.emplace_back(BucketUniqueWorkspaceSize(indices_size_ * worker_num_));
   workspace_size_list_.emplace_back(indices_size_ * sizeof(int) * worker_num_);
   workspace_size_list_.emplace_back(var_first_dim_size_ * var_outer_dim_size_ * sizeof(float) * worker_num_);
 }
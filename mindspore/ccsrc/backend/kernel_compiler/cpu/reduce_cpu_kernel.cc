@@ -17,6 +17,7 @@
 #include <string>
 #include <vector>
 #include "backend/kernel_compiler/cpu/reduce_cpu_kernel.h"
+#include "backend/kernel_compiler/cpu/simd/simd_kernels.h"
 #include "runtime/device/cpu/cpu_device_address.h"
 
 namespace mindspore {
@@ -24,7 +25,6 @@ namespace kernel {
 const size_t kReduceTypeMax = 0;
 const size_t kReduceTypeMean = 1;
 const size_t kReduceTypeSum = 2;
-const size_t kMaxDim = 100;
 void ReduceCPUKernel::InitKernel(const CNodePtr &kernel_node) {
   MS_EXCEPTION_IF_NULL(kernel_node);
   std::string kernel_name = AnfAlgo::GetCNodeName(kernel_node);
@@ -63,24 +63,13 @@ bool ReduceCPUKernel::Launch(const std::vector<kernel::AddressPtr> &inputs,
   }
   auto input = reinterpret_cast<float *>(inputs[0]->addr);
   auto output = reinterpret_cast<float *>(outputs[0]->addr);
-  int size = inputs[0]->size / sizeof(float);
-  std::vector<float> new_input(IntToSize(size), 0.0);
-  std::vector<size_t> transpose_axis;
-  for (size_t i = 0; i < shape_.size(); ++i) {
-    bool insert = true;
-    for (size_t j = 0; j < axis_.size(); ++j) {
-      if (axis_[j] == i) {
-        insert = false;
-        break;
-      }
-    }
-    if (insert) {
-      transpose_axis.push_back(i);
-    }
+  simd::ReduceType reduce_type = simd::ReduceType::kSum;
+  if (reduce_type_ == kReduceTypeMax) {
+    reduce_type = simd::ReduceType::kMax;
+  } else if (reduce_type_ == kReduceTypeMean) {
+    reduce_type = simd::ReduceType::kMean;
   }
-  (void)transpose_axis.insert(transpose_axis.end(), axis_.begin(), axis_.end());
-  Transpose(size, input, shape_, transpose_axis, SizeToInt(shape_.size()), &new_input[0]);
-  ConvertDataToOutput(&new_input[0], output);
+  simd::Reduce(input, shape_, axis_, reduce_type, output);
   return true;
 }
 
@@ -118,56 +107,5 @@ void ReduceCPUKernel::CheckAxis(const CNodePtr &kernel_node) {
     MS_LOG(EXCEPTION) << "Attribute axis type is invalid.";
   }
 }
-
-void ReduceCPUKernel::ConvertDataToOutput(const float *new_input, float *output) {
-  if (reduce_type_ == kReduceTypeMax) {
-    for (size_t i = 0; i < left_dims_; ++i) {
-      float value = new_input[i * stride_];
-      for (size_t k = 0; k < stride_; ++k) {
-        if (value < new_input[i * stride_ + k]) {
-          value = new_input[i * stride_ + k];
-        }
-      }
-      output[i] = value;
-    }
-  } else {
-    for (size_t i = 0; i < left_dims_; ++i) {
-      float value = 0.0;
-      for (size_t k = 0; k < stride_; ++k) {
-        value += new_input[i * stride_ + k];
-      }
-      if (reduce_type_ == kReduceTypeMean) {
-        output[i] = value / stride_;
-      } else {
-        output[i] = value;
-      }
-    }
-  }
-}
-void ReduceCPUKernel::Transpose(const int size, const float *input, const std::vector<size_t> &input_shape,
-                                const std::vector<size_t> &input_axis, const int shape_size, float *output) {
-  int pos_array[kMaxDim];
-  int size_offset[kMaxDim];
-  size_offset[0] = size / SizeToInt(input_shape[0]);
-  for (int i = 1; i < shape_size; i++) {
-    size_offset[i] = size_offset[i - 1] / SizeToInt(input_shape[i]);
-  }
-  for (int position = 0; position < size; position += 1) {
-    int temp_position = position;
-    pos_array[0] = temp_position / size_offset[0];
-    for (int i = 1; i < shape_size; i++) {
-      temp_position -= pos_array[i - 1] * size_offset[i - 1];
-      pos_array[i] = temp_position / size_offset[i];
-    }
-    int new_position = pos_array[SizeToInt(input_axis[shape_size - 1])];
-    int new_position_size = 1;
-    for (int j = shape_size - 2; j >= 0; j--) {
-      new_position_size *= SizeToInt(input_shape[SizeToInt(input_axis[j + 1])]);
-      new_position += pos_array[SizeToInt(input_axis[j])] * new_position_size;
-    }
-    output[new_position] = input[position];
-  }
-  return;
-}
 }  // namespace kernel
 }  // namespace mindspore
@@ -32,9 +32,6 @@ class ReduceCPUKernel : public CPUKernel {
               const std::vector<AddressPtr> &outputs) override;
 
  private:
-  void Transpose(const int size, const float *input, const std::vector<size_t> &input_shape,
-                 const std::vector<size_t> &input_axis, const int shape_size, float *output);
-  void ConvertDataToOutput(const float *input, float *output);
   void CheckAxis(const CNodePtr &kernel_node);
   size_t reduce_type_ = 0;
   std::vector<size_t> axis_;
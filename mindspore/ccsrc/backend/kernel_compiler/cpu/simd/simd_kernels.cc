@@ -0,0 +1,744 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "backend/kernel_compiler/cpu/simd/simd_kernels.h"
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <utility>
+#include "backend/kernel_compiler/cpu/cpu_thread_pool.h"
+#include "utils/log_adapter.h"
+#include "securec/include/securec.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define ENABLE_X86_SIMD
+#include <immintrin.h>
+#define AVX2_TARGET __attribute__((target("avx2,fma")))
+#define AVX512_TARGET __attribute__((target("avx512f,avx2,fma")))
+#endif
+
+namespace mindspore {
+namespace kernel {
+namespace simd {
+namespace {
+// elements computed by one task at least
+constexpr size_t kGrainSize = 16384;
+// rows of the input transposed by one task
+constexpr size_t kTransposeRowBlock = 64;
+constexpr size_t kTransposeTile = 8;
+
+ISA DetectISA() {
+#ifdef ENABLE_X86_SIMD
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) {
+    return ISA::kAVX512;
+  }
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+    return ISA::kAVX2;
+  }
+#endif
+  return ISA::kScalar;
+}
+
+ISA SupportedISA() {
+  static const ISA supported_isa = DetectISA();
+  return supported_isa;
+}
+
+std::atomic<int> &CurrentISA() {
+  static std::atomic<int> current_isa(static_cast<int>(SupportedISA()));
+  return current_isa;
+}
+
+size_t ShapeSize(const std::vector<size_t> &shape) {
+  return std::accumulate(shape.begin(), shape.end(), size_t(1), std::multiplies<size_t>());
+}
+
+// Offset of the index-th element of a row-major iteration over dims, in an array with the given strides.
+size_t GetOffset(size_t index, const std::vector<size_t> &dims, const std::vector<size_t> &strides) {
+  size_t offset = 0;
+  for (size_t i = dims.size(); i > 0; --i) {
+    offset += (index % dims[i - 1]) * strides[i - 1];
+    index /= dims[i - 1];
+  }
+  return offset;
+}
+
+// Offsets of all elements of a row-major iteration over dims.
+std::vector<size_t> GetAllOffsets(const std::vector<size_t> &dims, const std::vector<size_t> &strides) {
+  std::vector<size_t> offsets(1, 0);
+  for (size_t i = 0; i < dims.size(); ++i) {
+    std::vector<size_t> next_offsets;
+    next_offsets.reserve(offsets.size() * dims[i]);
+    for (auto offset : offsets) {
+      for (size_t j = 0; j < dims[i]; ++j) {
+        next_offsets.push_back(offset + j * strides[i]);
+      }
+    }
+    offsets.swap(next_offsets);
+  }
+  return offsets;
+}
+
+template <BinaryType op>
+inline float ScalarBinary(float a, float b) {
+  if constexpr (op == BinaryType::kAdd) {
+    return a + b;
+  } else if constexpr (op == BinaryType::kSub) {
+    return a - b;
+  } else if constexpr (op == BinaryType::kMul) {
+    return a * b;
+  } else {
+    return a / b;
+  }
+}
+
+// out[i] = a[i] op b[i], an input flagged as scalar is broadcast over the row.
+template <BinaryType op>
+void BinaryRowScalar(const float *a, bool a_scalar, const float *b, bool b_scalar, float *out, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    out[i] = ScalarBinary<op>(a_scalar ? *a : a[i], b_scalar ? *b : b[i]);
+  }
+}
+
+float ReduceRowScalar(const float *in, size_t n, bool is_max) {
+  float value = is_max ? in[0] : 0;
+  for (size_t i = 0; i < n; ++i) {
+    value = is_max ? std::max(value, in[i]) : value + in[i];
+  }
+  return value;
+}
+
+void AccumulateRowScalar(const float *in, float *acc, size_t n, bool is_max) {
+  for (size_t i = 0; i < n; ++i) {
+    acc[i] = is_max ? std::max(acc[i], in[i]) : acc[i] + in[i];
+  }
+}
+
+void TransposeTileScalar(const float *src, size_t lds, float *dst, size_t ldd, size_t rows, size_t cols) {
+  for (size_t j = 0; j < rows; ++j) {
+    for (size_t k = 0; k < cols; ++k) {
+      dst[k * ldd + j] = src[j * lds + k];
+    }
+  }
+}
+
+#ifdef ENABLE_X86_SIMD
+AVX2_TARGET inline float HorizontalReduceAVX2(__m256 v, bool is_max) {
+  __m128 lo = _mm256_castps256_ps128(v);
+  __m128 hi = _mm256_extractf128_ps(v, 1);
+  lo = is_max ? _mm_max_ps(lo, hi) : _mm_add_ps(lo, hi);
+  __m128 shuf = _mm_movehdup_ps(lo);
+  __m128 res = is_max ? _mm_max_ps(lo, shuf) : _mm_add_ps(lo, shuf);
+  shuf = _mm_movehl_ps(shuf, res);
+  res = is_max ? _mm_max_ss(res, shuf) : _mm_add_ss(res, shuf);
+  return _mm_cvtss_f32(res);
+}
+
+template <BinaryType op>
+AVX2_TARGET inline __m256 BinaryAVX2(__m256 a, __m256 b) {
+  if constexpr (op == BinaryType::kAdd) {
+    return _mm256_add_ps(a, b);
+  } else if constexpr (op == BinaryType::kSub) {
+    return _mm256_sub_ps(a, b);
+  } else if constexpr (op == BinaryType::kMul) {
+    return _mm256_mul_ps(a, b);
+  } else {
+    return _mm256_div_ps(a, b);
+  }
+}
+
+template <BinaryType op>
+AVX2_TARGET void BinaryRowAVX2(const float *a, bool a_scalar, const float *b, bool b_scalar, float *out, size_t n) {
+  const __m256 va = _mm256_set1_ps(*a);
+  const __m256 vb = _mm256_set1_ps(*b);
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256 x = a_scalar ? va : _mm256_loadu_ps(a + i);
+    __m256 y = b_scalar ? vb : _mm256_loadu_ps(b + i);
+    _mm256_storeu_ps(out + i, BinaryAVX2<op>(x, y));
+  }
+  for (; i < n; ++i) {
+    out[i] = ScalarBinary<op>(a_scalar ? *a : a[i], b_scalar ? *b : b[i]);
+  }
+}
+
+AVX2_TARGET float ReduceRowAVX2(const float *in, size_t n, bool is_max) {
+  size_t i = 0;
+  float value = is_max ? in[0] : 0;
+  if (n >= 16) {
+    __m256 acc0 = _mm256_loadu_ps(in);
+    __m256 acc1 = _mm256_loadu_ps(in + 8);
+    for (i = 16; i + 16 <= n; i += 16) {
+      __m256 x0 = _mm256_loadu_ps(in + i);
+      __m256 x1 = _mm256_loadu_ps(in + i + 8);
+      acc0 = is_max ? _mm256_max_ps(acc0, x0) : _mm256_add_ps(acc0, x0);
+      acc1 = is_max ? _mm256_max_ps(acc1, x1) : _mm256_add_ps(acc1, x1);
+    }
+    value = HorizontalReduceAVX2(is_max ? _mm256_max_ps(acc0, acc1) : _mm256_add_ps(acc0, acc1), is_max);
+  }
+  for (; i < n; ++i) {
+    value = is_max ? std::max(value, in[i]) : value + in[i];
+  }
+  return value;
+}
+
+AVX2_TARGET void AccumulateRowAVX2(const float *in, float *acc, size_t n, bool is_max) {
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256 x = _mm256_loadu_ps(in + i);
+    __m256 y = _mm256_loadu_ps(acc + i);
+    _mm256_storeu_ps(acc + i, is_max ? _mm256_max_ps(x, y) : _mm256_add_ps(x, y));
+  }
+  for (; i < n; ++i) {
+    acc[i] = is_max ? std::max(acc[i], in[i]) : acc[i] + in[i];
+  }
+}
+
+AVX2_TARGET void Transpose8x8AVX2(const float *src, size_t lds, float *dst, size_t ldd) {
+  __m256 r0 = _mm256_loadu_ps(src);
+  __m256 r1 = _mm256_loadu_ps(src + lds);
+  __m256 r2 = _mm256_loadu_ps(src + 2 * lds);
+  __m256 r3 = _mm256_loadu_ps(src + 3 * lds);
+  __m256 r4 = _mm256_loadu_ps(src + 4 * lds);
+  __m256 r5 = _mm256_loadu_ps(src + 5 * lds);
+  __m256 r6 = _mm256_loadu_ps(src + 6 * lds);
+  __m256 r7 = _mm256_loadu_ps(src + 7 * lds);
+  __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+  __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+  __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+  __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+  __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+  __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+  __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+  __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+  __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+  __m256 s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+  __m256 s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+  __m256 s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+  __m256 s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+  __m256 s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+  __m256 s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+  __m256 s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+  _mm256_storeu_ps(dst, _mm256_permute2f128_ps(s0, s4, 0x20));
+  _mm256_storeu_ps(dst + ldd, _mm256_permute2f128_ps(s1, s5, 0x20));
+  _mm256_storeu_ps(dst + 2 * ldd, _mm256_permute2f128_ps(s2, s6, 0x20));
+  _mm256_storeu_ps(dst + 3 * ldd, _mm256_permute2f128_ps(s3, s7, 0x20));
+  _mm256_storeu_ps(dst + 4 * ldd, _mm256_permute2f128_ps(s0, s4, 0x31));
+  _mm256_storeu_ps(dst + 5 * ldd, _mm256_permute2f128_ps(s1, s5, 0x31));
+  _mm256_storeu_ps(dst + 6 * ldd, _mm256_permute2f128_ps(s2, s6, 0x31));
+  _mm256_storeu_ps(dst + 7 * ldd, _mm256_permute2f128_ps(s3, s7, 0x31));
+}
+
+// _mm512_max_ps and _mm512_reduce_*_ps start from an undefined vector, which gcc reports as maybe uninitialized
+AVX512_TARGET inline __m512 MaxAVX512(__m512 a, __m512 b) { return _mm512_mask_max_ps(a, 0xFFFF, a, b); }
+
+AVX512_TARGET inline float HorizontalReduceAVX512(__m512 v, bool is_max) {
+  float lanes[16];
+  _mm512_storeu_ps(lanes, v);
+  __m256 lo = _mm256_loadu_ps(lanes);
+  __m256 hi = _mm256_loadu_ps(lanes + 8);
+  return HorizontalReduceAVX2(is_max ? _mm256_max_ps(lo, hi) : _mm256_add_ps(lo, hi), is_max);
+}
+
+template <BinaryType op>
+AVX512_TARGET inline __m512 BinaryAVX512(__m512 a, __m512 b) {
+  if constexpr (op == BinaryType::kAdd) {
+    return _mm512_add_ps(a, b);
+  } else if constexpr (op == BinaryType::kSub) {
+    return _mm512_sub_ps(a, b);
+  } else if constexpr (op == BinaryType::kMul) {
+    return _mm512_mul_ps(a, b);
+  } else {
+    return _mm512_div_ps(a, b);
+  }
+}
+
+template <BinaryType op>
+AVX512_TARGET void BinaryRowAVX512(const float *a, bool a_scalar, const float *b, bool b_scalar, float *out,
+                                   size_t n) {
+  const __m512 va = _mm512_set1_ps(*a);
+  const __m512 vb = _mm512_set1_ps(*b);
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m512 x = a_scalar ? va : _mm512_loadu_ps(a + i);
+    __m512 y = b_scalar ? vb : _mm512_loadu_ps(b + i);
+    _mm512_storeu_ps(out + i, BinaryAVX512<op>(x, y));
+  }
+  if (i < n) {
+    __mmask16 mask = static_cast<__mmask16>((1U << (n - i)) - 1);
+    __m512 x = a_scalar ? va : _mm512_maskz_loadu_ps(mask, a + i);
+    __m512 y = b_scalar ? vb : _mm512_mask_loadu_ps(_mm512_set1_ps(1), mask, b + i);
+    _mm512_mask_storeu_ps(out + i, mask, BinaryAVX512<op>(x, y));
+  }
+}
+
+AVX512_TARGET float ReduceRowAVX512(const float *in, size_t n, bool is_max) {
+  size_t i = 0;
+  float value = is_max ? in[0] : 0;
+  if (n >= 32) {
+    __m512 acc0 = _mm512_loadu_ps(in);
+    __m512 acc1 = _mm512_loadu_ps(in + 16);
+    for (i = 32; i + 32 <= n; i += 32) {
+      __m512 x0 = _mm512_loadu_ps(in + i);
+      __m512 x1 = _mm512_loadu_ps(in + i + 16);
+      acc0 = is_max ? MaxAVX512(acc0, x0) : _mm512_add_ps(acc0, x0);
+      acc1 = is_max ? MaxAVX512(acc1, x1) : _mm512_add_ps(acc1, x1);
+    }
+    value = HorizontalReduceAVX512(is_max ? MaxAVX512(acc0, acc1) : _mm512_add_ps(acc0, acc1), is_max);
+  }
+  for (; i < n; ++i) {
+    value = is_max ? std::max(value, in[i]) : value + in[i];
+  }
+  return value;
+}
+
+AVX512_TARGET void AccumulateRowAVX512(const float *in, float *acc, size_t n, bool is_max) {
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m512 x = _mm512_loadu_ps(in + i);
+    __m512 y = _mm512_loadu_ps(acc + i);
+    _mm512_storeu_ps(acc + i, is_max ? MaxAVX512(x, y) : _mm512_add_ps(x, y));
+  }
+  for (; i < n; ++i) {
+    acc[i] = is_max ? std::max(acc[i], in[i]) : acc[i] + in[i];
+  }
+}
+#endif
+
+template <BinaryType op>
+void BinaryRow(const float *a, bool a_scalar, const float *b, bool b_scalar, float *out, size_t n, ISA isa) {
+#ifdef ENABLE_X86_SIMD
+  if (isa == ISA::kAVX512) {
+    BinaryRowAVX512<op>(a, a_scalar, b, b_scalar, out, n);
+    return;
+  }
+  if (isa == ISA::kAVX2) {
+    BinaryRowAVX2<op>(a, a_scalar, b, b_scalar, out, n);
+    return;
+  }
+#endif
+  BinaryRowScalar<op>(a, a_scalar, b, b_scalar, out, n);
+}
+
+void BinaryRow(BinaryType type, const float *a, bool a_scalar, const float *b, bool b_scalar, float *out, size_t n,
+               ISA isa) {
+  switch (type) {
+    case BinaryType::kAdd:
+      BinaryRow<BinaryType::kAdd>(a, a_scalar, b, b_scalar, out, n, isa);
+      break;
+    case BinaryType::kSub:
+      BinaryRow<BinaryType::kSub>(a, a_scalar, b, b_scalar, out, n, isa);
+      break;
+    case BinaryType::kMul:
+      BinaryRow<BinaryType::kMul>(a, a_scalar, b, b_scalar, out, n, isa);
+      break;
+    default:
+      BinaryRow<BinaryType::kDiv>(a, a_scalar, b, b_scalar, out, n, isa);
+      break;
+  }
+}
+
+float ReduceRow(const float *in, size_t n, bool is_max, ISA isa) {
+#ifdef ENABLE_X86_SIMD
+  if (isa == ISA::kAVX512) {
+    return ReduceRowAVX512(in, n, is_max);
+  }
+  if (isa == ISA::kAVX2) {
+    return ReduceRowAVX2(in, n, is_max);
+  }
+#endif
+  return ReduceRowScalar(in, n, is_max);
+}
+
+void AccumulateRow(const float *in, float *acc, size_t n, bool is_max, ISA isa) {
+#ifdef ENABLE_X86_SIMD
+  if (isa == ISA::kAVX512) {
+    AccumulateRowAVX512(in, acc, n, is_max);
+    return;
+  }
+  if (isa == ISA::kAVX2) {
+    AccumulateRowAVX2(in, acc, n, is_max);
+    return;
+  }
+#endif
+  AccumulateRowScalar(in, acc, n, is_max);
+}
+
+// dst[k * ldd + j] = src[j * lds + k] for j in [0, rows) and k in [0, cols).
+void Transpose2D(const float *src, size_t lds, float *dst, size_t ldd, size_t rows, size_t cols, ISA isa) {
+  for (size_t j = 0; j < rows; j += kTransposeTile) {
+    size_t tile_rows = std::min(kTransposeTile, rows - j);
+    for (size_t k = 0; k < cols; k += kTransposeTile) {
+      size_t tile_cols = std::min(kTransposeTile, cols - k);
+      const float *tile_src = src + j * lds + k;
+      float *tile_dst = dst + k * ldd + j;
+#ifdef ENABLE_X86_SIMD
+      if (isa != ISA::kScalar && tile_rows == kTransposeTile && tile_cols == kTransposeTile) {
+        Transpose8x8AVX2(tile_src, lds, tile_dst, ldd);
+        continue;
+      }
+#endif
+      TransposeTileScalar(tile_src, lds, tile_dst, ldd, tile_rows, tile_cols);
+    }
+  }
+}
+
+std::vector<size_t> GetStrides(const std::vector<size_t> &shape) {
+  std::vector<size_t> strides(shape.size(), 1);
+  for (size_t i = shape.size(); i > 1; --i) {
+    strides[i - 2] = strides[i - 1] * shape[i - 1];
+  }
+  return strides;
+}
+}  // namespace
+
+ISA GetISA() { return static_cast<ISA>(CurrentISA().load()); }
+
+void SetISA(ISA isa) { CurrentISA() = static_cast<int>(std::min(isa, SupportedISA())); }
+
+std::string ISAName(ISA isa) {
+  switch (isa) {
+    case ISA::kAVX512:
+      return "avx512";
+    case ISA::kAVX2:
+      return "avx2";
+    default:
+      return "scalar";
+  }
+}
+
+void Transpose(const float *input, const std::vector<size_t> &shape, const std::vector<size_t> &perm, float *output) {
+  MS_EXCEPTION_IF_NULL(input);
+  MS_EXCEPTION_IF_NULL(output);
+  if (perm.size() != shape.size()) {
+    MS_LOG(EXCEPTION) << "The size of perm " << perm.size() << " is not equal to the size of shape " << shape.size();
+  }
+  std::vector<size_t> new_index(shape.size(), 0);
+  std::vector<bool> used(shape.size(), false);
+  for (auto axis : perm) {
+    if (axis >= shape.size() || used[axis]) {
+      MS_LOG(EXCEPTION) << "Invalid transpose perm, axis " << axis << " is out of range or repeated.";
+    }
+    used[axis] = true;
+  }
+  // drop the dims of size 1
+  size_t dim_num = 0;
+  for (size_t i = 0; i < shape.size(); ++i) {
+    new_index[i] = dim_num;
+    dim_num += shape[i] > 1 ? 1 : 0;
+  }
+  std::vector<size_t> squeezed_perm;
+  for (auto axis : perm) {
+    if (shape[axis] > 1) {
+      squeezed_perm.push_back(new_index[axis]);
+    }
+  }
+  std::vector<size_t> squeezed_shape;
+  std::copy_if(shape.begin(), shape.end(), std::back_inserter(squeezed_shape), [](size_t dim) { return dim > 1; });
+  // merge the output dims reading consecutive input dims
+  std::vector<std::pair<size_t, size_t>> groups;
+  for (size_t i = 0; i < squeezed_perm.size(); ++i) {
+    if (i > 0 && squeezed_perm[i] == squeezed_perm[i - 1] + 1) {
+      groups.back().second = squeezed_perm[i];
+    } else {
+      groups.emplace_back(squeezed_perm[i], squeezed_perm[i]);
+    }
+  }
+  std::vector<size_t> group_order(groups.size());
+  std::iota(group_order.begin(), group_order.end(), 0);
+  std::sort(group_order.begin(), group_order.end(),
+            [&groups](size_t lhs, size_t rhs) { return groups[lhs].first < groups[rhs].first; });
+  std::vector<size_t> in_shape(groups.size(), 1);
+  std::vector<size_t> out_perm(groups.size(), 0);
+  for (size_t i = 0; i < group_order.size(); ++i) {
+    auto &group = groups[group_order[i]];
+    for (size_t j = group.first; j <= group.second; ++j) {
+      in_shape[i] *= squeezed_shape[j];
+    }
+    out_perm[group_order[i]] = i;
+  }
+
+  size_t total = ShapeSize(shape);
+  size_t n = in_shape.size();
+  if (n <= 1) {
+    if (total > 0 && memcpy_s(output, total * sizeof(float), input, total * sizeof(float)) != EOK) {
+      MS_LOG(EXCEPTION) << "Transpose memcpy failed.";
+    }
+    return;
+  }
+  auto in_strides = GetStrides(in_shape);
+  std::vector<size_t> out_shape(n);
+  std::vector<size_t> perm_strides(n);
+  for (size_t i = 0; i < n; ++i) {
+    out_shape[i] = in_shape[out_perm[i]];
+    perm_strides[i] = in_strides[out_perm[i]];
+  }
+  auto out_strides = GetStrides(out_shape);
+  ISA isa = GetISA();
+  auto &thread_pool = CPUThreadPool::GetInstance();
+  if (out_perm[n - 1] == n - 1) {
+    // the innermost dim stays innermost, whole rows of the input are copied
+    size_t cols = in_shape[n - 1];
+    std::vector<size_t> outer_shape(out_shape.begin(), out_shape.end() - 1);
+    std::vector<size_t> outer_strides(perm_strides.begin(), perm_strides.end() - 1);
+    auto task = [&](size_t start, size_t end) {
+      for (size_t i = start; i < end; ++i) {
+        if (memcpy_s(output + i * cols, cols * sizeof(float), input + GetOffset(i, outer_shape, outer_strides),
+                     cols * sizeof(float)) != EOK) {
+          MS_LOG(EXCEPTION) << "Transpose memcpy failed.";
+        }
+      }
+    };
+    thread_pool.ParallelFor(total / cols, std::max(size_t(1), kGrainSize / cols), task);
+    return;
+  }
+  // rows of the input along out_perm[n - 1] become the columns of the output along the input innermost dim,
+  // they are transposed by tiles
+  size_t in_row_dim = out_perm[n - 1];
+  size_t out_col_dim = std::find(out_perm.begin(), out_perm.end(), n - 1) - out_perm.begin();
+  size_t rows = in_shape[in_row_dim];
+  size_t cols = in_shape[n - 1];
+  std::vector<size_t> outer_shape;
+  std::vector<size_t> outer_in_strides;
+  std::vector<size_t> outer_out_strides;
+  for (size_t i = 0; i < n - 1; ++i) {
+    if (i != out_col_dim) {
+      outer_shape.push_back(out_shape[i]);
+      outer_in_strides.push_back(perm_strides[i]);
+      outer_out_strides.push_back(out_strides[i]);
+    }
+  }
+  size_t row_blocks = (rows + kTransposeRowBlock - 1) / kTransposeRowBlock;
+  size_t task_num = ShapeSize(outer_shape) * row_blocks;
+  size_t block_size = std::min(rows, kTransposeRowBlock) * cols;
+  auto task = [&](size_t start, size_t end) {
+    for (size_t i = start; i < end; ++i) {
+      size_t outer = i / row_blocks;
+      size_t row_start = (i % row_blocks) * kTransposeRowBlock;
+      const float *src = input + GetOffset(outer, outer_shape, outer_in_strides) + row_start * in_strides[in_row_dim];
+      float *dst = output + GetOffset(outer, outer_shape, outer_out_strides) + row_start;
+      Transpose2D(src, in_strides[in_row_dim], dst, out_strides[out_col_dim],
+                  std::min(kTransposeRowBlock, rows - row_start), cols, isa);
+    }
+  };
+  thread_pool.ParallelFor(task_num, std::max(size_t(1), kGrainSize / block_size), task);
+}
+
+void Reduce(const float *input, const std::vector<size_t> &shape, const std::vector<size_t> &axis, ReduceType type,
+            float *output) {
+  MS_EXCEPTION_IF_NULL(input);
+  MS_EXCEPTION_IF_NULL(output);
+  std::vector<bool> reduced(shape.size(), false);
+  size_t reduce_size = 1;
+  for (auto i : axis) {
+    if (i >= shape.size()) {
+      MS_LOG(EXCEPTION) << "Reduce axis " << i << " is out of range " << shape.size();
+    }
+    if (!reduced[i]) {
+      reduced[i] = true;
+      reduce_size *= shape[i];
+    }
+  }
+  // drop the dims of size 1 and merge the adjacent dims which are both reduced or both kept
+  std::vector<size_t> dims;
+  std::vector<bool> dim_reduced;
+  for (size_t i = 0; i < shape.size(); ++i) {
+    if (shape[i] == 1) {
+      continue;
+    }
+    if (!dims.empty() && dim_reduced.back() == reduced[i]) {
+      dims.back() *= shape[i];
+    } else {
+      dims.push_back(shape[i]);
+      dim_reduced.push_back(reduced[i]);
+    }
+  }
+  size_t total = ShapeSize(shape);
+  if (total == 0) {
+    return;
+  }
+  bool is_max = type == ReduceType::kMax;
+  float scale = type == ReduceType::kMean ? 1.0f / reduce_size : 1.0f;
+  if (std::find(dim_reduced.begin(), dim_reduced.end(), true) == dim_reduced.end()) {
+    if (memcpy_s(output, total * sizeof(float), input, total * sizeof(float)) != EOK) {
+      MS_LOG(EXCEPTION) << "Reduce memcpy failed.";
+    }
+    return;
+  }
+  auto strides = GetStrides(dims);
+  size_t n = dims.size();
+  size_t inner = dims[n - 1];
+  bool inner_reduced = dim_reduced[n - 1];
+  std::vector<size_t> kept_dims;
+  std::vector<size_t> kept_strides;
+  std::vector<size_t> reduced_dims;
+  std::vector<size_t> reduced_strides;
+  for (size_t i = 0; i < n - 1; ++i) {
+    if (dim_reduced[i]) {
+      reduced_dims.push_back(dims[i]);
+      reduced_strides.push_back(strides[i]);
+    } else {
+      kept_dims.push_back(dims[i]);
+      kept_strides.push_back(strides[i]);
+    }
+  }
+  auto reduced_offsets = GetAllOffsets(reduced_dims, reduced_strides);
+  size_t outer_num = ShapeSize(kept_dims);
+  ISA isa = GetISA();
+  auto &thread_pool = CPUThreadPool::GetInstance();
+
+  if (inner_reduced && outer_num == 1 && reduced_offsets.size() == 1) {
+    // reduce all elements of a contiguous array, partial results of the tasks are combined at the end
+    size_t task_num = std::min(thread_pool.thread_num(), (inner + kGrainSize - 1) / kGrainSize);
+    size_t chunk = (inner + task_num - 1) / task_num;
+    std::vector<float> partials(task_num, 0);
+    thread_pool.ParallelLaunch(task_num, [&](size_t start, size_t) {
+      size_t begin = start * chunk;
+      size_t len = std::min(chunk, inner - begin);
+      partials[start] = ReduceRow(input + begin, len, is_max, isa);
+    });
+    output[0] = ReduceRow(partials.data(), partials.size(), is_max, ISA::kScalar) * scale;
+    return;
+  }
+  if (inner_reduced) {
+    // each output reduces contiguous rows of the innermost dim
+    size_t reduce_num = inner * reduced_offsets.size();
+    auto task = [&](size_t start, size_t end) {
+      for (size_t i = start; i < end; ++i) {
+        const float *src = input + GetOffset(i, kept_dims, kept_strides);
+        float value = ReduceRow(src + reduced_offsets[0], inner, is_max, isa);
+        for (size_t j = 1; j < reduced_offsets.size(); ++j) {
+          float row_value = ReduceRow(src + reduced_offsets[j], inner, is_max, isa);
+          value = is_max ? std::max(value, row_value) : value + row_value;
+        }
+        output[i] = value * scale;
+      }
+    };
+    thread_pool.ParallelFor(outer_num, std::max(size_t(1), kGrainSize / reduce_num), task);
+    return;
+  }
+  // the innermost dim is kept, rows of the input are accumulated into the output rows in vector registers
+  size_t col_blocks = (inner + kGrainSize - 1) / kGrainSize;
+  size_t block_size = std::min(inner, kGrainSize);
+  auto task = [&](size_t start, size_t end) {
+    for (size_t i = start; i < end; ++i) {
+      size_t outer = i / col_blocks;
+      size_t col_start = (i % col_blocks) * kGrainSize;
+      size_t len = std::min(kGrainSize, inner - col_start);
+      const float *src = input + GetOffset(outer, kept_dims, kept_strides) + col_start;
+      float *dst = output + outer * inner + col_start;
+      if (memcpy_s(dst, len * sizeof(float), src + reduced_offsets[0], len * sizeof(float)) != EOK) {
+        MS_LOG(EXCEPTION) << "Reduce memcpy failed.";
+      }
+      for (size_t j = 1; j < reduced_offsets.size(); ++j) {
+        AccumulateRow(src + reduced_offsets[j], dst, len, is_max, isa);
+      }
+      if (type == ReduceType::kMean) {
+        BinaryRow(BinaryType::kMul, dst, false, &scale, true, dst, len, isa);
+      }
+    }
+  };
+  size_t task_size = block_size * reduced_offsets.size();
+  thread_pool.ParallelFor(outer_num * col_blocks, std::max(size_t(1), kGrainSize / task_size), task);
+}
+
+std::vector<size_t> BroadcastShape(const std::vector<size_t> &shape0, const std::vector<size_t> &shape1) {
+  size_t n = std::max(shape0.size(), shape1.size());
+  std::vector<size_t> out_shape(n, 1);
+  for (size_t i = 0; i < n; ++i) {
+    size_t dim0 = i < n - shape0.size() ? 1 : shape0[i - (n - shape0.size())];
+    size_t dim1 = i < n - shape1.size() ? 1 : shape1[i - (n - shape1.size())];
+    if (dim0 != dim1 && dim0 != 1 && dim1 != 1) {
+      MS_LOG(EXCEPTION) << "Shapes can not be broadcast, dim " << i << ": " << dim0 << " vs " << dim1;
+    }
+    out_shape[i] = dim0 == 1 ? dim1 : dim0;
+  }
+  return out_shape;
+}
+
+void BroadcastBinary(const float *input0, const std::vector<size_t> &shape0, const float *input1,
+                     const std::vector<size_t> &shape1, BinaryType type, float *output) {
+  MS_EXCEPTION_IF_NULL(input0);
+  MS_EXCEPTION_IF_NULL(input1);
+  MS_EXCEPTION_IF_NULL(output);
+  auto out_shape = BroadcastShape(shape0, shape1);
+  size_t total = ShapeSize(out_shape);
+  if (total == 0) {
+    return;
+  }
+  // drop the dims of size 1 and merge the adjacent dims broadcast in the same way
+  size_t rank = out_shape.size();
+  std::vector<size_t> dims;
+  std::vector<std::pair<bool, bool>> dim_broadcast;
+  for (size_t i = 0; i < rank; ++i) {
+    if (out_shape[i] == 1) {
+      continue;
+    }
+    bool broadcast0 = i < rank - shape0.size() || shape0[i - (rank - shape0.size())] == 1;
+    bool broadcast1 = i < rank - shape1.size() || shape1[i - (rank - shape1.size())] == 1;
+    if (!dims.empty() && dim_broadcast.back() == std::make_pair(broadcast0, broadcast1)) {
+      dims.back() *= out_shape[i];
+    } else {
+      dims.push_back(out_shape[i]);
+      dim_broadcast.emplace_back(broadcast0, broadcast1);
+    }
+  }
+  ISA isa = GetISA();
+  if (dims.empty()) {
+    BinaryRow(type, input0, true, input1, true, output, 1, ISA::kScalar);
+    return;
+  }
+  size_t n = dims.size();
+  std::vector<size_t> strides0(n, 0);
+  std::vector<size_t> strides1(n, 0);
+  size_t stride0 = 1;
+  size_t stride1 = 1;
+  for (size_t i = n; i > 0; --i) {
+    if (!dim_broadcast[i - 1].first) {
+      strides0[i - 1] = stride0;
+      stride0 *= dims[i - 1];
+    }
+    if (!dim_broadcast[i - 1].second) {
+      strides1[i - 1] = stride1;
+      stride1 *= dims[i - 1];
+    }
+  }
+  size_t inner = dims[n - 1];
+  bool scalar0 = dim_broadcast[n - 1].first;
+  bool scalar1 = dim_broadcast[n - 1].second;
+  std::vector<size_t> outer_dims(dims.begin(), dims.end() - 1);
+  std::vector<size_t> outer_strides0(strides0.begin(), strides0.end() - 1);
+  std::vector<size_t> outer_strides1(strides1.begin(), strides1.end() - 1);
+  size_t col_blocks = (inner + kGrainSize - 1) / kGrainSize;
+  size_t block_size = std::min(inner, kGrainSize);
+  auto task = [&](size_t start, size_t end) {
+    for (size_t i = start; i < end; ++i) {
+      size_t outer = i / col_blocks;
+      size_t col_start = (i % col_blocks) * kGrainSize;
+      size_t len = std::min(kGrainSize, inner - col_start);
+      const float *src0 = input0 + GetOffset(outer, outer_dims, outer_strides0) + (scalar0 ? 0 : col_start);
+      const float *src1 = input1 + GetOffset(outer, outer_dims, outer_strides1) + (scalar1 ? 0 : col_start);
+      BinaryRow(type, src0, scalar0, src1, scalar1, output + outer * inner + col_start, len, isa);
+    }
+  };
+  CPUThreadPool::GetInstance().ParallelFor(ShapeSize(outer_dims) * col_blocks,
+                                           std::max(size_t(1), kGrainSize / block_size), task);
+}
+}  // namespace simd
+}  // namespace kernel
+}  // namespace mindspore
@@ -0,0 +1,56 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_BACKEND_KERNEL_COMPILER_CPU_SIMD_SIMD_KERNELS_H_
+#define MINDSPORE_CCSRC_BACKEND_KERNEL_COMPILER_CPU_SIMD_SIMD_KERNELS_H_
+
+#include <string>
+#include <vector>
+
+namespace mindspore {
+namespace kernel {
+namespace simd {
+// Vectorized float32 kernels shared by the cpu kernels. The instruction set is selected at runtime, so the
+// library is built without any -m flag and falls back to scalar loops on cpus (or compilers) without avx.
+enum class ISA { kScalar = 0, kAVX2, kAVX512 };
+enum class ReduceType { kMax = 0, kSum, kMean };
+enum class BinaryType { kAdd = 0, kSub, kMul, kDiv };
+
+// The instruction set used by the kernels, the best one supported by the cpu unless capped by SetISA.
+ISA GetISA();
+// Cap the instruction set used by the kernels, for tests and benchmarks. Unsupported ones are ignored.
+void SetISA(ISA isa);
+std::string ISAName(ISA isa);
+
+// output = input.transpose(perm). Dims of size 1 are dropped and dims staying adjacent are merged, then
+// either contiguous rows are copied or 8x8 tiles are transposed in registers.
+void Transpose(const float *input, const std::vector<size_t> &shape, const std::vector<size_t> &perm, float *output);
+
+// Reduce input over axis (duplicated axes are ignored) directly on the strided input, without materializing
+// a transposed copy. The output keeps the other dims in order.
+void Reduce(const float *input, const std::vector<size_t> &shape, const std::vector<size_t> &axis, ReduceType type,
+            float *output);
+
+// output = input0 op input1 with numpy broadcasting, the output shape is the broadcast shape of the inputs.
+void BroadcastBinary(const float *input0, const std::vector<size_t> &shape0, const float *input1,
+                     const std::vector<size_t> &shape1, BinaryType type, float *output);
+
+// The shape of BroadcastBinary output, raises an exception if the shapes can not be broadcast.
+std::vector<size_t> BroadcastShape(const std::vector<size_t> &shape0, const std::vector<size_t> &shape1);
+}  // namespace simd
+}  // namespace kernel
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_BACKEND_KERNEL_COMPILER_CPU_SIMD_SIMD_KERNELS_H_
@@ -83,7 +83,7 @@ template <typename T>
 void SparseApplyAdamCPUKernel::InitWorkspaceSize() {
   workspace_size_list_.emplace_back(indices_size_ * var_outer_dim_size_ * sizeof(float));
   workspace_size_list_.emplace_back(indices_size_ * sizeof(T));
-  workspace_size_list_.emplace_back(indices_size_ * var_outer_dim_size_ * sizeof(float));
+  workspace_size_list_.emplace_back(BucketUniqueWorkspaceSize(indices_size_));
   workspace_size_list_.emplace_back(indices_size_ * sizeof(T));
   workspace_size_list_.emplace_back(var_first_dim_size_ * var_outer_dim_size_ * sizeof(float));
 }
@@ -152,12 +152,11 @@ void SparseApplyAdamCPUKernel::LaunchKernel(const std::vector<kernel::AddressPtr
   auto indices = reinterpret_cast<T *>(inputs[10]->addr);
   auto new_grad = reinterpret_cast<float *>(workspace[0]->addr);
   auto new_indices = reinterpret_cast<T *>(workspace[1]->addr);
-  auto workspace_grad = reinterpret_cast<float *>(workspace[2]->addr);
   auto workspace_indices = reinterpret_cast<T *>(workspace[3]->addr);
   auto m_t = reinterpret_cast<float *>(workspace[4]->addr);
 
   SparseGradient<T> unique_sparse_grad({new_grad, new_indices, indices_size_});
-  SparseGradient<T> workspace_sparse_grad({workspace_grad, workspace_indices, indices_size_});
+  SparseGradient<T> workspace_sparse_grad({nullptr, workspace_indices, indices_size_});
   SparseGradient<T> input_sparse_grad({grad, indices, indices_size_});
   ReduceSparseGradientParam<T> param;
   param.input_grad_ = &input_sparse_grad;
@@ -165,6 +164,8 @@ void SparseApplyAdamCPUKernel::LaunchKernel(const std::vector<kernel::AddressPtr
   param.output_grad_ = &unique_sparse_grad;
   param.max_index_ = var_first_dim_size_;
   param.value_stride_ = var_outer_dim_size_;
+  param.unique_workspace_ = workspace[2]->addr;
+  param.unique_workspace_size_ = workspace[2]->size;
   BucketReduceSparseGradient(param);
 
   size_t total_dim_size = var_first_dim_size_ * var_outer_dim_size_;
@@ -61,7 +61,7 @@ template <typename T>
 void SparseApplyProximalAdagradCPUKernel::InitWorkspaceSize() {
   workspace_size_list_.emplace_back(indices_size_ * var_outer_dim_size_ * sizeof(float));
   workspace_size_list_.emplace_back(indices_size_ * sizeof(T));
-  workspace_size_list_.emplace_back(indices_size_ * var_outer_dim_size_ * sizeof(float));
+  workspace_size_list_.emplace_back(BucketUniqueWorkspaceSize(indices_size_));
   workspace_size_list_.emplace_back(indices_size_ * sizeof(T));
 }
 
@@ -127,11 +127,10 @@ void SparseApplyProximalAdagradCPUKernel::LaunchKernel(const std::vector<kernel:
   auto indices = reinterpret_cast<T *>(inputs[6]->addr);
   auto new_grad = reinterpret_cast<float *>(workspace[0]->addr);
   auto new_indices = reinterpret_cast<T *>(workspace[1]->addr);
-  auto workspace_grad = reinterpret_cast<float *>(workspace[2]->addr);
   auto workspace_indices = reinterpret_cast<T *>(workspace[3]->addr);
 
   SparseGradient<T> unique_sparse_grad({new_grad, new_indices, indices_size_});
-  SparseGradient<T> workspace_sparse_grad({workspace_grad, workspace_indices, indices_size_});
+  SparseGradient<T> workspace_sparse_grad({nullptr, workspace_indices, indices_size_});
   SparseGradient<T> input_sparse_grad({grad, indices, indices_size_});
   ReduceSparseGradientParam<T> param;
   param.input_grad_ = &input_sparse_grad;
@@ -139,6 +138,8 @@ void SparseApplyProximalAdagradCPUKernel::LaunchKernel(const std::vector<kernel:
   param.output_grad_ = &unique_sparse_grad;
   param.max_index_ = var_first_dim_size_;
   param.value_stride_ = var_outer_dim_size_;
+  param.unique_workspace_ = workspace[2]->addr;
+  param.unique_workspace_size_ = workspace[2]->size;
   BucketReduceSparseGradient(param);
 
   MultiThreadComputeParams<T> input_params;
@@ -34,7 +34,7 @@ class TransposeCPUFwdKernel : public CPUKernel {
 
  private:
   std::vector<size_t> shape_;
-  std::vector<int> axis_;
+  std::vector<size_t> axis_;
 };
 
 MS_REG_CPU_KERNEL(Transpose, KernelAttr().AddInputAttr(kNumberTypeFloat32).AddOutputAttr(kNumberTypeFloat32),
@@ -15,6 +15,7 @@
  */
 
 #include "backend/kernel_compiler/cpu/unique_cpu_kernel.h"
+#include "backend/kernel_compiler/cpu/bucket_unique.h"
 #include "runtime/device/cpu/cpu_device_address.h"
 
 namespace mindspore {
@@ -26,38 +27,37 @@ void UniqueCPUKernel::InitKernel(const CNodePtr &kernel_node) {
   dtype_ = AnfAlgo::GetPrevNodeOutputInferDataType(kernel_node, 0);
 }
 
+void UniqueCPUKernel::InitInputOutputSize(const CNodePtr &kernel_node) {
+  CPUKernel::InitInputOutputSize(kernel_node);
+  workspace_size_list_.emplace_back(BucketUniqueWorkspaceSize(n_));
+}
+
 bool UniqueCPUKernel::Launch(const std::vector<kernel::AddressPtr> &inputs,
-                             const std::vector<kernel::AddressPtr> & /*workspace*/,
+                             const std::vector<kernel::AddressPtr> &workspace,
                              const std::vector<kernel::AddressPtr> &outputs) {
   if (dtype_ == kNumberTypeInt32) {
-    LaunchKernel<int>(inputs, outputs);
+    LaunchKernel<int>(inputs, workspace, outputs);
   } else if (dtype_ == kNumberTypeFloat32) {
-    LaunchKernel<float>(inputs, outputs);
+    LaunchKernel<float>(inputs, workspace, outputs);
   } else if (dtype_ == kNumberTypeInt64) {
-    LaunchKernel<int64_t>(inputs, outputs);
+    LaunchKernel<int64_t>(inputs, workspace, outputs);
   }
   return true;
 }
 
 template <typename T>
-void UniqueCPUKernel::LaunchKernel(const std::vector<AddressPtr> &inputs, const std::vector<AddressPtr> &outputs) {
-  auto x_addr = reinterpret_cast<T *>(inputs[0]->addr);
-  auto y_addr = reinterpret_cast<T *>(outputs[0]->addr);
-  auto idx_addr = reinterpret_cast<int *>(outputs[1]->addr);
-
-  std::unordered_map<T, int> uniq;
-  int n = SizeToInt(n_);
-  uniq.reserve(n * 2);
-  for (int i = 0, j = 0; i < n; ++i) {
-    auto it = uniq.emplace(x_addr[i], j);
-    idx_addr[i] = it.first->second;
-    if (it.second) {
-      ++j;
-    }
-  }
-  for (const auto &it : uniq) {
-    y_addr[it.second] = it.first;
+void UniqueCPUKernel::LaunchKernel(const std::vector<AddressPtr> &inputs, const std::vector<AddressPtr> &workspace,
+                                   const std::vector<AddressPtr> &outputs) {
+  BucketUniqueParam<T, int> param;
+  param.input_ = reinterpret_cast<T *>(inputs[0]->addr);
+  param.input_size_ = n_;
+  param.output_ = reinterpret_cast<T *>(outputs[0]->addr);
+  param.inverse_ = reinterpret_cast<int *>(outputs[1]->addr);
+  if (!workspace.empty()) {
+    param.workspace_ = workspace[0]->addr;
+    param.workspace_size_ = workspace[0]->size;
   }
+  BucketUnique<T, int>(&param).Run();
 }
 
 void UniqueCPUKernel::CheckParam(const CNodePtr &kernel_node) {
@@ -15,6 +15,8 @@
  */
 
 #include "backend/kernel_compiler/cpu/unique_with_pad_cpu_kernel.h"
+#include <algorithm>
+#include "backend/kernel_compiler/cpu/bucket_unique.h"
 #include "runtime/device/cpu/cpu_device_address.h"
 
 namespace mindspore {
@@ -26,13 +28,18 @@ void UniqueWithPadCPUKernel::InitKernel(const CNodePtr &kernel_node) {
   dtype_ = AnfAlgo::GetPrevNodeOutputInferDataType(kernel_node, 0);
 }
 
+void UniqueWithPadCPUKernel::InitInputOutputSize(const CNodePtr &kernel_node) {
+  CPUKernel::InitInputOutputSize(kernel_node);
+  workspace_size_list_.emplace_back(BucketUniqueWorkspaceSize(LongToSize(n_)));
+}
+
 bool UniqueWithPadCPUKernel::Launch(const std::vector<kernel::AddressPtr> &inputs,
-                                    const std::vector<kernel::AddressPtr> & /*workspace*/,
+                                    const std::vector<kernel::AddressPtr> &workspace,
                                     const std::vector<kernel::AddressPtr> &outputs) {
   if (dtype_ == kNumberTypeInt32) {
-    LaunchKernel<int>(inputs, outputs);
+    LaunchKernel<int>(inputs, workspace, outputs);
   } else if (dtype_ == kNumberTypeInt64) {
-    LaunchKernel<int64_t>(inputs, outputs);
+    LaunchKernel<int64_t>(inputs, workspace, outputs);
   } else {
     MS_LOG(EXCEPTION) << "Only unsupported int32 or int64 dtype";
   }
@@ -41,27 +48,21 @@ bool UniqueWithPadCPUKernel::Launch(const std::vector<kernel::AddressPtr> &input
 
 template <typename T>
 void UniqueWithPadCPUKernel::LaunchKernel(const std::vector<AddressPtr> &inputs,
+                                          const std::vector<AddressPtr> &workspace,
                                           const std::vector<AddressPtr> &outputs) {
-  T *a = reinterpret_cast<T *>(inputs[0]->addr);
   T pad_num = *reinterpret_cast<T *>(inputs[1]->addr);
   T *out = reinterpret_cast<T *>(outputs[0]->addr);
-  T *idx_vec = reinterpret_cast<T *>(outputs[1]->addr);
-
-  for (int64_t i = 0; i < n_; ++i) {
-    out[i] = pad_num;
-  }
-  std::unordered_map<T, int> uniq;
-  uniq.reserve(n_);
-  for (int64_t i = 0, j = 0; i < n_; ++i) {
-    auto it = uniq.emplace(a[i], j);
-    idx_vec[i] = it.first->second;
-    if (it.second) {
-      ++j;
-    }
-  }
-  for (const auto &it : uniq) {
-    out[it.second] = it.first;
+  BucketUniqueParam<T, T> param;
+  param.input_ = reinterpret_cast<T *>(inputs[0]->addr);
+  param.input_size_ = LongToSize(n_);
+  param.output_ = out;
+  param.inverse_ = reinterpret_cast<T *>(outputs[1]->addr);
+  if (!workspace.empty()) {
+    param.workspace_ = workspace[0]->addr;
+    param.workspace_size_ = workspace[0]->size;
   }
+  BucketUnique<T, T>(&param).Run();
+  std::fill(out + param.output_size_, out + n_, pad_num);
 }
 
 void UniqueWithPadCPUKernel::CheckParam(const CNodePtr &kernel_node) {
@@ -0,0 +1,64 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "backend/optimizer/cpu/activation_fusion.h"
+
+#include <memory>
+#include <vector>
+#include <string>
+
+#include "backend/session/anf_runtime_algorithm.h"
+#include "ir/primitive.h"
+#include "utils/utils.h"
+#include "backend/optimizer/common/helper.h"
+#include "runtime/device/cpu/kernel_select_cpu.h"
+
+namespace mindspore {
+namespace opt {
+const BaseRef ActivationFusion::DefinePattern() const {
+  VectorRef op = VectorRef({prim_, inputs_});
+  VectorRef activation = VectorRef({activation_, op});
+  return activation;
+}
+
+const AnfNodePtr ActivationFusion::Process(const FuncGraphPtr &graph, const AnfNodePtr &node,
+                                           const EquivPtr &equiv) const {
+  MS_EXCEPTION_IF_NULL(graph);
+  MS_EXCEPTION_IF_NULL(node);
+  auto activation = node->cast<CNodePtr>();
+  MS_EXCEPTION_IF_NULL(activation);
+  auto op = AnfAlgo::GetInputNode(activation, 0);
+  MS_EXCEPTION_IF_NULL(op);
+  auto op_cnode = op->cast<CNodePtr>();
+  MS_EXCEPTION_IF_NULL(op_cnode);
+  // the input of the activation is kept when a backward kernel also reads it
+  if (AnfAlgo::HasNodeAttr(kAttrActivationType, op_cnode) || IsUsedByOthers(graph, op)) {
+    return nullptr;
+  }
+
+  auto prim = std::make_shared<Primitive>(fused_op_name_);
+  std::vector<AnfNodePtr> inputs = {NewValueNode(prim)};
+  (void)inputs.insert(inputs.end(), op_cnode->inputs().begin() + 1, op_cnode->inputs().end());
+  auto fused_node = graph->NewCNode(inputs);
+  MS_EXCEPTION_IF_NULL(fused_node);
+  fused_node->set_scope(node->scope());
+  fused_node->set_abstract(node->abstract());
+  AnfAlgo::CopyNodeAttrs(op, fused_node);
+  AnfAlgo::SetNodeAttr(kAttrActivationType, MakeValue(activation_->name()), fused_node);
+  device::cpu::SetKernelInfo(fused_node);
+  return fused_node;
+}
+}  // namespace opt
+}  // namespace mindspore
@@ -0,0 +1,48 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_BACKEND_OPTIMIZER_CPU_ACTIVATION_FUSION_H_
+#define MINDSPORE_CCSRC_BACKEND_OPTIMIZER_CPU_ACTIVATION_FUSION_H_
+
+#include <memory>
+#include <string>
+#include "backend/optimizer/common/optimizer.h"
+
+namespace mindspore {
+namespace opt {
+// activation(op(inputs)) -> fused_op(inputs), the activation runs as an eltwise post op of the mkldnn primitive.
+class ActivationFusion : public PatternProcessPass {
+ public:
+  ActivationFusion(const PrimitivePtr &prim, const PrimitivePtr &activation, const std::string &fused_op_name,
+                   bool multigraph = true)
+      : PatternProcessPass(prim->name() + "_" + activation->name() + "_fusion", multigraph),
+        prim_(prim),
+        activation_(activation),
+        fused_op_name_(fused_op_name) {
+    inputs_ = std::make_shared<SeqVar>();
+  }
+  ~ActivationFusion() override = default;
+  const BaseRef DefinePattern() const override;
+  const AnfNodePtr Process(const FuncGraphPtr &, const AnfNodePtr &, const EquivPtr &) const override;
+
+ private:
+  PrimitivePtr prim_;
+  PrimitivePtr activation_;
+  std::string fused_op_name_;
+  VarPtr inputs_;
+};
+}  // namespace opt
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_BACKEND_OPTIMIZER_CPU_ACTIVATION_FUSION_H_
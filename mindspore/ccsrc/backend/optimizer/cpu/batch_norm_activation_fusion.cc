@@ -0,0 +1,110 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "backend/optimizer/cpu/batch_norm_activation_fusion.h"
+
+#include <memory>
+#include <vector>
+#include <string>
+
+#include "backend/session/anf_runtime_algorithm.h"
+#include "ir/primitive.h"
+#include "utils/utils.h"
+#include "backend/optimizer/common/helper.h"
+#include "runtime/device/cpu/kernel_select_cpu.h"
+
+namespace mindspore {
+namespace opt {
+namespace {
+// the normalized output must be read by the activation only, mean and variance outputs may have any users
+bool IsOnlyReadByActivation(const FuncGraphPtr &graph, const AnfNodePtr &batch_norm, const AnfNodePtr &tuple_get) {
+  if (IsUsedByOthers(graph, tuple_get)) {
+    return false;
+  }
+  auto manager = graph->manager();
+  MS_EXCEPTION_IF_NULL(manager);
+  auto &node_users = manager->node_users();
+  auto iter = node_users.find(batch_norm);
+  if (iter == node_users.end()) {
+    return false;
+  }
+  for (const auto &node_user : iter->second) {
+    auto user = node_user.first;
+    if (user == tuple_get) {
+      continue;
+    }
+    if (!AnfAlgo::CheckPrimitiveType(user, prim::kPrimTupleGetItem)) {
+      return false;
+    }
+    auto user_cnode = user->cast<CNodePtr>();
+    MS_EXCEPTION_IF_NULL(user_cnode);
+    auto index_node = user_cnode->input(kInputNodeOutputIndexInTupleGetItem)->cast<ValueNodePtr>();
+    MS_EXCEPTION_IF_NULL(index_node);
+    if (GetValue<int>(index_node->value()) == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
+const BaseRef BatchNormActivationFusion::DefinePattern() const {
+  VectorRef batch_norm = VectorRef({prim_, x_, scale_, bias_, mean_, var_});
+  VectorRef tuple_get = VectorRef({prim::kPrimTupleGetItem, batch_norm, index_});
+  VectorRef relu = VectorRef({prim::kPrimRelu, tuple_get});
+  return relu;
+}
+
+const AnfNodePtr BatchNormActivationFusion::Process(const FuncGraphPtr &graph, const AnfNodePtr &node,
+                                                    const EquivPtr &equiv) const {
+  MS_EXCEPTION_IF_NULL(graph);
+  MS_EXCEPTION_IF_NULL(node);
+  auto tuple_get_item = AnfAlgo::GetInputNode(utils::cast<CNodePtr>(node), 0);
+  MS_EXCEPTION_IF_NULL(tuple_get_item);
+  auto index_node = utils::cast<CNodePtr>(tuple_get_item)->input(kInputNodeOutputIndexInTupleGetItem);
+  MS_EXCEPTION_IF_NULL(index_node);
+  auto index_value_node = index_node->cast<ValueNodePtr>();
+  if (index_value_node == nullptr || GetValue<int>(index_value_node->value()) != 0) {
+    return nullptr;
+  }
+  auto batch_norm = AnfAlgo::GetInputNode(utils::cast<CNodePtr>(tuple_get_item), 0);
+  MS_EXCEPTION_IF_NULL(batch_norm);
+  if (!IsOnlyReadByActivation(graph, batch_norm, tuple_get_item)) {
+    return nullptr;
+  }
+
+  auto batch_norm_cnode = batch_norm->cast<CNodePtr>();
+  MS_EXCEPTION_IF_NULL(batch_norm_cnode);
+  auto prim = std::make_shared<Primitive>(kFusedBatchNormWithActivationOpName);
+  std::vector<AnfNodePtr> inputs = {NewValueNode(prim)};
+  (void)inputs.insert(inputs.end(), batch_norm_cnode->inputs().begin() + 1, batch_norm_cnode->inputs().end());
+  auto fused_batch_norm_with_relu = graph->NewCNode(inputs);
+  MS_EXCEPTION_IF_NULL(fused_batch_norm_with_relu);
+  fused_batch_norm_with_relu->set_scope(batch_norm->scope());
+  fused_batch_norm_with_relu->set_abstract(batch_norm->abstract());
+  AnfAlgo::CopyNodeAttrs(batch_norm, fused_batch_norm_with_relu);
+  // only FusedBatchNorm computes batch statistics on cpu, BatchNorm always uses the moving ones
+  AnfAlgo::SetNodeAttr(kAttrIsTraining, MakeValue(prim_->name() == prim::kPrimFusedBatchNorm->name()),
+                       fused_batch_norm_with_relu);
+  AnfAlgo::SetNodeAttr(kAttrActivationType, MakeValue(prim::kPrimRelu->name()), fused_batch_norm_with_relu);
+
+  auto manager = graph->manager();
+  MS_EXCEPTION_IF_NULL(manager);
+  (void)manager->Replace(batch_norm, fused_batch_norm_with_relu);
+  device::cpu::SetKernelInfo(fused_batch_norm_with_relu);
+  return tuple_get_item;
+}
+}  // namespace opt
+}  // namespace mindspore
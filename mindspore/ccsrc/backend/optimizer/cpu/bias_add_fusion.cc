@@ -0,0 +1,81 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "backend/optimizer/cpu/bias_add_fusion.h"
+
+#include <memory>
+#include <vector>
+#include <string>
+
+#include "backend/session/anf_runtime_algorithm.h"
+#include "ir/primitive.h"
+#include "utils/utils.h"
+#include "backend/optimizer/common/helper.h"
+#include "runtime/device/cpu/kernel_select_cpu.h"
+
+namespace mindspore {
+namespace opt {
+namespace {
+// the fused mkldnn primitives add the bias along axis 1, the channel axis of NCHW
+bool IsChannelFirst(const CNodePtr &node) {
+  if (!AnfAlgo::HasNodeAttr(kAttrDataFormat, node)) {
+    return true;
+  }
+  return AnfAlgo::GetNodeAttr<std::string>(node, kAttrDataFormat) == kOpFormat_NCHW;
+}
+}  // namespace
+
+const BaseRef BiasAddFusion::DefinePattern() const {
+  VectorRef op = VectorRef({prim_, x_, w_});
+  VectorRef bias_add = VectorRef({std::make_shared<Primitive>(kBiasAddOpName), op, bias_});
+  return bias_add;
+}
+
+const AnfNodePtr BiasAddFusion::Process(const FuncGraphPtr &graph, const AnfNodePtr &node,
+                                        const EquivPtr &equiv) const {
+  MS_EXCEPTION_IF_NULL(graph);
+  MS_EXCEPTION_IF_NULL(node);
+  auto bias_add = node->cast<CNodePtr>();
+  MS_EXCEPTION_IF_NULL(bias_add);
+  auto op = AnfAlgo::GetInputNode(bias_add, 0);
+  MS_EXCEPTION_IF_NULL(op);
+  if (IsUsedByOthers(graph, op)) {
+    return nullptr;
+  }
+  auto op_cnode = op->cast<CNodePtr>();
+  MS_EXCEPTION_IF_NULL(op_cnode);
+  if (!IsChannelFirst(bias_add) || !IsChannelFirst(op_cnode)) {
+    return nullptr;
+  }
+  auto x = AnfAlgo::GetInputNode(op_cnode, 0);
+  auto w = AnfAlgo::GetInputNode(op_cnode, 1);
+  auto bias = AnfAlgo::GetInputNode(bias_add, 1);
+  MS_EXCEPTION_IF_NULL(x);
+  MS_EXCEPTION_IF_NULL(w);
+  MS_EXCEPTION_IF_NULL(bias);
+
+  auto prim = std::make_shared<Primitive>(fused_op_name_);
+  std::vector<AnfNodePtr> inputs = {NewValueNode(prim), x, w, bias};
+  auto fused_node = graph->NewCNode(inputs);
+  MS_EXCEPTION_IF_NULL(fused_node);
+  fused_node->set_scope(node->scope());
+  fused_node->set_abstract(node->abstract());
+  AnfAlgo::CopyNodeAttrs(op, fused_node);
+  AnfAlgo::SetNodeAttr(kAttrHasBias, MakeValue(true), fused_node);
+  device::cpu::SetKernelInfo(fused_node);
+  return fused_node;
+}
+}  // namespace opt
+}  // namespace mindspore
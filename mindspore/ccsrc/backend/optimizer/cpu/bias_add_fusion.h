@@ -0,0 +1,49 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_BACKEND_OPTIMIZER_CPU_BIAS_ADD_FUSION_H_
+#define MINDSPORE_CCSRC_BACKEND_OPTIMIZER_CPU_BIAS_ADD_FUSION_H_
+
+#include <memory>
+#include <string>
+#include "backend/optimizer/common/optimizer.h"
+
+namespace mindspore {
+namespace opt {
+// BiasAdd(op(x, w), b) -> fused_op(x, w, b), the bias is added by the mkldnn primitive of op.
+class BiasAddFusion : public PatternProcessPass {
+ public:
+  BiasAddFusion(const PrimitivePtr &prim, const std::string &fused_op_name, bool multigraph = true)
+      : PatternProcessPass(prim->name() + "_bias_add_fusion", multigraph),
+        prim_(prim),
+        fused_op_name_(fused_op_name) {
+    x_ = std::make_shared<Var>();
+    w_ = std::make_shared<Var>();
+    bias_ = std::make_shared<Var>();
+  }
+  ~BiasAddFusion() override = default;
+  const BaseRef DefinePattern() const override;
+  const AnfNodePtr Process(const FuncGraphPtr &, const AnfNodePtr &, const EquivPtr &) const override;
+
+ private:
+  PrimitivePtr prim_;
+  std::string fused_op_name_;
+  VarPtr x_;
+  VarPtr w_;
+  VarPtr bias_;
+};
+}  // namespace opt
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_BACKEND_OPTIMIZER_CPU_BIAS_ADD_FUSION_H_
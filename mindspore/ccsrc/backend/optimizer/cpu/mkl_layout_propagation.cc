@@ -0,0 +1,101 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "backend/optimizer/cpu/mkl_layout_propagation.h"
+#include <memory>
+#include <set>
+#include <vector>
+#include "backend/session/anf_runtime_algorithm.h"
+#include "backend/kernel_compiler/cpu/mkldnn/mkl_layout_info.h"
+#include "utils/utils.h"
+
+namespace mindspore {
+namespace opt {
+namespace {
+constexpr size_t kMKLDataInputIndex = 1;
+constexpr size_t kMKLDataOutputIndex = 0;
+
+bool IsLayoutAwareKernel(const AnfNodePtr &node) {
+  if (node == nullptr || !node->isa<CNode>() || !AnfAlgo::IsRealKernel(node)) {
+    return false;
+  }
+  return kernel::kMKLLayoutAwareOps.find(AnfAlgo::GetCNodeName(node)) != kernel::kMKLLayoutAwareOps.end();
+}
+
+bool IsTrainingKernel(const AnfNodePtr &node) {
+  if (node == nullptr || !node->isa<CNode>() || !AnfAlgo::IsRealKernel(node)) {
+    return false;
+  }
+  const std::string grad_suffix = "Grad";
+  auto name = AnfAlgo::GetCNodeName(node);
+  if (name.size() > grad_suffix.size() && name.compare(name.size() - grad_suffix.size(), grad_suffix.size(),
+                                                        grad_suffix) == 0) {
+    return true;
+  }
+  return kOptOperatorSet.find(name) != kOptOperatorSet.end();
+}
+}  // namespace
+
+bool MKLLayoutPropagation::Run(const FuncGraphPtr &graph) {
+  MS_EXCEPTION_IF_NULL(graph);
+  auto node_list = TopoSort(graph->get_return());
+  std::set<session::KernelWithIndex> mkl_read_outputs;
+  std::set<session::KernelWithIndex> plain_outputs;
+  bool inference = true;
+  for (const auto &node : node_list) {
+    if (node == nullptr || !node->isa<CNode>()) {
+      continue;
+    }
+    inference = inference && !IsTrainingKernel(node);
+    // the users of a tuple_getitem are visited through it
+    if (AnfAlgo::CheckPrimitiveType(node, prim::kPrimTupleGetItem)) {
+      continue;
+    }
+    auto cnode = node->cast<CNodePtr>();
+    bool layout_aware = IsLayoutAwareKernel(cnode);
+    for (size_t i = 1; i < cnode->inputs().size(); ++i) {
+      auto prev_output = AnfAlgo::VisitKernelWithReturnType(cnode->input(i), 0);
+      if (!IsLayoutAwareKernel(prev_output.first)) {
+        continue;
+      }
+      // depend, make_tuple, summary and the graph return all read the plain layout
+      if (layout_aware && i == kMKLDataInputIndex) {
+        (void)mkl_read_outputs.insert(prev_output);
+      } else {
+        (void)plain_outputs.insert(prev_output);
+      }
+    }
+  }
+
+  bool changed = false;
+  for (const auto &node : node_list) {
+    if (!IsLayoutAwareKernel(node)) {
+      continue;
+    }
+    auto layout_info = std::make_shared<kernel::MKLLayoutInfo>();
+    layout_info->inference = inference;
+    layout_info->blocked_outputs.resize(AnfAlgo::GetOutputTensorNum(node), false);
+    session::KernelWithIndex data_output(node, kMKLDataOutputIndex);
+    if (mkl_read_outputs.find(data_output) != mkl_read_outputs.end() &&
+        plain_outputs.find(data_output) == plain_outputs.end()) {
+      layout_info->blocked_outputs[kMKLDataOutputIndex] = true;
+      changed = true;
+    }
+    node->set_user_data<kernel::MKLLayoutInfo>(layout_info);
+  }
+  return changed;
+}
+}  // namespace opt
+}  // namespace mindspore
@@ -0,0 +1,38 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_BACKEND_OPTIMIZER_CPU_MKL_LAYOUT_PROPAGATION_H_
+#define MINDSPORE_CCSRC_BACKEND_OPTIMIZER_CPU_MKL_LAYOUT_PROPAGATION_H_
+#include <string>
+
+#include "backend/optimizer/common/pass.h"
+#include "ir/func_graph.h"
+#include "ir/anf.h"
+
+namespace mindspore {
+namespace opt {
+// Marks the outputs of layout aware mkldnn kernels that are read by layout aware mkldnn kernels only. Those
+// outputs keep the blocked layout chosen by the primitive, so consecutive mkldnn kernels run without reorders and
+// tensors are converted to the plain layout only where they leave the mkldnn subgraph. Must run before the kernels
+// are built.
+class MKLLayoutPropagation : public Pass {
+ public:
+  explicit MKLLayoutPropagation(const std::string &name = "mkl_layout_propagation") : Pass(name) {}
+  ~MKLLayoutPropagation() override = default;
+  bool Run(const FuncGraphPtr &graph) override;
+};
+}  // namespace opt
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_BACKEND_OPTIMIZER_CPU_MKL_LAYOUT_PROPAGATION_H_
@@ -26,6 +26,10 @@
 #include "backend/optimizer/common/optimizer.h"
 #include "backend/optimizer/common/pass_manager.h"
 #include "backend/optimizer/pass/replace_node_by_proxy.h"
+#include "backend/optimizer/cpu/mkl_layout_propagation.h"
+#include "backend/optimizer/cpu/bias_add_fusion.h"
+#include "backend/optimizer/cpu/activation_fusion.h"
+#include "backend/optimizer/cpu/batch_norm_activation_fusion.h"
 #if (ENABLE_CPU && (ENABLE_D || ENABLE_GPU))
 #include "ps/util.h"
 #endif
@@ -61,6 +65,33 @@ void CPUSession::Optimize(const std::shared_ptr<KernelGraph> &kernel_graph) {
   kernel_graph->SetExecOrderByDefault();
 }
 
+void CPUSession::HardwareOptimize(const std::shared_ptr<KernelGraph> &kernel_graph) {
+  MS_EXCEPTION_IF_NULL(kernel_graph);
+  auto fused_conv2d = std::make_shared<Primitive>(kFusedConv2DOpName);
+  auto fused_matmul = std::make_shared<Primitive>(kFusedMatMulOpName);
+  auto optimizer = std::make_shared<opt::GraphOptimizer>();
+  auto pm = std::make_shared<opt::PassManager>();
+  pm->AddPass(std::make_shared<opt::BiasAddFusion>(prim::kPrimConv2D, kFusedConv2DOpName));
+  pm->AddPass(std::make_shared<opt::BiasAddFusion>(prim::kPrimMatMul, kFusedMatMulOpName));
+  pm->AddPass(std::make_shared<opt::ActivationFusion>(prim::kPrimConv2D, prim::kPrimRelu, kFusedConv2DOpName));
+  pm->AddPass(std::make_shared<opt::ActivationFusion>(fused_conv2d, prim::kPrimRelu, kFusedConv2DOpName));
+  pm->AddPass(std::make_shared<opt::ActivationFusion>(fused_matmul, prim::kPrimRelu, kFusedMatMulOpName));
+  pm->AddPass(std::make_shared<opt::ActivationFusion>(fused_matmul, prim::kPrimGelu, kFusedMatMulOpName));
+  pm->AddPass(std::make_shared<opt::BatchNormActivationFusion>(prim::kPrimFusedBatchNorm));
+  pm->AddPass(std::make_shared<opt::BatchNormActivationFusion>(prim::kPrimBatchNorm));
+  optimizer->AddPassManager(pm);
+  (void)optimizer->Optimize(kernel_graph);
+  kernel_graph->SetExecOrderByDefault();
+}
+
+void CPUSession::PropagateMKLLayout(const std::shared_ptr<KernelGraph> &kernel_graph) {
+  auto optimizer = std::make_shared<opt::GraphOptimizer>();
+  auto pm = std::make_shared<opt::PassManager>();
+  pm->AddPass(std::make_shared<opt::MKLLayoutPropagation>());
+  optimizer->AddPassManager(pm);
+  (void)optimizer->Optimize(kernel_graph);
+}
+
 GraphId CPUSession::CompileGraph(const AnfNodePtrList &lst, const AnfNodePtrList &outputs) {
   auto graph_id = graph_sum_;
   auto graph = ConstructKernelGraph(lst, outputs);
@@ -73,8 +104,17 @@ GraphId CPUSession::CompileGraph(const AnfNodePtrList &lst, const AnfNodePtrList
     Optimize(graph);
   }
 #endif
+  MS_LOG(INFO) << "Fuse kernels";
+  HardwareOptimize(graph);
+  MS_LOG(INFO) << "Propagate mkl layout";
+  PropagateMKLLayout(graph);
   MS_LOG(INFO) << "Build kernel";
   BuildKernel(graph.get());
+  // memory is planned over the execution order used by RunGraph, summary tensors must outlive the graph
+  auto execution_order = graph->execution_order();
+  Reorder(&execution_order);
+  graph->set_execution_order(execution_order);
+  SetSummaryNodes(graph.get());
   MS_LOG(INFO) << "Assign kernel address";
   runtime_.AssignKernelAddress(graph.get());
   return graph_id;
@@ -107,7 +147,7 @@ void CPUSession::RunGraph(const GraphId &graph_id, const std::vector<tensor::Ten
   if (enable_summary) {
     SetSummaryNodes(kernel_graph.get());
     summary_outputs = kernel_graph->summary_nodes();
-    runtime_.IncreaseSummaryRefCount(summary_outputs);
+    runtime_.IncreaseSummaryRefCount(kernel_graph.get(), summary_outputs);
   }
 
   bool ret = runtime_.Run(kernel_graph.get(), false);
@@ -117,12 +157,61 @@ void CPUSession::RunGraph(const GraphId &graph_id, const std::vector<tensor::Ten
 
   if (enable_summary) {
     Summary(kernel_graph.get());
-    runtime_.DecreaseSummaryRefCount(summary_outputs);
+    runtime_.DecreaseSummaryRefCount(kernel_graph.get(), summary_outputs);
   }
 
   MS_LOG(INFO) << "Run graph end";
 }
 
+void CPUSession::BuildOp(const OpRunInfo &op_run_info, const GraphInfo &graph_info,
+                         const std::vector<tensor::TensorPtr> &input_tensors, const std::vector<int> &tensors_mask) {
+  // Check if the graph cache exists.
+  if (run_op_graphs_.find(graph_info) != run_op_graphs_.end()) {
+    return;
+  }
+  // Prepare the graph
+  auto kernel_graph = ConstructSingleOpGraph(op_run_info, input_tensors, tensors_mask);
+  MS_EXCEPTION_IF_NULL(kernel_graph);
+  SetKernelInfo(kernel_graph.get());
+  BuildKernel(kernel_graph.get());
+  runtime_.AssignKernelAddress(kernel_graph.get());
+  run_op_graphs_[graph_info] = kernel_graph;
+}
+
+namespace {
+void SyncOutputTensors(const VectorRef *outputs) {
+  MS_EXCEPTION_IF_NULL(outputs);
+  for (auto &item : *outputs) {
+    if (utils::isa<VectorRefPtr>(item)) {
+      auto vector_ref = utils::cast<VectorRef>(item);
+      SyncOutputTensors(&vector_ref);
+    } else if (utils::isa<tensor::TensorPtr>(item)) {
+      auto tensor = utils::cast<tensor::TensorPtr>(item);
+      MS_EXCEPTION_IF_NULL(tensor);
+      if (tensor->NeedSyncDeviceToHostImmediately()) {
+        tensor->data_sync();
+        tensor->set_device_address(nullptr);
+        tensor->set_sync_status(kNeedSyncHostToDevice);
+      }
+    }
+  }
+}
+}  // namespace
+
+void CPUSession::RunOp(const OpRunInfo &op_run_info, const GraphInfo &graph_info,
+                       const std::vector<tensor::TensorPtr> &input_tensors, VectorRef *outputs) {
+  auto kernel_graph = run_op_graphs_[graph_info];
+  MS_EXCEPTION_IF_NULL(kernel_graph);
+  runtime_.BindInputOutput(kernel_graph.get(), input_tensors, outputs);
+  bool ret = runtime_.Run(kernel_graph.get(), false);
+  if (!ret) {
+    MS_LOG(EXCEPTION) << "Run op " << op_run_info.op_name << " failed";
+  }
+  // the output tensors own their data once synced, the cached graph keeps no reference to them
+  SyncOutputTensors(outputs);
+  runtime_.RunOpClearMemory(kernel_graph.get());
+}
+
 void CPUSession::SetKernelInfo(const KernelGraph *kernel_graph) {
   MS_EXCEPTION_IF_NULL(kernel_graph);
   auto &kernel_nodes = kernel_graph->execution_order();
@@ -1962,8 +1962,9 @@ std::vector<std::shared_ptr<DatasetOp>> ShuffleDataset::Build() {
   // A vector containing shared pointer to the Dataset Ops that this object will create
   std::vector<std::shared_ptr<DatasetOp>> node_ops;
 
+  int32_t num_partitions = GlobalContext::config_manager()->shuffle_partitions();
   node_ops.push_back(std::make_shared<ShuffleOp>(shuffle_size_, shuffle_seed_, connector_que_size_, reset_every_epoch_,
-                                                 rows_per_buffer_));
+                                                 rows_per_buffer_, num_partitions));
   return node_ops;
 }
 
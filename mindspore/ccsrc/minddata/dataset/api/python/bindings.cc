@@ -53,17 +53,19 @@ PYBIND_REGISTER(
              return out;
            })
       .def("GetNextAsMap",
-           [](DEPipeline &de) {
+           [](DEPipeline &de, bool zero_copy) {
              py::dict out;
-             THROW_IF_ERROR(de.GetNextAsMap(&out));
+             THROW_IF_ERROR(de.GetNextAsMap(&out, zero_copy));
              return out;
-           })
+           },
+           py::arg("zero_copy") = true)
       .def("GetNextAsList",
-           [](DEPipeline &de) {
+           [](DEPipeline &de, bool zero_copy) {
              py::list out;
-             THROW_IF_ERROR(de.GetNextAsList(&out));
+             THROW_IF_ERROR(de.GetNextAsList(&out, zero_copy));
              return out;
-           })
+           },
+           py::arg("zero_copy") = true)
       .def("GetOutputShapes",
            [](DEPipeline &de) {
              py::list out;
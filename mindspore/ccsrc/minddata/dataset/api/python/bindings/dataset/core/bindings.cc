@@ -47,6 +47,24 @@ PYBIND_REGISTER(ConfigManager, 0, ([](const py::module *m) {
                     .def("get_monitor_sampling_interval", &ConfigManager::monitor_sampling_interval)
                     .def("get_callback_timeout", &ConfigManager::callback_timeout)
                     .def("set_callback_timeout", &ConfigManager::set_callback_timeout)
+                    .def("get_autotune_steps", &ConfigManager::autotune_steps)
+                    .def("set_autotune_steps", &ConfigManager::set_autotune_steps)
+                    .def("get_autotune_memory_budget", &ConfigManager::autotune_memory_budget)
+                    .def("set_autotune_memory_budget", &ConfigManager::set_autotune_memory_budget)
+                    .def("get_lock_free_connector", &ConfigManager::lock_free_connector)
+                    .def("set_lock_free_connector", &ConfigManager::set_lock_free_connector)
+                    .def("get_shuffle_partitions", &ConfigManager::shuffle_partitions)
+                    .def("set_shuffle_partitions", &ConfigManager::set_shuffle_partitions)
+                    .def("get_file_read_ahead", &ConfigManager::file_read_ahead)
+                    .def("set_file_read_ahead", &ConfigManager::set_file_read_ahead)
+                    .def("get_tfrecord_verify_crc", &ConfigManager::tfrecord_verify_crc)
+                    .def("set_tfrecord_verify_crc", &ConfigManager::set_tfrecord_verify_crc)
+                    .def("get_tensor_pool", &ConfigManager::tensor_pool)
+                    .def("set_tensor_pool", &ConfigManager::set_tensor_pool)
+                    .def("get_tensor_pool_thread_cache_size", &ConfigManager::tensor_pool_thread_cache_size)
+                    .def("set_tensor_pool_thread_cache_size", &ConfigManager::set_tensor_pool_thread_cache_size)
+                    .def("get_tensor_pool_central_cache_size", &ConfigManager::tensor_pool_central_cache_size)
+                    .def("set_tensor_pool_central_cache_size", &ConfigManager::set_tensor_pool_central_cache_size)
                     .def("load", [](ConfigManager &c, std::string s) { THROW_IF_ERROR(c.LoadFile(s)); });
                 }));
 
@@ -210,7 +210,7 @@ Status DEPipeline::GetColumnNames(py::list *output) {
   return Status::OK();
 }
 
-Status DEPipeline::GetNextAsMap(py::dict *output) {
+Status DEPipeline::GetNextAsMap(py::dict *output, bool zero_copy) {
   std::vector<std::pair<std::string, std::shared_ptr<Tensor>>> vec;
   Status s;
   {
@@ -221,12 +221,14 @@ Status DEPipeline::GetNextAsMap(py::dict *output) {
 
   // Generate Python dict, python dict maintains its insertion order
   for (const auto &pair : vec) {
-    (*output)[common::SafeCStr(pair.first)] = pair.second;
+    py::array data;
+    RETURN_IF_NOT_OK(zero_copy ? Tensor::GetDataAsNumpyNoCopy(pair.second, &data) : pair.second->GetDataAsNumpy(&data));
+    (*output)[common::SafeCStr(pair.first)] = data;
   }
   return Status::OK();
 }
 
-Status DEPipeline::GetNextAsList(py::list *output) {
+Status DEPipeline::GetNextAsList(py::list *output, bool zero_copy) {
   TensorRow row;
   Status s;
   {
@@ -235,8 +237,10 @@ Status DEPipeline::GetNextAsList(py::list *output) {
   }
   RETURN_IF_NOT_OK(s);
   // Generate Python list as return
-  for (auto el : row) {
-    output->append(el);
+  for (const auto &el : row) {
+    py::array data;
+    RETURN_IF_NOT_OK(zero_copy ? Tensor::GetDataAsNumpyNoCopy(el, &data) : el->GetDataAsNumpy(&data));
+    output->append(data);
   }
   return Status::OK();
 }
@@ -101,11 +101,11 @@ class DEPipeline {
   // Function to launch the tree execution.
   Status LaunchTreeExec();
 
-  // Get a row of data as dictionary of column name to the value.
-  Status GetNextAsMap(py::dict *output);
+  // Get a row of data as dictionary of column name to the numpy array, zero_copy shares the tensor buffers with numpy.
+  Status GetNextAsMap(py::dict *output, bool zero_copy = true);
 
-  // Get a row of data as list.
-  Status GetNextAsList(py::list *output);
+  // Get a row of data as list of numpy arrays, zero_copy shares the tensor buffers with numpy.
+  Status GetNextAsList(py::list *output, bool zero_copy = true);
 
   Status GetOutputShapes(py::list *output);
 
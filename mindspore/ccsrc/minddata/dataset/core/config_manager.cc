@@ -32,6 +32,15 @@ ConfigManager::ConfigManager()
       seed_(kCfgDefaultSeed),
       monitor_sampling_interval_(kCfgMonitorSamplingInterval),
       callback_timout_(kCfgCallbackTimeout),
+      autotune_steps_(kCfgAutotuneSteps),
+      autotune_memory_budget_(kCfgAutotuneMemoryBudget),
+      lock_free_connector_(kCfgLockFreeConnector),
+      shuffle_partitions_(kCfgShufflePartitions),
+      file_read_ahead_(kCfgFileReadAhead),
+      tfrecord_verify_crc_(kCfgTFRecordVerifyCrc),
+      tensor_pool_(kCfgTensorPool),
+      tensor_pool_thread_cache_size_(kCfgTensorPoolThreadCache),
+      tensor_pool_central_cache_size_(kCfgTensorPoolCentralCache),
       cache_host_(kCfgDefaultCacheHost),
       cache_port_(kCfgDefaultCachePort) {
   auto env_cache_host = std::getenv("MS_CACHE_HOST");
@@ -69,6 +78,15 @@ Status ConfigManager::FromJson(const nlohmann::json &j) {
   set_op_connector_size(j.value("opConnectorSize", op_connector_size_));
   set_seed(j.value("seed", seed_));
   set_monitor_sampling_interval(j.value("monitorSamplingInterval", monitor_sampling_interval_));
+  set_autotune_steps(j.value("autotuneSteps", autotune_steps_));
+  set_autotune_memory_budget(j.value("autotuneMemoryBudget", autotune_memory_budget_));
+  set_lock_free_connector(j.value("lockFreeConnector", lock_free_connector_));
+  set_shuffle_partitions(j.value("shufflePartitions", shuffle_partitions_));
+  set_file_read_ahead(j.value("fileReadAhead", file_read_ahead_));
+  set_tfrecord_verify_crc(j.value("tfrecordVerifyCrc", tfrecord_verify_crc_));
+  set_tensor_pool(j.value("tensorPool", tensor_pool_));
+  set_tensor_pool_thread_cache_size(j.value("tensorPoolThreadCacheSize", tensor_pool_thread_cache_size_));
+  set_tensor_pool_central_cache_size(j.value("tensorPoolCentralCacheSize", tensor_pool_central_cache_size_));
   set_cache_host(j.value("cacheHost", cache_host_));
   set_cache_port(j.value("cachePort", cache_port_));
   return Status::OK();
@@ -120,6 +138,24 @@ void ConfigManager::set_monitor_sampling_interval(uint32_t interval) { monitor_s
 
 void ConfigManager::set_callback_timeout(uint32_t timeout) { callback_timout_ = timeout; }
 
+void ConfigManager::set_autotune_steps(uint32_t steps) { autotune_steps_ = steps; }
+
+void ConfigManager::set_autotune_memory_budget(uint32_t budget) { autotune_memory_budget_ = budget; }
+
+void ConfigManager::set_lock_free_connector(bool lock_free) { lock_free_connector_ = lock_free; }
+
+void ConfigManager::set_shuffle_partitions(uint32_t partitions) { shuffle_partitions_ = partitions; }
+
+void ConfigManager::set_file_read_ahead(uint32_t num_files) { file_read_ahead_ = num_files; }
+
+void ConfigManager::set_tfrecord_verify_crc(bool verify_crc) { tfrecord_verify_crc_ = verify_crc; }
+
+void ConfigManager::set_tensor_pool(bool enable) { tensor_pool_ = enable; }
+
+void ConfigManager::set_tensor_pool_thread_cache_size(uint32_t size) { tensor_pool_thread_cache_size_ = size; }
+
+void ConfigManager::set_tensor_pool_central_cache_size(uint32_t size) { tensor_pool_central_cache_size_ = size; }
+
 void ConfigManager::set_cache_host(std::string cache_host) { cache_host_ = cache_host; }
 
 void ConfigManager::set_cache_port(int32_t cache_port) { cache_port_ = cache_port; }
@@ -143,6 +143,78 @@ class ConfigManager {
   // @return The timeout DSWaitedCallback would wait for before raising an error
   int32_t callback_timeout() const { return callback_timout_; }
 
+  // setter function
+  // @param steps - The number of steps to autotune the pipeline for, 0 to turn autotuning off
+  void set_autotune_steps(uint32_t steps);
+
+  // getter function
+  // @return The number of steps the workers and connector sizes of the pipeline are tuned for
+  uint32_t autotune_steps() const { return autotune_steps_; }
+
+  // setter function
+  // @param budget - The memory (in MB) the connectors of the pipeline may hold when autotuning
+  void set_autotune_memory_budget(uint32_t budget);
+
+  // getter function
+  // @return The memory (in MB) the connectors of the pipeline may hold when autotuning
+  uint32_t autotune_memory_budget() const { return autotune_memory_budget_; }
+
+  // setter function
+  // @param lock_free - Whether the connectors between the ops use lock free ring queues
+  void set_lock_free_connector(bool lock_free);
+
+  // getter function
+  // @return Whether the connectors between the ops use lock free ring queues
+  bool lock_free_connector() const { return lock_free_connector_; }
+
+  // setter function
+  // @param partitions - Number of partitions the shuffle buffer is split into, each shuffled by its own thread
+  void set_shuffle_partitions(uint32_t partitions);
+
+  // getter function
+  // @return Number of partitions the shuffle buffer is split into
+  uint32_t shuffle_partitions() const { return shuffle_partitions_; }
+
+  // setter function
+  // @param num_files - Number of image files the leaf ops read ahead of their workers, rows for MindRecordOp
+  void set_file_read_ahead(uint32_t num_files);
+
+  // getter function
+  // @return Number of image files the leaf ops read ahead of their workers, 0 if they don't
+  uint32_t file_read_ahead() const { return file_read_ahead_; }
+
+  // setter function
+  // @param verify_crc - Whether TFReaderOp checks the crc of the length and the data of each record it reads
+  void set_tfrecord_verify_crc(bool verify_crc);
+
+  // getter function
+  // @return Whether TFReaderOp checks the crc of the records it reads
+  bool tfrecord_verify_crc() const { return tfrecord_verify_crc_; }
+
+  // setter function
+  // @param enable - Whether the data of the new tensors comes from the size class pool or straight from the system
+  void set_tensor_pool(bool enable);
+
+  // getter function
+  // @return Whether the data of the new tensors comes from the size class pool
+  bool tensor_pool() const { return tensor_pool_; }
+
+  // setter function
+  // @param size - The free tensor data (in MB) each thread keeps before giving some to the central cache
+  void set_tensor_pool_thread_cache_size(uint32_t size);
+
+  // getter function
+  // @return The free tensor data (in MB) each thread keeps
+  uint32_t tensor_pool_thread_cache_size() const { return tensor_pool_thread_cache_size_; }
+
+  // setter function
+  // @param size - The free tensor data (in MB) the central cache keeps before freeing it to the system
+  void set_tensor_pool_central_cache_size(uint32_t size);
+
+  // getter function
+  // @return The free tensor data (in MB) the central cache keeps
+  uint32_t tensor_pool_central_cache_size() const { return tensor_pool_central_cache_size_; }
+
  private:
   int32_t rows_per_buffer_;
   int32_t num_parallel_workers_;
@@ -151,6 +223,15 @@ class ConfigManager {
   uint32_t seed_;
   uint32_t monitor_sampling_interval_;
   uint32_t callback_timout_;
+  uint32_t autotune_steps_;
+  uint32_t autotune_memory_budget_;
+  bool lock_free_connector_;
+  uint32_t shuffle_partitions_;
+  uint32_t file_read_ahead_;
+  bool tfrecord_verify_crc_;
+  bool tensor_pool_;
+  uint32_t tensor_pool_thread_cache_size_;
+  uint32_t tensor_pool_central_cache_size_;
   std::string cache_host_;
   int32_t cache_port_;
 
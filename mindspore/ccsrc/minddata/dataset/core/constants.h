@@ -68,7 +68,16 @@ constexpr uint32_t kCfgWorkerConnectorSize = 16;
 constexpr uint32_t kCfgOpConnectorSize = 16;
 constexpr uint32_t kCfgDefaultSeed = std::mt19937::default_seed;
 constexpr uint32_t kCfgMonitorSamplingInterval = 10;
-constexpr uint32_t kCfgCallbackTimeout = 60;  // timeout value for callback in seconds
+constexpr uint32_t kCfgCallbackTimeout = 60;          // timeout value for callback in seconds
+constexpr uint32_t kCfgAutotuneSteps = 0;             // 0 turns autotuning off
+constexpr uint32_t kCfgAutotuneMemoryBudget = 4096;   // MB of buffers the connectors may hold when autotuning
+constexpr bool kCfgLockFreeConnector = false;         // use the lock free ring queues in the connectors
+constexpr uint32_t kCfgShufflePartitions = 1;         // 1 keeps the single threaded shuffle
+constexpr uint32_t kCfgFileReadAhead = 0;             // 0 turns the read ahead of the image files off
+constexpr bool kCfgTFRecordVerifyCrc = false;         // check the crc of the records of the tfrecord files
+constexpr bool kCfgTensorPool = true;                 // the tensor data comes from the size class pool
+constexpr uint32_t kCfgTensorPoolThreadCache = 32;    // MB of free tensor data blocks each thread keeps
+constexpr uint32_t kCfgTensorPoolCentralCache = 512;  // MB of free tensor data blocks shared by the threads
 constexpr int32_t kCfgDefaultCachePort = 50052;
 constexpr char kCfgDefaultCacheHost[] = "127.0.0.1";
 
@@ -30,6 +30,11 @@ CVTensor::CVTensor(std::shared_ptr<Tensor> tensor) : Tensor(std::move(*tensor))
 
 Status CVTensor::CreateEmpty(const TensorShape &shape, DataType type, CVTensorPtr *out) {
   const CVTensorAlloc *alloc = GlobalContext::Instance()->cv_tensor_allocator();
+  TensorPtr slot;
+  if (TakeOutputSlot(shape, type, &slot)) {
+    *out = std::allocate_shared<CVTensor>(*alloc, slot);
+    return Status::OK();
+  }
   *out = std::allocate_shared<CVTensor>(*alloc, shape, type);
   int64_t byte_size = (*out)->SizeInBytes();
   // Don't allocate if we have a tensor with no elements.
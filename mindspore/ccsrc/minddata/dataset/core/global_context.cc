@@ -23,6 +23,7 @@
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/util/allocator.h"
 #include "minddata/dataset/util/circular_pool.h"
+#include "minddata/dataset/util/size_class_pool.h"
 #include "minddata/dataset/util/system_pool.h"
 
 namespace mindspore {
@@ -52,6 +53,9 @@ GlobalContext *GlobalContext::Instance() {
 Status GlobalContext::Init() {
   config_manager_ = std::make_shared<ConfigManager>();
   mem_pool_ = std::make_shared<SystemPool>();
+  tensor_data_pool_ = std::make_shared<SizeClassPool>(
+    static_cast<size_t>(config_manager_->tensor_pool_thread_cache_size()) << 20,
+    static_cast<size_t>(config_manager_->tensor_pool_central_cache_size()) << 20);
   // For testing we can use Dummy pool instead
 
   // Create some tensor allocators for the different types and hook them into the pool.
@@ -61,6 +65,15 @@ Status GlobalContext::Init() {
   return Status::OK();
 }
 
+std::shared_ptr<MemoryPool> GlobalContext::tensor_mem_pool() const {
+  if (!config_manager_->tensor_pool()) {
+    return mem_pool_;
+  }
+  tensor_data_pool_->SetCacheLimits(static_cast<size_t>(config_manager_->tensor_pool_thread_cache_size()) << 20,
+                                    static_cast<size_t>(config_manager_->tensor_pool_central_cache_size()) << 20);
+  return tensor_data_pool_;
+}
+
 // A print method typically used for debugging
 void GlobalContext::Print(std::ostream &out) const {
   out << "GlobalContext contains the following default config: " << *config_manager_ << "\n";
@@ -27,6 +27,7 @@ namespace mindspore {
 namespace dataset {
 // forward declare
 class MemoryPool;
+class SizeClassPool;
 class ConfigManager;
 class Tensor;
 class CVTensor;
@@ -74,6 +75,15 @@ class GlobalContext {
   // @return the mem pool
   std::shared_ptr<MemoryPool> mem_pool() const { return mem_pool_; }
 
+  // Getter method
+  // @return the pool of the tensor data
+  std::shared_ptr<SizeClassPool> tensor_data_pool() const { return tensor_data_pool_; }
+
+  // Pick the pool the data of a new tensor comes from. The settings of the config manager are read at each call,
+  // a tensor keeps the pool it got its data from.
+  // @return the tensor data pool with the cache limits of the config, or the mem pool if the config disables it
+  std::shared_ptr<MemoryPool> tensor_mem_pool() const;
+
   // Getter method
   // @return the tensor allocator as raw pointer
   const TensorAlloc *tensor_allocator() const { return tensor_allocator_.get(); }
@@ -97,6 +107,7 @@ class GlobalContext {
   static std::once_flag init_instance_flag_;
   static std::unique_ptr<GlobalContext> global_context_;  // The instance of the singleton (global)
   std::shared_ptr<MemoryPool> mem_pool_;                  // A global memory pool
+  std::shared_ptr<SizeClassPool> tensor_data_pool_;       // A global memory pool for the data of tensors
   std::shared_ptr<ConfigManager> config_manager_;         // The configs
   std::unique_ptr<TensorAlloc> tensor_allocator_;         // An allocator for Tensors
   std::unique_ptr<CVTensorAlloc> cv_tensor_allocator_;    // An allocator for CV Tensors
@@ -33,6 +33,7 @@
 namespace py = pybind11;
 #endif
 #include "minddata/dataset/core/tensor_shape.h"
+#include "minddata/dataset/util/size_class_pool.h"
 
 namespace mindspore {
 namespace dataset {
@@ -53,9 +54,11 @@ namespace dataset {
     break;                                                                                      \
   }
 
+thread_local TensorPtr Tensor::output_slot_ = nullptr;
+
 Tensor::Tensor(const TensorShape &shape, const DataType &type) : shape_(shape), type_(type), data_(nullptr) {
-  // grab the mem pool from global context and create the allocator for char data area
-  std::shared_ptr<MemoryPool> global_pool = GlobalContext::Instance()->mem_pool();
+  // grab the tensor data pool from global context and create the allocator for char data area
+  std::shared_ptr<MemoryPool> global_pool = GlobalContext::Instance()->tensor_mem_pool();
   data_allocator_ = std::make_unique<Allocator<unsigned char>>(global_pool);
 }
 
@@ -64,7 +67,8 @@ Tensor::Tensor(Tensor &&other) noexcept
       type_(other.type()),
       data_(other.GetMutableBuffer()),
       data_end_(other.data_end_),
-      data_allocator_(std::move(other.data_allocator_)) {
+      data_allocator_(std::move(other.data_allocator_)),
+      base_(std::move(other.base_)) {
   other.Invalidate();
 }
 
@@ -75,6 +79,7 @@ Tensor &Tensor::operator=(Tensor &&other) noexcept {
     data_ = other.GetMutableBuffer();
     data_end_ = other.data_end_;
     data_allocator_ = std::move(other.data_allocator_);
+    base_ = std::move(other.base_);
     other.Invalidate();
   }
   return *this;
@@ -82,6 +87,9 @@ Tensor &Tensor::operator=(Tensor &&other) noexcept {
 Status Tensor::CreateEmpty(const TensorShape &shape, const DataType &type, TensorPtr *out) {
   CHECK_FAIL_RETURN_UNEXPECTED(shape.known(), "Invalid shape.");
   CHECK_FAIL_RETURN_UNEXPECTED(type != DataType::DE_UNKNOWN, "Invalid data type.");
+  if (TakeOutputSlot(shape, type, out)) {
+    return Status::OK();
+  }
   const TensorAlloc *alloc = GlobalContext::Instance()->tensor_allocator();
   *out = std::allocate_shared<Tensor>(*alloc, shape, type);
   // if it's a string tensor and it has no elements, Just initialize the shape and type.
@@ -99,6 +107,52 @@ Status Tensor::CreateEmpty(const TensorShape &shape, const DataType &type, Tenso
 
   return Status::OK();
 }
+Status Tensor::CreateEmpty(const TensorShape &shape, const DataType &type, const std::shared_ptr<MemoryPool> &pool,
+                          TensorPtr *out) {
+  CHECK_FAIL_RETURN_UNEXPECTED(shape.known(), "Invalid shape.");
+  CHECK_FAIL_RETURN_UNEXPECTED(type.IsNumeric(), "Invalid data type, only numeric tensors can use a memory pool.");
+  RETURN_UNEXPECTED_IF_NULL(pool);
+  const TensorAlloc *alloc = GlobalContext::Instance()->tensor_allocator();
+  *out = std::allocate_shared<Tensor>(*alloc, shape, type);
+  (*out)->data_allocator_ = std::make_unique<Allocator<unsigned char>>(pool);
+  int64_t byte_size = (*out)->SizeInBytes();
+  if (byte_size != 0) {
+    RETURN_IF_NOT_OK((*out)->AllocateBuffer(byte_size));
+  }
+  return Status::OK();
+}
+
+Status Tensor::CreateView(const TensorPtr &base, const std::vector<dsize_t> &index, const TensorShape &shape,
+                          TensorPtr *out) {
+  RETURN_UNEXPECTED_IF_NULL(base);
+  CHECK_FAIL_RETURN_UNEXPECTED(base->type().IsNumeric(), "Invalid data type, only numeric tensors can have views.");
+  CHECK_FAIL_RETURN_UNEXPECTED(shape.known(), "Invalid shape.");
+  uchar *start = nullptr;
+  TensorShape remaining = TensorShape::CreateUnknownRankShape();
+  RETURN_IF_NOT_OK(base->StartAddrOfIndex(index, &start, &remaining));
+  dsize_t byte_size = shape.NumOfElements() * base->type().SizeInBytes();
+  CHECK_FAIL_RETURN_UNEXPECTED(start + byte_size <= base->data_end_,
+                               "Invalid shape, the view exceeds the base tensor.");
+  const TensorAlloc *alloc = GlobalContext::Instance()->tensor_allocator();
+  *out = std::allocate_shared<Tensor>(*alloc, shape, base->type());
+  (*out)->data_ = start;
+  (*out)->data_end_ = start + byte_size;
+  // a view of a view shares the memory of the first base
+  (*out)->base_ = base->base_ != nullptr ? base->base_ : base;
+  return Status::OK();
+}
+
+void Tensor::SetOutputSlot(TensorPtr slot) { output_slot_ = std::move(slot); }
+
+bool Tensor::TakeOutputSlot(const TensorShape &shape, const DataType &type, TensorPtr *out) {
+  if (output_slot_ == nullptr || output_slot_->shape() != shape || output_slot_->type() != type) {
+    return false;
+  }
+  *out = std::move(output_slot_);
+  output_slot_ = nullptr;
+  return true;
+}
+
 Status Tensor::CreateFromMemory(const TensorShape &shape, const DataType &type, const uchar *src, TensorPtr *out) {
   RETURN_IF_NOT_OK(CreateEmpty(shape, type, out));
   if (src != nullptr) {
@@ -170,7 +224,7 @@ Status Tensor::CreateFromNpArray(const py::array &arr, std::shared_ptr<Tensor> *
 
   if ((*out)->type_ == DataType::DE_UNKNOWN) RETURN_STATUS_UNEXPECTED("Invalid data type.");
 
-  std::shared_ptr<MemoryPool> global_pool = GlobalContext::Instance()->mem_pool();
+  std::shared_ptr<MemoryPool> global_pool = GlobalContext::Instance()->tensor_mem_pool();
   (*out)->data_allocator_ = std::make_unique<Allocator<unsigned char>>(global_pool);
   int64_t byte_size = (*out)->SizeInBytes();
   if (byte_size == 0) {
@@ -336,7 +390,11 @@ Status Tensor::CopyStridedArray(unsigned char *dst, unsigned char *src, std::vec
 // Name: Destructor
 // Description: Destructor
 Tensor::~Tensor() {
-  if (data_ != nullptr) {
+  if (base_ != nullptr) {
+    // a view does not own its memory, releasing base_ is enough
+    data_ = nullptr;
+    data_end_ = nullptr;
+  } else if (data_ != nullptr) {
     if (data_allocator_ != nullptr) {
       data_allocator_->deallocate(data_);
       data_ = nullptr;
@@ -468,6 +526,7 @@ void Tensor::Invalidate() {
   data_ = nullptr;
   data_end_ = nullptr;
   data_allocator_ = nullptr;
+  base_ = nullptr;
 }
 
 template <typename T>
@@ -688,6 +747,23 @@ Status Tensor::GetDataAsNumpy(py::array *data) {
   }
   return Status::OK();
 }
+
+Status Tensor::GetDataAsNumpyNoCopy(const std::shared_ptr<Tensor> &tensor, py::array *data) {
+  RETURN_UNEXPECTED_IF_NULL(tensor);
+  RETURN_UNEXPECTED_IF_NULL(data);
+  if (tensor->type() == DataType::DE_STRING) {
+    return tensor->GetDataAsNumpyStrings(data);
+  }
+  py::buffer_info info;
+  RETURN_IF_NOT_OK(GetBufferInfo(tensor.get(), &info));
+  auto owner = new std::shared_ptr<Tensor>(tensor);
+  py::capsule base(owner, [](void *ptr) { delete reinterpret_cast<std::shared_ptr<Tensor> *>(ptr); });
+  *data = py::array(py::dtype(info), info.shape, info.strides, info.ptr, base);
+  // The buffer may be shared with other rows of the pipeline, only a copy may be written
+  py::detail::array_proxy(data->ptr())->flags &= ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+  return Status::OK();
+}
+
 Status Tensor::GetDataAsNumpyStrings(py::array *data) {
   auto itr = begin<std::string_view>();
   uint64_t max = 0;
@@ -16,12 +16,15 @@
 #ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_CONNECTOR_H_
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_CONNECTOR_H_
 
+#include <atomic>
+#include <deque>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 #include "minddata/dataset/util/task_manager.h"
 #include "minddata/dataset/util/queue.h"
+#include "minddata/dataset/util/ring_queue.h"
 #include "minddata/dataset/util/services.h"
 #include "minddata/dataset/util/cond_var.h"
 
@@ -71,8 +74,13 @@ class Connector {
   // @param n_producers The number of threads producing data into this DbConnector.
   // @param n_consumers The number of thread consuming data from this DbConnector.
   // @param queue_capacity The number of element (DataBuffer) for each queue.
-  Connector(int32_t n_producers, int32_t n_consumers, int32_t queue_capacity)
-      : num_producers_(n_producers), num_consumers_(n_consumers) {
+  // @param lock_free Use lock free ring queues (see ring_queue.h) instead of the mutex based ones.
+  Connector(int32_t n_producers, int32_t n_consumers, int32_t queue_capacity, bool lock_free = false)
+      : num_producers_(n_producers),
+        num_consumers_(n_consumers),
+        lock_free_(lock_free),
+        pop_seq_(0),
+        active_producers_(n_producers) {
     MS_LOG(DEBUG) << "A connector is created with " << n_producers << " producers and " << n_consumers << " consumers.";
     my_name_ = Services::GetUniqueID();
     // We require the consumers to have ids sequentially from 0 to the num_consumers_-1,
@@ -84,7 +92,11 @@ class Connector {
 
     // Initialize the queues_ to have num_producers_ number of queues.
     // Each queue is a blocking queue and has the same queue_capacity.
-    queues_.Init(num_producers_, queue_capacity);
+    if (lock_free_) {
+      ring_queues_.Init(num_producers_, queue_capacity);
+    } else {
+      queues_.Init(num_producers_, queue_capacity);
+    }
   }
 
   // Destructor of Connector
@@ -100,8 +112,8 @@ class Connector {
       MS_ASSERT(worker_id < num_consumers_);
       std::unique_lock<std::mutex> lk(m_);
       RETURN_IF_NOT_OK(cv_.Wait(&lk, [this, worker_id]() { return expect_consumer_ == worker_id; }));
-      RETURN_IF_NOT_OK(queues_[pop_from_]->PopFront(result));
-      pop_from_ = (pop_from_ + 1) % num_producers_;
+      RETURN_IF_NOT_OK(PopFrom(pop_from_, result));
+      AdvancePopFrom();
       out_buffers_count_++;
       expect_consumer_ = (expect_consumer_ + 1) % num_consumers_;
     }
@@ -116,9 +128,8 @@ class Connector {
   // @param worker_id The id of a worker thread calling this method.
   // @param el A const lvalue element to be passed/added/pushed.
   Status Push(int32_t worker_id, const T &el) noexcept {
-    MS_ASSERT(worker_id < static_cast<int32_t>(queues_.size()));
-    MS_ASSERT(queues_[worker_id] != nullptr);
-    return (queues_[worker_id]->Add(el));
+    MS_ASSERT(worker_id < num_producers_);
+    return lock_free_ ? ring_queues_[worker_id]->Add(el) : queues_[worker_id]->Add(el);
   }
 
   auto out_buffers_count() const { return out_buffers_count_.load(); }
@@ -129,19 +140,29 @@ class Connector {
   // @param worker_id The id of a worker thread calling this method.
   // @param el An element to be passed/added/pushed.
   virtual Status Push(int32_t worker_id, T &&el) noexcept {
-    MS_ASSERT(worker_id < static_cast<int32_t>(queues_.size()));
-    MS_ASSERT(queues_[worker_id] != nullptr);
-    return (queues_[worker_id]->Add(std::forward<T>(el)));
+    MS_ASSERT(worker_id < num_producers_);
+    return lock_free_ ? ring_queues_[worker_id]->Add(std::forward<T>(el))
+                      : queues_[worker_id]->Add(std::forward<T>(el));
   }
 
   // Resets the internal index tracking of the queue so that it can be used again with new inputs,
   // starting from the beginning.
   void Reset() {
-    for (int i = 0; i < queues_.size(); ++i) {
-      queues_[i]->ResetQue();
+    for (int i = 0; i < num_producers_; ++i) {
+      if (lock_free_) {
+        ring_queues_[i]->ResetQue();
+      } else {
+        queues_[i]->ResetQue();
+      }
     }
     expect_consumer_ = 0;
     pop_from_ = 0;
+    pop_seq_ = 0;
+    active_producers_ = num_producers_;
+    {
+      std::lock_guard<std::mutex> lk(schedule_mux_);
+      schedule_.clear();
+    }
     out_buffers_count_ = 0;
     MS_LOG(DEBUG) << "Connector counters reset.";
   }
@@ -160,25 +181,48 @@ class Connector {
   // Get current size of connector.
   int32_t size() const {
     int32_t size = 0;
-    for (int32_t i = 0; i < queues_.size(); ++i) {
-      size += queues_[i]->size();
+    for (int32_t i = 0; i < num_producers_; ++i) {
+      size += lock_free_ ? ring_queues_[i]->size() : queues_[i]->size();
     }
     return size;
   }
 
+  // Get the capacity of the queues of the producers in use.
   int32_t capacity() const {
     int32_t capacity = 0;
-    for (int32_t i = 0; i < queues_.size(); ++i) {
-      capacity += queues_[i]->capacity();
+    int32_t active = active_producers_;
+    for (int32_t i = 0; i < active; ++i) {
+      capacity += lock_free_ ? ring_queues_[i]->capacity() : queues_[i]->capacity();
     }
     return capacity;
   }
 
+  // Change the capacity of each internal queue while the connector is in use.
+  // @param queue_capacity The number of element for each queue.
+  // @return Status The error code return
+  Status SetQueueCapacity(int32_t queue_capacity) {
+    for (int32_t i = 0; i < num_producers_; ++i) {
+      RETURN_IF_NOT_OK(lock_free_ ? ring_queues_[i]->Resize(queue_capacity) : queues_[i]->Resize(queue_capacity));
+    }
+    return Status::OK();
+  }
+
+  // Change the number of producers taking part in the round robin, so that a multi-threaded producer can grow or
+  // shrink the number of its threads in use without breaking the order. The producers must do the switch at the
+  // start of a round (the element at seq goes to producer 0) and call this before pushing the element at seq.
+  // @param seq The number of elements pushed before the switch, counted from the creation of the connector.
+  // @param n_producers The number of producers in use from the element at seq on, at most the number of producers.
+  void ScheduleActiveProducers(int64_t seq, int32_t n_producers) {
+    MS_ASSERT(n_producers > 0 && n_producers <= num_producers_);
+    std::lock_guard<std::mutex> lk(schedule_mux_);
+    schedule_.emplace_back(seq, n_producers);
+  }
+
   // Register the internal resources with Task group for interruption service.
   // @param vg
   // @return
   Status Register(TaskGroup *vg) {
-    Status rc = queues_.Register(vg);
+    Status rc = lock_free_ ? ring_queues_.Register(vg) : queues_.Register(vg);
     if (rc.IsOk()) {
       rc = cv_.Register(vg->GetIntrpService());
     }
@@ -186,10 +230,31 @@ class Connector {
   }
 
  protected:
+  // Pop an element from the queue of a producer, blocking while it is empty.
+  // @param producer_id The id of the producer.
+  // @param result The address of an object where the popped element will be placed.
+  Status PopFrom(int32_t producer_id, T *result) {
+    return lock_free_ ? ring_queues_[producer_id]->PopFront(result) : queues_[producer_id]->PopFront(result);
+  }
+
+  // Move pop_from_ to the queue of the next element, called under m_ after an element is popped.
+  void AdvancePopFrom() {
+    {
+      std::lock_guard<std::mutex> lk(schedule_mux_);
+      while (!schedule_.empty() && schedule_.front().first <= pop_seq_) {
+        active_producers_ = schedule_.front().second;
+        schedule_.pop_front();
+      }
+    }
+    pop_seq_++;
+    pop_from_ = (pop_from_ + 1) % active_producers_;
+  }
+
   std::string my_name_;
 
-  // A list of Queues that are thread safe.
+  // A list of Queues that are thread safe, only one of the two lists is used.
   QueueList<T> queues_;
+  QueueList<T, RingQueue<T>> ring_queues_;
 
   // The consumer that we allow to get the next data from pop()
   int32_t expect_consumer_;
@@ -199,6 +264,15 @@ class Connector {
 
   int32_t num_producers_;
   int32_t num_consumers_;
+  bool lock_free_;
+
+  // The number of elements popped so far, and the number of producers the round robin goes through.
+  int64_t pop_seq_;
+  std::atomic<int32_t> active_producers_;
+
+  // Pending changes of active_producers_, as (seq, number of producers) pairs in the order of seq.
+  std::mutex schedule_mux_;
+  std::deque<std::pair<int64_t, int32_t>> schedule_;
 
   // Used in the Pop(), when a thread call pop() but it is not the expect_consumer_.
   std::mutex m_;
@@ -0,0 +1,142 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/datasetops/batch_buffer_pool.h"
+#include <cstdlib>
+#include <limits>
+#include "./securec.h"
+
+namespace mindspore {
+namespace dataset {
+BatchBufferPool::BatchBufferPool(int32_t max_free_blocks) : max_free_blocks_(max_free_blocks), num_reused_(0) {}
+
+BatchBufferPool::~BatchBufferPool() {
+  for (auto &block : free_blocks_) {
+    free(block.second);
+  }
+}
+
+Status BatchBufferPool::Allocate(size_t n, void **p) {
+  RETURN_UNEXPECTED_IF_NULL(p);
+  {
+    std::lock_guard<std::mutex> lck(mux_);
+    auto it = free_blocks_.find(n);
+    if (it != free_blocks_.end()) {
+      *p = it->second;
+      free_blocks_.erase(it);
+      block_size_[*p] = n;
+      num_reused_++;
+      return Status::OK();
+    }
+  }
+  RETURN_IF_NOT_OK(DeMalloc(n, p, false));
+  std::lock_guard<std::mutex> lck(mux_);
+  block_size_[*p] = n;
+  return Status::OK();
+}
+
+Status BatchBufferPool::Reallocate(void **p, size_t old_sz, size_t new_sz) {
+  RETURN_UNEXPECTED_IF_NULL(p);
+  if (old_sz >= new_sz) {
+    return Status::OK();
+  }
+  void *q = nullptr;
+  RETURN_IF_NOT_OK(Allocate(new_sz, &q));
+  int ret_code = memcpy_s(q, new_sz, *p, old_sz);
+  if (ret_code != 0) {
+    Deallocate(q);
+    RETURN_STATUS_UNEXPECTED("Failed to copy data into the reallocated block.");
+  }
+  Deallocate(*p);
+  *p = q;
+  return Status::OK();
+}
+
+void BatchBufferPool::Deallocate(void *p) {
+  if (p == nullptr) {
+    return;
+  }
+  std::unique_lock<std::mutex> lck(mux_);
+  auto it = block_size_.find(p);
+  if (it != block_size_.end()) {
+    size_t size = it->second;
+    block_size_.erase(it);
+    if (free_blocks_.size() < static_cast<size_t>(max_free_blocks_)) {
+      free_blocks_.emplace(size, p);
+      return;
+    }
+  }
+  lck.unlock();
+  free(p);
+}
+
+uint64_t BatchBufferPool::get_max_size() const { return std::numeric_limits<uint64_t>::max(); }
+
+int BatchBufferPool::PercentFree() const { return 100; }
+
+int64_t BatchBufferPool::num_reused() const {
+  std::lock_guard<std::mutex> lck(mux_);
+  return num_reused_;
+}
+
+BatchSlots::BatchSlots(int32_t batch_size, std::shared_ptr<MemoryPool> pool)
+    : batch_size_(batch_size),
+      pool_(std::move(pool)),
+      variable_shape_(false),
+      row_shape_(TensorShape::CreateUnknownRankShape()),
+      row_type_(DataType::DE_UNKNOWN) {}
+
+void BatchSlots::Observe(const TensorPtr &tensor) {
+  std::lock_guard<std::mutex> lck(mux_);
+  if (variable_shape_ || tensor == nullptr) {
+    return;
+  }
+  if (row_type_ == DataType::DE_UNKNOWN) {
+    if (tensor->type().IsNumeric() && tensor->shape().known()) {
+      row_shape_ = tensor->shape();
+      row_type_ = tensor->type();
+    } else {
+      variable_shape_ = true;
+    }
+  } else if (tensor->shape() != row_shape_ || tensor->type() != row_type_) {
+    // rows of different shapes can't share a batch tensor, stop handing out slots
+    variable_shape_ = true;
+    batches_.clear();
+  }
+}
+
+Status BatchSlots::GetSlot(int64_t repeat, int64_t row_id, TensorPtr *out) {
+  RETURN_UNEXPECTED_IF_NULL(out);
+  *out = nullptr;
+  std::lock_guard<std::mutex> lck(mux_);
+  if (variable_shape_ || row_type_ == DataType::DE_UNKNOWN) {
+    return Status::OK();
+  }
+  auto key = std::make_pair(repeat, row_id / batch_size_);
+  auto it = batches_.find(key);
+  if (it == batches_.end()) {
+    TensorPtr batch;
+    RETURN_IF_NOT_OK(Tensor::CreateEmpty(row_shape_.PrependDim(batch_size_), row_type_, pool_, &batch));
+    it = batches_.emplace(key, std::move(batch)).first;
+  }
+  return Tensor::CreateView(it->second, {row_id % batch_size_}, row_shape_, out);
+}
+
+void BatchSlots::Release(int64_t repeat, int64_t batch_id) {
+  std::lock_guard<std::mutex> lck(mux_);
+  (void)batches_.erase(std::make_pair(repeat, batch_id));
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,105 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_BATCH_BUFFER_POOL_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_BATCH_BUFFER_POOL_H_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/util/memory_pool.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+// Memory pool for the batch tensors of a BatchOp. Every step allocates a batch of the same size, so the blocks freed
+// by the consumer are kept and handed to the next batches instead of going back to the system.
+class BatchBufferPool : public MemoryPool {
+ public:
+  // Constructor
+  // @param max_free_blocks - number of freed blocks kept for reuse, roughly the number of batches in flight
+  explicit BatchBufferPool(int32_t max_free_blocks);
+
+  // Destructor, frees the blocks kept for reuse
+  ~BatchBufferPool() override;
+
+  Status Allocate(size_t n, void **p) override;
+
+  Status Reallocate(void **p, size_t old_sz, size_t new_sz) override;
+
+  void Deallocate(void *p) override;
+
+  uint64_t get_max_size() const override;
+
+  int PercentFree() const override;
+
+  // @return number of allocations served by a reused block
+  int64_t num_reused() const;
+
+ private:
+  int32_t max_free_blocks_;
+  mutable std::mutex mux_;
+  std::unordered_map<void *, size_t> block_size_;  // size of every block handed out
+  std::multimap<size_t, void *> free_blocks_;      // blocks kept for reuse, by size
+  int64_t num_reused_;
+};
+
+// Batch tensors prepared by a BatchOp for the MapOp right below it. The map workers write the output of a row
+// straight into its slot of the batch tensor, so that BatchOp::BatchRows hands the batch tensor over without copying
+// the rows. A row is identified by its position since the last eoe, the same way BatchOp counts its batches.
+class BatchSlots {
+ public:
+  // Constructor
+  // @param batch_size - number of rows in a batch
+  // @param pool - memory pool of the batch tensors
+  BatchSlots(int32_t batch_size, std::shared_ptr<MemoryPool> pool);
+
+  // Destructor
+  ~BatchSlots() = default;
+
+  // Learn the shape and type of the column from a row produced by the map. Slots are only handed out while every row
+  // seen so far has the same shape and type.
+  // @param tensor - the column of a row
+  void Observe(const TensorPtr &tensor);
+
+  // Get the slot of a row
+  // @param repeat - number of eoe seen before the row
+  // @param row_id - position of the row since the last eoe
+  // @param out - the slot, nullptr if the shape of the rows is not known
+  // @return Status - The error code return
+  Status GetSlot(int64_t repeat, int64_t row_id, TensorPtr *out);
+
+  // Forget the batch tensor of a batch once it is assembled or dropped
+  // @param repeat - number of eoe seen before the batch
+  // @param batch_id - position of the batch since the last eoe
+  void Release(int64_t repeat, int64_t batch_id);
+
+ private:
+  int32_t batch_size_;
+  std::shared_ptr<MemoryPool> pool_;
+  std::mutex mux_;
+  bool variable_shape_;
+  TensorShape row_shape_;
+  DataType row_type_;
+  std::map<std::pair<int64_t, int64_t>, TensorPtr> batches_;  // (repeat, batch id) -> batch tensor
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_BATCH_BUFFER_POOL_H_
@@ -24,11 +24,38 @@
 #endif
 #include "minddata/dataset/engine/data_buffer.h"
 #include "minddata/dataset/engine/db_connector.h"
+#include "minddata/dataset/engine/datasetops/map_op/map_op.h"
 #include "minddata/dataset/engine/opt/pass.h"
 #include "minddata/dataset/kernels/data/data_utils.h"
 
 namespace mindspore {
 namespace dataset {
+namespace {
+// Get the batch tensor whose consecutive slots hold column col of all the rows, nullptr if a row is not in its slot
+Status BatchFromSlots(const TensorQTable &rows, size_t col, dsize_t batch_size, TensorPtr *out) {
+  *out = nullptr;
+  const TensorPtr &first = rows.front().at(col);
+  TensorPtr base = first->base();
+  if (base == nullptr || base->Rank() != first->Rank() + 1 || base->shape()[0] < batch_size ||
+      base->type() != first->type() || base->shape() != first->shape().PrependDim(base->shape()[0])) {
+    return Status::OK();
+  }
+  dsize_t row_bytes = first->SizeInBytes();
+  for (dsize_t j = 0; j < batch_size; j++) {
+    const TensorPtr &tensor = rows.at(j).at(col);
+    if (tensor->base() != base || tensor->shape() != first->shape() ||
+        tensor->GetBuffer() != base->GetBuffer() + j * row_bytes) {
+      return Status::OK();
+    }
+  }
+  if (base->shape()[0] == batch_size) {
+    *out = base;
+    return Status::OK();
+  }
+  return Tensor::CreateView(base, {0}, first->shape().PrependDim(batch_size), out);
+}
+}  // namespace
+
 BatchOp::Builder::Builder(int32_t batch_size) : builder_drop_(false), builder_pad_(false), builder_pad_map_({}) {
   builder_batch_size_ = batch_size;
   std::shared_ptr<ConfigManager> cfg = GlobalContext::config_manager();
@@ -74,9 +101,8 @@ BatchOp::BatchOp(int32_t batch_size, bool drop, bool pad, int32_t op_queue_size,
       pyfunc_column_names_(cols_to_map),
       batch_size_func_(batch_size_func),
       batch_map_func_(batch_map_func),
-      pad_info_(pad_map) {
-  worker_queues_.Init(num_workers, op_queue_size);
-}
+      pad_info_(pad_map),
+      buffer_pool_(std::make_shared<BatchBufferPool>(num_workers + op_queue_size)) {}
 #else
 BatchOp::BatchOp(int32_t batch_size, bool drop, bool pad, int32_t op_queue_size, int32_t num_workers,
                  const std::vector<std::string> &cols_to_map, PadInfo pad_map)
@@ -85,9 +111,8 @@ BatchOp::BatchOp(int32_t batch_size, bool drop, bool pad, int32_t op_queue_size,
       drop_(drop),
       pad_(pad),
       pyfunc_column_names_(cols_to_map),
-      pad_info_(pad_map) {
-  worker_queues_.Init(num_workers, op_queue_size);
-}
+      pad_info_(pad_map),
+      buffer_pool_(std::make_shared<BatchBufferPool>(num_workers + op_queue_size)) {}
 #endif
 
 Status BatchOp::operator()() {
@@ -107,7 +132,7 @@ Status BatchOp::operator()() {
       table->emplace_back(new_row);
       // if # of rows is enough to make 1 batch (1 batch is buffer), send it to worker_queue
       if (table->size() == static_cast<size_t>(cur_batch_size)) {
-        RETURN_IF_NOT_OK(worker_queues_[cnt % num_workers_]->EmplaceBack(
+        RETURN_IF_NOT_OK(worker_queues_[NextWorker(cnt)]->EmplaceBack(
           std::make_pair(std::move(table), CBatchInfo(epoch_num, batch_num++, cnt + 1 - epoch_num))));
         cnt++;
         table = std::make_unique<TensorQTable>();
@@ -116,22 +141,27 @@ Status BatchOp::operator()() {
       RETURN_IF_NOT_OK(child_iterator_->FetchNextTensorRow(&new_row));
     }
     // Reminder logic, execute only when there is a remainder (table is non empty) and don't drop
-    if (drop_ == false && table->empty() == false) {
-      RETURN_IF_NOT_OK(worker_queues_[cnt % num_workers_]->EmplaceBack(
+    bool has_remainder = !table->empty();
+    if (drop_ == false && has_remainder) {
+      RETURN_IF_NOT_OK(worker_queues_[NextWorker(cnt)]->EmplaceBack(
         std::make_pair(std::move(table), CBatchInfo(epoch_num, batch_num++, cnt + 1 - epoch_num))));
       cnt++;
     }
+    // a dropped remainder never reaches a worker, release the batch tensor its rows were written into here
+    if (drop_ && has_remainder && batch_slots_ != nullptr) {
+      batch_slots_->Release(epoch_num, batch_num);
+    }
     table = std::make_unique<TensorQTable>();  // this drops when drop == true
     // end of the current epoch, batch_num should start from 0 again
     batch_num = 0;
     epoch_num++;
     RETURN_IF_NOT_OK(
-      worker_queues_[cnt++ % num_workers_]->EmplaceBack(std::make_pair(nullptr, CBatchInfo(batchCtrl::kEOE))));
+      worker_queues_[NextWorker(cnt++)]->EmplaceBack(std::make_pair(nullptr, CBatchInfo(batchCtrl::kEOE))));
     RETURN_IF_NOT_OK(GetBatchSize(&cur_batch_size, CBatchInfo(epoch_num, batch_num, cnt - epoch_num)));
     RETURN_IF_NOT_OK(child_iterator_->FetchNextTensorRow(&new_row));
   }  // end of eof_handled() == false
   RETURN_IF_NOT_OK(
-    worker_queues_[cnt++ % num_workers_]->EmplaceBack(std::make_pair(nullptr, CBatchInfo(batchCtrl::kEOF))));
+    worker_queues_[NextWorker(cnt++)]->EmplaceBack(std::make_pair(nullptr, CBatchInfo(batchCtrl::kEOF))));
   // EOF received, send quit signal (an empty buffer) to all workers
   for (int32_t ind = 0; ind < num_workers_; ind++) {
     RETURN_IF_NOT_OK(
@@ -155,7 +185,7 @@ void BatchOp::Print(std::ostream &out, bool show_all) const {
 }
 
 Status BatchOp::BatchRows(const std::unique_ptr<TensorQTable> *src, const std::unique_ptr<TensorQTable> *dest,
-                          dsize_t batch_size) {
+                          dsize_t batch_size, const std::shared_ptr<MemoryPool> &pool) {
   if ((*src)->size() != batch_size) {
     RETURN_STATUS_UNEXPECTED("[Internal Batch ERROR] Source table size does not match the batch_size");
   }
@@ -180,7 +210,15 @@ Status BatchOp::BatchRows(const std::unique_ptr<TensorQTable> *src, const std::u
 
     std::shared_ptr<Tensor> new_tensor;
     if (first_type.IsNumeric()) {  // numeric tensor
-      RETURN_IF_NOT_OK(Tensor::CreateEmpty(new_shape, first_type, &new_tensor));
+      // rows written into the consecutive slots of one batch tensor are handed over without a copy
+      RETURN_IF_NOT_OK(BatchFromSlots(**src, i, batch_size, &new_tensor));
+    }
+    if (first_type.IsNumeric() && new_tensor == nullptr) {
+      if (pool != nullptr) {
+        RETURN_IF_NOT_OK(Tensor::CreateEmpty(new_shape, first_type, pool, &new_tensor));
+      } else {
+        RETURN_IF_NOT_OK(Tensor::CreateEmpty(new_shape, first_type, &new_tensor));
+      }
       dsize_t j = 0;
       for (auto row : **src) {
         std::shared_ptr<Tensor> old_tensor = row.at(i);  // row j, column i
@@ -195,7 +233,7 @@ Status BatchOp::BatchRows(const std::unique_ptr<TensorQTable> *src, const std::u
             std::to_string(i));
         }
       }
-    } else {  // handle string column differently
+    } else if (!first_type.IsNumeric()) {  // handle string column differently
       std::vector<std::string> strings;
       for (dsize_t j = 0; j < batch_size; j++) {
         std::shared_ptr<Tensor> old_tensor = (*src)->at(j).at(i);
@@ -238,10 +276,15 @@ Status BatchOp::MakeBatchedBuffer(std::pair<std::unique_ptr<TensorQTable>, CBatc
 #ifdef ENABLE_PYTHON
   if (!pyfunc_column_names_.empty()) RETURN_IF_NOT_OK(MapColumns(&table_pair));  // pass it through pyfunc
 #endif
-  if (pad_) RETURN_IF_NOT_OK(PadColumns(&table_pair.first, pad_info_, column_name_id_map_));  // do padding if needed
+  if (pad_) {  // do padding if needed
+    RETURN_IF_NOT_OK(PadColumns(&table_pair.first, pad_info_, column_name_id_map_, buffer_pool_));
+  }
   (*db) = std::make_unique<DataBuffer>(table_pair.second.batch_num_, DataBuffer::kDeBFlagNone);
   std::unique_ptr<TensorQTable> dest_table = std::make_unique<TensorQTable>();
-  RETURN_IF_NOT_OK(BatchRows(&table_pair.first, &dest_table, table_pair.first->size()));
+  RETURN_IF_NOT_OK(BatchRows(&table_pair.first, &dest_table, table_pair.first->size(), buffer_pool_));
+  if (batch_slots_ != nullptr) {
+    batch_slots_->Release(table_pair.second.epoch_num_, table_pair.second.batch_num_);
+  }
   (*db)->set_tensor_table(std::move(dest_table));
   return Status::OK();
 }
@@ -250,11 +293,26 @@ Status BatchOp::LaunchThreadsAndInitOp() {
   if (tree_ == nullptr) {
     return Status(StatusCode::kUnexpectedError, __LINE__, __FILE__, "Pipeline init failed, Execution tree not set.");
   }
+  worker_queues_.Init(num_workers_, oc_queue_size_);
   RETURN_IF_NOT_OK(worker_queues_.Register(tree_->AllTasks()));
   RETURN_IF_NOT_OK(tree_->LaunchWorkers(num_workers_, std::bind(&BatchOp::WorkerEntry, this, std::placeholders::_1)));
   return Status::OK();
 }
 
+Status BatchOp::PrepareNodePostAction() {
+  RETURN_IF_NOT_OK(ParallelOp::PrepareNodePostAction());
+  // Slots need every batch but the last to have start_batch_size_ rows, left untouched by batch itself
+  bool fixed_rows = !pad_ && pyfunc_column_names_.empty() && start_batch_size_ > 1;
+#ifdef ENABLE_PYTHON
+  fixed_rows = fixed_rows && !batch_size_func_;
+#endif
+  std::shared_ptr<MapOp> map_op = child_.empty() ? nullptr : std::dynamic_pointer_cast<MapOp>(child_[0]);
+  if (fixed_rows && map_op != nullptr) {
+    RETURN_IF_NOT_OK(map_op->AttachBatchSlots(start_batch_size_, buffer_pool_, &batch_slots_));
+  }
+  return Status::OK();
+}
+
 Status BatchOp::EofReceived(int32_t) { return Status::OK(); }
 
 Status BatchOp::EoeReceived(int32_t) {
@@ -382,7 +440,8 @@ Status BatchOp::InvokeBatchMapFunc(TensorBatchTable *input, TensorBatchTable *ou
 #endif
 
 Status BatchOp::PadColumns(std::unique_ptr<TensorQTable> *table, const PadInfo &pad_info,
-                           const std::unordered_map<std::string, int32_t> &column_name_id_map) {
+                           const std::unordered_map<std::string, int32_t> &column_name_id_map,
+                           const std::shared_ptr<MemoryPool> &pool) {
   RETURN_UNEXPECTED_IF_NULL(table);  // placeholder for now, might need this in the future
   CHECK_FAIL_RETURN_UNEXPECTED(
     (*table)->front().size() == column_name_id_map.size(),
@@ -426,11 +485,35 @@ Status BatchOp::PadColumns(std::unique_ptr<TensorQTable> *table, const PadInfo &
   }
 
   // call pad on each tensor that needs to be padded
-  for (TensorRow &row : **table) {
-    for (size_t col_id : pad_cols) {
-      std::shared_ptr<Tensor> pad_tensor;
-      RETURN_IF_NOT_OK(PadEnd(row[col_id], &pad_tensor, pad_shapes[col_id], pad_vals[col_id]));
+  for (size_t col_id : pad_cols) {
+    // pad numeric rows straight into their slot of the batch tensor, BatchRows then hands it over without a copy
+    std::shared_ptr<Tensor> batch;
+    TensorShape batch_shape = TensorShape(pad_shapes[col_id]).PrependDim(static_cast<dsize_t>((*table)->size()));
+    DataType type = (*table)->front()[col_id]->type();
+    if (type.IsNumeric() && batch_shape.NumOfElements() != 0) {
+      if (pool != nullptr) {
+        RETURN_IF_NOT_OK(Tensor::CreateEmpty(batch_shape, type, pool, &batch));
+      } else {
+        RETURN_IF_NOT_OK(Tensor::CreateEmpty(batch_shape, type, &batch));
+      }
+    }
+    dsize_t j = 0;
+    for (TensorRow &row : **table) {
+      std::shared_ptr<Tensor> slot, pad_tensor;
+      if (batch != nullptr && row[col_id]->type() == type) {
+        RETURN_IF_NOT_OK(Tensor::CreateView(batch, {j}, TensorShape(pad_shapes[col_id]), &slot));
+      }
+      Tensor::SetOutputSlot(slot);
+      Status rc = PadEnd(row[col_id], &pad_tensor, pad_shapes[col_id], pad_vals[col_id]);
+      Tensor::SetOutputSlot(nullptr);
+      RETURN_IF_NOT_OK(rc);
+      if (slot != nullptr && pad_tensor != slot) {
+        // rows that need no padding are copied into their slot
+        RETURN_IF_NOT_OK(batch->InsertTensor({j}, pad_tensor));
+        pad_tensor = slot;
+      }
       row[col_id] = pad_tensor;
+      j++;
     }
   }
   return Status::OK();
@@ -29,6 +29,7 @@
 #include "minddata/dataset/core/config_manager.h"
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/engine/dataset_iterator.h"
+#include "minddata/dataset/engine/datasetops/batch_buffer_pool.h"
 #include "minddata/dataset/engine/datasetops/parallel_op.h"
 #include "minddata/dataset/util/status.h"
 
@@ -192,6 +193,14 @@ class BatchOp : public ParallelOp {
   // @return Status - The error code return
   Status operator()() override;
 
+  // Base-class override for tree prepare, lets a MapOp child write its rows straight into the batch tensors
+  // @return Status - The error code return
+  Status PrepareNodePostAction() override;
+
+  // Getter
+  // @return true, the batches are given to the workers in round robin and each batch produces one buffer
+  bool WorkersTunable() const override { return true; }
+
   // Base-class override for NodePass visitor acceptor.
   // @param p - Pointer to the NodePass to be accepted.
   // @param modified - Whether this node visit modified the pipeline.
@@ -206,17 +215,21 @@ class BatchOp : public ParallelOp {
   // @param const std::unique_ptr<TensorQTable> *src - table that has the rows for batching
   // @param const std::unique_ptr<TensorQTable> *dest - dest_table to hold batched rows
   // @param int32_t size - batch_size
-  // @param const std::unordered_map<std::string, int32_t>& column_name_id_map - column names to index mapping
+  // @param const std::shared_ptr<MemoryPool> &pool - memory pool of the batch tensors, global memory pool if nullptr
   // @return Status - The error code return
+  // @notes A column whose rows are the consecutive slots of one batch tensor is handed over without a copy
   static Status BatchRows(const std::unique_ptr<TensorQTable> *src, const std::unique_ptr<TensorQTable> *dest,
-                          dsize_t batch_size);
+                          dsize_t batch_size, const std::shared_ptr<MemoryPool> &pool = nullptr);
 
   // @param table
   // @param const PadInfo &pad_info pad info
   // @param const std::unordered_map<std::string, int32_t>& column_name_id_map - column names to index mapping
+  // @param const std::shared_ptr<MemoryPool> &pool - memory pool of the batch tensors, global memory pool if nullptr
   // @return Status - The error code return
+  // @notes Numeric rows are padded straight into the slots of a batch tensor, which BatchRows then hands over
   static Status PadColumns(std::unique_ptr<TensorQTable> *table, const PadInfo &pad_info,
-                           const std::unordered_map<std::string, int32_t> &column_name_id_map);
+                           const std::unordered_map<std::string, int32_t> &column_name_id_map,
+                           const std::shared_ptr<MemoryPool> &pool = nullptr);
 
  private:
   // Worker thread for doing the memcpy of batch
@@ -276,6 +289,8 @@ class BatchOp : public ParallelOp {
   PadInfo pad_info_;                               // column names to perform padding on
   std::unique_ptr<ChildIterator> child_iterator_;  // child iterator for fetching TensorRows 1 by 1
   QueueList<std::pair<std::unique_ptr<TensorQTable>, CBatchInfo>> worker_queues_;  // internal queue for syncing worker
+  std::shared_ptr<BatchBufferPool> buffer_pool_;   // recycled memory of the batch tensors
+  std::shared_ptr<BatchSlots> batch_slots_;        // batch tensors the MapOp child writes into, nullptr if not used
 #ifdef ENABLE_PYTHON
   py::function batch_size_func_;  // Function pointer of batch size function
   py::function batch_map_func_;   // Function pointer of per batch map function
@@ -23,6 +23,8 @@
 #include <string>
 #include <algorithm>
 
+#include "minddata/dataset/core/config_manager.h"
+#include "minddata/dataset/core/global_context.h"
 #include "minddata/dataset/engine/execution_tree.h"
 #include "minddata/dataset/engine/datasetops/device_queue_op.h"
 #include "minddata/dataset/engine/datasetops/source/sampler/sampler.h"
@@ -211,7 +213,8 @@ void DatasetOp::CreateConnector(int32_t num_producers, int32_t num_consumers) {
   if (oc_queue_size_ > 0) {
     out_connector_ = std::make_unique<DbConnector>(num_producers,  // The number of producers
                                                    num_consumers,  // Only one consumer (the training App)
-                                                   oc_queue_size_);
+                                                   oc_queue_size_,
+                                                   GlobalContext::config_manager()->lock_free_connector());
   } else {
     // Some op's may choose not to have an output connector
     MS_LOG(DEBUG) << "Bypassed connector creation for tree operator: " << operator_id_ << ".";
@@ -219,6 +222,15 @@ void DatasetOp::CreateConnector(int32_t num_producers, int32_t num_consumers) {
   }
 }
 
+// Changes the capacity of each queue of the output connector
+Status DatasetOp::SetConnectorQueueSize(int32_t size) {
+  CHECK_FAIL_RETURN_UNEXPECTED(size > 0, "Invalid connector queue size: " + std::to_string(size) + ".");
+  if (out_connector_ == nullptr) {
+    RETURN_STATUS_UNEXPECTED("Operator " + Name() + " has no output connector.");
+  }
+  return out_connector_->SetQueueCapacity(size);
+}
+
 // A print method typically used for debugging.  showAll of true will recursively descend to child prints
 void DatasetOp::Print(std::ostream &out, bool show_all) const {
   // When show_all is false, we display a 1 liner piece of text for the op.
@@ -293,6 +293,16 @@ class DatasetOp : public std::enable_shared_from_this<DatasetOp> {
     return ChildOpConnectorCapacity();
   }
 
+  /// \brief Getter function
+  /// \return capacity of each queue of the output connector, 0 for an inlined op
+  int32_t op_connector_size() const { return oc_queue_size_; }
+
+  /// \brief Change the capacity of each queue of the output connector while the tree is running. The configured
+  /// size returned by op_connector_size() is left as is.
+  /// \param size - the new capacity
+  /// \return Status The status code returned
+  Status SetConnectorQueueSize(int32_t size);
+
   /// \brief Getter function
   /// \return connector size of child op
   int32_t ChildOpConnectorSize(int32_t child_index = 0) const { return child_[child_index]->ConnectorSize(); }
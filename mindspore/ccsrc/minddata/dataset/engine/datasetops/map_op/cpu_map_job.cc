@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
 #include <vector>
 #include <utility>
@@ -33,13 +35,26 @@ CpuMapJob::~CpuMapJob() = default;
 
 // A function to execute a cpu map job
 Status CpuMapJob::Run(std::vector<TensorRow> in, std::vector<TensorRow> *out) {
+  if (UseBatch()) {
+    return RunBatch(std::move(in), out);
+  }
   int32_t num_rows = in.size();
   for (int32_t row = 0; row < num_rows; row++) {
     TensorRow input_row = in[row];
     TensorRow result_row;
     for (size_t i = 0; i < ops_.size(); i++) {
+      // Let the last TensorOp write its output straight into the slot prepared for the row
+      bool use_slot =
+        i + 1 == ops_.size() && static_cast<size_t>(row) < output_slots_.size() && output_slots_[row] != nullptr;
+      if (use_slot) {
+        Tensor::SetOutputSlot(output_slots_[row]);
+      }
       // Call compute function for cpu
-      RETURN_IF_NOT_OK(ops_[i]->Compute(input_row, &result_row));
+      Status rc = ops_[i]->Compute(input_row, &result_row);
+      if (use_slot) {
+        Tensor::SetOutputSlot(nullptr);
+      }
+      RETURN_IF_NOT_OK(rc);
 
       // Assign result_row to to_process for the next TensorOp processing, except for the last TensorOp in the list.
       if (i + 1 < ops_.size()) {
@@ -52,5 +67,24 @@ Status CpuMapJob::Run(std::vector<TensorRow> in, std::vector<TensorRow> *out) {
   return Status::OK();
 }
 
+bool CpuMapJob::UseBatch() const {
+  return !ops_.empty() && std::all_of(ops_.begin(), ops_.end(), [this](const auto &op) {
+    return op->SupportsBatch() && (!exact_batch_only_ || op->ExactBatch());
+  });
+}
+
+// Hand the whole batch to one TensorOp after the other
+Status CpuMapJob::RunBatch(std::vector<TensorRow> in, std::vector<TensorRow> *out) {
+  const std::vector<TensorPtr> no_slots;
+  for (size_t i = 0; i < ops_.size(); i++) {
+    TensorTable result;
+    // Only the last TensorOp writes its output into the slots
+    RETURN_IF_NOT_OK(ops_[i]->BatchCompute(in, &result, i + 1 == ops_.size() ? output_slots_ : no_slots));
+    in = std::move(result);
+  }
+  out->insert(out->end(), std::make_move_iterator(in.begin()), std::make_move_iterator(in.end()));
+  return Status::OK();
+}
+
 }  // namespace dataset
 }  // namespace mindspore
@@ -35,6 +35,18 @@ class CpuMapJob : public MapJob {
 
   // A pure virtual run function to execute a cpu map job
   Status Run(std::vector<TensorRow> in, std::vector<TensorRow> *out) override;
+
+  // Run batches only through TensorOps whose BatchCompute gives the same bits as Compute, see TensorOp::ExactBatch
+  void SetExactBatchOnly(bool exact_only) { exact_batch_only_ = exact_only; }
+
+ private:
+  // Run the TensorOps on the whole batch at once, when they all support it, see TensorOp::BatchCompute
+  Status RunBatch(std::vector<TensorRow> in, std::vector<TensorRow> *out);
+
+  // Whether the TensorOps should run on batches
+  bool UseBatch() const;
+
+  bool exact_batch_only_ = true;
 };
 
 }  // namespace dataset
@@ -17,6 +17,7 @@
 #define DATASET_ENGINE_DATASETOPS_MAP_OP_MAP_JOB_H_
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "minddata/dataset/kernels/tensor_op.h"
@@ -42,11 +43,15 @@ class MapJob {
     return Status::OK();
   }
 
+  // Set the tensors the last operation writes the output of each row into, see Tensor::SetOutputSlot
+  void SetOutputSlots(std::vector<TensorPtr> slots) { output_slots_ = std::move(slots); }
+
   // A pure virtual run function to execute a particular map job
   virtual Status Run(std::vector<TensorRow> in, std::vector<TensorRow> *out) = 0;
 
  protected:
   std::vector<std::shared_ptr<TensorOp>> ops_;
+  std::vector<TensorPtr> output_slots_;
 };
 
 }  // namespace dataset
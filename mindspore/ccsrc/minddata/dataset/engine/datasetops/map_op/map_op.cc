@@ -17,6 +17,7 @@
 #include <cstring>
 #include <iostream>
 #include <memory>
+#include <utility>
 #include <vector>
 #include "minddata/dataset/core/config_manager.h"
 
@@ -129,7 +130,10 @@ Status MapOp::GenerateWorkerJob(const std::unique_ptr<MapWorkerJob> *worker_job)
         // map_job could be nullptr when we are at the first tensor op or when the target device of the prev op
         // is different with that of the current op.
         if (map_job == nullptr) {
-          map_job = std::make_shared<CpuMapJob>();
+          auto cpu_map_job = std::make_shared<CpuMapJob>();
+          // The batch paths that round differently from Compute are among the optional optimizations
+          cpu_map_job->SetExactBatchOnly(tree_ == nullptr || !tree_->OptimizationEnabled());
+          map_job = std::move(cpu_map_job);
         }
         map_job->AddOperation(tfuncs_[i]);
         break;
@@ -177,6 +181,8 @@ Status MapOp::operator()() {
   RETURN_IF_NOT_OK(rc);
   // num_buffers received, including eoe, num_epoch, num_step of current epoch
   int64_t num_buf = 0, ep_step = 0, total_step = 0;
+  // eoe received and rows since the last eoe, to find the batch slot of a row
+  int64_t num_repeat = 0, row_id = 0;
 
   RETURN_IF_NOT_OK(callback_manager_.Begin(CallbackParam(0, ep_step, total_step)));
 
@@ -198,9 +204,12 @@ Status MapOp::operator()() {
 
       // Populate map worker job for a worker to execute
       RETURN_IF_NOT_OK(GenerateWorkerJob(&worker_job));
+      if (batch_slots_ != nullptr) {
+        RETURN_IF_NOT_OK(AssignBatchSlots(&worker_job, num_repeat, &row_id));
+      }
 
       // Push map worker job to the corresponding worker's queue
-      RETURN_IF_NOT_OK(local_queues_[num_buf++ % num_workers_]->Add(std::move(worker_job)));
+      RETURN_IF_NOT_OK(local_queues_[NextWorker(num_buf++)]->Add(std::move(worker_job)));
 
       RETURN_IF_NOT_OK(callback_manager_.StepEnd(CallbackParam(op_current_epochs_ + 1, ep_step, total_step)));
 
@@ -215,14 +224,16 @@ Status MapOp::operator()() {
     }
     // Propagate the eoe buffer to worker
     std::unique_ptr<MapWorkerJob> worker_job = std::make_unique<MapWorkerJob>(std::move(buff));
-    RETURN_IF_NOT_OK(local_queues_[num_buf++ % num_workers_]->Add(std::move(worker_job)));
+    RETURN_IF_NOT_OK(local_queues_[NextWorker(num_buf++)]->Add(std::move(worker_job)));
     UpdateRepeatAndEpochCounter();
+    num_repeat++;
+    row_id = 0;
     RETURN_IF_NOT_OK(child_[0]->GetNextBuffer(&buff, 0));
   }
   // End() is commented out because it might never be called due to the lack of EOF when EpochCtrl is -1
   // Handle eof logic, this code might never be reached if epoch_ctrl = -1.
   std::unique_ptr<MapWorkerJob> worker_job = std::make_unique<MapWorkerJob>(std::move(buff));
-  RETURN_IF_NOT_OK(local_queues_[num_buf++ % num_workers_]->Add(std::move(worker_job)));
+  RETURN_IF_NOT_OK(local_queues_[NextWorker(num_buf++)]->Add(std::move(worker_job)));
 
   // Quit all workers, this code might never be reached if EpochCtrl is -1.
   for (int32_t wkr_id = 0; wkr_id < num_workers_; wkr_id++) {
@@ -323,6 +334,11 @@ Status MapOp::WorkerCompute(DataBuffer *in_buffer, TensorQTable *new_tensor_tabl
   if (!result_table.empty() && out_columns_.size() != result_table[0].size()) {
     RETURN_STATUS_UNEXPECTED("Result of a tensorOp doesn't match output column names");
   }
+  if (batch_slots_ != nullptr) {
+    for (const auto &row : result_table) {
+      batch_slots_->Observe(row[0]);
+    }
+  }
 
   // Merging the data processed by job (result_table) with the data that are not used.
   for (int32_t r = 0; r < num_rows; r++) {
@@ -348,6 +364,31 @@ Status MapOp::WorkerCompute(DataBuffer *in_buffer, TensorQTable *new_tensor_tabl
   return Status::OK();
 }
 
+Status MapOp::AttachBatchSlots(int32_t batch_size, std::shared_ptr<MemoryPool> pool,
+                               std::shared_ptr<BatchSlots> *slots) {
+  RETURN_UNEXPECTED_IF_NULL(slots);
+  if (out_columns_.size() != 1 || tfuncs_.empty()) {
+    *slots = nullptr;
+    return Status::OK();
+  }
+  batch_slots_ = std::make_shared<BatchSlots>(batch_size, std::move(pool));
+  *slots = batch_slots_;
+  return Status::OK();
+}
+
+Status MapOp::AssignBatchSlots(const std::unique_ptr<MapWorkerJob> *worker_job, int64_t repeat, int64_t *row_id) {
+  if ((*worker_job)->jobs.empty() || (*worker_job)->databuffer->buffer_flags() != DataBuffer::kDeBFlagNone) {
+    return Status::OK();
+  }
+  int32_t num_rows = (*worker_job)->databuffer->NumRows();
+  std::vector<TensorPtr> slots(num_rows);
+  for (int32_t r = 0; r < num_rows; r++) {
+    RETURN_IF_NOT_OK(batch_slots_->GetSlot(repeat, (*row_id)++, &slots[r]));
+  }
+  (*worker_job)->jobs.back()->SetOutputSlots(std::move(slots));
+  return Status::OK();
+}
+
 Status MapOp::ComputeColMap() {
   // If the map has not been set up yet in the base class, then set it up
   if (column_name_id_map_.empty()) {
@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "minddata/dataset/callback/ds_callback.h"
+#include "minddata/dataset/engine/datasetops/batch_buffer_pool.h"
 #include "minddata/dataset/engine/datasetops/map_op/map_job.h"
 #include "minddata/dataset/engine/datasetops/parallel_op.h"
 #include "minddata/dataset/kernels/tensor_op.h"
@@ -177,6 +178,10 @@ class MapOp : public ParallelOp {
   // @return the number of threads consuming data from previous op's output Connector.
   int32_t num_consumers() const override;
 
+  // Getter
+  // @return true, the jobs are given to the workers in round robin and each job produces one buffer
+  bool WorkersTunable() const override { return true; }
+
   // Base-class override for NodePass visitor acceptor.
   // @param p - Pointer to the NodePass to be accepted.
   // @param modified - Whether this node visit modified the pipeline.
@@ -194,6 +199,14 @@ class MapOp : public ParallelOp {
 
   const auto &TFuncs() const { return tfuncs_; }
 
+  // Let the workers write the output column straight into the batch tensors of the BatchOp above.
+  // Only supported when the map produces a single column.
+  // @param batch_size The number of rows in a batch
+  // @param pool The memory pool of the batch tensors
+  // @param[out] slots The batch tensors shared with the BatchOp, nullptr if not supported
+  // @return Status The error code return
+  Status AttachBatchSlots(int32_t batch_size, std::shared_ptr<MemoryPool> pool, std::shared_ptr<BatchSlots> *slots);
+
  private:
   // A unit of job for map worker thread.
   // MapWorkerJob holds a list of MapJob where each MapJob can be a CpuMapJob, GpuMapJob or DvppMapJob.
@@ -234,6 +247,16 @@ class MapOp : public ParallelOp {
   // Count number of workers that have signaled master
   std::atomic_int num_workers_paused_;
 
+  // Batch tensors the last TensorOp writes its output into, nullptr if the parent is not a BatchOp
+  std::shared_ptr<BatchSlots> batch_slots_;
+
+  // Private function for the master thread to hand the slots of the rows in a worker job to its last MapJob.
+  // @param worker_job The worker job holding the rows
+  // @param repeat The number of eoe seen so far
+  // @param[in, out] row_id The position of the first row since the last eoe, moved past the rows of the job
+  // @return Status The error code return
+  Status AssignBatchSlots(const std::unique_ptr<MapWorkerJob> *worker_job, int64_t repeat, int64_t *row_id);
+
   // Private function for worker/thread to loop continuously. It comprises the main
   // logic of MapOp: getting the data from previous Op, validating user specified column names,
   // applying a list of TensorOps to each of the data, process the results and then
@@ -15,6 +15,7 @@
  */
 #include "minddata/dataset/engine/datasetops/parallel_op.h"
 
+#include <algorithm>
 #include <iostream>
 #include <utility>
 #include "minddata/dataset/engine/datasetops/dataset_op.h"
@@ -31,7 +32,10 @@ ParallelOp::ParallelOp(int32_t num_workers, int32_t op_connector_size, std::shar
       num_workers_(num_workers),
       num_producers_(num_workers),
       worker_connector_size_(1),
-      worker_connector_(nullptr) {}
+      worker_connector_(nullptr),
+      target_workers_(num_workers),
+      round_workers_(num_workers),
+      round_start_(0) {}
 
 // Creates the internal worker connector for the parallel op if the derived class wants to use it
 Status ParallelOp::CreateWorkerConnector(int32_t worker_connector_size) {
@@ -75,6 +79,31 @@ Status ParallelOp::Reset() {
   return Status::OK();
 }
 
+// Launch up to max_workers workers, keeping the configured ones in use
+Status ParallelOp::SetMaxWorkers(int32_t max_workers) {
+  CHECK_FAIL_RETURN_UNEXPECTED(WorkersTunable(), "The number of workers of " + Name() + " can't be tuned.");
+  CHECK_FAIL_RETURN_UNEXPECTED(out_connector_ == nullptr, "SetMaxWorkers must be called before the tree is prepared.");
+  if (max_workers > num_workers_ && !inlined()) {
+    num_workers_ = max_workers;
+    num_producers_ = max_workers;
+    round_workers_ = max_workers;
+  }
+  return Status::OK();
+}
+
+void ParallelOp::SetNumActiveWorkers(int32_t num_workers) {
+  target_workers_ = std::max(1, std::min(num_workers, num_workers_));
+}
+
+int32_t ParallelOp::NextWorker(int64_t seq) {
+  if ((seq - round_start_) % round_workers_ == 0 && target_workers_ != round_workers_ && out_connector_ != nullptr) {
+    round_workers_ = target_workers_;
+    round_start_ = seq;
+    out_connector_->ScheduleActiveProducers(seq, round_workers_);
+  }
+  return static_cast<int32_t>((seq - round_start_) % round_workers_);
+}
+
 // Register the internal worker connectors
 Status ParallelOp::RegisterWorkerConnectors() {
   if (worker_connector_) {
@@ -16,6 +16,7 @@
 #ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_PARALLEL_OP_H_
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_PARALLEL_OP_H_
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <vector>
@@ -111,7 +112,33 @@ class ParallelOp : public DatasetOp {
   // @return Status
   Status RegisterWorkerConnectors() override;
 
+  // Getter
+  // @return true if the number of workers in use can be changed while the tree is running
+  virtual bool WorkersTunable() const { return false; }
+
+  // Launch up to max_workers workers so that the number of workers in use can be changed later with
+  // SetNumActiveWorkers. The workers in use stay the configured ones until then.
+  // @notes Must be called before the output connector is created, during the tree prepare phase.
+  // @param max_workers - the number of workers to launch
+  // @return Status - The error code return
+  Status SetMaxWorkers(int32_t max_workers);
+
+  // Setter, the change takes effect at the start of the next round of work given to the workers
+  // @param num_workers - the number of workers in use, clamped to [1, num_workers()]
+  void SetNumActiveWorkers(int32_t num_workers);
+
+  // Getter
+  // @return the number of workers in use
+  int32_t num_active_workers() const { return target_workers_; }
+
  protected:
+  // Pick the worker of the next job given out in round robin. A change of the number of workers in use is applied at
+  // the start of a round, and passed on to the output connector so that the order of the output is kept.
+  // @notes Every job must produce exactly one buffer in the output connector.
+  // @param seq - the number of jobs given out so far
+  // @return the id of the worker
+  int32_t NextWorker(int64_t seq);
+
   // Interface for derived classes to implement. All derived classes must provide the entry
   // function with the main execution loop for worker threads.
   // @return Status - The error code return
@@ -121,6 +148,11 @@ class ParallelOp : public DatasetOp {
   int32_t num_producers_;  // The number of threads pushing to the out_connector_
   int32_t worker_connector_size_;
   std::unique_ptr<DbConnector> worker_connector_;  // The internal connector for worker threads
+
+ private:
+  std::atomic<int32_t> target_workers_;  // The number of workers in use asked for
+  int32_t round_workers_;                // The number of workers in use in the current round
+  int64_t round_start_;                  // The seq of the first job of the current round
 };
 }  // namespace dataset
 }  // namespace mindspore
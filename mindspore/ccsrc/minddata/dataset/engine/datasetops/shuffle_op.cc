@@ -19,11 +19,14 @@
 #include <securec.h>
 #include <algorithm>
 #include <chrono>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <random>
 #include <utility>
+#include <vector>
 
 #include "minddata/dataset/core/config_manager.h"
 #include "minddata/dataset/engine/datasetops/shuffle_op.h"
@@ -41,6 +44,10 @@ namespace dataset {
 constexpr int32_t ShuffleOp::kShuffleStateInit;
 constexpr int32_t ShuffleOp::kShuffleStateActive;
 constexpr int32_t ShuffleOp::kShuffleStateDrain;
+constexpr int32_t ShuffleOp::kPartitionFlagNone;
+constexpr int32_t ShuffleOp::kPartitionFlagEoe;
+constexpr int32_t ShuffleOp::kPartitionFlagEof;
+constexpr int32_t ShuffleOp::kPartitionQueueSize;
 
 // Builder constructor. Creates the builder object.
 ShuffleOp::Builder::Builder() : build_shuffle_size_(0), build_reshuffle_each_epoch_(true) {
@@ -48,12 +55,16 @@ ShuffleOp::Builder::Builder() : build_shuffle_size_(0), build_reshuffle_each_epo
   build_op_connector_size_ = cfg->op_connector_size();
   build_rows_per_buffer_ = cfg->rows_per_buffer();
   build_shuffle_seed_ = GetSeed();
+  build_num_partitions_ = cfg->shuffle_partitions();
 }
 
 Status ShuffleOp::Builder::SanityCheck() const {
   if (build_shuffle_size_ < 2) {
     RETURN_STATUS_UNEXPECTED("Invalid parameter, shuffle buffer size must be greater than 1.");
   }
+  if (build_num_partitions_ < 1) {
+    RETURN_STATUS_UNEXPECTED("Invalid parameter, number of shuffle partitions must be greater than 0.");
+  }
   return Status::OK();
 }
 
@@ -61,13 +72,13 @@ Status ShuffleOp::Builder::SanityCheck() const {
 Status ShuffleOp::Builder::Build(std::shared_ptr<ShuffleOp> *ptr) {
   RETURN_IF_NOT_OK(SanityCheck());
   *ptr = std::make_shared<ShuffleOp>(build_shuffle_size_, build_shuffle_seed_, build_op_connector_size_,
-                                     build_reshuffle_each_epoch_, build_rows_per_buffer_);
+                                     build_reshuffle_each_epoch_, build_rows_per_buffer_, build_num_partitions_);
   return Status::OK();
 }
 
 // Constructor of the ShuffleOp
 ShuffleOp::ShuffleOp(int32_t shuffle_size, uint32_t shuffle_seed, int32_t op_connector_size, bool reset_every_epoch,
-                     int32_t rows_per_buffer)
+                     int32_t rows_per_buffer, int32_t num_partitions)
     : PipelineOp(op_connector_size),
       shuffle_size_(shuffle_size),
       shuffle_seed_(shuffle_seed),
@@ -77,7 +88,9 @@ ShuffleOp::ShuffleOp(int32_t shuffle_size, uint32_t shuffle_seed, int32_t op_con
       rows_per_buffer_(rows_per_buffer),
       shuffle_buffer_(std::make_unique<TensorTable>()),
       shuffle_last_row_idx_(0),
-      shuffle_buffer_state_(kShuffleStateInit) {}
+      shuffle_buffer_state_(kShuffleStateInit),
+      // A partition holds one row of the shuffle buffer at least
+      num_partitions_(std::max(1, std::min(num_partitions, shuffle_size))) {}
 
 // Private function to re-init the shuffle op for another epoch.  Shuffle op calls this by
 // itself rather than waiting for the reset driven from operators above it in the pipeline.
@@ -110,7 +123,8 @@ void ShuffleOp::Print(std::ostream &out, bool show_all) const {
     PipelineOp::Print(out, show_all);
     // Then show any custom derived-internal stuff
     out << "\nShuffle size: " << shuffle_size_ << "\nRows per buffer: " << rows_per_buffer_
-        << "\nShuffle buffer state: " << shuffle_buffer_state_ << "\nShuffle seed: " << shuffle_seed_ << "\n\n";
+        << "\nShuffle buffer state: " << shuffle_buffer_state_ << "\nShuffle seed: " << shuffle_seed_
+        << "\nShuffle partitions: " << num_partitions_ << "\n\n";
   }
 }
 
@@ -150,6 +164,10 @@ Status ShuffleOp::operator()() {
   int32_t child_idx = 0;
   child_iterator_ = std::make_unique<ChildIterator>(this, worker_id, child_idx);
 
+  if (num_partitions_ > 1) {
+    return PartitionedShuffle();
+  }
+
   // Main operator loop
   while (true) {
     // Do an initial populate of the shuffle buffer
@@ -293,6 +311,140 @@ Status ShuffleOp::EoeReceived(int32_t worker_id) {
   return Status::OK();
 }
 
+Status ShuffleOp::EofReceived(int32_t worker_id) {
+  if (num_partitions_ == 1) {
+    return DatasetOp::EofReceived(worker_id);
+  }
+  for (int32_t p = 0; p < num_partitions_; p++) {
+    RETURN_IF_NOT_OK(partition_in_queues_[p]->EmplaceBack(TensorRow(), kPartitionFlagEof));
+  }
+  return Status::OK();
+}
+
+// Private function for the partitioned shuffle. The op's thread deals the rows to the partitions.
+Status ShuffleOp::PartitionedShuffle() {
+  partition_in_queues_.Init(num_partitions_, kPartitionQueueSize);
+  partition_out_queues_.Init(num_partitions_, kPartitionQueueSize);
+  RETURN_IF_NOT_OK(partition_in_queues_.Register(tree_->AllTasks()));
+  RETURN_IF_NOT_OK(partition_out_queues_.Register(tree_->AllTasks()));
+  RETURN_IF_NOT_OK(
+    tree_->LaunchWorkers(num_partitions_, std::bind(&ShuffleOp::PartitionEntry, this, std::placeholders::_1)));
+  RETURN_IF_NOT_OK(
+    tree_->AllTasks()->CreateAsyncTask("Shuffle collector", std::bind(&ShuffleOp::CollectorEntry, this)));
+
+  // Row i of an epoch goes to partition i % num_partitions_, so that every partition sees the same rows from run
+  // to run. The eof is dealt by EofReceived, called from the child iterator.
+  int64_t row_count = 0;
+  while (!child_iterator_->eof_handled()) {
+    TensorRow new_row;
+    RETURN_IF_NOT_OK(child_iterator_->FetchNextTensorRow(&new_row));
+    if (!new_row.empty()) {
+      RETURN_IF_NOT_OK(
+        partition_in_queues_[row_count % num_partitions_]->EmplaceBack(std::move(new_row), kPartitionFlagNone));
+      row_count++;
+    } else if (!child_iterator_->eof_handled()) {
+      MS_LOG(DEBUG) << "Shuffle operator dealing EOE to the partitions.";
+      for (int32_t p = 0; p < num_partitions_; p++) {
+        RETURN_IF_NOT_OK(partition_in_queues_[p]->EmplaceBack(TensorRow(), kPartitionFlagEoe));
+      }
+      row_count = 0;
+    }
+  }
+  return Status::OK();
+}
+
+std::mt19937_64 ShuffleOp::PartitionRng(int32_t partition_id) const {
+  std::seed_seq seq{shuffle_seed_, static_cast<uint32_t>(partition_id)};
+  return std::mt19937_64(seq);
+}
+
+// Entry point of the thread of a partition
+Status ShuffleOp::PartitionEntry(int32_t partition_id) {
+  TaskManager::FindMe()->Post();
+  // The rows of the shuffle buffer left over by the division go to the first partitions
+  size_t buffer_size = shuffle_size_ / num_partitions_ + (partition_id < shuffle_size_ % num_partitions_ ? 1 : 0);
+  std::mt19937_64 rng = PartitionRng(partition_id);
+  TensorTable buffer;
+  auto &in_queue = partition_in_queues_[partition_id];
+  auto &out_queue = partition_out_queues_[partition_id];
+  while (true) {
+    PartitionRow in_row;
+    RETURN_IF_NOT_OK(in_queue->PopFront(&in_row));
+    if (in_row.second == kPartitionFlagNone) {
+      if (buffer.size() < buffer_size) {
+        buffer.push_back(std::move(in_row.first));
+        continue;
+      }
+      // Same as the single threaded op: send a random row of the full buffer out and take the new row in its slot
+      size_t random_slot = rng() % buffer.size();
+      RETURN_IF_NOT_OK(out_queue->EmplaceBack(std::move(buffer[random_slot]), kPartitionFlagNone));
+      buffer[random_slot] = std::move(in_row.first);
+      continue;
+    }
+
+    // At the end of an epoch, drain the buffer in random order then pass the flag on
+    while (!buffer.empty()) {
+      size_t random_slot = rng() % buffer.size();
+      RETURN_IF_NOT_OK(out_queue->EmplaceBack(std::move(buffer[random_slot]), kPartitionFlagNone));
+      if (random_slot != buffer.size() - 1) {
+        buffer[random_slot] = std::move(buffer.back());
+      }
+      buffer.pop_back();
+    }
+    RETURN_IF_NOT_OK(out_queue->EmplaceBack(TensorRow(), in_row.second));
+    if (in_row.second == kPartitionFlagEof) {
+      return Status::OK();
+    }
+    if (!reshuffle_each_epoch_) {
+      rng = PartitionRng(partition_id);
+    }
+  }
+}
+
+// Entry point of the collector thread
+Status ShuffleOp::CollectorEntry() {
+  TaskManager::FindMe()->Post();
+  while (true) {
+    // Take the rows from the partitions in turn, skipping the ones that have reached the end of the epoch
+    std::vector<bool> drained(num_partitions_, false);
+    int32_t num_drained = 0;
+    int32_t flag = kPartitionFlagEoe;
+    auto new_buffer_table = std::make_unique<TensorQTable>();
+    for (int32_t p = 0; num_drained < num_partitions_; p = (p + 1) % num_partitions_) {
+      if (drained[p]) {
+        continue;
+      }
+      PartitionRow out_row;
+      RETURN_IF_NOT_OK(partition_out_queues_[p]->PopFront(&out_row));
+      if (out_row.second != kPartitionFlagNone) {
+        drained[p] = true;
+        num_drained++;
+        flag = out_row.second;
+        continue;
+      }
+      new_buffer_table->push_back(std::move(out_row.first));
+      if (new_buffer_table->size() == rows_per_buffer_) {
+        auto new_buffer = std::make_unique<DataBuffer>(buffer_counter_++, DataBuffer::kDeBFlagNone);
+        new_buffer->set_tensor_table(std::move(new_buffer_table));
+        RETURN_IF_NOT_OK(out_connector_->Add(0, std::move(new_buffer)));
+        new_buffer_table = std::make_unique<TensorQTable>();
+      }
+    }
+    if (!new_buffer_table->empty()) {
+      auto new_buffer = std::make_unique<DataBuffer>(buffer_counter_++, DataBuffer::kDeBFlagNone);
+      new_buffer->set_tensor_table(std::move(new_buffer_table));
+      RETURN_IF_NOT_OK(out_connector_->Add(0, std::move(new_buffer)));
+    }
+    if (flag == kPartitionFlagEof) {
+      MS_LOG(DEBUG) << "Shuffle collector sending EOF.";
+      return DatasetOp::EofReceived(0);
+    }
+    MS_LOG(DEBUG) << "Shuffle collector sending EOE.";
+    RETURN_IF_NOT_OK(out_connector_->Add(0, std::make_unique<DataBuffer>(0, DataBuffer::kDeBFlagEOE)));
+    buffer_counter_ = 0;
+  }
+}
+
 // Visitor accept method for NodePass
 Status ShuffleOp::Accept(NodePass *p, bool *modified) {
   // Downcast shared pointer then call visitor
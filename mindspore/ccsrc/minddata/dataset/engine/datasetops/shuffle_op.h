@@ -22,12 +22,14 @@
 #include <random>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/core/tensor_shape.h"
 #include "minddata/dataset/engine/dataset_iterator.h"
 #include "minddata/dataset/engine/datasetops/pipeline_op.h"
+#include "minddata/dataset/util/queue.h"
 #include "minddata/dataset/util/status.h"
 
 namespace mindspore {
@@ -51,6 +53,23 @@ class ShuffleOp : public PipelineOp {
   // Shuffle buffer is in a state of being drained
   static constexpr int32_t kShuffleStateDrain = 2;
 
+  // Flags of the rows passed to and from the partitions of a partitioned shuffle
+  //
+  // A row of data
+  static constexpr int32_t kPartitionFlagNone = 0;
+
+  // The end of an epoch, the partition drains its buffer
+  static constexpr int32_t kPartitionFlagEoe = 1;
+
+  // The end of the data, the partition drains its buffer and quits
+  static constexpr int32_t kPartitionFlagEof = 2;
+
+  // Capacity of the queues to and from each partition
+  static constexpr int32_t kPartitionQueueSize = 64;
+
+  // A row and its flag
+  using PartitionRow = std::pair<TensorRow, int32_t>;
+
  public:
   // The nested builder class inside of the ShuffleOp is used to help manage all of the arguments
   // for constructing it.  The shuffle op is fairly simple though, but the builder provides a
@@ -100,6 +119,13 @@ class ShuffleOp : public PipelineOp {
       return *this;
     }
 
+    // Setter method.
+    // @return Builder setter method returns reference to the builder.
+    Builder &SetNumPartitions(int32_t num_partitions) {
+      build_num_partitions_ = num_partitions;
+      return *this;
+    }
+
     // The builder "build" method creates the final object.
     // @return shared_ptr to the new ShuffleOp object
     Status Build(std::shared_ptr<ShuffleOp> *);
@@ -112,6 +138,7 @@ class ShuffleOp : public PipelineOp {
     int32_t build_rows_per_buffer_;
     bool build_reshuffle_each_epoch_;
     int32_t build_op_connector_size_;
+    int32_t build_num_partitions_;
 
     Status SanityCheck() const;
   };
@@ -122,8 +149,9 @@ class ShuffleOp : public PipelineOp {
   // @param shuffle_seed - The seed to use for random number generation
   // @param op_connector_size - The output connector queue size
   // @param rows_per_buffer - The requested number of rows per buffer
+  // @param num_partitions - The number of partitions the shuffle buffer is split into, 1 shuffles in the op's thread
   ShuffleOp(int32_t shuffle_size, uint32_t shuffle_seed, int32_t op_connector_size, bool reset_every_epoch,
-            int32_t rows_per_buffer);
+            int32_t rows_per_buffer, int32_t num_partitions = 1);
 
   // Destructor
   ~ShuffleOp() = default;
@@ -155,6 +183,11 @@ class ShuffleOp : public PipelineOp {
   // @return Status - The error code return
   Status EoeReceived(int32_t worker_id) override;
 
+  // Base-class override for special eof handler.
+  // A partitioned ShuffleOp passes the eof to its partitions, the collector flows it up once they are drained.
+  // @return Status - The error code return
+  Status EofReceived(int32_t worker_id) override;
+
   // Base-class override for NodePass visitor acceptor.
   // @param p - Pointer to the NodePass to be accepted.
   // @param modified - Whether this node visit modified the pipeline.
@@ -165,6 +198,12 @@ class ShuffleOp : public PipelineOp {
   // @return Name of the current Op
   std::string Name() const override { return kShuffleOp; }
 
+  // Getter functions
+  int32_t shuffle_size() const { return shuffle_size_; }
+  uint32_t shuffle_seed() const { return shuffle_seed_; }
+  bool reshuffle_each_epoch() const { return reshuffle_each_epoch_; }
+  int32_t num_partitions() const { return num_partitions_; }
+
  private:
   // Private function to add a new row to the shuffle buffer.
   // @return Status - The error code return
@@ -180,6 +219,27 @@ class ShuffleOp : public PipelineOp {
   // @return Status - The error code return
   Status SelfReset();
 
+  // Private function for the partitioned shuffle. The op's thread deals the rows of the child to the partitions in
+  // turn, the partitions shuffle them in their own threads, and a collector thread takes the output rows from the
+  // partitions in turn. The output only depends on the seed and the number of partitions.
+  // @return Status - The error code return
+  Status PartitionedShuffle();
+
+  // Entry point of the thread of a partition. It runs the same buffer shuffle as the single threaded op over its
+  // share of the rows, with its own random generator.
+  // @param partition_id - The partition to shuffle
+  // @return Status - The error code return
+  Status PartitionEntry(int32_t partition_id);
+
+  // Entry point of the collector thread, it packs the rows of the partitions into buffers and sends them up.
+  // @return Status - The error code return
+  Status CollectorEntry();
+
+  // Private function to seed the random generator of a partition
+  // @param partition_id - The partition to seed the generator for
+  // @return The seeded generator
+  std::mt19937_64 PartitionRng(int32_t partition_id) const;
+
   int32_t shuffle_size_;  // User config for the size of the shuffle buffer (number of rows)
   uint32_t shuffle_seed_;
   bool reshuffle_each_epoch_;
@@ -197,6 +257,11 @@ class ShuffleOp : public PipelineOp {
   int32_t shuffle_buffer_state_;  // State tracking for the shuffle buffer phases of work
 
   std::unique_ptr<ChildIterator> child_iterator_;  // An iterator for fetching.
+
+  int32_t num_partitions_;  // Number of partitions of a partitioned shuffle, 1 if not partitioned
+  // Rows dealt to and taken from the partitions of a partitioned shuffle
+  QueueList<PartitionRow> partition_in_queues_;
+  QueueList<PartitionRow> partition_out_queues_;
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -143,6 +143,7 @@ Status CocoOp::TraverseSampleIds(const std::shared_ptr<Tensor> &sample_ids, std:
     keys->push_back(*itr);
     row_cnt_++;
     if (row_cnt_ % rows_per_buffer_ == 0) {
+      RETURN_IF_NOT_OK(ReadAhead(*keys));
       RETURN_IF_NOT_OK(io_block_queues_[buf_cnt_++ % num_workers_]->Add(
         std::make_unique<IOBlock>(IOBlock(*keys, IOBlock::kDeIoBlockNone))));
       keys->clear();
@@ -169,6 +170,7 @@ Status CocoOp::operator()() {
       RETURN_IF_NOT_OK(sampler_->GetNextSample(&sampler_buffer));
     }
     if (keys.empty() == false) {
+      RETURN_IF_NOT_OK(ReadAhead(keys));
       RETURN_IF_NOT_OK(io_block_queues_[(buf_cnt_++) % num_workers_]->Add(
         std::make_unique<IOBlock>(IOBlock(keys, IOBlock::kDeIoBlockNone))));
     }
@@ -181,6 +183,9 @@ Status CocoOp::operator()() {
         RETURN_IF_NOT_OK(
           io_block_queues_[i]->Add(std::make_unique<IOBlock>(std::vector<int64_t>(), IOBlock::kDeIoBlockNone)));
       }
+      if (file_reader_ != nullptr) {
+        file_reader_->Stop();
+      }
       return Status::OK();
     } else {
       RETURN_IF_NOT_OK(
@@ -371,6 +376,18 @@ Status CocoOp::LoadBuffer(const std::vector<int64_t> &keys, std::unique_ptr<Data
   return Status::OK();
 }
 
+Status CocoOp::ReadAhead(const std::vector<int64_t> &keys) {
+  if (file_reader_ == nullptr) {
+    return Status::OK();
+  }
+  std::vector<std::string> paths;
+  paths.reserve(keys.size());
+  for (const int64_t &key : keys) {
+    paths.push_back(image_folder_path_ + std::string("/") + image_ids_[key]);
+  }
+  return file_reader_->Submit(paths);
+}
+
 Status CocoOp::WorkerEntry(int32_t worker_id) {
   TaskManager::FindMe()->Post();
   int64_t buffer_id = worker_id;
@@ -614,6 +631,11 @@ Status CocoOp::LaunchThreadsAndInitOp() {
   }
   RETURN_IF_NOT_OK(io_block_queues_.Register(tree_->AllTasks()));
   RETURN_IF_NOT_OK(wp_.Register(tree_->AllTasks()));
+  uint32_t read_ahead = GlobalContext::config_manager()->file_read_ahead();
+  if (read_ahead > 0) {
+    file_reader_ = std::make_unique<AsyncFileReader>(static_cast<int32_t>(read_ahead));
+    RETURN_IF_NOT_OK(file_reader_->Launch(tree_->AllTasks()));
+  }
   RETURN_IF_NOT_OK(tree_->LaunchWorkers(num_workers_, std::bind(&CocoOp::WorkerEntry, this, std::placeholders::_1)));
   TaskManager::FindMe()->Post();
   RETURN_IF_NOT_OK(this->ParseAnnotationIds());
@@ -622,7 +644,7 @@ Status CocoOp::LaunchThreadsAndInitOp() {
 }
 
 Status CocoOp::ReadImageToTensor(const std::string &path, const ColDescriptor &col, std::shared_ptr<Tensor> *tensor) {
-  RETURN_IF_NOT_OK(Tensor::CreateFromFile(path, tensor));
+  RETURN_IF_NOT_OK(file_reader_ != nullptr ? file_reader_->Take(path, tensor) : Tensor::CreateFromFile(path, tensor));
 
   if (decode_ == true) {
     Status rc = Decode(*tensor, tensor);
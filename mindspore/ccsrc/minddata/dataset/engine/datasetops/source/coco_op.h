@@ -30,6 +30,7 @@
 #include "minddata/dataset/engine/datasetops/source/io_block.h"
 #include "minddata/dataset/engine/datasetops/source/sampler/sampler.h"
 #include "minddata/dataset/kernels/image/image_utils.h"
+#include "minddata/dataset/util/async_file_reader.h"
 #include "minddata/dataset/util/path.h"
 #include "minddata/dataset/util/queue.h"
 #include "minddata/dataset/util/status.h"
@@ -259,6 +260,11 @@ class CocoOp : public ParallelOp, public RandomAccessOp {
   // @return Status - The error code return
   Status LoadBuffer(const std::vector<int64_t> &keys, std::unique_ptr<DataBuffer> *db);
 
+  // Submit the image files of the rows of an IOBlock to the file reader, before the IOBlock goes to a worker
+  // @param const std::vector<int64_t> &keys - keys in ioblock
+  // @return Status - The error code return
+  Status ReadAhead(const std::vector<int64_t> &keys);
+
   // Read annotation from Annotation folder
   // @return Status - The error code return
   Status ParseAnnotationIds();
@@ -328,6 +334,7 @@ class CocoOp : public ParallelOp, public RandomAccessOp {
   std::unique_ptr<DataSchema> data_schema_;
 
   WaitPost wp_;
+  std::unique_ptr<AsyncFileReader> file_reader_;  // reads the image files ahead of the workers, null if off
   std::vector<std::string> image_ids_;
   std::map<int32_t, std::string> image_index_;
   QueueList<std::unique_ptr<IOBlock>> io_block_queues_;
@@ -143,6 +143,7 @@ Status ImageFolderOp::operator()() {
         keys.push_back(*itr);
         row_cnt_++;
         if (row_cnt_ % rows_per_buffer_ == 0) {
+          RETURN_IF_NOT_OK(ReadAhead(keys));
           RETURN_IF_NOT_OK(
             io_block_queues_[buf_cnt_++ % num_workers_]->Add(std::make_unique<IOBlock>(keys, IOBlock::kDeIoBlockNone)));
           keys.clear();
@@ -151,6 +152,7 @@ Status ImageFolderOp::operator()() {
       RETURN_IF_NOT_OK(sampler_->GetNextSample(&sampler_buffer));
     }
     if (keys.empty() == false) {
+      RETURN_IF_NOT_OK(ReadAhead(keys));
       RETURN_IF_NOT_OK(
         io_block_queues_[(buf_cnt_++) % num_workers_]->Add(std::make_unique<IOBlock>(keys, IOBlock::kDeIoBlockNone)));
     }
@@ -163,6 +165,9 @@ Status ImageFolderOp::operator()() {
         RETURN_IF_NOT_OK(
           io_block_queues_[i]->Add(std::make_unique<IOBlock>(std::vector<int64_t>(), IOBlock::kDeIoBlockNone)));
       }
+      if (file_reader_ != nullptr) {
+        file_reader_->Stop();
+      }
       return Status::OK();
     } else {  // not the last repeat. Sleep master thread, wait for the wake-up from reset
       RETURN_IF_NOT_OK(
@@ -206,7 +211,9 @@ Status ImageFolderOp::WorkerEntry(int32_t worker_id) {
 Status ImageFolderOp::LoadTensorRow(row_id_type row_id, ImageLabelPair pairPtr, TensorRow *trow) {
   std::shared_ptr<Tensor> image, label;
   RETURN_IF_NOT_OK(Tensor::CreateScalar(pairPtr->second, &label));
-  RETURN_IF_NOT_OK(Tensor::CreateFromFile(folder_path_ + (pairPtr->first), &image));
+  std::string image_path = folder_path_ + (pairPtr->first);
+  RETURN_IF_NOT_OK(file_reader_ != nullptr ? file_reader_->Take(image_path, &image)
+                                           : Tensor::CreateFromFile(image_path, &image));
 
   if (decode_ == true) {
     Status rc = Decode(image, &image);
@@ -231,6 +238,18 @@ Status ImageFolderOp::LoadBuffer(const std::vector<int64_t> &keys, std::unique_p
   return Status::OK();
 }
 
+Status ImageFolderOp::ReadAhead(const std::vector<int64_t> &keys) {
+  if (file_reader_ == nullptr) {
+    return Status::OK();
+  }
+  std::vector<std::string> paths;
+  paths.reserve(keys.size());
+  for (const int64_t &key : keys) {
+    paths.push_back(folder_path_ + image_label_pairs_[key]->first);
+  }
+  return file_reader_->Submit(paths);
+}
+
 void ImageFolderOp::Print(std::ostream &out, bool show_all) const {
   if (!show_all) {
     // Call the super class for displaying any common 1-liner info
@@ -366,6 +385,11 @@ Status ImageFolderOp::LaunchThreadsAndInitOp() {
   RETURN_IF_NOT_OK(folder_name_queue_->Register(tree_->AllTasks()));
   RETURN_IF_NOT_OK(image_name_queue_->Register(tree_->AllTasks()));
   RETURN_IF_NOT_OK(wp_.Register(tree_->AllTasks()));
+  uint32_t read_ahead = GlobalContext::config_manager()->file_read_ahead();
+  if (read_ahead > 0) {
+    file_reader_ = std::make_unique<AsyncFileReader>(static_cast<int32_t>(read_ahead));
+    RETURN_IF_NOT_OK(file_reader_->Launch(tree_->AllTasks()));
+  }
   // The following code launch 3 threads group
   // 1) A thread that walks all folders and push the folder names to a util:Queue mFoldernameQueue.
   // 2) Workers that pull foldername from mFoldernameQueue, walk it and return the sorted images to mImagenameQueue
@@ -32,6 +32,7 @@
 #include "minddata/dataset/engine/datasetops/source/io_block.h"
 #include "minddata/dataset/engine/datasetops/source/sampler/sampler.h"
 #include "minddata/dataset/kernels/image/image_utils.h"
+#include "minddata/dataset/util/async_file_reader.h"
 #include "minddata/dataset/util/path.h"
 #include "minddata/dataset/util/queue.h"
 #include "minddata/dataset/util/services.h"
@@ -231,6 +232,11 @@ class ImageFolderOp : public ParallelOp, public RandomAccessOp {
   // @return Status - The error code return
   Status LoadBuffer(const std::vector<int64_t> &keys, std::unique_ptr<DataBuffer> *db);
 
+  // Submit the image files of the rows of an IOBlock to the file reader, before the IOBlock goes to a worker
+  // @param const std::vector<int64_t> &keys - keys in ioblock
+  // @return Status - The error code return
+  Status ReadAhead(const std::vector<int64_t> &keys);
+
   // @param std::string & dir - dir to walk all images
   // @param int64_t * cnt - number of non folder files under the current dir
   // @return
@@ -264,6 +270,7 @@ class ImageFolderOp : public ParallelOp, public RandomAccessOp {
   int64_t sampler_ind_;
   int64_t dirname_offset_;
   WaitPost wp_;
+  std::unique_ptr<AsyncFileReader> file_reader_;  // reads the image files ahead of the workers, null if off
   std::vector<ImageLabelPair> image_label_pairs_;
   QueueList<std::unique_ptr<IOBlock>> io_block_queues_;  // queues of IOBlocks
   std::unique_ptr<Queue<std::string>> folder_name_queue_;
@@ -103,6 +103,7 @@ Status ManifestOp::AddIoBlock(std::unique_ptr<DataBuffer> *sampler_buffer) {
         keys.push_back(*itr);
         row_cnt_++;
         if (row_cnt_ % rows_per_buffer_ == 0) {
+          RETURN_IF_NOT_OK(ReadAhead(keys));
           RETURN_IF_NOT_OK(io_block_queues_[buf_cnt_++ % num_workers_]->Add(
             std::make_unique<IOBlock>(IOBlock(keys, IOBlock::kDeIoBlockNone))));
           keys.clear();
@@ -111,6 +112,7 @@ Status ManifestOp::AddIoBlock(std::unique_ptr<DataBuffer> *sampler_buffer) {
       RETURN_IF_NOT_OK(sampler_->GetNextSample(sampler_buffer));
     }
     if (keys.empty() == false) {
+      RETURN_IF_NOT_OK(ReadAhead(keys));
       RETURN_IF_NOT_OK(io_block_queues_[(buf_cnt_++) % num_workers_]->Add(
         std::make_unique<IOBlock>(IOBlock(keys, IOBlock::kDeIoBlockNone))));
     }
@@ -123,6 +125,9 @@ Status ManifestOp::AddIoBlock(std::unique_ptr<DataBuffer> *sampler_buffer) {
         RETURN_IF_NOT_OK(
           io_block_queues_[i]->Add(std::make_unique<IOBlock>(std::vector<int64_t>(), IOBlock::kDeIoBlockNone)));
       }
+      if (file_reader_ != nullptr) {
+        file_reader_->Stop();
+      }
       return Status::OK();
     } else {
       RETURN_IF_NOT_OK(
@@ -141,6 +146,11 @@ Status ManifestOp::LaunchThreadsAndInitOp() {
   }
   RETURN_IF_NOT_OK(io_block_queues_.Register(tree_->AllTasks()));
   RETURN_IF_NOT_OK(wp_.Register(tree_->AllTasks()));
+  uint32_t read_ahead = GlobalContext::config_manager()->file_read_ahead();
+  if (read_ahead > 0) {
+    file_reader_ = std::make_unique<AsyncFileReader>(static_cast<int32_t>(read_ahead));
+    RETURN_IF_NOT_OK(file_reader_->Launch(tree_->AllTasks()));
+  }
 
   RETURN_IF_NOT_OK(
     tree_->LaunchWorkers(num_workers_, std::bind(&ManifestOp::WorkerEntry, this, std::placeholders::_1)));
@@ -195,7 +205,8 @@ Status ManifestOp::LoadTensorRow(row_id_type row_id, const std::pair<std::string
     label->Reshape(TensorShape(std::vector<dsize_t>(1, label_index.size())));
   }
 
-  RETURN_IF_NOT_OK(Tensor::CreateFromFile(data.first, &image));
+  RETURN_IF_NOT_OK(file_reader_ != nullptr ? file_reader_->Take(data.first, &image)
+                                           : Tensor::CreateFromFile(data.first, &image));
   if (decode_ == true) {
     Status rc = Decode(image, &image);
     if (rc.IsError()) {
@@ -219,6 +230,18 @@ Status ManifestOp::LoadBuffer(const std::vector<int64_t> &keys, std::unique_ptr<
   return Status::OK();
 }
 
+Status ManifestOp::ReadAhead(const std::vector<int64_t> &keys) {
+  if (file_reader_ == nullptr) {
+    return Status::OK();
+  }
+  std::vector<std::string> paths;
+  paths.reserve(keys.size());
+  for (const auto &key : keys) {
+    paths.push_back(image_labelname_[static_cast<size_t>(key)].first);
+  }
+  return file_reader_->Submit(paths);
+}
+
 void ManifestOp::Print(std::ostream &out, bool show_all) const {
   if (!show_all) {
     // Call the super class for displaying any common 1-liner info
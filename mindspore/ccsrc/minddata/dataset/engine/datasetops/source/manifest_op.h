@@ -29,6 +29,7 @@
 #include "minddata/dataset/engine/datasetops/source/io_block.h"
 #include "minddata/dataset/engine/datasetops/source/sampler/sampler.h"
 #include "minddata/dataset/kernels/image/image_utils.h"
+#include "minddata/dataset/util/async_file_reader.h"
 #include "minddata/dataset/util/queue.h"
 #include "minddata/dataset/util/services.h"
 #include "minddata/dataset/util/status.h"
@@ -207,6 +208,11 @@ class ManifestOp : public ParallelOp, public RandomAccessOp {
   // @return Status - The error code return
   Status LoadBuffer(const std::vector<int64_t> &keys, std::unique_ptr<DataBuffer> *db);
 
+  // Submit the image files of the rows of an IOBlock to the file reader, before the IOBlock goes to a worker
+  // @param const std::vector<int64_t> &keys - keys in ioblock
+  // @return Status - The error code return
+  Status ReadAhead(const std::vector<int64_t> &keys);
+
   // Parse manifest file to get image path and label and so on.
   // @return Status - The error code return
   Status ParseManifestFile();
@@ -243,6 +249,7 @@ class ManifestOp : public ParallelOp, public RandomAccessOp {
   int64_t buf_cnt_;
 
   WaitPost wp_;
+  std::unique_ptr<AsyncFileReader> file_reader_;  // reads the image files ahead of the workers, null if off
   QueueList<std::unique_ptr<IOBlock>> io_block_queues_;
   std::map<std::string, int32_t> label_index_;
   std::vector<std::pair<std::string, std::vector<std::string>>> image_labelname_;
@@ -266,21 +266,22 @@ Status MindRecordOp::GetBufferFromReader(std::unique_ptr<DataBuffer> *fetched_bu
   std::unique_ptr<TensorQTable> tensor_table = std::make_unique<TensorQTable>();
   for (int32_t i = 0; i < rows_per_buffer_; ++i) {
     int32_t row_id = buffer_id * rows_per_buffer_ + i;
-    auto rc = shard_reader_->GetNextById(row_id, worker_id);
+    std::vector<uint8_t> columns_label;
+    auto rc = shard_reader_->GetNextById(row_id, worker_id, &columns_label);
     auto task_type = rc.first;
     auto tupled_buffer = rc.second;
     if (task_type == mindrecord::TaskType::kPaddedTask) {
       TensorRow tensor_row;
-      RETURN_IF_NOT_OK(LoadTensorRow(&tensor_row, {}, mindrecord::json(), task_type));
+      RETURN_IF_NOT_OK(LoadTensorRow(&tensor_row, {}, mindrecord::json(), {}, task_type));
       tensor_table->push_back(std::move(tensor_row));
     }
     if (tupled_buffer.empty()) break;
     if (task_type == mindrecord::TaskType::kCommonTask) {
       for (const auto &tupled_row : tupled_buffer) {
-        std::vector<uint8_t> columns_blob = std::get<0>(tupled_row);
-        mindrecord::json columns_json = std::get<1>(tupled_row);
+        const std::vector<uint8_t> &columns_blob = std::get<0>(tupled_row);
+        const mindrecord::json &columns_json = std::get<1>(tupled_row);
         TensorRow tensor_row;
-        RETURN_IF_NOT_OK(LoadTensorRow(&tensor_row, columns_blob, columns_json, task_type));
+        RETURN_IF_NOT_OK(LoadTensorRow(&tensor_row, columns_blob, columns_json, columns_label, task_type));
         tensor_table->push_back(std::move(tensor_row));
       }
     }
@@ -292,7 +293,8 @@ Status MindRecordOp::GetBufferFromReader(std::unique_ptr<DataBuffer> *fetched_bu
 }
 
 Status MindRecordOp::LoadTensorRow(TensorRow *tensor_row, const std::vector<uint8_t> &columns_blob,
-                                   const mindrecord::json &columns_json, const mindrecord::TaskType task_type) {
+                                   const mindrecord::json &columns_json, const std::vector<uint8_t> &columns_label,
+                                   const mindrecord::TaskType task_type) {
   for (uint32_t i_col = 0; i_col < columns_to_load_.size(); i_col++) {
     auto column_name = columns_to_load_[i_col];
 
@@ -333,8 +335,8 @@ Status MindRecordOp::LoadTensorRow(TensorRow *tensor_row, const std::vector<uint
       }
     } else {
       auto has_column =
-        shard_column->GetColumnValueByName(column_name, columns_blob, columns_json, &data, &data_ptr, &n_bytes,
-                                           &column_data_type, &column_data_type_size, &column_shape);
+        shard_column->GetColumnValueByName(column_name, columns_blob, columns_json, columns_label, &data, &data_ptr,
+                                           &n_bytes, &column_data_type, &column_data_type_size, &column_shape);
       if (has_column == MSRStatus::FAILED) {
         RETURN_STATUS_UNEXPECTED("Invalid data, failed to retrieve data from mindrecord reader.");
       }
@@ -421,6 +423,7 @@ Status MindRecordOp::LaunchThreadAndInitOp() {
 
   RETURN_IF_NOT_OK(io_blk_queues_.Register(tree_->AllTasks()));
   RETURN_IF_NOT_OK(shard_reader_wait_post_.Register(tree_->AllTasks()));
+  shard_reader_->SetReadAhead(GlobalContext::config_manager()->file_read_ahead());
   if (shard_reader_->Launch(true) == MSRStatus::FAILED) {
     RETURN_STATUS_UNEXPECTED("MindRecordOp launch failed.");
   }
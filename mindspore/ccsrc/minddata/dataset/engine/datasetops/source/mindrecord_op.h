@@ -220,8 +220,10 @@ class MindRecordOp : public ParallelOp {
   // @param tensor_row - the tensor row to put the parsed data in
   // @param columns_blob - the blob data received from the reader
   // @param columns_json - the data for fields received from the reader
+  // @param columns_label - the packed label columns received from the reader, empty when they are in columns_json
   Status LoadTensorRow(TensorRow *tensor_row, const std::vector<uint8_t> &columns_blob,
-                       const mindrecord::json &columns_json, const mindrecord::TaskType task_type);
+                       const mindrecord::json &columns_json, const std::vector<uint8_t> &columns_label,
+                       const mindrecord::TaskType task_type);
 
   // Private function for computing the assignment of the column name map.
   // @return - Status
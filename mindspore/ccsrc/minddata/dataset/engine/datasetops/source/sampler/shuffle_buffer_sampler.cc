@@ -0,0 +1,132 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/datasetops/source/sampler/shuffle_buffer_sampler.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+
+namespace mindspore {
+namespace dataset {
+ShuffleBufferSampler::ShuffleBufferSampler(int32_t shuffle_size, uint32_t shuffle_seed, bool reshuffle_each_epoch,
+                                           int64_t samples_per_buffer)
+    : Sampler(0, samples_per_buffer),
+      shuffle_size_(shuffle_size),
+      shuffle_seed_(shuffle_seed),
+      reshuffle_each_epoch_(reshuffle_each_epoch),
+      rng_(shuffle_seed),
+      next_id_(0) {}
+
+Status ShuffleBufferSampler::ShuffleIds() {
+  std::vector<int64_t> ids;
+  if (HasChildSampler()) {
+    // Take all the ids of the child for this epoch, the buffer shuffle goes over them in their order
+    std::unique_ptr<DataBuffer> child_buffer;
+    RETURN_IF_NOT_OK(child_[0]->GetNextSample(&child_buffer));
+    while (!child_buffer->eoe()) {
+      std::shared_ptr<Tensor> child_ids;
+      RETURN_IF_NOT_OK(child_buffer->GetTensor(&child_ids, 0, 0));
+      ids.insert(ids.end(), child_ids->begin<int64_t>(), child_ids->end<int64_t>());
+      RETURN_IF_NOT_OK(child_[0]->GetNextSample(&child_buffer));
+    }
+  } else {
+    ids.resize(num_rows_);
+    for (int64_t i = 0; i < num_rows_; i++) {
+      ids[i] = i;
+    }
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(static_cast<int64_t>(ids.size()) == num_samples_,
+                               "ShuffleBufferSampler expected " + std::to_string(num_samples_) + " ids, but got " +
+                                 std::to_string(ids.size()));
+
+  // The steps of ShuffleOp: a random slot of the buffer goes out, the last slot moves into it, and the next id
+  // refills the last slot until there is none left and the buffer drains
+  shuffled_ids_.clear();
+  shuffled_ids_.reserve(ids.size());
+  size_t next = std::min(ids.size(), static_cast<size_t>(shuffle_size_));
+  std::vector<int64_t> buffer(ids.begin(), ids.begin() + next);
+  int64_t last = static_cast<int64_t>(buffer.size()) - 1;
+  while (last >= 0) {
+    int64_t random_slot = rng_() % (last + 1);
+    shuffled_ids_.push_back(buffer[random_slot]);
+    buffer[random_slot] = buffer[last];
+    if (next < ids.size()) {
+      buffer[last] = ids[next++];
+    } else {
+      last--;
+    }
+  }
+  return Status::OK();
+}
+
+Status ShuffleBufferSampler::GetNextSample(std::unique_ptr<DataBuffer> *out_buffer) {
+  if (next_id_ > num_samples_) {
+    RETURN_STATUS_UNEXPECTED("ShuffleBufferSampler Internal Error");
+  } else if (next_id_ == num_samples_) {
+    (*out_buffer) = std::make_unique<DataBuffer>(0, DataBuffer::kDeBFlagEOE);
+  } else {
+    if (next_id_ == 0) {
+      RETURN_IF_NOT_OK(ShuffleIds());
+    }
+    (*out_buffer) = std::make_unique<DataBuffer>(next_id_, DataBuffer::kDeBFlagNone);
+
+    std::shared_ptr<Tensor> sampleIds;
+    int64_t last_id = std::min(samples_per_buffer_ + next_id_, num_samples_);
+    RETURN_IF_NOT_OK(CreateSamplerTensor(&sampleIds, last_id - next_id_));
+    std::copy(shuffled_ids_.begin() + next_id_, shuffled_ids_.begin() + last_id, sampleIds->begin<int64_t>());
+    next_id_ = last_id;
+    TensorRow row(1, sampleIds);
+    (*out_buffer)->set_tensor_table(std::make_unique<TensorQTable>(1, row));
+  }
+  return Status::OK();
+}
+
+Status ShuffleBufferSampler::InitSampler() {
+  // All the ids of the child, or of the dataset, are shuffled
+  num_samples_ = num_rows_;
+  CHECK_FAIL_RETURN_UNEXPECTED(num_rows_ > 0, "Invalid parameter, num_rows must be greater than 0, but got num_rows: " +
+                                                std::to_string(num_rows_));
+  CHECK_FAIL_RETURN_UNEXPECTED(shuffle_size_ > 1, "Invalid parameter, shuffle buffer size must be greater than 1.");
+  samples_per_buffer_ = samples_per_buffer_ > num_samples_ ? num_samples_ : samples_per_buffer_;
+  return Status::OK();
+}
+
+Status ShuffleBufferSampler::ResetSampler() {
+  CHECK_FAIL_RETURN_UNEXPECTED(next_id_ == num_samples_, "ERROR Reset() called early/late");
+  next_id_ = 0;
+  // Like ShuffleOp, the generator goes on drawing in the next epoch unless every epoch is shuffled the same way
+  if (!reshuffle_each_epoch_) {
+    rng_ = std::mt19937_64(shuffle_seed_);
+  }
+
+  if (HasChildSampler()) {
+    RETURN_IF_NOT_OK(child_[0]->ResetSampler());
+  }
+
+  return Status::OK();
+}
+
+void ShuffleBufferSampler::Print(std::ostream &out, bool show_all) const {
+  out << "\nSampler: ShuffleBufferSampler";
+  if (show_all) {
+    // Call the super class for displaying any common detailed info
+    Sampler::Print(out, show_all);
+    // Then add our own info
+    out << "\nshuffle_size_: " << shuffle_size_ << "\nshuffle_seed_: " << shuffle_seed_;
+  }
+}
+}  // namespace dataset
+}  // namespace mindspore
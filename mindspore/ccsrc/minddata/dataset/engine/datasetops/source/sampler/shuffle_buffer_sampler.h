@@ -0,0 +1,72 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_SAMPLER_SHUFFLE_BUFFER_SAMPLER_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_SAMPLER_SHUFFLE_BUFFER_SAMPLER_H_
+
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "minddata/dataset/engine/datasetops/source/sampler/sampler.h"
+
+namespace mindspore {
+namespace dataset {
+// Runs the buffer shuffle of ShuffleOp over the sample ids instead of the rows. The ids come out in the order
+// ShuffleOp would give the rows read with them, with the same seed, so a leaf sampled this way gives the same
+// output as the leaf followed by a ShuffleOp while only the ids are held.
+class ShuffleBufferSampler : public Sampler {
+ public:
+  // Constructor
+  // @param shuffle_size - The size of the shuffle buffer
+  // @param shuffle_seed - The seed of the random generator
+  // @param reshuffle_each_epoch - T/F to keep drawing from the generator after an epoch instead of seeding it again
+  // @param int64_t samples_per_buffer - Num of Sampler Ids to fetch via 1 GetNextBuffer call
+  ShuffleBufferSampler(int32_t shuffle_size, uint32_t shuffle_seed, bool reshuffle_each_epoch,
+                       int64_t samples_per_buffer = std::numeric_limits<int64_t>::max());
+
+  // Destructor.
+  ~ShuffleBufferSampler() = default;
+
+  // Op calls this to get next Buffer that contains all the sampleIds
+  // @param std::unique_ptr<DataBuffer> pBuffer - Buffer to be returned to StorageOp
+  // @return - The error code return
+  Status GetNextSample(std::unique_ptr<DataBuffer> *out_buffer) override;
+
+  // meant to be called by base class or python
+  Status InitSampler() override;
+
+  // for next epoch of sampleIds
+  // @return - The error code return
+  Status ResetSampler() override;
+
+  void Print(std::ostream &out, bool show_all) const override;
+
+ private:
+  // Fills shuffled_ids_ with the ids of the epoch, in the order of the buffer shuffle
+  // @return - The error code return
+  Status ShuffleIds();
+
+  int32_t shuffle_size_;
+  uint32_t shuffle_seed_;
+  bool reshuffle_each_epoch_;
+  std::mt19937_64 rng_;  // Same generator and same draws as ShuffleOp
+  std::vector<int64_t> shuffled_ids_;
+  int64_t next_id_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_SAMPLER_SHUFFLE_BUFFER_SAMPLER_H_
@@ -0,0 +1,460 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/datasetops/source/tf_example_decoder.h"
+
+#include <algorithm>
+#include <cstring>
+#include "./securec.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+// Wire types of the protobuf encoding
+constexpr uint32_t kWireVarint = 0;
+constexpr uint32_t kWireFixed64 = 1;
+constexpr uint32_t kWireLength = 2;
+constexpr uint32_t kWireFixed32 = 5;
+
+// Field numbers of the messages of example.proto and feature.proto
+constexpr uint32_t kExampleFeatures = 1;
+constexpr uint32_t kFeaturesFeature = 1;
+constexpr uint32_t kMapKey = 1;
+constexpr uint32_t kMapValue = 2;
+constexpr uint32_t kFeatureBytesList = 1;
+constexpr uint32_t kFeatureFloatList = 2;
+constexpr uint32_t kFeatureInt64List = 3;
+constexpr uint32_t kListValue = 1;
+
+constexpr int32_t kMaxVarintBytes = 10;
+
+bool ReadVarint(const unsigned char **p, const unsigned char *end, uint64_t *value) {
+  uint64_t result = 0;
+  for (int32_t i = 0; i < kMaxVarintBytes && *p < end; i++) {
+    uint8_t byte = *(*p)++;
+    result |= static_cast<uint64_t>(byte & 0x7F) << (7 * i);
+    if ((byte & 0x80) == 0) {
+      *value = result;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ReadTag(const unsigned char **p, const unsigned char *end, uint32_t *field, uint32_t *wire_type) {
+  uint64_t tag = 0;
+  if (!ReadVarint(p, end, &tag) || (tag >> 3) == 0 || (tag >> 3) > UINT32_MAX) {
+    return false;
+  }
+  *field = static_cast<uint32_t>(tag >> 3);
+  *wire_type = static_cast<uint32_t>(tag & 0x7);
+  return true;
+}
+
+bool ReadLengthDelimited(const unsigned char **p, const unsigned char *end, const unsigned char **data,
+                         int64_t *size) {
+  uint64_t length = 0;
+  if (!ReadVarint(p, end, &length) || length > static_cast<uint64_t>(end - *p)) {
+    return false;
+  }
+  *data = *p;
+  *size = static_cast<int64_t>(length);
+  *p += length;
+  return true;
+}
+
+bool SkipField(const unsigned char **p, const unsigned char *end, uint32_t wire_type) {
+  uint64_t value = 0;
+  const unsigned char *data = nullptr;
+  int64_t size = 0;
+  switch (wire_type) {
+    case kWireVarint:
+      return ReadVarint(p, end, &value);
+    case kWireFixed64:
+      if (end - *p < 8) return false;
+      *p += 8;
+      return true;
+    case kWireLength:
+      return ReadLengthDelimited(p, end, &data, &size);
+    case kWireFixed32:
+      if (end - *p < 4) return false;
+      *p += 4;
+      return true;
+    default:
+      // Groups are not used by example.proto
+      return false;
+  }
+}
+
+// Count the values of an Int64List, packed or not
+bool CountInt64List(const unsigned char *p, const unsigned char *end, int64_t *count) {
+  *count = 0;
+  uint32_t field = 0;
+  uint32_t wire_type = 0;
+  uint64_t value = 0;
+  while (p < end) {
+    if (!ReadTag(&p, end, &field, &wire_type)) return false;
+    if (field == kListValue && wire_type == kWireLength) {
+      const unsigned char *data = nullptr;
+      int64_t size = 0;
+      if (!ReadLengthDelimited(&p, end, &data, &size)) return false;
+      const unsigned char *data_end = data + size;
+      while (data < data_end) {
+        if (!ReadVarint(&data, data_end, &value)) return false;
+        (*count)++;
+      }
+    } else if (field == kListValue && wire_type == kWireVarint) {
+      if (!ReadVarint(&p, end, &value)) return false;
+      (*count)++;
+    } else if (!SkipField(&p, end, wire_type)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Write the values of an Int64List, that CountInt64List has validated, into a buffer cast to T
+template <typename T>
+void FillInt64List(const unsigned char *p, const unsigned char *end, T *out) {
+  uint32_t field = 0;
+  uint32_t wire_type = 0;
+  uint64_t value = 0;
+  while (p < end) {
+    (void)ReadTag(&p, end, &field, &wire_type);
+    if (field == kListValue && wire_type == kWireLength) {
+      const unsigned char *data = nullptr;
+      int64_t size = 0;
+      (void)ReadLengthDelimited(&p, end, &data, &size);
+      const unsigned char *data_end = data + size;
+      while (data < data_end) {
+        (void)ReadVarint(&data, data_end, &value);
+        *out++ = static_cast<T>(static_cast<int64_t>(value));
+      }
+    } else if (field == kListValue && wire_type == kWireVarint) {
+      (void)ReadVarint(&p, end, &value);
+      *out++ = static_cast<T>(static_cast<int64_t>(value));
+    } else {
+      (void)SkipField(&p, end, wire_type);
+    }
+  }
+}
+}  // namespace
+
+TFExampleDecoder::TFExampleDecoder(const DataSchema *data_schema) : data_schema_(data_schema) {
+  int32_t num_columns = data_schema_->NumColumns();
+  column_names_.reserve(num_columns);
+  for (int32_t col = 0; col < num_columns; ++col) {
+    column_names_.push_back(data_schema_->column(col).name());
+  }
+  // The names are not moved anymore, the views stay valid
+  for (int32_t col = 0; col < num_columns; ++col) {
+    column_index_[column_names_[col]] = col;
+  }
+  features_.resize(num_columns);
+}
+
+Status TFExampleDecoder::Decode(const unsigned char *data, int64_t size, TensorRow *row, bool *decoded) {
+  RETURN_UNEXPECTED_IF_NULL(row);
+  RETURN_UNEXPECTED_IF_NULL(decoded);
+  *decoded = false;
+  std::fill(features_.begin(), features_.end(), Span());
+
+  const unsigned char *p = data;
+  const unsigned char *end = data + size;
+  uint32_t field = 0;
+  uint32_t wire_type = 0;
+  while (p < end) {
+    if (!ReadTag(&p, end, &field, &wire_type)) return Status::OK();
+    if (field == kExampleFeatures && wire_type == kWireLength) {
+      // Features given more than once are merged, the entries of the later ones win
+      Span features;
+      if (!ReadLengthDelimited(&p, end, &features.data, &features.size) || !ScanFeatures(features)) {
+        return Status::OK();
+      }
+    } else if (!SkipField(&p, end, wire_type)) {
+      return Status::OK();
+    }
+  }
+
+  int32_t num_columns = data_schema_->NumColumns();
+  row->resize(num_columns);
+  *decoded = true;
+  for (int32_t col = 0; col < num_columns; ++col) {
+    // A missing column is reported by the protobuf path
+    if (features_[col].size < 0) {
+      *decoded = false;
+      return Status::OK();
+    }
+    RETURN_IF_NOT_OK(DecodeFeature(data_schema_->column(col), features_[col], &(*row)[col], decoded));
+    if (!*decoded) return Status::OK();
+  }
+  return Status::OK();
+}
+
+bool TFExampleDecoder::ScanFeatures(Span features) {
+  const unsigned char *p = features.data;
+  const unsigned char *end = features.data + features.size;
+  uint32_t field = 0;
+  uint32_t wire_type = 0;
+  while (p < end) {
+    if (!ReadTag(&p, end, &field, &wire_type)) return false;
+    if (field != kFeaturesFeature || wire_type != kWireLength) {
+      if (!SkipField(&p, end, wire_type)) return false;
+      continue;
+    }
+    Span entry;
+    if (!ReadLengthDelimited(&p, end, &entry.data, &entry.size)) return false;
+    const unsigned char *q = entry.data;
+    const unsigned char *entry_end = entry.data + entry.size;
+    Span key{nullptr, 0};
+    Span value;
+    bool has_key = false;
+    while (q < entry_end) {
+      if (!ReadTag(&q, entry_end, &field, &wire_type)) return false;
+      if (field == kMapKey && wire_type == kWireLength && !has_key) {
+        if (!ReadLengthDelimited(&q, entry_end, &key.data, &key.size)) return false;
+        has_key = true;
+      } else if (field == kMapValue && wire_type == kWireLength && value.size < 0) {
+        if (!ReadLengthDelimited(&q, entry_end, &value.data, &value.size)) return false;
+      } else if (field == kMapKey || field == kMapValue) {
+        // Keys and values given twice in an entry are merged by protobuf
+        return false;
+      } else if (!SkipField(&q, entry_end, wire_type)) {
+        return false;
+      }
+    }
+    auto it = column_index_.find(std::string_view(reinterpret_cast<const char *>(key.data), key.size));
+    if (it != column_index_.end()) {
+      // An entry without a value holds a Feature of no kind, which the protobuf path reports
+      if (value.size < 0) return false;
+      features_[it->second] = value;
+    }
+  }
+  return true;
+}
+
+Status TFExampleDecoder::DecodeFeature(const ColDescriptor &current_col, Span feature, std::shared_ptr<Tensor> *out,
+                                       bool *decoded) {
+  *decoded = false;
+  const unsigned char *p = feature.data;
+  const unsigned char *end = feature.data + feature.size;
+  uint32_t field = 0;
+  uint32_t wire_type = 0;
+  uint32_t kind = 0;
+  Span list;
+  while (p < end) {
+    if (!ReadTag(&p, end, &field, &wire_type)) return Status::OK();
+    if (field == kFeatureBytesList || field == kFeatureFloatList || field == kFeatureInt64List) {
+      // The lists of a oneof given more than once are merged or replaced by protobuf
+      if (wire_type != kWireLength || kind != 0) return Status::OK();
+      if (!ReadLengthDelimited(&p, end, &list.data, &list.size)) return Status::OK();
+      kind = field;
+    } else if (!SkipField(&p, end, wire_type)) {
+      return Status::OK();
+    }
+  }
+
+  switch (kind) {
+    case kFeatureBytesList:
+      return DecodeBytesList(current_col, list, out, decoded);
+    case kFeatureFloatList:
+      return DecodeFloatList(current_col, list, out, decoded);
+    case kFeatureInt64List:
+      return DecodeInt64List(current_col, list, out, decoded);
+    default:
+      return Status::OK();
+  }
+}
+
+Status TFExampleDecoder::DecodeBytesList(const ColDescriptor &current_col, Span list, std::shared_ptr<Tensor> *out,
+                                         bool *decoded) {
+  const DataType type = current_col.type();
+  if (type != DataType::DE_UINT8 && type != DataType::DE_INT8 && type != DataType::DE_STRING) {
+    return Status::OK();
+  }
+
+  bytes_.clear();
+  const unsigned char *p = list.data;
+  const unsigned char *end = list.data + list.size;
+  uint32_t field = 0;
+  uint32_t wire_type = 0;
+  while (p < end) {
+    if (!ReadTag(&p, end, &field, &wire_type)) return Status::OK();
+    if (field == kListValue && wire_type == kWireLength) {
+      Span value;
+      if (!ReadLengthDelimited(&p, end, &value.data, &value.size)) return Status::OK();
+      bytes_.emplace_back(reinterpret_cast<const char *>(value.data), value.size);
+    } else if (!SkipField(&p, end, wire_type)) {
+      return Status::OK();
+    }
+  }
+  int32_t num_elements = static_cast<int32_t>(bytes_.size());
+
+  if (type == DataType::DE_STRING) {
+    TensorShape shape = TensorShape::CreateScalar();
+    RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(num_elements, &shape));
+    if (shape.NumOfElements() != num_elements) return Status::OK();
+    RETURN_IF_NOT_OK(Tensor::CreateFromVector(bytes_, shape, out));
+    *decoded = true;
+    return Status::OK();
+  }
+
+  uint64_t max_size = 0;
+  for (const auto &value : bytes_) max_size = std::max<uint64_t>(max_size, value.size());
+  int64_t pad_size = max_size;
+
+  // if user provides a shape in the form of [-1, d1, 2d, ... , dn], we need to pad to d1 * d2 * ... * dn
+  if (current_col.hasShape()) {
+    TensorShape cur_shape = current_col.shape();
+    if (cur_shape.Size() >= 2 && cur_shape[0] == TensorShape::kDimUnknown) {
+      int64_t new_pad_size = 1;
+      for (int i = 1; i < cur_shape.Size(); ++i) {
+        if (cur_shape[i] == TensorShape::kDimUnknown) {
+          std::string err_msg =
+            "Invalid data, more than one unknown dimension in the shape of column: " + current_col.name();
+          RETURN_STATUS_UNEXPECTED(err_msg);
+        }
+        new_pad_size *= cur_shape[i];
+      }
+      pad_size = new_pad_size;
+    }
+  }
+  // Values longer than the padding fail in the protobuf path
+  if (static_cast<int64_t>(max_size) > pad_size) return Status::OK();
+
+  TensorShape current_shape = TensorShape::CreateScalar();
+  RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(num_elements * pad_size, &current_shape));
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(current_shape, type, out));
+
+  unsigned char *current_tensor_addr = (*out)->GetMutableBuffer();
+  int64_t tensor_bytes_remaining = (*out)->SizeInBytes();
+  for (const auto &value : bytes_) {
+    CHECK_FAIL_RETURN_UNEXPECTED(tensor_bytes_remaining >= pad_size, "Invalid data, bytes list larger than tensor.");
+    if (!value.empty()) {
+      int ret_code = memcpy_s(current_tensor_addr, tensor_bytes_remaining, value.data(), value.size());
+      CHECK_FAIL_RETURN_UNEXPECTED(ret_code == 0, "memcpy_s failed when reading bytesList element into Tensor");
+    }
+    int64_t chars_to_pad = pad_size - value.size();
+    if (chars_to_pad > 0) {
+      int ret_code = memset_s(current_tensor_addr + value.size(), tensor_bytes_remaining - value.size(),
+                              static_cast<int>(' '), chars_to_pad);
+      CHECK_FAIL_RETURN_UNEXPECTED(ret_code == 0, "memset_s failed when padding Tensor");
+    }
+    current_tensor_addr += pad_size;
+    tensor_bytes_remaining -= pad_size;
+  }
+  *decoded = true;
+  return Status::OK();
+}
+
+Status TFExampleDecoder::DecodeFloatList(const ColDescriptor &current_col, Span list, std::shared_ptr<Tensor> *out,
+                                         bool *decoded) {
+  if (current_col.type() != DataType::DE_FLOAT32) {
+    return Status::OK();
+  }
+
+  // First pass validates the list and counts the values, packed or not
+  const unsigned char *end = list.data + list.size;
+  int64_t num_elements = 0;
+  const unsigned char *p = list.data;
+  uint32_t field = 0;
+  uint32_t wire_type = 0;
+  while (p < end) {
+    if (!ReadTag(&p, end, &field, &wire_type)) return Status::OK();
+    if (field == kListValue && wire_type == kWireLength) {
+      Span values;
+      if (!ReadLengthDelimited(&p, end, &values.data, &values.size)) return Status::OK();
+      if (values.size % sizeof(float) != 0) return Status::OK();
+      num_elements += values.size / static_cast<int64_t>(sizeof(float));
+    } else if (field == kListValue && wire_type == kWireFixed32) {
+      if (end - p < static_cast<int64_t>(sizeof(float))) return Status::OK();
+      p += sizeof(float);
+      num_elements++;
+    } else if (!SkipField(&p, end, wire_type)) {
+      return Status::OK();
+    }
+  }
+
+  TensorShape current_shape = TensorShape::CreateUnknownRankShape();
+  RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(num_elements, &current_shape));
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(current_shape, current_col.type(), out));
+  CHECK_FAIL_RETURN_UNEXPECTED((*out)->SizeInBytes() == num_elements * static_cast<int64_t>(sizeof(float)),
+                               "Invalid data, float list does not match the shape of column: " + current_col.name());
+
+  // Second pass copies the little endian values as they are
+  unsigned char *dest = (*out)->GetMutableBuffer();
+  p = list.data;
+  while (p < end) {
+    (void)ReadTag(&p, end, &field, &wire_type);
+    if (field == kListValue && wire_type == kWireLength) {
+      Span values;
+      (void)ReadLengthDelimited(&p, end, &values.data, &values.size);
+      if (values.size > 0) {
+        (void)memcpy(dest, values.data, values.size);
+        dest += values.size;
+      }
+    } else if (field == kListValue && wire_type == kWireFixed32) {
+      (void)memcpy(dest, p, sizeof(float));
+      dest += sizeof(float);
+      p += sizeof(float);
+    } else {
+      (void)SkipField(&p, end, wire_type);
+    }
+  }
+  *decoded = true;
+  return Status::OK();
+}
+
+Status TFExampleDecoder::DecodeInt64List(const ColDescriptor &current_col, Span list, std::shared_ptr<Tensor> *out,
+                                         bool *decoded) {
+  const DataType type = current_col.type();
+  if (!type.IsInt()) {
+    return Status::OK();
+  }
+  const unsigned char *end = list.data + list.size;
+  int64_t num_elements = 0;
+  if (!CountInt64List(list.data, end, &num_elements)) {
+    return Status::OK();
+  }
+
+  TensorShape current_shape = TensorShape::CreateUnknownRankShape();
+  RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(num_elements, &current_shape));
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(current_shape, type, out));
+  CHECK_FAIL_RETURN_UNEXPECTED((*out)->shape().NumOfElements() == num_elements,
+                               "Invalid data, int list does not match the shape of column: " + current_col.name());
+
+  unsigned char *buffer = (*out)->GetMutableBuffer();
+  if (type == DataType::DE_UINT64) {
+    FillInt64List(list.data, end, reinterpret_cast<uint64_t *>(buffer));
+  } else if (type == DataType::DE_INT64) {
+    FillInt64List(list.data, end, reinterpret_cast<int64_t *>(buffer));
+  } else if (type == DataType::DE_UINT32) {
+    FillInt64List(list.data, end, reinterpret_cast<uint32_t *>(buffer));
+  } else if (type == DataType::DE_INT32) {
+    FillInt64List(list.data, end, reinterpret_cast<int32_t *>(buffer));
+  } else if (type == DataType::DE_UINT16) {
+    FillInt64List(list.data, end, reinterpret_cast<uint16_t *>(buffer));
+  } else if (type == DataType::DE_INT16) {
+    FillInt64List(list.data, end, reinterpret_cast<int16_t *>(buffer));
+  } else if (type == DataType::DE_UINT8) {
+    FillInt64List(list.data, end, reinterpret_cast<uint8_t *>(buffer));
+  } else {
+    FillInt64List(list.data, end, reinterpret_cast<int8_t *>(buffer));
+  }
+  *decoded = true;
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
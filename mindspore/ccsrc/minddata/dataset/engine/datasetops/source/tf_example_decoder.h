@@ -0,0 +1,84 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_TF_EXAMPLE_DECODER_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_TF_EXAMPLE_DECODER_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/core/tensor_row.h"
+#include "minddata/dataset/engine/data_schema.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+// Decodes the serialized dataengine::Example of a tfrecord straight into the tensors of the columns of a schema.
+// It scans the protobuf wire format in place instead of building the Example message, the values of the features
+// are copied once, from the record into the tensors. The decoder keeps its scratch space between records, one
+// decoder is meant to be used by one thread.
+// Records it does not handle the same way protobuf would, like a feature given twice in one Feature message or a
+// feature whose type does not match its column, are left to the caller: Decode reports them as not decoded and the
+// caller parses them with protobuf, which also produces the error messages of the bad records.
+class TFExampleDecoder {
+ public:
+  // Constructor
+  // @param data_schema - The columns to decode, the rows are filled in the order of the schema
+  explicit TFExampleDecoder(const DataSchema *data_schema);
+
+  ~TFExampleDecoder() = default;
+
+  // Decode one record
+  // @param data - The serialized Example
+  // @param size - The number of bytes of the serialized Example
+  // @param row - The row to fill, resized to the number of columns of the schema
+  // @param decoded - Set to false when the record has to be parsed by protobuf, the row is not valid then
+  // @return Status - The error code return
+  Status Decode(const unsigned char *data, int64_t size, TensorRow *row, bool *decoded);
+
+ private:
+  // A length delimited field of the record
+  struct Span {
+    const unsigned char *data = nullptr;
+    int64_t size = -1;  // -1 when the field is not in the record
+  };
+
+  // Find the Feature message of each column
+  // @return bool - false when the record has to be parsed by protobuf
+  bool ScanFeatures(Span features);
+
+  // Decode the Feature message of a column into a tensor
+  // @return Status - The error code return, decoded is false when the feature has to be parsed by protobuf
+  Status DecodeFeature(const ColDescriptor &current_col, Span feature, std::shared_ptr<Tensor> *out, bool *decoded);
+
+  Status DecodeBytesList(const ColDescriptor &current_col, Span list, std::shared_ptr<Tensor> *out, bool *decoded);
+
+  Status DecodeFloatList(const ColDescriptor &current_col, Span list, std::shared_ptr<Tensor> *out, bool *decoded);
+
+  Status DecodeInt64List(const ColDescriptor &current_col, Span list, std::shared_ptr<Tensor> *out, bool *decoded);
+
+  const DataSchema *data_schema_;
+  std::unordered_map<std::string_view, int32_t> column_index_;  // Views of the names in column_names_
+  std::vector<std::string> column_names_;
+  std::vector<Span> features_;           // The Feature message of each column in the current record
+  std::vector<std::string_view> bytes_;  // The values of the current bytes list
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_TF_EXAMPLE_DECODER_H_
@@ -33,6 +33,7 @@
 #include "minddata/dataset/engine/connector.h"
 #include "minddata/dataset/engine/data_schema.h"
 #include "minddata/dataset/engine/datasetops/source/io_block.h"
+#include "minddata/dataset/engine/datasetops/source/tf_example_decoder.h"
 #include "minddata/dataset/engine/db_connector.h"
 #include "minddata/dataset/engine/execution_tree.h"
 #include "minddata/dataset/engine/jagged_connector.h"
@@ -154,7 +155,8 @@ TFReaderOp::TFReaderOp(int32_t num_workers, int32_t worker_connector_size, int64
       load_jagged_connector_(true),
       num_rows_(0),
       num_rows_per_shard_(0),
-      equal_rows_per_shard_(equal_rows_per_shard) {
+      equal_rows_per_shard_(equal_rows_per_shard),
+      verify_crc_(GlobalContext::config_manager()->tfrecord_verify_crc()) {
   worker_connector_size_ = worker_connector_size;
 }
 
@@ -577,36 +579,69 @@ Status TFReaderOp::LoadFile(const std::string &filename, const int64_t start_off
   int64_t rows_total = 0;
   std::unique_ptr<DataBuffer> current_buffer = std::make_unique<DataBuffer>(0, DataBuffer::BufferFlags::kDeBFlagNone);
   std::unique_ptr<TensorQTable> new_tensor_table = std::make_unique<TensorQTable>();
+  TFExampleDecoder decoder(data_schema_.get());
+  // Reused by all the records of the file
+  std::string serialized_example;
 
   while (reader.peek() != EOF) {
     if (!load_jagged_connector_) {
       break;
     }
+    // The rows after the range of this worker are not needed
+    if (start_offset != kInvalidOffset && rows_total >= end_offset) {
+      break;
+    }
     RETURN_IF_INTERRUPTED();
 
     // read length
     int64_t record_length = 0;
     (void)reader.read(reinterpret_cast<char *>(&record_length), static_cast<std::streamsize>(sizeof(int64_t)));
 
-    // ignore crc header
-    (void)reader.ignore(static_cast<std::streamsize>(sizeof(int32_t)));
+    // read crc header
+    uint32_t length_crc = 0;
+    (void)reader.read(reinterpret_cast<char *>(&length_crc), static_cast<std::streamsize>(sizeof(uint32_t)));
+    if (verify_crc_ && length_crc != system::Crc32c::GetMaskCrc32cValue(reinterpret_cast<char *>(&record_length),
+                                                                        sizeof(int64_t))) {
+      RETURN_STATUS_UNEXPECTED("Invalid file, failed to verify the crc of the length of record " +
+                               std::to_string(rows_total) + " in file: " + filename);
+    }
+
+    bool load_row = start_offset == kInvalidOffset || (rows_total >= start_offset && rows_total < end_offset);
+    if (!load_row && !verify_crc_) {
+      (void)reader.ignore(static_cast<std::streamsize>(record_length + sizeof(int32_t)));
+      rows_total++;
+      continue;
+    }
 
     // read serialized Example
-    std::string serialized_example;
     serialized_example.resize(record_length);
     (void)reader.read(&serialized_example[0], static_cast<std::streamsize>(record_length));
-    if (start_offset == kInvalidOffset || (rows_total >= start_offset && rows_total < end_offset)) {
-      dataengine::Example tf_file;
-      if (!tf_file.ParseFromString(serialized_example)) {
-        std::string errMsg = "Invalid file, failed to parse tfrecord file : " + serialized_example;
-        RETURN_STATUS_UNEXPECTED(errMsg);
+
+    // read crc footer
+    uint32_t data_crc = 0;
+    (void)reader.read(reinterpret_cast<char *>(&data_crc), static_cast<std::streamsize>(sizeof(uint32_t)));
+    if (verify_crc_ && data_crc != system::Crc32c::GetMaskCrc32cValue(serialized_example.data(), record_length)) {
+      RETURN_STATUS_UNEXPECTED("Invalid file, failed to verify the crc of the data of record " +
+                               std::to_string(rows_total) + " in file: " + filename);
+    }
+
+    if (load_row) {
+      TensorRow new_row;
+      bool decoded = false;
+      RETURN_IF_NOT_OK(decoder.Decode(reinterpret_cast<const unsigned char *>(serialized_example.data()),
+                                      record_length, &new_row, &decoded));
+      if (decoded) {
+        new_tensor_table->push_back(std::move(new_row));
+      } else {
+        dataengine::Example tf_file;
+        if (!tf_file.ParseFromString(serialized_example)) {
+          std::string errMsg = "Invalid file, failed to parse tfrecord file : " + serialized_example;
+          RETURN_STATUS_UNEXPECTED(errMsg);
+        }
+        RETURN_IF_NOT_OK(LoadExample(&tf_file, &new_tensor_table, rows_read));
       }
-      RETURN_IF_NOT_OK(LoadExample(&tf_file, &new_tensor_table, rows_read));
       rows_read++;
     }
-
-    // ignore crc footer
-    (void)reader.ignore(static_cast<std::streamsize>(sizeof(int32_t)));
     rows_total++;
 
     if (rows_read == rows_per_buffer_) {
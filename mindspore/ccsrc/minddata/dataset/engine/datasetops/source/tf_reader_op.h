@@ -292,7 +292,8 @@ class TFReaderOp : public ParallelOp {
   // @return Status - the error code returned.
   Status PushIoBlockQueue(int32_t index, std::unique_ptr<FilenameBlock> &&io_block);
 
-  // Reads a tf_file file and loads the data into multiple buffers.
+  // Reads a tf_file file and loads the data into multiple buffers. The records are decoded by a TFExampleDecoder,
+  // the ones it leaves to protobuf are parsed into an Example and loaded by LoadExample.
   // @param filename - the tf_file file to read.
   // @param start_offset - the start offset of file.
   // @param end_offset - the end offset of file.
@@ -414,6 +415,7 @@ class TFReaderOp : public ParallelOp {
   int64_t num_rows_;
   int64_t num_rows_per_shard_;
   bool equal_rows_per_shard_;
+  bool verify_crc_;
 };
 }  // namespace dataset
 }  // namespace mindspore
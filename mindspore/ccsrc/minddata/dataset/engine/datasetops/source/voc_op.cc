@@ -122,6 +122,7 @@ Status VOCOp::TraverseSampleIds(const std::shared_ptr<Tensor> &sample_ids, std::
     keys->push_back(*itr);
     row_cnt_++;
     if (row_cnt_ % rows_per_buffer_ == 0) {
+      RETURN_IF_NOT_OK(ReadAhead(*keys));
       RETURN_IF_NOT_OK(io_block_queues_[buf_cnt_++ % num_workers_]->Add(
         std::make_unique<IOBlock>(IOBlock(*keys, IOBlock::kDeIoBlockNone))));
       keys->clear();
@@ -148,6 +149,7 @@ Status VOCOp::operator()() {
       RETURN_IF_NOT_OK(sampler_->GetNextSample(&sampler_buffer));
     }
     if (keys.empty() == false) {
+      RETURN_IF_NOT_OK(ReadAhead(keys));
       RETURN_IF_NOT_OK(io_block_queues_[(buf_cnt_++) % num_workers_]->Add(
         std::make_unique<IOBlock>(IOBlock(keys, IOBlock::kDeIoBlockNone))));
     }
@@ -160,6 +162,9 @@ Status VOCOp::operator()() {
         RETURN_IF_NOT_OK(
           io_block_queues_[i]->Add(std::make_unique<IOBlock>(std::vector<int64_t>(), IOBlock::kDeIoBlockNone)));
       }
+      if (file_reader_ != nullptr) {
+        file_reader_->Stop();
+      }
       return Status::OK();
     } else {
       RETURN_IF_NOT_OK(
@@ -229,6 +234,24 @@ Status VOCOp::LoadBuffer(const std::vector<int64_t> &keys, std::unique_ptr<DataB
   return Status::OK();
 }
 
+Status VOCOp::ReadAhead(const std::vector<int64_t> &keys) {
+  if (file_reader_ == nullptr) {
+    return Status::OK();
+  }
+  std::vector<std::string> paths;
+  paths.reserve(keys.size() * 2);
+  for (const uint64_t &key : keys) {
+    const std::string &image_id = image_ids_[key];
+    paths.push_back(folder_path_ + std::string(kJPEGImagesFolder) + image_id + std::string(kImageExtension));
+    // The annotations of the detection task are parsed as xml, only the targets of the segmentation are images
+    if (task_type_ == TaskType::Segmentation) {
+      paths.push_back(folder_path_ + std::string(kSegmentationClassFolder) + image_id +
+                      std::string(kSegmentationExtension));
+    }
+  }
+  return file_reader_->Submit(paths);
+}
+
 Status VOCOp::WorkerEntry(int32_t worker_id) {
   TaskManager::FindMe()->Post();
   int64_t buffer_id = worker_id;
@@ -372,6 +395,11 @@ Status VOCOp::LaunchThreadsAndInitOp() {
   }
   RETURN_IF_NOT_OK(io_block_queues_.Register(tree_->AllTasks()));
   RETURN_IF_NOT_OK(wp_.Register(tree_->AllTasks()));
+  uint32_t read_ahead = GlobalContext::config_manager()->file_read_ahead();
+  if (read_ahead > 0) {
+    file_reader_ = std::make_unique<AsyncFileReader>(static_cast<int32_t>(read_ahead));
+    RETURN_IF_NOT_OK(file_reader_->Launch(tree_->AllTasks()));
+  }
   RETURN_IF_NOT_OK(tree_->LaunchWorkers(num_workers_, std::bind(&VOCOp::WorkerEntry, this, std::placeholders::_1)));
   TaskManager::FindMe()->Post();
   RETURN_IF_NOT_OK(this->ParseImageIds());
@@ -383,7 +411,7 @@ Status VOCOp::LaunchThreadsAndInitOp() {
 }
 
 Status VOCOp::ReadImageToTensor(const std::string &path, const ColDescriptor &col, std::shared_ptr<Tensor> *tensor) {
-  RETURN_IF_NOT_OK(Tensor::CreateFromFile(path, tensor));
+  RETURN_IF_NOT_OK(file_reader_ != nullptr ? file_reader_->Take(path, tensor) : Tensor::CreateFromFile(path, tensor));
   if (decode_ == true) {
     Status rc = Decode(*tensor, tensor);
     if (rc.IsError()) {
@@ -14,11 +14,17 @@
  * limitations under the License.
  */
 #include "minddata/dataset/engine/execution_tree.h"
+#include <algorithm>
 #include <iostream>
 #include <string>
+#include <thread>
+#include "minddata/dataset/core/config_manager.h"
+#include "minddata/dataset/core/global_context.h"
 #include "minddata/dataset/engine/datasetops/dataset_op.h"
+#include "minddata/dataset/engine/datasetops/parallel_op.h"
 #include "minddata/dataset/engine/datasetops/shuffle_op.h"
 #include "minddata/dataset/engine/datasetops/device_queue_op.h"
+#include "minddata/dataset/util/size_class_pool.h"
 #include "minddata/dataset/util/task_manager.h"
 #include "minddata/dataset/engine/opt/pass.h"
 #include "minddata/dataset/engine/opt/pre/removal_pass.h"
@@ -27,9 +33,11 @@
 #include "minddata/dataset/engine/opt/post/repeat_pass.h"
 #endif
 #include "minddata/dataset/engine/opt/pre/epoch_injection_pass.h"
+#include "minddata/dataset/engine/opt/optional/shuffle_id_pass.h"
 #include "mindspore/ccsrc/minddata/dataset/engine/opt/optional/tensor_op_fusion_pass.h"
 #include "minddata/dataset/engine/perf/profiling.h"
 #include "minddata/dataset/engine/perf/monitor.h"
+#include "minddata/dataset/engine/perf/auto_tune.h"
 
 namespace mindspore {
 namespace dataset {
@@ -150,6 +158,11 @@ Status ExecutionTree::Launch() {
     RETURN_IF_NOT_OK(profiling_manager_->LaunchMonitor());
   }
 
+  // The autotuner only reads and adjusts the operators, it can start before them
+  if (auto_tune_ != nullptr) {
+    RETURN_IF_NOT_OK(tg_->CreateAsyncTask("AutoTune Thread launched", std::ref(*auto_tune_)));
+  }
+
   MS_LOG(DEBUG) << "Printing the tree before launch tasks:\n" << ss.str();
   for (auto itr = this->begin(); itr != this->end(); ++itr) {
     // An inlined operator is one that has an output connector size of 0, and it does not
@@ -158,7 +171,12 @@ Status ExecutionTree::Launch() {
     // the launching tree/user thread.  Do not exec any thread for an inlined op.
     itr->state_ = DatasetOp::OpState::kDeOpRunning;
     if (!itr->inlined()) {
-      RETURN_IF_NOT_OK(tg_->CreateAsyncTask("Op launched, OperatorId:" + std::to_string(itr->id()), std::ref(*itr)));
+      // Count the tensor data allocated by the thread of the op, and by the workers it launches, for the op
+      DatasetOp *op = &(*itr);
+      RETURN_IF_NOT_OK(tg_->CreateAsyncTask("Op launched, OperatorId:" + std::to_string(itr->id()), [op]() {
+        SizeClassPool::SetThreadOperatorId(op->id());
+        return (*op)();
+      }));
       // Set the state of the Operator as running. This only matters in Leaf ops, CacheOp and TakeOp
     }
   }
@@ -189,8 +207,12 @@ ExecutionTree::Iterator::Iterator(const std::shared_ptr<DatasetOp> &root) : ind_
 // wrapper for the TaskGroup handling that is stored inside the execution tree.
 Status ExecutionTree::LaunchWorkers(int32_t num_workers, std::function<Status(uint32_t)> func) {
   // Launch the workers
+  int32_t op_id = SizeClassPool::ThreadOperatorId();
   for (int32_t i = 0; i < num_workers; ++i) {
-    RETURN_IF_NOT_OK(tg_->CreateAsyncTask("Parallel Op Worker", std::bind(func, i)));
+    RETURN_IF_NOT_OK(tg_->CreateAsyncTask("Parallel Op Worker", [func, i, op_id]() {
+      SizeClassPool::SetThreadOperatorId(op_id);
+      return func(i);
+    }));
   }
   return Status::OK();
 }
@@ -203,7 +225,7 @@ Status ExecutionTree::LaunchWorkers(int32_t num_workers, std::function<Status(ui
 //    For example, CacheOp Insertion
 //
 // 2. Optimize()
-//    Optimization transformation/action, optional
+//    Optimization transformation/action, optional except for the ones that keep the output the same
 //    For example, MapOp Fusion
 //
 // 3. PrepareTreePostAction()
@@ -217,19 +239,43 @@ Status ExecutionTree::Prepare(int32_t num_epochs) {
   // Pre optimization compulsory transformation
   RETURN_IF_NOT_OK(this->PrepareTreePreAction());
 
-  // If optional optimizations are enabled
-  if (optimize_) {
-    RETURN_IF_NOT_OK(this->Optimize());
-  }
+  // Optimizations, the optional ones only if enabled
+  RETURN_IF_NOT_OK(this->Optimize());
 
   // Post optimization compulsory transformation
   RETURN_IF_NOT_OK(this->PrepareTreePostAction());
 
+  // Spare workers must be in place before the connectors are created
+  uint32_t autotune_steps = GlobalContext::config_manager()->autotune_steps();
+  if (autotune_steps > 0) {
+    RETURN_IF_NOT_OK(this->PrepareAutoTune(autotune_steps));
+  }
+
   // Existing transformation implementation, will be removed later
   RETURN_IF_NOT_OK(this->PrepareDeprecated());
   return Status::OK();
 }
 
+// Prepares the tree for the autotuner
+Status ExecutionTree::PrepareAutoTune(int64_t steps) {
+  if (root_ == nullptr) {
+    RETURN_STATUS_UNEXPECTED("Please assign one operator as the root of this tree.");
+  }
+  int32_t cpu_budget = static_cast<int32_t>(std::thread::hardware_concurrency());
+  if (cpu_budget <= 0) {
+    cpu_budget = kCfgParallelWorkers;
+  }
+  for (auto itr = this->begin(); itr != this->end(); ++itr) {
+    auto parallel_op = dynamic_cast<ParallelOp *>(&(*itr));
+    if (parallel_op != nullptr && parallel_op->WorkersTunable()) {
+      RETURN_IF_NOT_OK(parallel_op->SetMaxWorkers(cpu_budget));
+    }
+  }
+  int64_t memory_budget = static_cast<int64_t>(GlobalContext::config_manager()->autotune_memory_budget()) << 20;
+  auto_tune_ = std::make_unique<AutoTune>(this, steps, cpu_budget, memory_budget);
+  return Status::OK();
+}
+
 Status ExecutionTree::PrepareTreePreAction() {
   bool modified = false;
   std::vector<std::unique_ptr<Pass>> pre_actions;
@@ -270,14 +316,16 @@ Status ExecutionTree::PrepareTreePostAction() {
 }
 
 Status ExecutionTree::Optimize() {
-  // Vector of optimizations, currently only 1, add more as necessary
-  std::vector<std::unique_ptr<NodePass>> optimizations;
-  optimizations.push_back(std::make_unique<TensorOpFusionPass>());
+  // Vector of optimizations, add more as necessary
+  // Unless the optional optimizations are enabled, only the ones that keep the output the same are done
+  std::vector<std::unique_ptr<Pass>> optimizations;
+  optimizations.push_back(std::make_unique<ShuffleIdPass>());
+  optimizations.push_back(std::make_unique<TensorOpFusionPass>(!optimize_));
   // vector of flags for each optimization
   std::vector<bool> modified(optimizations.size(), false);
   for (auto i = 0; i < optimizations.size(); i++) {
     auto m = false;
-    optimizations[i]->Run(this, &m);
+    RETURN_IF_NOT_OK(optimizations[i]->Run(this, &m));
     modified[i] = m;
   }
   return Status::OK();
@@ -30,6 +30,7 @@ namespace dataset {
 // Forward declares
 class TaskGroup;
 class DatasetOp;
+class AutoTune;
 
 class ExecutionTree {
  public:
@@ -168,7 +169,7 @@ class ExecutionTree {
   //    For example, CacheOp Insertion
   //
   // 2. Optimize()
-  //    Optimization transformation/action, optional
+  //    Optimization transformation/action, optional except for the ones that keep the output the same
   //    For example, MapOp Fusion
   //
   // 3. PrepareTreePostAction()
@@ -186,7 +187,8 @@ class ExecutionTree {
   // @return Status - The error code return
   Status PrepareTreePostAction();
 
-  // Optimization transformation/action, optional.
+  // Optimization transformation/action. The optional ones run only if enabled, the ones that keep the output
+  // the same always run.
   // @return Status - The error code return
   Status Optimize();
 
@@ -197,6 +199,13 @@ class ExecutionTree {
   // @return Status - The error code return
   Status PrepareDeprecated();
 
+  // Prepares the tree for the autotuner: launches spare workers for the ParallelOps whose number of workers in use
+  // can be tuned, and creates the autotuner. Runs before the nodes are prepared, since the number of workers sets the
+  // number of queues of the output connectors.
+  // @param steps - The number of steps to autotune for
+  // @return Status - The error code return
+  Status PrepareAutoTune(int64_t steps);
+
   // Recursive function used during prepare phase to visit a node and drive any pre- and post-
   // node actions during a tree walk.
   // @param op - The dataset op to work on
@@ -269,6 +278,7 @@ class ExecutionTree {
   TreeState tree_state_;                                 // Tracking the current tree state
   int32_t num_epochs_;                                   // Total number of epochs to run for this tree
   std::unique_ptr<ProfilingManager> profiling_manager_;  // Profiling manager
+  std::unique_ptr<AutoTune> auto_tune_;                  // Autotuner, only created if autotuning is on
   bool optimize_;                                        // Flag to enable optional optimizations
 };
 }  // namespace dataset
@@ -0,0 +1,61 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include "minddata/dataset/engine/opt/optional/shuffle_id_pass.h"
+#include "minddata/dataset/engine/datasetops/shuffle_op.h"
+#include "minddata/dataset/engine/datasetops/source/sampler/sampler.h"
+#include "minddata/dataset/engine/datasetops/source/sampler/shuffle_buffer_sampler.h"
+#include "minddata/dataset/engine/execution_tree.h"
+
+namespace mindspore {
+namespace dataset {
+
+// Checks whether the child of the ShuffleOp is a random access leaf with a sampler
+Status ShuffleIdPass::ShuffleNodes::RunOnNode(std::shared_ptr<ShuffleOp> node, bool *modified) {
+  *modified = false;
+  // The partitioned shuffle gives another order, it stays on the rows
+  if (node->num_partitions() != 1 || node->Children().size() != 1) {
+    return Status::OK();
+  }
+  std::shared_ptr<DatasetOp> leaf = node->child(0);
+  if (leaf->IsLeaf() && leaf->sampler() != nullptr && dynamic_cast<RandomAccessOp *>(leaf.get()) != nullptr) {
+    MS_LOG(INFO) << "ShuffleOp identified to shuffle the sample ids of " << leaf->Name() << ".";
+    shuffle_nodes_.push_back(node);
+  }
+  return Status::OK();
+}
+
+// Walk the tree to collect the ShuffleOps, then moves them into the samplers of their leaf.
+Status ShuffleIdPass::RunOnTree(ExecutionTree *tree, bool *modified) {
+  MS_LOG(INFO) << "Shuffle id pass started.";
+  ShuffleNodes shuffle_nodes;
+  RETURN_IF_NOT_OK(shuffle_nodes.Run(tree, modified));
+
+  for (auto &node : shuffle_nodes.shuffle_nodes()) {
+    std::shared_ptr<DatasetOp> leaf = node->child(0);
+    auto sampler =
+      std::make_shared<ShuffleBufferSampler>(node->shuffle_size(), node->shuffle_seed(), node->reshuffle_each_epoch());
+    RETURN_IF_NOT_OK(sampler->AddChild(leaf->sampler()));
+    leaf->SetSampler(sampler);
+    RETURN_IF_NOT_OK(node->Remove());
+    *modified = true;
+  }
+  MS_LOG(INFO) << "Shuffle id pass complete.";
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,71 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_OPT_OPTIONAL_SHUFFLE_ID_PASS_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_OPT_OPTIONAL_SHUFFLE_ID_PASS_H_
+
+#include <memory>
+#include <vector>
+#include "minddata/dataset/engine/opt/pass.h"
+
+namespace mindspore {
+namespace dataset {
+
+/// \class ShuffleIdPass shuffle_id_pass.h
+/// \brief A tree pass that moves the shuffle right above a random access leaf into the sampler of the leaf. The
+///     ShuffleOp is removed and a ShuffleBufferSampler over the sampler of the leaf shuffles the sample ids the same
+///     way, so the output is the same but the shuffle buffer holds ids instead of rows.
+class ShuffleIdPass : public TreePass {
+  /// \class ShuffleNodes
+  /// \brief This is a NodePass who's job is to identify the ShuffleOps that can shuffle ids instead of rows.
+  class ShuffleNodes : public NodePass {
+   public:
+    /// \brief Constructor
+    ShuffleNodes() = default;
+
+    /// \brief Destructor
+    ~ShuffleNodes() = default;
+
+    /// \brief Checks whether the child of the ShuffleOp is a random access leaf with a sampler
+    /// \param[in] node The node being visited
+    /// \param[inout] modified Indicator if the node was changed at all
+    /// \return Status The error code return
+    Status RunOnNode(std::shared_ptr<ShuffleOp> node, bool *modified) override;
+
+    /// \brief Getter
+    /// \return The ShuffleOps to move into the samplers of their leaf
+    std::vector<std::shared_ptr<ShuffleOp>> shuffle_nodes() { return shuffle_nodes_; }
+
+   private:
+    std::vector<std::shared_ptr<ShuffleOp>> shuffle_nodes_;
+  };
+
+ public:
+  /// \brief Constructor
+  ShuffleIdPass() = default;
+
+  /// \brief Destructor
+  ~ShuffleIdPass() = default;
+
+  /// \brief Runs a ShuffleNodes pass first to find the ShuffleOps to move, then moves them into the samplers.
+  /// \param[inout] tree The tree to operate on.
+  /// \param[inout] Indicate of the tree was modified.
+  /// \return Status The error code return
+  Status RunOnTree(ExecutionTree *tree, bool *modified) override;
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_OPT_OPTIONAL_SHUFFLE_ID_PASS_H_
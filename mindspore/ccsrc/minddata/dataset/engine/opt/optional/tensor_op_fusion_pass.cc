@@ -18,39 +18,94 @@
 #include "minddata/dataset/engine/opt/optional/tensor_op_fusion_pass.h"
 #include "minddata/dataset/kernels/image/decode_op.h"
 #include "minddata/dataset/engine/datasetops/map_op/map_op.h"
+#include "minddata/dataset/kernels/image/center_crop_op.h"
+#include "minddata/dataset/kernels/image/decode_center_crop_op.h"
+#include "minddata/dataset/kernels/image/normalize_hwc_to_chw_op.h"
+#include "minddata/dataset/kernels/image/normalize_op.h"
 #include "minddata/dataset/kernels/image/random_crop_decode_resize_op.h"
+#include "minddata/dataset/kernels/image/rescale_normalize_op.h"
+#include "minddata/dataset/kernels/image/rescale_op.h"
 
 namespace mindspore {
 namespace dataset {
 
+const std::vector<TensorOpFusionPass::FusionPattern> &TensorOpFusionPass::Patterns() {
+  using Ops = std::vector<std::shared_ptr<TensorOp>>;
+  static const std::vector<FusionPattern> patterns = {
+    {{kRescaleOp, kNormalizeOp, kHwcToChwOp}, false,
+     [](const Ops &ops) -> std::shared_ptr<TensorOp> {
+       return std::make_shared<RescaleNormalizeOp>(*static_cast<RescaleOp *>(ops[0].get()),
+                                                   *static_cast<NormalizeOp *>(ops[1].get()), true);
+     }},
+    {{kRescaleOp, kNormalizeOp}, false,
+     [](const Ops &ops) -> std::shared_ptr<TensorOp> {
+       return std::make_shared<RescaleNormalizeOp>(*static_cast<RescaleOp *>(ops[0].get()),
+                                                   *static_cast<NormalizeOp *>(ops[1].get()), false);
+     }},
+    {{kNormalizeOp, kHwcToChwOp}, true,
+     [](const Ops &ops) -> std::shared_ptr<TensorOp> {
+       return std::make_shared<NormalizeHwcToChwOp>(*static_cast<NormalizeOp *>(ops[0].get()));
+     }},
+    // The fused decodes only give RGB images
+    {{kDecodeOp, kRandomCropAndResizeOp}, false,
+     [](const Ops &ops) -> std::shared_ptr<TensorOp> {
+       if (!static_cast<DecodeOp *>(ops[0].get())->is_rgb_format()) {
+         return nullptr;
+       }
+       return std::make_shared<RandomCropDecodeResizeOp>(*static_cast<RandomCropAndResizeOp *>(ops[1].get()));
+     }},
+    {{kDecodeOp, kCenterCropOp}, false,
+     [](const Ops &ops) -> std::shared_ptr<TensorOp> {
+       if (!static_cast<DecodeOp *>(ops[0].get())->is_rgb_format()) {
+         return nullptr;
+       }
+       return std::make_shared<DecodeCenterCropOp>(*static_cast<CenterCropOp *>(ops[1].get()));
+     }},
+  };
+  return patterns;
+}
+
 Status TensorOpFusionPass::RunOnNode(std::shared_ptr<MapOp> node, bool *modified) {
-  // Most primitive pattern: DecodeOp immediately followed by RandomCropAndResizeOp
-  // Abstract into a more general member function that can find any pattern, expressed
-  // by regular expressions, for instance.
-  // Add a list of optimisation policies. For now, just this lambda
-  auto FindPattern = [](auto &tfuncs) {
-    auto it =
-      std::find_if(tfuncs.begin(), tfuncs.end(), [](const auto &tf) -> bool { return tf->Name() == kDecodeOp; });
-    auto next = it + 1;
-    if (it != tfuncs.end() && next != tfuncs.end() && (*next)->Name() == kRandomCropAndResizeOp) {
-      return it;
-    } else {
-      return tfuncs.end();
+  if (modified == nullptr) {
+    RETURN_STATUS_UNEXPECTED("modified is nullptr");
+  }
+  auto &tfuncs = node->TFuncs();
+  auto Matches = [&tfuncs](size_t pos, const FusionPattern &pattern) {
+    if (pos + pattern.names.size() > tfuncs.size()) {
+      return false;
     }
+    for (size_t i = 0; i < pattern.names.size(); i++) {
+      if (tfuncs[pos + i]->Name() != pattern.names[i]) {
+        return false;
+      }
+    }
+    return true;
   };
 
-  auto &tfuncs = node->TFuncs();
-  auto it = FindPattern(tfuncs);
-  if (it != tfuncs.end()) {
-    auto next = it + 1;
-    auto op = static_cast<RandomCropAndResizeOp *>(next->get());
-    *it = std::static_pointer_cast<TensorOp>(std::make_shared<RandomCropDecodeResizeOp>(*op));
-    tfuncs.erase(next);
-  }
-  if (modified != nullptr) {
+  size_t pos = 0;
+  while (pos < tfuncs.size()) {
+    auto first = tfuncs.begin() + pos;
+    auto last = first;
+    std::shared_ptr<TensorOp> fused;
+    for (const auto &pattern : Patterns()) {
+      if ((pattern.exact || !exact_only_) && Matches(pos, pattern)) {
+        last = first + pattern.names.size();
+        fused = pattern.fuse(std::vector<std::shared_ptr<TensorOp>>(first, last));
+        if (fused != nullptr) {
+          break;
+        }
+      }
+    }
+    if (fused == nullptr) {
+      pos++;
+      continue;
+    }
+    MS_LOG(INFO) << "Fused " << (last - first) << " tensor ops into " << fused->Name() << " in MapOp(ID:"
+                 << node->id() << ").";
+    *first = fused;
+    tfuncs.erase(first + 1, last);
     *modified = true;
-  } else {
-    RETURN_STATUS_UNEXPECTED("modified is nullptr");
+    // Stay at the fused op, it may start another pattern
   }
   return Status::OK();
 }
@@ -16,21 +16,47 @@
 #ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_TENSOR_OP_FUSION_PASS_H_
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_TENSOR_OP_FUSION_PASS_H_
 
+#include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 #include "minddata/dataset/engine/opt/pass.h"
 
 namespace mindspore {
 namespace dataset {
 
+class TensorOp;
+
 /// \class TensorOpFusionPass tensor_op_fusion_pass.h
 /// \brief And optional optimization pass identifying and fusing
 ///     tensor ops within MapOp
 class TensorOpFusionPass : public NodePass {
+ public:
+  /// \brief A sequence of adjacent tensor ops and the way to fuse it into a single op
+  struct FusionPattern {
+    std::vector<std::string> names;  // The names of the tensor ops of the sequence, in order
+    bool exact;                      // Whether the fused op gives the same output as the sequence, bit for bit
+    // Builds the fused op, or returns nullptr if the parameters of the ops keep them from being fused
+    std::function<std::shared_ptr<TensorOp>(const std::vector<std::shared_ptr<TensorOp>> &)> fuse;
+  };
+
+  /// \brief Constructor
+  /// \param[in] exact_only Only apply the patterns whose fused op gives the same output as the unfused ops
+  explicit TensorOpFusionPass(bool exact_only = false) : exact_only_(exact_only) {}
+
+  /// \brief The patterns known to the pass. At each position the first matching pattern that fuses the ops is
+  ///     applied, so the longer patterns come first.
+  /// \return The patterns
+  static const std::vector<FusionPattern> &Patterns();
+
   /// \brief Identifies and fuses tensor ops within MapOp
   /// \param[in] node The node being visited
   /// \param[inout] *modified indicates whether the node has been visited
   /// \return Status The error code return
   Status RunOnNode(std::shared_ptr<MapOp> node, bool *modified) override;
+
+ private:
+  bool exact_only_;
 };
 }  // namespace dataset
 }  // namespace mindspore
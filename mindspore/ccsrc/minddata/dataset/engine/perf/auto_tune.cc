@@ -0,0 +1,270 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/perf/auto_tune.h"
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <thread>
+#include "minddata/dataset/core/config_manager.h"
+#include "minddata/dataset/core/global_context.h"
+#include "minddata/dataset/engine/datasetops/parallel_op.h"
+#include "minddata/dataset/engine/execution_tree.h"
+#include "minddata/dataset/util/size_class_pool.h"
+#include "minddata/dataset/util/task_manager.h"
+
+namespace mindspore {
+namespace dataset {
+AutoTune::AutoTune(ExecutionTree *tree, int64_t steps, int32_t cpu_budget, int64_t memory_budget)
+    : tree_(tree), steps_(steps), cpu_budget_(cpu_budget), memory_budget_(memory_budget), num_samples_(0) {
+  std::shared_ptr<ConfigManager> cfg = GlobalContext::config_manager();
+  sampling_interval_ = cfg->monitor_sampling_interval();
+}
+
+Status AutoTune::operator()() {
+  // Register this thread with TaskManager to receive proper interrupt signal.
+  TaskManager::FindMe()->Post();
+  Init();
+
+  // Keep tuning until the steps are done, the tree is finished or the task is interrupted
+  while (!this_thread::is_interrupted() && !(tree_->isFinished()) && Steps() < steps_) {
+    Sample();
+    if (num_samples_ == kWindowSamples) {
+      RETURN_IF_NOT_OK(Tune());
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(sampling_interval_));
+  }
+  MS_LOG(INFO) << "AutoTune done after " << Steps() << " steps, chosen configuration:\n" << Report();
+  return Status::OK();
+}
+
+void AutoTune::Init() {
+  ops_.clear();
+  for (auto itr = tree_->begin(); itr != tree_->end(); ++itr) {
+    // Only the ops with an output connector can be sampled
+    if (itr->inlined() || itr->ConnectorOutBufferCount() < 0) {
+      continue;
+    }
+    OpState state{};
+    state.op = &(*itr);
+    auto parallel_op = dynamic_cast<ParallelOp *>(state.op);
+    state.parallel_op = (parallel_op != nullptr && parallel_op->WorkersTunable()) ? parallel_op : nullptr;
+    state.configured_queue_size = itr->op_connector_size();
+    state.queue_size = state.configured_queue_size;
+    state.out_count = itr->ConnectorOutBufferCount();
+    ops_.push_back(state);
+  }
+  num_samples_ = 0;
+  window_start_ = std::chrono::steady_clock::now();
+}
+
+void AutoTune::Sample() {
+  for (auto &state : ops_) {
+    int32_t size = state.op->ConnectorSize();
+    int32_t capacity = state.op->ConnectorCapacity();
+    if (size == 0) {
+      state.empty_samples++;
+    }
+    if (size >= capacity) {
+      state.full_samples++;
+    }
+    state.fill_sum += capacity > 0 ? static_cast<double>(size) / capacity : 1.0;
+  }
+  num_samples_++;
+}
+
+Status AutoTune::Tune() {
+  if (num_samples_ == 0) {
+    return Status::OK();
+  }
+  TimePoint now = std::chrono::steady_clock::now();
+  double seconds = std::max(std::chrono::duration<double>(now - window_start_).count(), 1e-6);
+  for (auto &state : ops_) {
+    int64_t out_count = state.op->ConnectorOutBufferCount();
+    state.throughput = (out_count - state.out_count) / seconds;
+    state.out_count = out_count;
+  }
+
+  // Take back the workers given in the last window if they didn't pay off
+  for (auto &state : ops_) {
+    if (state.grown_from > 0) {
+      if (state.throughput < state.throughput_before * (1.0 + kMinGain)) {
+        MS_LOG(INFO) << "AutoTune: " << state.op->Name() << "(ID:" << state.op->id() << ") is saturated at "
+                     << state.grown_from << " workers.";
+        state.parallel_op->SetNumActiveWorkers(state.grown_from);
+        state.saturated = true;
+      }
+      state.grown_from = 0;
+    }
+  }
+
+  OpState *bottleneck = FindBottleneck();
+  if (bottleneck != nullptr) {
+    Grow(bottleneck);
+  }
+
+  for (auto &state : ops_) {
+    // An op always blocked on its output can do with fewer workers
+    if (state.parallel_op != nullptr && &state != bottleneck) {
+      int32_t active = state.parallel_op->num_active_workers();
+      if (state.full_samples >= kFullRatio * num_samples_ && active > 1) {
+        state.parallel_op->SetNumActiveWorkers(active - 1);
+      }
+    }
+    RETURN_IF_NOT_OK(TuneConnector(&state));
+  }
+
+  // Start a new window
+  for (auto &state : ops_) {
+    state.empty_samples = 0;
+    state.full_samples = 0;
+    state.fill_sum = 0;
+  }
+  num_samples_ = 0;
+  window_start_ = now;
+  return Status::OK();
+}
+
+AutoTune::OpState *AutoTune::FindBottleneck() {
+  std::map<DatasetOp *, OpState *> op_states;
+  for (auto &state : ops_) {
+    op_states[state.op] = &state;
+  }
+  OpState *bottleneck = nullptr;
+  double max_gap = 0;
+  for (auto &state : ops_) {
+    if (state.parallel_op == nullptr || state.saturated ||
+        state.parallel_op->num_active_workers() >= state.parallel_op->num_workers()) {
+      continue;
+    }
+    double output_fill = state.fill_sum / num_samples_;
+    if (state.empty_samples < kStarvedRatio * num_samples_) {
+      continue;
+    }
+    // The input of an op whose child can't be sampled (e.g. an inlined child) is taken as filled
+    double input_fill = 1.0;
+    auto child = state.op->child(0);
+    if (child != nullptr && op_states.find(child.get()) != op_states.end()) {
+      input_fill = op_states[child.get()]->fill_sum / num_samples_;
+    }
+    if (input_fill >= kFilledRatio && input_fill - output_fill > max_gap) {
+      max_gap = input_fill - output_fill;
+      bottleneck = &state;
+    }
+  }
+  return bottleneck;
+}
+
+void AutoTune::Grow(OpState *state) {
+  int32_t active = state->parallel_op->num_active_workers();
+  int32_t add = std::max(1, active / 4);
+  add = std::min(add, cpu_budget_ - ActiveWorkers());
+  add = std::min(add, state->parallel_op->num_workers() - active);
+  if (add <= 0) {
+    return;
+  }
+  MS_LOG(INFO) << "AutoTune: " << state->op->Name() << "(ID:" << state->op->id() << ") is the bottleneck, workers "
+               << active << " -> " << active + add << ".";
+  state->parallel_op->SetNumActiveWorkers(active + add);
+  state->grown_from = active;
+  state->throughput_before = state->throughput;
+}
+
+Status AutoTune::TuneConnector(OpState *state) {
+  int32_t new_size = state->queue_size;
+  if (state->empty_samples >= kBurstyRatio * num_samples_ && state->full_samples >= kBurstyRatio * num_samples_) {
+    // The producer is bursty, a longer queue evens it out if the memory allows
+    int64_t extra_bytes = BufferBytes(*state) * state->queue_size * NumQueues(*state);
+    if (state->queue_size * 2 <= state->configured_queue_size * kMaxQueueScale &&
+        ConnectorBytes() + extra_bytes <= memory_budget_) {
+      new_size = state->queue_size * 2;
+    }
+  } else if (state->full_samples >= kFullRatio * num_samples_ && state->queue_size > state->configured_queue_size) {
+    // The consumer is the slower one, a longer queue only holds more memory
+    new_size = std::max(std::max(state->queue_size / 2, state->configured_queue_size), kMinQueueSize);
+  }
+  if (new_size != state->queue_size) {
+    MS_LOG(INFO) << "AutoTune: " << state->op->Name() << "(ID:" << state->op->id() << ") connector queue size "
+                 << state->queue_size << " -> " << new_size << ".";
+    RETURN_IF_NOT_OK(state->op->SetConnectorQueueSize(new_size));
+    state->queue_size = new_size;
+  }
+  return Status::OK();
+}
+
+int64_t AutoTune::Steps() const {
+  // Walk down from the root to the first op with an output connector, the root may not have one (e.g. DeviceQueueOp)
+  DatasetOp *op = tree_->root().get();
+  while (op != nullptr) {
+    int64_t count = op->ConnectorOutBufferCount();
+    if (count >= 0) {
+      return count;
+    }
+    op = op->child(0).get();
+  }
+  return 0;
+}
+
+int32_t AutoTune::ActiveWorkers() const {
+  int32_t workers = 0;
+  for (auto itr = tree_->begin(); itr != tree_->end(); ++itr) {
+    auto parallel_op = dynamic_cast<ParallelOp *>(&(*itr));
+    if (parallel_op != nullptr) {
+      workers += parallel_op->WorkersTunable() ? parallel_op->num_active_workers() : parallel_op->num_workers();
+    }
+  }
+  return workers;
+}
+
+int64_t AutoTune::BufferBytes(const OpState &state) const {
+  auto pool = GlobalContext::Instance()->tensor_data_pool();
+  if (pool == nullptr) {
+    return 0;
+  }
+  auto stats = pool->GetStats();
+  auto it = stats.find(state.op->id());
+  if (it == stats.end()) {
+    return 0;
+  }
+  // The tensors allocated by the op are either waiting in the connector or being worked on
+  int32_t workers = state.parallel_op != nullptr ? state.parallel_op->num_active_workers() : 1;
+  return it->second.bytes_in_use / std::max(1, state.op->ConnectorSize() + workers);
+}
+
+int32_t AutoTune::NumQueues(const OpState &state) const {
+  return state.parallel_op != nullptr ? state.parallel_op->num_active_workers() : state.op->num_producers();
+}
+
+int64_t AutoTune::ConnectorBytes() const {
+  int64_t bytes = 0;
+  for (auto &state : ops_) {
+    bytes += BufferBytes(state) * state.queue_size * NumQueues(state);
+  }
+  return bytes;
+}
+
+std::string AutoTune::Report() const {
+  std::ostringstream ss;
+  for (auto &state : ops_) {
+    ss << "  " << state.op->Name() << "(ID:" << state.op->id() << ")";
+    if (state.parallel_op != nullptr) {
+      ss << " num_parallel_workers: " << state.parallel_op->num_active_workers() << ",";
+    }
+    ss << " connector queue size: " << state.queue_size << "\n";
+  }
+  return ss.str();
+}
+}  // namespace dataset
+}  // namespace mindspore
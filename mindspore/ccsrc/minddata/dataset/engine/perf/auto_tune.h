@@ -0,0 +1,135 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_PERF_AUTO_TUNE_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_PERF_AUTO_TUNE_H_
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+class DatasetOp;
+class ExecutionTree;
+class ParallelOp;
+
+// AutoTune adjusts the pipeline during its first steps. It samples the output connector of every op, the same
+// counters the ConnectorSize and ConnectorThroughput samplers read, and at the end of every window of samples:
+//   - gives more workers to the bottleneck, the op whose output is starved while its input is filled. The workers
+//     are taken back if the throughput of the op doesn't improve, and the op is not grown again.
+//   - takes a worker from the ops whose output is always full, their consumer is slower than them.
+//   - doubles the connectors that are alternately empty and full, and halves back the ones always full.
+// The workers in use stay within the CPU budget and the buffers held by the connectors within the memory budget.
+// Once done, the chosen configuration is written to the log.
+class AutoTune {
+ public:
+  static constexpr int32_t kWindowSamples = 20;  // samples taken before each decision
+  static constexpr double kMinGain = 0.05;       // throughput gain needed to keep new workers
+  static constexpr double kStarvedRatio = 0.5;   // share of the samples an output is empty to be starved
+  static constexpr double kFilledRatio = 0.5;    // average fill of an input to be filled
+  static constexpr double kFullRatio = 0.8;      // share of the samples an output is full to be blocked
+  static constexpr double kBurstyRatio = 0.25;   // share of the samples a connector is both empty and full
+  static constexpr int32_t kMinQueueSize = 2;    // smallest queue size the tuner sets
+  static constexpr int32_t kMaxQueueScale = 8;   // largest queue size the tuner sets, times the configured one
+
+  // Constructor
+  // @param tree - the execution tree to tune
+  // @param steps - the number of buffers popped from the root to tune for
+  // @param cpu_budget - the number of workers the ParallelOps may use in total
+  // @param memory_budget - the bytes of buffers the connectors may hold in total
+  AutoTune(ExecutionTree *tree, int64_t steps, int32_t cpu_budget, int64_t memory_budget);
+
+  ~AutoTune() = default;
+
+  // Functor for the tuner main loop.
+  // This function will be the entry point of mindspore::Dataset::Task
+  Status operator()();
+
+  // Find the ops of the tree to tune, called by the main loop before the first sample
+  void Init();
+
+  // Take one sample of the output connector of every op
+  void Sample();
+
+  // Adjust the ops from the samples of the current window, and start a new window
+  // @return Status - The error code return
+  Status Tune();
+
+  // @return the chosen configuration, one line per op
+  std::string Report() const;
+
+ private:
+  using TimePoint = std::chrono::time_point<std::chrono::steady_clock>;
+
+  struct OpState {
+    DatasetOp *op;
+    ParallelOp *parallel_op;  // nullptr if the workers of the op can't be tuned
+    int32_t configured_queue_size;
+    int32_t queue_size;
+    int64_t out_count;  // buffers popped from the output connector at the start of the window
+    int32_t empty_samples;
+    int32_t full_samples;
+    double fill_sum;
+    double throughput;         // buffers per second in the last window
+    int32_t grown_from;        // workers in use before the last grow, 0 if the grow is already judged
+    double throughput_before;  // throughput before the last grow
+    bool saturated;            // more workers didn't help
+  };
+
+  // @return the buffers popped from the root, the number of steps run so far
+  int64_t Steps() const;
+
+  // @return the number of workers in use by all the ParallelOps
+  int32_t ActiveWorkers() const;
+
+  // @param state - an op
+  // @return the estimated size of a buffer of the op, 0 if unknown
+  int64_t BufferBytes(const OpState &state) const;
+
+  // @param state - an op
+  // @return the number of queues of the output connector in use
+  int32_t NumQueues(const OpState &state) const;
+
+  // @return the estimated bytes of buffers the connectors hold when they are full
+  int64_t ConnectorBytes() const;
+
+  // @return the op to give more workers to, nullptr if none
+  OpState *FindBottleneck();
+
+  // Give more workers to an op
+  // @param state - the op
+  void Grow(OpState *state);
+
+  // Adjust the size of the queues of the output connector of an op
+  // @param state - the op
+  // @return Status - The error code return
+  Status TuneConnector(OpState *state);
+
+  ExecutionTree *tree_;
+  int64_t steps_;
+  int32_t cpu_budget_;
+  int64_t memory_budget_;
+  int64_t sampling_interval_;
+  int32_t num_samples_;
+  TimePoint window_start_;
+  std::vector<OpState> ops_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_PERF_AUTO_TUNE_H_
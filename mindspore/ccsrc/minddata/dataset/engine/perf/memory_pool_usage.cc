@@ -0,0 +1,111 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/perf/memory_pool_usage.h"
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include "minddata/dataset/core/config_manager.h"
+#include "minddata/dataset/engine/execution_tree.h"
+#include "minddata/dataset/util/path.h"
+
+using json = nlohmann::json;
+namespace mindspore {
+namespace dataset {
+// Sample action
+Status MemoryPoolUsage::Sample() {
+  auto stats = pool_->GetStats();
+  MemoryPoolUsageSample cur_row;
+  std::transform(tree_->begin(), tree_->end(), std::back_inserter(cur_row), [&stats](DatasetOp &op) -> int64_t {
+    auto it = stats.find(op.id());
+    return it == stats.end() ? 0 : it->second.bytes_in_use;
+  });
+  // Push new row of sample
+  sample_table_.push_back(cur_row);
+  return Status::OK();
+}
+
+// JSON serializer helper function
+json MemoryPoolUsage::ParseStats(const SizeClassPool::Stats &stats, const std::vector<int64_t> &bytes_in_use) {
+  json metrics;
+  metrics["bytes_in_use"] = bytes_in_use;
+  metrics["peak_bytes_in_use"] = stats.peak_bytes_in_use;
+  metrics["bytes_allocated"] = stats.bytes_allocated;
+  metrics["num_alloc"] = stats.num_alloc;
+  metrics["num_free"] = stats.num_free;
+  metrics["num_thread_cache_hit"] = stats.num_thread_hit;
+  metrics["num_central_cache_hit"] = stats.num_central_hit;
+  metrics["num_system_alloc"] = stats.num_system_alloc;
+  return metrics;
+}
+
+// Save profiling data to file
+// If the file is already exist (created by other sampling node), simply add the data to metrics field.
+Status MemoryPoolUsage::SaveToFile() {
+  Path path = Path(file_path_);
+  json output;
+  if (path.Exists()) {
+    MS_LOG(DEBUG) << file_path_ << " exists";
+    std::ifstream file(file_path_);
+    file >> output;
+  } else {
+    output["sampling_interval"] = GlobalContext::config_manager()->monitor_sampling_interval();
+  }
+
+  auto stats = pool_->GetStats();
+  uint32_t idx = 0;
+  // Traverse the ExecutionTree for JSON node generation
+  for (auto &node : *tree_) {
+    std::vector<int64_t> bytes_in_use;
+    std::transform(sample_table_.begin(), sample_table_.end(), std::back_inserter(bytes_in_use),
+                   [&](const MemoryPoolUsageSample &sample) { return sample[idx]; });
+    json metrics = ParseStats(stats[node.id()], bytes_in_use);
+    if (!path.Exists()) {
+      auto children = node.Children();
+      std::vector<int32_t> children_id;
+      std::transform(children.begin(), children.end(), std::back_inserter(children_id),
+                     [](std::shared_ptr<DatasetOp> op) -> int32_t { return op->id(); });
+      json json_node;
+      json_node["op_id"] = node.id();
+      json_node["op_type"] = node.Name();
+      json_node["num_workers"] = node.num_workers();
+      json_node["metrics"]["memory_pool"] = metrics;
+      if (!children_id.empty()) {
+        json_node["children"] = children_id;
+      }
+      output["op_info"].push_back(json_node);
+    } else {
+      output["op_info"][idx]["metrics"]["memory_pool"] = metrics;
+    }
+    idx++;
+  }
+  // Tensors allocated by threads not launched for an op, e.g. the iterator of the user
+  output["memory_pool"] = {{"central_cache_bytes", pool_->CentralCacheBytes()},
+                           {"other_threads", ParseStats(stats[SizeClassPool::kNoOperator], {})}};
+
+  // Discard the content of the file when opening.
+  std::ofstream os(file_path_, std::ios::trunc);
+  os << output;
+  return Status::OK();
+}
+
+Status MemoryPoolUsage::Init(const std::string &dir_path, const std::string &device_id) {
+  file_path_ = (Path(dir_path) / Path("pipeline_profiling_" + device_id + ".json")).toString();
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
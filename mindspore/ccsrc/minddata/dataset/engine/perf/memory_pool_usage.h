@@ -0,0 +1,71 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_MEMORY_POOL_USAGE_H
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_MEMORY_POOL_USAGE_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <utility>
+#include <nlohmann/json.hpp>
+#include "minddata/dataset/engine/perf/profiling.h"
+#include "minddata/dataset/engine/datasetops/dataset_op.h"
+#include "minddata/dataset/util/size_class_pool.h"
+
+using json = nlohmann::json;
+
+namespace mindspore {
+namespace dataset {
+class ExecutionTree;
+
+// Memory pool usage sampling samples the bytes of tensor data held by each op in the pipeline, and reports the
+// allocation counters of the tensor data pool for each op. It support JSON serialization for external usage.
+class MemoryPoolUsage : public Sampling {
+  // Bytes in use are stored as a 2D vector, one row per sample and one column per op like ConnectorSize.
+  using MemoryPoolUsageSample = std::vector<int64_t>;
+  using MemoryPoolUsageSampleTable = std::vector<MemoryPoolUsageSample>;
+
+ public:
+  MemoryPoolUsage(ExecutionTree *tree, std::shared_ptr<SizeClassPool> pool) : tree_(tree), pool_(std::move(pool)) {}
+
+  ~MemoryPoolUsage() override = default;
+
+  // Driver function for memory pool usage sampling.
+  // This function samples the bytes in use of every nodes within the ExecutionTree
+  Status Sample() override;
+
+  std::string Name() const override { return kMemoryPoolSamplingName; }
+
+  // Save sampling data to file
+  // @return Status - The error code return
+  Status SaveToFile() override;
+
+  Status Init(const std::string &dir_path, const std::string &device_id) override;
+
+  // Transform the counters of an op to json format
+  // @param stats - allocation counters of the op
+  // @param bytes_in_use - samples of the bytes in use by the op
+  static json ParseStats(const SizeClassPool::Stats &stats, const std::vector<int64_t> &bytes_in_use);
+
+ private:
+  ExecutionTree *tree_ = nullptr;            // ExecutionTree pointer
+  std::shared_ptr<SizeClassPool> pool_;      // The pool of the tensor data
+  MemoryPoolUsageSampleTable sample_table_;  // Dataset structure to store all samples of bytes in use
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_MEMORY_POOL_USAGE_H
@@ -24,6 +24,8 @@
 #include "minddata/dataset/engine/perf/connector_size.h"
 #include "minddata/dataset/engine/perf/connector_throughput.h"
 #include "minddata/dataset/engine/perf/dataset_iterator_tracing.h"
+#include "minddata/dataset/engine/perf/memory_pool_usage.h"
+#include "minddata/dataset/core/global_context.h"
 #include "utils/log_adapter.h"
 
 namespace mindspore {
@@ -84,6 +86,10 @@ Status ProfilingManager::Initialize() {
   std::shared_ptr<Sampling> connector_thr_sampling = std::make_shared<ConnectorThroughput>(tree_);
   RETURN_IF_NOT_OK(RegisterSamplingNode(connector_thr_sampling));
 
+  std::shared_ptr<Sampling> memory_pool_sampling =
+    std::make_shared<MemoryPoolUsage>(tree_, GlobalContext::Instance()->tensor_data_pool());
+  RETURN_IF_NOT_OK(RegisterSamplingNode(memory_pool_sampling));
+
   return Status::OK();
 }
 
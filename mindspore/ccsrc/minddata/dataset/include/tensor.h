@@ -55,6 +55,7 @@ class DETensor;
 #endif
 namespace dataset {
 class Tensor;
+class MemoryPool;
 template <typename T>
 class Allocator;
 
@@ -91,6 +92,30 @@ class Tensor {
   /// \return Status code
   static Status CreateEmpty(const TensorShape &shape, const DataType &type, TensorPtr *out);
 
+  /// Create a numeric tensor with type and shape whose memory comes from `pool` instead of the global memory pool.
+  /// \param[in] shape shape of the output tensor
+  /// \param[in] type type of the output tensor
+  /// \param[in] pool memory pool to allocate the data from
+  /// \param[out] out Generated tensor
+  /// \return Status code
+  static Status CreateEmpty(const TensorShape &shape, const DataType &type, const std::shared_ptr<MemoryPool> &pool,
+                            TensorPtr *out);
+
+  /// Create a numeric tensor sharing the memory of `base` from the item at `index` on. No data is copied, the view
+  /// keeps `base` alive and writes to the view are seen in `base`.
+  /// \param[in] base numeric tensor owning the memory
+  /// \param[in] index index of the first item of the view in base, can be shorter than the rank of base
+  /// \param[in] shape shape of the view, it has to fit in base from index on
+  /// \param[out] out Generated tensor
+  /// \return Status code
+  static Status CreateView(const TensorPtr &base, const std::vector<dsize_t> &index, const TensorShape &shape,
+                           TensorPtr *out);
+
+  /// Let the next CreateEmpty of the calling thread with the same shape and type return `slot` instead of
+  /// allocating, so that an op writes its output straight into memory prepared by the caller.
+  /// \param[in] slot tensor to hand out, nullptr clears a slot that has not been taken
+  static void SetOutputSlot(TensorPtr slot);
+
   /// Create a numeric tensor from a pointer in memory. Length of the source data is determined from the shape and type.
   /// Data will be copied into the new created tensor.
   /// \param[in] shape shape of the output tensor
@@ -308,6 +333,10 @@ class Tensor {
   /// \return const unsigned char*
   const unsigned char *GetBuffer() const { return data_; }
 
+  /// Getter of the tensor owning the memory of a view created by CreateView
+  /// \return nullptr if this tensor owns its memory
+  TensorPtr base() const { return base_; }
+
   /// Getter of the type
   /// \return
   DataType type() const { return type_; }
@@ -390,6 +419,14 @@ class Tensor {
   /// \return Status code
   Status GetDataAsNumpy(py::array *data);
 
+  /// Constructs a read only numpy array sharing the buffer of the tensor instead of copying it
+  /// \note A capsule holding a reference to the tensor is the base of the array, which keeps the tensor alive.
+  ///     Strings have no numpy layout in the buffer and are still copied, into a writable array.
+  /// \param[in] tensor the tensor to export
+  /// \param[out] data this data is the location of python data
+  /// \return Status code
+  static Status GetDataAsNumpyNoCopy(const std::shared_ptr<Tensor> &tensor, py::array *data);
+
   Status GetDataAsNumpyStrings(py::array *data);
 
   static Status GetBufferInfo(Tensor *t, py::buffer_info *out);
@@ -647,6 +684,13 @@ class Tensor {
   /// of the tensor.
   uchar *GetStringsBuffer() const { return data_ + kOffsetSize * shape_.NumOfElements() + kOffsetSize; }
 
+  /// Take the slot set by SetOutputSlot if it matches shape and type
+  /// \param[in] shape shape of the tensor to be created
+  /// \param[in] type type of the tensor to be created
+  /// \param[out] out the slot, untouched when no slot matches
+  /// \return true if the slot is taken
+  static bool TakeOutputSlot(const TensorShape &shape, const DataType &type, TensorPtr *out);
+
   /// all access to shape_ should be via shape
   TensorShape shape_;
   /// data type of tensor
@@ -657,6 +701,10 @@ class Tensor {
   CharAllocPtr data_allocator_;
   /// pointer to the end of the physical data
   unsigned char *data_end_ = nullptr;
+  /// tensor owning data_ if this tensor is a view, data_ is not freed by a view
+  TensorPtr base_ = nullptr;
+  /// output slot of the current thread, see SetOutputSlot
+  static thread_local TensorPtr output_slot_;
 
  private:
 #ifdef ENABLE_ANDROID
@@ -706,8 +754,8 @@ inline Tensor::TensorIterator<std::string_view> Tensor::end<std::string_view>()
 /// \param[out] out output argument to hold the created Tensor
 /// \return Status Code
 template <>
-inline Status Tensor::CreateFromVector<std::string>(const std::vector<std::string> &items, const TensorShape &shape,
-                                                    TensorPtr *out) {
+inline Status Tensor::CreateFromVector<std::string_view>(const std::vector<std::string_view> &items,
+                                                         const TensorShape &shape, TensorPtr *out) {
   CHECK_FAIL_RETURN_UNEXPECTED(
     items.size() == shape.NumOfElements(),
     "Number of elements in the vector does not match the number of elements of the shape required");
@@ -719,7 +767,7 @@ inline Status Tensor::CreateFromVector<std::string>(const std::vector<std::strin
       return (*out)->Reshape(shape);
     }
   }
-  auto length_sum = [](dsize_t sum, const std::string &s) { return s.length() + sum; };
+  auto length_sum = [](dsize_t sum, const std::string_view &s) { return s.length() + sum; };
   dsize_t total_length = std::accumulate(items.begin(), items.end(), 0, length_sum);
 
   // total bytes needed = offset array + strings
@@ -739,8 +787,11 @@ inline Status Tensor::CreateFromVector<std::string>(const std::vector<std::strin
     // total bytes are reduced by kOffsetSize
     num_bytes -= kOffsetSize;
     // insert actual string
-    int ret_code = memcpy_s((*out)->data_ + offset, num_bytes, common::SafeCStr(str), str.length() + 1);
-    if (ret_code != 0) MS_LOG(ERROR) << "Cannot copy string into Tensor";
+    if (!str.empty()) {
+      int ret_code = memcpy_s((*out)->data_ + offset, num_bytes, str.data(), str.length());
+      if (ret_code != 0) MS_LOG(ERROR) << "Cannot copy string into Tensor";
+    }
+    (*out)->data_[offset + str.length()] = '\0';
     //  next string will be stored right after the current one.
     offset = offset + str.length() + 1;
     // total bytes are reduced by the length of the string
@@ -758,6 +809,19 @@ inline Status Tensor::CreateFromVector<std::string>(const std::vector<std::strin
   }
   return Status::OK();
 }
+
+/// Create a Tensor from a given list of strings, same layout as the list of string_views above.
+/// \param[in] items elements of the tensor
+/// \param[in] shape shape of the output tensor
+/// \param[out] out output argument to hold the created Tensor
+/// \return Status Code
+template <>
+inline Status Tensor::CreateFromVector<std::string>(const std::vector<std::string> &items, const TensorShape &shape,
+                                                    TensorPtr *out) {
+  std::vector<std::string_view> views(items.begin(), items.end());
+  return CreateFromVector<std::string_view>(views, shape, out);
+}
+
 /// Create a string scalar Tensor from the given value.
 /// \param[in] item value
 /// \param[out] out Created tensor
@@ -15,6 +15,8 @@
  */
 #include "minddata/dataset/kernels/data/fill_op.h"
 
+#include <algorithm>
+
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/kernels/data/data_utils.h"
 #include "minddata/dataset/kernels/tensor_op.h"
@@ -26,5 +28,34 @@ Status FillOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Ten
   Status s = Fill(input, output, fill_value_);
   return s;
 }
+
+Status FillOp::BatchCompute(const TensorTable &input, TensorTable *output, const std::vector<TensorPtr> &slots) {
+  if (input.empty() || input[0].size() != 1 || !fill_value_->type().IsNumeric() ||
+      fill_value_->shape() != TensorShape({})) {
+    return TensorOp::BatchCompute(input, output, slots);
+  }
+  // Cast the fill value once for the batch, to the type of the first row. Fill casts it again for every row.
+  std::shared_ptr<Tensor> value;
+  if (input[0][0]->type().IsNumeric()) {
+    RETURN_IF_NOT_OK(TypeCast(fill_value_, &value, input[0][0]->type()));
+  }
+  return BatchComputeOneToOne(input, output, slots, [this, &value](const TensorPtr &in, TensorPtr *out) -> Status {
+    if (value == nullptr || in->type() != value->type() || in->Size() == 0) {
+      return Compute(in, out);
+    }
+    RETURN_IF_NOT_OK(Tensor::CreateEmpty(in->shape(), in->type(), out));
+    // Copy the value into the first element, then double the filled part until it covers the whole Tensor
+    size_t total = (*out)->SizeInBytes();
+    size_t filled = value->SizeInBytes();
+    uchar *dst = &(*(*out)->begin<uchar>());
+    CHECK_FAIL_RETURN_UNEXPECTED(memcpy_s(dst, total, value->GetBuffer(), filled) == 0, "memcpy err");
+    while (filled < total) {
+      size_t count = std::min(filled, total - filled);
+      CHECK_FAIL_RETURN_UNEXPECTED(memcpy_s(dst + filled, total - filled, dst, count) == 0, "memcpy err");
+      filled += count;
+    }
+    return Status::OK();
+  });
+}
 }  // namespace dataset
 }  // namespace mindspore
@@ -34,6 +34,10 @@ class FillOp : public TensorOp {
 
   Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
 
+  bool SupportsBatch() override { return true; }
+
+  Status BatchCompute(const TensorTable &input, TensorTable *output, const std::vector<TensorPtr> &slots) override;
+
   std::string Name() const override { return kFillOp; }
 
  private:
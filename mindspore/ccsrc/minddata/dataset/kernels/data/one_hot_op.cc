@@ -15,18 +15,67 @@
  */
 #include "minddata/dataset/kernels/data/one_hot_op.h"
 
+#include <algorithm>
+
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/kernels/data/data_utils.h"
 #include "minddata/dataset/kernels/tensor_op.h"
 
 namespace mindspore {
 namespace dataset {
+template <typename T>
+static Status OneHotElements(const std::shared_ptr<Tensor> &input, const std::shared_ptr<Tensor> &output,
+                             dsize_t num_classes) {
+  const T *in = reinterpret_cast<const T *>(input->GetBuffer());
+  T *out = &(*output->begin<T>());
+  std::fill_n(out, output->Size(), static_cast<T>(0));
+  for (dsize_t i = 0; i < input->Size(); i++) {
+    auto class_idx = static_cast<int64_t>(in[i]);
+    if (class_idx < 0 || class_idx >= num_classes) {
+      RETURN_STATUS_UNEXPECTED("One_hot index values are not in range");
+    }
+    out[i * num_classes + class_idx] = 1;
+  }
+  return Status::OK();
+}
+
 Status OneHotOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
   IO_CHECK(input, output);
   Status s = OneHotEncoding(input, output, num_classes_);
   return s;
 }
 
+Status OneHotOp::BatchCompute(const TensorTable &input, TensorTable *output, const std::vector<TensorPtr> &slots) {
+  return BatchComputeOneToOne(input, output, slots, [this](const TensorPtr &in, TensorPtr *out) -> Status {
+    if (!in->type().IsInt() || in->shape().Squeeze().Rank() > 1 || in->Size() == 0 || num_classes_ <= 0) {
+      return Compute(in, out);
+    }
+    // The shape OneHotEncoding gives: <num_elements, num_classes> squeezed
+    TensorShape out_shape = TensorShape({in->Size(), static_cast<dsize_t>(num_classes_)}).Squeeze();
+    RETURN_IF_NOT_OK(Tensor::CreateEmpty(out_shape, in->type(), out));
+    switch (in->type().value()) {
+      case DataType::DE_INT8:
+        return OneHotElements<int8_t>(in, *out, num_classes_);
+      case DataType::DE_UINT8:
+        return OneHotElements<uint8_t>(in, *out, num_classes_);
+      case DataType::DE_INT16:
+        return OneHotElements<int16_t>(in, *out, num_classes_);
+      case DataType::DE_UINT16:
+        return OneHotElements<uint16_t>(in, *out, num_classes_);
+      case DataType::DE_INT32:
+        return OneHotElements<int32_t>(in, *out, num_classes_);
+      case DataType::DE_UINT32:
+        return OneHotElements<uint32_t>(in, *out, num_classes_);
+      case DataType::DE_INT64:
+        return OneHotElements<int64_t>(in, *out, num_classes_);
+      case DataType::DE_UINT64:
+        return OneHotElements<uint64_t>(in, *out, num_classes_);
+      default:
+        RETURN_STATUS_UNEXPECTED("One hot does not support input of this type.");
+    }
+  });
+}
+
 Status OneHotOp::OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) {
   RETURN_IF_NOT_OK(TensorOp::OutputShape(inputs, outputs));
   outputs.clear();
@@ -33,6 +33,10 @@ class OneHotOp : public TensorOp {
 
   Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
 
+  bool SupportsBatch() override { return true; }
+
+  Status BatchCompute(const TensorTable &input, TensorTable *output, const std::vector<TensorPtr> &slots) override;
+
   Status OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) override;
 
   std::string Name() const override { return kOneHotOp; }
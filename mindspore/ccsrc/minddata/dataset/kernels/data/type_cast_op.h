@@ -39,6 +39,9 @@ class TypeCastOp : public TensorOp {
 
   Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
 
+  // The cast of a Tensor is a plain loop already, the default BatchCompute is as good as it gets
+  bool SupportsBatch() override { return true; }
+
   Status OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) override;
 
   std::string Name() const override { return kTypeCastOp; }
@@ -42,7 +42,7 @@ class CenterCropOp : public TensorOp {
 
   std::string Name() const override { return kCenterCropOp; }
 
- private:
+ protected:
   int32_t crop_het_;
   int32_t crop_wid_;
 };
@@ -0,0 +1,60 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/kernels/image/decode_center_crop_op.h"
+
+#include "minddata/dataset/kernels/image/decode_op.h"
+#include "minddata/dataset/kernels/image/image_utils.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+Status DecodeCenterCropOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+  IO_CHECK(input, output);
+  if (IsNonEmptyJPEG(input)) {
+    int w_in = 0;
+    int h_in = 0;
+    RETURN_IF_NOT_OK(GetJpegImageInfo(input, &w_in, &h_in));
+    // Only a crop within the image can be decoded directly, CenterCropOp pads the smaller images
+    if (crop_het_ > 0 && crop_wid_ > 0 && crop_het_ <= h_in && crop_wid_ <= w_in) {
+      return JpegCropAndDecode(input, output, (w_in - crop_wid_) / 2, (h_in - crop_het_) / 2, crop_wid_, crop_het_);
+    }
+  }
+  DecodeOp op(true);
+  std::shared_ptr<Tensor> decoded;
+  RETURN_IF_NOT_OK(op.Compute(input, &decoded));
+  return CenterCropOp::Compute(decoded, output);
+}
+
+Status DecodeCenterCropOp::OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) {
+  RETURN_IF_NOT_OK(TensorOp::OutputShape(inputs, outputs));
+  outputs.clear();
+  if (inputs[0].Rank() == 1) outputs.emplace_back(TensorShape{crop_het_, crop_wid_, 3});
+  if (!outputs.empty()) return Status::OK();
+  return Status(StatusCode::kUnexpectedError, "Input has a wrong shape");
+}
+
+Status DecodeCenterCropOp::OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) {
+  RETURN_IF_NOT_OK(TensorOp::OutputType(inputs, outputs));
+  outputs[0] = DataType(DataType::DE_UINT8);
+  return Status::OK();
+}
+
+void DecodeCenterCropOp::Print(std::ostream &out) const {
+  out << "DecodeCenterCropOp: "
+      << "cropWidth: " << crop_wid_ << "cropHeight: " << crop_het_ << "\n";
+}
+}  // namespace dataset
+}  // namespace mindspore
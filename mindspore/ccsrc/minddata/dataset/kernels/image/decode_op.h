@@ -42,6 +42,8 @@ class DecodeOp : public TensorOp {
 
   std::string Name() const override { return kDecodeOp; }
 
+  bool is_rgb_format() const { return is_rgb_format_; }
+
  private:
   bool is_rgb_format_ = true;
 };
@@ -20,12 +20,41 @@
 
 namespace mindspore {
 namespace dataset {
+template <typename T>
+static void HwcToChwElements(const std::shared_ptr<Tensor> &input, const std::shared_ptr<Tensor> &output) {
+  const T *in = reinterpret_cast<const T *>(input->GetBuffer());
+  T *out = &(*output->begin<T>());
+  dsize_t num_pixels = input->shape()[0] * input->shape()[1];
+  dsize_t num_channels = input->shape()[2];
+  for (dsize_t c = 0; c < num_channels; c++, out += num_pixels) {
+    for (dsize_t p = 0; p < num_pixels; p++) {
+      out[p] = in[p * num_channels + c];
+    }
+  }
+}
+
 Status HwcToChwOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
   IO_CHECK(input, output);
   // input.shape == HWC
   // output.shape == CHW
   return HwcToChw(input, output);
 }
+
+Status HwcToChwOp::BatchCompute(const TensorTable &input, TensorTable *output, const std::vector<TensorPtr> &slots) {
+  return BatchComputeOneToOne(input, output, slots, [this](const TensorPtr &in, TensorPtr *out) -> Status {
+    if ((in->type() != DataType::DE_UINT8 && in->type() != DataType::DE_FLOAT32) || in->Rank() != 3 ||
+        (in->shape()[2] != 3 && in->shape()[2] != 1) || in->Size() == 0) {
+      return Compute(in, out);
+    }
+    RETURN_IF_NOT_OK(Tensor::CreateEmpty(TensorShape{in->shape()[2], in->shape()[0], in->shape()[1]}, in->type(), out));
+    if (in->type() == DataType::DE_UINT8) {
+      HwcToChwElements<uint8_t>(in, *out);
+    } else {
+      HwcToChwElements<float>(in, *out);
+    }
+    return Status::OK();
+  });
+}
 Status HwcToChwOp::OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) {
   RETURN_IF_NOT_OK(TensorOp::OutputShape(inputs, outputs));
   outputs.clear();
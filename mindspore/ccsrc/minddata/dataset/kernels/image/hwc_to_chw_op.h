@@ -31,6 +31,10 @@ class HwcToChwOp : public TensorOp {
   Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
   Status OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) override;
 
+  bool SupportsBatch() override { return true; }
+
+  Status BatchCompute(const TensorTable &input, TensorTable *output, const std::vector<TensorPtr> &slots) override;
+
   std::string Name() const override { return kHwcToChwOp; }
 };
 }  // namespace dataset
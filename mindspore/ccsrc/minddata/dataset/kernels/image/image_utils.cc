@@ -619,6 +619,117 @@ Status Normalize(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *
   }
 }
 
+// Reads the per channel mean and std of Normalize
+static Status GetMeanStd(const std::shared_ptr<Tensor> &mean, const std::shared_ptr<Tensor> &std, float *mean_c,
+                         float *std_c) {
+  mean->Squeeze();
+  if (mean->type() != DataType::DE_FLOAT32 || mean->Rank() != 1 || mean->shape()[0] != 3) {
+    std::string err_msg = "Mean tensor should be of size 3 and type float.";
+    return Status(StatusCode::kShapeMisMatch, err_msg);
+  }
+  std->Squeeze();
+  if (std->type() != DataType::DE_FLOAT32 || std->Rank() != 1 || std->shape()[0] != 3) {
+    std::string err_msg = "Std tensor should be of size 3 and type float.";
+    return Status(StatusCode::kShapeMisMatch, err_msg);
+  }
+  for (uint8_t i = 0; i < 3; i++) {
+    RETURN_IF_NOT_OK(mean->GetItemAt<float>(&mean_c[i], {i}));
+    RETURN_IF_NOT_OK(std->GetItemAt<float>(&std_c[i], {i}));
+  }
+  return Status::OK();
+}
+
+Status NormalizeHwcToChw(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output,
+                         const std::shared_ptr<Tensor> &mean, const std::shared_ptr<Tensor> &std) {
+  std::shared_ptr<CVTensor> input_cv = CVTensor::AsCVTensor(input);
+  if (!(input_cv->mat().data && input_cv->Rank() == 3)) {
+    RETURN_STATUS_UNEXPECTED("Could not convert to CV Tensor");
+  }
+  float mean_c[3];
+  float std_c[3];
+  RETURN_IF_NOT_OK(GetMeanStd(mean, std, mean_c, std_c));
+  std::shared_ptr<CVTensor> output_cv;
+  RETURN_IF_NOT_OK(CVTensor::CreateEmpty(TensorShape{3, input_cv->shape()[0], input_cv->shape()[1]},
+                                         DataType(DataType::DE_FLOAT32), &output_cv));
+  try {
+    // The split and the conversion of each channel are the ones of Normalize, only the converted channel is written
+    // straight to its plane of the output instead of being merged and extracted again by HwcToChw
+    std::vector<cv::Mat> rgb;
+    cv::split(input_cv->mat(), rgb);
+    if (rgb.size() != 3) {
+      RETURN_STATUS_UNEXPECTED("Input image is not in RGB.");
+    }
+    for (int i = 0; i < 3; i++) {
+      cv::Mat plane;
+      RETURN_IF_NOT_OK(output_cv->MatAtIndex({i}, &plane));
+      rgb[i].convertTo(plane, CV_32F, 1.0 / std_c[i], (-mean_c[i] / std_c[i]));
+    }
+    *output = std::static_pointer_cast<Tensor>(output_cv);
+    return Status::OK();
+  } catch (const cv::Exception &e) {
+    RETURN_STATUS_UNEXPECTED("Unexpected error in NormalizeHwcToChw");
+  }
+}
+
+template <typename T>
+static void RescaleNormalizePixels(const T *in, float *out, int64_t num_pixels, const float *scale,
+                                   const float *offset, bool hwc_to_chw) {
+  if (hwc_to_chw) {
+    for (int64_t p = 0; p < num_pixels; p++, in += 3) {
+      out[p] = in[0] * scale[0] + offset[0];
+      out[num_pixels + p] = in[1] * scale[1] + offset[1];
+      out[2 * num_pixels + p] = in[2] * scale[2] + offset[2];
+    }
+  } else {
+    for (int64_t p = 0; p < num_pixels; p++, in += 3, out += 3) {
+      out[0] = in[0] * scale[0] + offset[0];
+      out[1] = in[1] * scale[1] + offset[1];
+      out[2] = in[2] * scale[2] + offset[2];
+    }
+  }
+}
+
+Status RescaleNormalize(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, float rescale,
+                        float shift, const std::shared_ptr<Tensor> &mean, const std::shared_ptr<Tensor> &std,
+                        bool hwc_to_chw) {
+  if (input->Rank() != 3 || input->shape()[2] != 3) {
+    RETURN_STATUS_UNEXPECTED("Input image is not in RGB.");
+  }
+  if (input->type() != DataType::DE_UINT8 && input->type() != DataType::DE_FLOAT32) {
+    // No single pass kernel for this type, do the steps one after the other
+    std::shared_ptr<Tensor> rescaled;
+    RETURN_IF_NOT_OK(Rescale(input, &rescaled, rescale, shift));
+    if (!hwc_to_chw) {
+      return Normalize(rescaled, output, mean, std);
+    }
+    return NormalizeHwcToChw(rescaled, output, mean, std);
+  }
+  float mean_c[3];
+  float std_c[3];
+  RETURN_IF_NOT_OK(GetMeanStd(mean, std, mean_c, std_c));
+  // ((x * rescale + shift) - mean) / std folded into x * scale + offset
+  float scale[3];
+  float offset[3];
+  for (int i = 0; i < 3; i++) {
+    scale[i] = rescale / std_c[i];
+    offset[i] = (shift - mean_c[i]) / std_c[i];
+  }
+  dsize_t height = input->shape()[0];
+  dsize_t width = input->shape()[1];
+  TensorShape shape = hwc_to_chw ? TensorShape{3, height, width} : TensorShape{height, width, 3};
+  std::shared_ptr<Tensor> output_tensor;
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(shape, DataType(DataType::DE_FLOAT32), &output_tensor));
+  float *out = &(*output_tensor->begin<float>());
+  if (input->type() == DataType::DE_UINT8) {
+    RescaleNormalizePixels(input->GetBuffer(), out, height * width, scale, offset, hwc_to_chw);
+  } else {
+    RescaleNormalizePixels(reinterpret_cast<const float *>(input->GetBuffer()), out, height * width, scale, offset,
+                           hwc_to_chw);
+  }
+  *output = std::move(output_tensor);
+  return Status::OK();
+}
+
 Status AdjustBrightness(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, const float &alpha) {
   try {
     std::shared_ptr<CVTensor> input_cv = CVTensor::AsCVTensor(input);
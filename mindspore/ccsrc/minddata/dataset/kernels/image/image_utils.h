@@ -182,6 +182,29 @@ Status Rotate(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *out
 Status Normalize(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output,
                  const std::shared_ptr<Tensor> &mean, const std::shared_ptr<Tensor> &std);
 
+/// \brief Returns Normalized image with the channels swapped to CHW, the same values as Normalize followed by
+///     HwcToChw without the normalized HWC image in between
+/// \param input: Tensor of shape <H,W,C> in RGB order and any OpenCv compatible type, see CVTensor.
+/// \param mean: Tensor of shape <3> and type DE_FLOAT32 which are mean of each channel in RGB order
+/// \param std:  Tensor of shape <3> and type DE_FLOAT32 which are std of each channel in RGB order
+/// \param output: Normalized image Tensor of shape <C,H,W> and type DE_FLOAT32
+Status NormalizeHwcToChw(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output,
+                         const std::shared_ptr<Tensor> &mean, const std::shared_ptr<Tensor> &std);
+
+/// \brief Returns Rescaled and Normalized image computed in a single pass, optionally with the channels swapped
+///     to CHW. The rescale is folded into the normalization, so the values may differ from Rescale followed by
+///     Normalize in the last bits.
+/// \param input: Tensor of shape <H,W,C> in RGB order and any OpenCv compatible type, see CVTensor.
+/// \param rescale: rescale parameter
+/// \param shift: shift parameter
+/// \param mean: Tensor of shape <3> and type DE_FLOAT32 which are mean of each channel in RGB order
+/// \param std:  Tensor of shape <3> and type DE_FLOAT32 which are std of each channel in RGB order
+/// \param hwc_to_chw: whether to swap the channels to CHW
+/// \param output: Normalized image Tensor of shape <H,W,C> (or <C,H,W>) and type DE_FLOAT32
+Status RescaleNormalize(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, float rescale,
+                        float shift, const std::shared_ptr<Tensor> &mean, const std::shared_ptr<Tensor> &std,
+                        bool hwc_to_chw);
+
 /// \brief Returns image with adjusted brightness.
 /// \param input: Tensor of shape <H,W,3> in RGB order and any OpenCv compatible type, see CVTensor.
 /// \param alpha: Alpha value to adjust brightness by. Should be a positive number.
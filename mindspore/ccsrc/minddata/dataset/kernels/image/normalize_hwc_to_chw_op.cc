@@ -0,0 +1,52 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/kernels/image/normalize_hwc_to_chw_op.h"
+
+#include "minddata/dataset/kernels/image/image_utils.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+Status NormalizeHwcToChwOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+  IO_CHECK(input, output);
+  return NormalizeHwcToChw(input, output, mean_, std_);
+}
+
+Status NormalizeHwcToChwOp::BatchCompute(const TensorTable &input, TensorTable *output,
+                                         const std::vector<TensorPtr> &slots) {
+  return BatchComputeOneToOne(input, output, slots, [this](const TensorPtr &in, TensorPtr *out) -> Status {
+    if ((in->type() != DataType::DE_UINT8 && in->type() != DataType::DE_FLOAT32) || in->Rank() != 3 ||
+        in->shape()[2] != 3) {
+      return Compute(in, out);
+    }
+    // A single pass over the pixels, the same as the one of NormalizeOp::BatchCompute
+    return RescaleNormalize(in, out, 1.0f, 0.0f, mean_, std_, true);
+  });
+}
+
+Status NormalizeHwcToChwOp::OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) {
+  RETURN_IF_NOT_OK(TensorOp::OutputShape(inputs, outputs));
+  outputs.clear();
+  if (inputs[0].Rank() == 3) outputs.emplace_back(TensorShape{inputs[0][2], inputs[0][0], inputs[0][1]});
+  if (!outputs.empty()) return Status::OK();
+  return Status(StatusCode::kUnexpectedError, "Input has a wrong shape");
+}
+
+void NormalizeHwcToChwOp::Print(std::ostream &out) const {
+  out << "NormalizeHwcToChwOp, mean: " << mean_ << std::endl << "std: " << std_ << std::endl;
+}
+}  // namespace dataset
+}  // namespace mindspore
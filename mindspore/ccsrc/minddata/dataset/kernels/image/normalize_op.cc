@@ -40,6 +40,17 @@ Status NormalizeOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_pt
   return Normalize(input, output, mean_, std_);
 }
 
+Status NormalizeOp::BatchCompute(const TensorTable &input, TensorTable *output, const std::vector<TensorPtr> &slots) {
+  return BatchComputeOneToOne(input, output, slots, [this](const TensorPtr &in, TensorPtr *out) -> Status {
+    if ((in->type() != DataType::DE_UINT8 && in->type() != DataType::DE_FLOAT32) || in->Rank() != 3 ||
+        in->shape()[2] != 3) {
+      return Compute(in, out);
+    }
+    // A single pass over the pixels instead of the split, convert and merge of every channel by OpenCV
+    return RescaleNormalize(in, out, 1.0f, 0.0f, mean_, std_, false);
+  });
+}
+
 void NormalizeOp::Print(std::ostream &out) const {
   out << "NormalizeOp, mean: " << mean_ << std::endl << "std: " << std_ << std::endl;
 }
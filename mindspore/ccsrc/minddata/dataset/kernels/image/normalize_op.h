@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "minddata/dataset/core/cv_tensor.h"
 #include "minddata/dataset/core/tensor.h"
@@ -36,9 +37,15 @@ class NormalizeOp : public TensorOp {
 
   Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
 
+  bool SupportsBatch() override { return true; }
+
+  bool ExactBatch() override { return false; }
+
+  Status BatchCompute(const TensorTable &input, TensorTable *output, const std::vector<TensorPtr> &slots) override;
+
   std::string Name() const override { return kNormalizeOp; }
 
- private:
+ protected:
   std::shared_ptr<Tensor> mean_;
   std::shared_ptr<Tensor> std_;
 };
@@ -22,6 +22,25 @@ namespace mindspore {
 namespace dataset {
 const float RandomHorizontalFlipOp::kDefProbability = 0.5;
 
+template <typename T>
+static void HorizontalFlipElements(const std::shared_ptr<Tensor> &input, const std::shared_ptr<Tensor> &output) {
+  const T *in = reinterpret_cast<const T *>(input->GetBuffer());
+  T *out = &(*output->begin<T>());
+  dsize_t height = input->shape()[0];
+  dsize_t width = input->shape()[1];
+  dsize_t num_channels = input->Rank() == 3 ? input->shape()[2] : 1;
+  dsize_t row_size = width * num_channels;
+  for (dsize_t y = 0; y < height; y++, in += row_size, out += row_size) {
+    for (dsize_t x = 0; x < width; x++) {
+      const T *src = in + (width - 1 - x) * num_channels;
+      T *dst = out + x * num_channels;
+      for (dsize_t c = 0; c < num_channels; c++) {
+        dst[c] = src[c];
+      }
+    }
+  }
+}
+
 Status RandomHorizontalFlipOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
   IO_CHECK(input, output);
   if (distribution_(rnd_)) {
@@ -30,5 +49,27 @@ Status RandomHorizontalFlipOp::Compute(const std::shared_ptr<Tensor> &input, std
   *output = input;
   return Status::OK();
 }
+
+Status RandomHorizontalFlipOp::BatchCompute(const TensorTable &input, TensorTable *output,
+                                            const std::vector<TensorPtr> &slots) {
+  return BatchComputeOneToOne(input, output, slots, [this](const TensorPtr &in, TensorPtr *out) -> Status {
+    // One draw per row in the order of the rows, the same draws as Compute
+    if (!distribution_(rnd_)) {
+      *out = in;
+      return Status::OK();
+    }
+    if ((in->type() != DataType::DE_UINT8 && in->type() != DataType::DE_FLOAT32) ||
+        (in->Rank() != 2 && in->Rank() != 3) || in->Size() == 0) {
+      return HorizontalFlip(in, out);
+    }
+    RETURN_IF_NOT_OK(Tensor::CreateEmpty(in->shape(), in->type(), out));
+    if (in->type() == DataType::DE_UINT8) {
+      HorizontalFlipElements<uint8_t>(in, *out);
+    } else {
+      HorizontalFlipElements<float>(in, *out);
+    }
+    return Status::OK();
+  });
+}
 }  // namespace dataset
 }  // namespace mindspore
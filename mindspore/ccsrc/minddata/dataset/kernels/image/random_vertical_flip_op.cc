@@ -31,5 +31,30 @@ Status RandomVerticalFlipOp::Compute(const std::shared_ptr<Tensor> &input, std::
   *output = input;
   return Status::OK();
 }
+
+Status RandomVerticalFlipOp::BatchCompute(const TensorTable &input, TensorTable *output,
+                                          const std::vector<TensorPtr> &slots) {
+  return BatchComputeOneToOne(input, output, slots, [this](const TensorPtr &in, TensorPtr *out) -> Status {
+    // One draw per row in the order of the rows, the same draws as Compute
+    if (!distribution_(rnd_)) {
+      *out = in;
+      return Status::OK();
+    }
+    if (!in->type().IsNumeric() || (in->Rank() != 2 && in->Rank() != 3) || in->Size() == 0) {
+      return VerticalFlip(in, out);
+    }
+    RETURN_IF_NOT_OK(Tensor::CreateEmpty(in->shape(), in->type(), out));
+    // Whatever the type, a vertical flip copies whole image rows
+    dsize_t height = in->shape()[0];
+    size_t row_bytes = in->SizeInBytes() / height;
+    const uchar *src = in->GetBuffer();
+    uchar *dst = &(*(*out)->begin<uchar>());
+    for (dsize_t y = 0; y < height; y++) {
+      int ret_code = memcpy_s(dst + y * row_bytes, row_bytes, src + (height - 1 - y) * row_bytes, row_bytes);
+      CHECK_FAIL_RETURN_UNEXPECTED(ret_code == 0, "Failed to copy an image row.");
+    }
+    return Status::OK();
+  });
+}
 }  // namespace dataset
 }  // namespace mindspore
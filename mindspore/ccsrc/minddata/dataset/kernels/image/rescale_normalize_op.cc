@@ -0,0 +1,55 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/kernels/image/rescale_normalize_op.h"
+
+#include "minddata/dataset/kernels/image/image_utils.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+Status RescaleNormalizeOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+  IO_CHECK(input, output);
+  return RescaleNormalize(input, output, rescale_, shift_, mean_, std_, hwc_to_chw_);
+}
+
+Status RescaleNormalizeOp::BatchCompute(const TensorTable &input, TensorTable *output,
+                                        const std::vector<TensorPtr> &slots) {
+  // Compute already makes a single pass over the image, skip the one of NormalizeOp
+  return TensorOp::BatchCompute(input, output, slots);
+}
+
+Status RescaleNormalizeOp::OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) {
+  RETURN_IF_NOT_OK(TensorOp::OutputShape(inputs, outputs));
+  if (!hwc_to_chw_) return Status::OK();
+  outputs.clear();
+  if (inputs[0].Rank() == 3) outputs.emplace_back(TensorShape{inputs[0][2], inputs[0][0], inputs[0][1]});
+  if (!outputs.empty()) return Status::OK();
+  return Status(StatusCode::kUnexpectedError, "Input has a wrong shape");
+}
+
+Status RescaleNormalizeOp::OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) {
+  RETURN_IF_NOT_OK(TensorOp::OutputType(inputs, outputs));
+  outputs[0] = DataType(DataType::DE_FLOAT32);
+  return Status::OK();
+}
+
+void RescaleNormalizeOp::Print(std::ostream &out) const {
+  out << Name() << ": shift: " << shift_ << ", Rescale: " << rescale_ << ", mean: " << mean_ << std::endl
+      << "std: " << std_ << std::endl
+      << "HWC to CHW: " << hwc_to_chw_ << std::endl;
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -20,10 +20,33 @@
 
 namespace mindspore {
 namespace dataset {
+template <typename T>
+static void RescaleElements(const T *in, float *out, dsize_t num_elements, float rescale, float shift) {
+  for (dsize_t i = 0; i < num_elements; i++) {
+    out[i] = static_cast<float>(in[i]) * rescale + shift;
+  }
+}
+
 Status RescaleOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
   IO_CHECK(input, output);
   return Rescale(input, output, rescale_, shift_);
 }
+
+Status RescaleOp::BatchCompute(const TensorTable &input, TensorTable *output, const std::vector<TensorPtr> &slots) {
+  return BatchComputeOneToOne(input, output, slots, [this](const TensorPtr &in, TensorPtr *out) -> Status {
+    if ((in->type() != DataType::DE_UINT8 && in->type() != DataType::DE_FLOAT32) || in->Size() == 0) {
+      return Compute(in, out);
+    }
+    RETURN_IF_NOT_OK(Tensor::CreateEmpty(in->shape(), DataType(DataType::DE_FLOAT32), out));
+    float *dst = &(*(*out)->begin<float>());
+    if (in->type() == DataType::DE_UINT8) {
+      RescaleElements(in->GetBuffer(), dst, in->Size(), rescale_, shift_);
+    } else {
+      RescaleElements(reinterpret_cast<const float *>(in->GetBuffer()), dst, in->Size(), rescale_, shift_);
+    }
+    return Status::OK();
+  });
+}
 Status RescaleOp::OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) {
   RETURN_IF_NOT_OK(TensorOp::OutputType(inputs, outputs));
   outputs[0] = DataType(DataType::DE_FLOAT32);
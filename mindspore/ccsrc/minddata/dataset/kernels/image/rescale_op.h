@@ -39,8 +39,18 @@ class RescaleOp : public TensorOp {
   Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
   Status OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) override;
 
+  bool SupportsBatch() override { return true; }
+
+  bool ExactBatch() override { return false; }
+
+  Status BatchCompute(const TensorTable &input, TensorTable *output, const std::vector<TensorPtr> &slots) override;
+
   std::string Name() const override { return kRescaleOp; }
 
+  float rescale() const { return rescale_; }
+
+  float shift() const { return shift_; }
+
  private:
   float rescale_;
   float shift_;
@@ -48,6 +48,21 @@ Status TensorOp::Compute(const TensorRow &input, TensorRow *output) {
                 "Is this TensorOp oneToOne? If no, please implement this Compute() in the derived class.");
 }
 
+// Name: BatchCompute()
+// Description: This BatchCompute() takes a table of rows and calls Compute() on every row. The derived class should
+//              override this function when it can do better than that, and SupportsBatch() to say so.
+Status TensorOp::BatchCompute(const TensorTable &input, TensorTable *output, const std::vector<TensorPtr> &slots) {
+  RETURN_UNEXPECTED_IF_NULL(output);
+  output->resize(input.size());
+  for (size_t r = 0; r < input.size(); r++) {
+    Tensor::SetOutputSlot(r < slots.size() ? slots[r] : nullptr);
+    Status rc = Compute(input[r], &(*output)[r]);
+    Tensor::SetOutputSlot(nullptr);
+    RETURN_IF_NOT_OK(rc);
+  }
+  return Status::OK();
+}
+
 Status TensorOp::OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) {
   if (inputs.size() != NumInput())
     return Status(StatusCode::kUnexpectedError,
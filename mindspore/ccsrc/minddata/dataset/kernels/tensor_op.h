@@ -53,6 +53,7 @@ constexpr char kTensorOp[] = "TensorOp";
 constexpr char kAutoContrastOp[] = "AutoContrastOp";
 constexpr char kBoundingBoxAugmentOp[] = "BoundingBoxAugmentOp";
 constexpr char kDecodeOp[] = "DecodeOp";
+constexpr char kDecodeCenterCropOp[] = "DecodeCenterCropOp";
 constexpr char kCenterCropOp[] = "CenterCropOp";
 constexpr char kCutMixBatchOp[] = "CutMixBatchOp";
 constexpr char kCutOutOp[] = "CutOutOp";
@@ -62,6 +63,7 @@ constexpr char kHwcToChwOp[] = "HwcToChwOp";
 constexpr char kInvertOp[] = "InvertOp";
 constexpr char kMixUpBatchOp[] = "MixUpBatchOp";
 constexpr char kNormalizeOp[] = "NormalizeOp";
+constexpr char kNormalizeHwcToChwOp[] = "NormalizeHwcToChwOp";
 constexpr char kPadOp[] = "PadOp";
 constexpr char kRandomColorAdjustOp[] = "RandomColorAdjustOp";
 constexpr char kRandomCropAndResizeOp[] = "RandomCropAndResizeOp";
@@ -79,6 +81,7 @@ constexpr char kRandomSharpnessOp[] = "RandomSharpnessOp";
 constexpr char kRandomVerticalFlipOp[] = "RandomVerticalFlipOp";
 constexpr char kRandomVerticalFlipWithBBoxOp[] = "RandomVerticalFlipWithBBoxOp";
 constexpr char kRescaleOp[] = "RescaleOp";
+constexpr char kRescaleNormalizeOp[] = "RescaleNormalizeOp";
 constexpr char kResizeBilinearOp[] = "ResizeBilinearOp";
 constexpr char kResizeOp[] = "ResizeOp";
 constexpr char kResizeWithBBoxOp[] = "ResizeWithBBoxOp";
@@ -164,6 +167,24 @@ class TensorOp {
   // @return Status
   virtual Status Compute(const TensorRow &input, TensorRow *output);
 
+  // Returns true if the TensorOp has a BatchCompute that is cheaper than calling Compute on every row, MapOp hands
+  // whole batches to its TensorOps when all of them do.
+  // @return true/false
+  virtual bool SupportsBatch() { return false; }
+
+  // Returns false if the float arithmetic of BatchCompute can differ from the one of Compute in the last bits. MapOp
+  // hands batches to such TensorOps only when the OPTIMIZE switch is on.
+  // @return true/false
+  virtual bool ExactBatch() { return true; }
+
+  // Perform the operation on all the rows of a table at once. The default calls Compute on every row.
+  // @param input the rows to process.
+  // @param output the address to a table where the result rows will be placed, in the same order as the input.
+  // @param slots tensors the output of every row is written into when they match its shape and type, see
+  //     Tensor::SetOutputSlot. Can be shorter than input or empty.
+  // @return Status
+  virtual Status BatchCompute(const TensorTable &input, TensorTable *output, const std::vector<TensorPtr> &slots);
+
   // Returns true oif the TensorOp takes one input and returns one output.
   // @return true/false
   bool OneToOne() { return NumInput() == 1 && NumOutput() == 1; }
@@ -191,6 +212,28 @@ class TensorOp {
   virtual Status OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs);
 
   virtual std::string Name() const = 0;
+
+ protected:
+  // Run compute on the only Tensor of every row of a table, with the output slot of the row set. This is the body
+  // of BatchCompute for 1-1 TensorOps, which only give the computation of a single Tensor.
+  // @param compute function of (const std::shared_ptr<Tensor> &, std::shared_ptr<Tensor> *) returning Status.
+  template <typename F>
+  Status BatchComputeOneToOne(const TensorTable &input, TensorTable *output, const std::vector<TensorPtr> &slots,
+                              F &&compute) {
+    RETURN_UNEXPECTED_IF_NULL(output);
+    output->resize(input.size());
+    for (size_t r = 0; r < input.size(); r++) {
+      if (input[r].size() != 1) {
+        RETURN_STATUS_UNEXPECTED(Name() + " expects rows of one Tensor.");
+      }
+      (*output)[r].resize(1);
+      Tensor::SetOutputSlot(r < slots.size() ? slots[r] : nullptr);
+      Status rc = compute(input[r][0], &(*output)[r][0]);
+      Tensor::SetOutputSlot(nullptr);
+      RETURN_IF_NOT_OK(rc);
+    }
+    return Status::OK();
+  }
 };
 }  // namespace dataset
 }  // namespace mindspore
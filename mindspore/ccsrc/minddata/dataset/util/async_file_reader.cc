@@ -0,0 +1,147 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/util/async_file_reader.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include "minddata/dataset/core/constants.h"
+#include "minddata/dataset/util/task_manager.h"
+
+namespace mindspore {
+namespace dataset {
+constexpr int32_t AsyncFileReader::kMaxThreads;
+constexpr int32_t AsyncFileReader::kPending;
+constexpr int32_t AsyncFileReader::kReading;
+constexpr int32_t AsyncFileReader::kDone;
+
+AsyncFileReader::AsyncFileReader(int32_t depth) : depth_(std::max(1, depth)), num_submitted_(0), quit_(false) {}
+
+Status AsyncFileReader::Launch(TaskGroup *vg) {
+  RETURN_UNEXPECTED_IF_NULL(vg);
+  RETURN_IF_NOT_OK(submit_cv_.Register(vg->GetIntrpService()));
+  RETURN_IF_NOT_OK(done_cv_.Register(vg->GetIntrpService()));
+  int32_t num_threads = std::min(depth_, kMaxThreads);
+  for (int32_t i = 0; i < num_threads; i++) {
+    RETURN_IF_NOT_OK(vg->CreateAsyncTask("File reader", std::bind(&AsyncFileReader::ReaderEntry, this)));
+  }
+  return Status::OK();
+}
+
+Status AsyncFileReader::Submit(const std::vector<std::string> &paths) {
+  std::unique_lock<std::mutex> lck(mux_);
+  RETURN_IF_NOT_OK(submit_cv_.Wait(&lck, [this]() -> bool { return num_submitted_ < depth_; }));
+  for (const auto &path : paths) {
+    Entry &entry = entries_[path];
+    // A file submitted again before it is taken is read once
+    if (entry.num_takes == 0) {
+      pending_.push_back(path);
+    }
+    entry.num_takes++;
+    num_submitted_++;
+  }
+  submit_cv_.NotifyAll();
+  return Status::OK();
+}
+
+Status AsyncFileReader::Take(const std::string &path, std::shared_ptr<Tensor> *out) {
+  RETURN_UNEXPECTED_IF_NULL(out);
+  std::unique_lock<std::mutex> lck(mux_);
+  auto it = entries_.find(path);
+  if (it == entries_.end()) {
+    lck.unlock();
+    return ReadFile(path, out);
+  }
+  // References to the elements of an unordered_map stay valid when other elements are added
+  Entry &entry = it->second;
+  RETURN_IF_NOT_OK(done_cv_.Wait(&lck, [&entry]() -> bool { return entry.state == kDone; }));
+  Status rc = entry.rc;
+  if (--entry.num_takes == 0) {
+    *out = std::move(entry.data);
+    entries_.erase(it);
+  } else if (rc.IsOk()) {
+    // The rows of the file may be changed in place further up the pipeline, only the last one gets the original
+    rc = Tensor::CreateFromTensor(entry.data, out);
+  }
+  num_submitted_--;
+  submit_cv_.NotifyAll();
+  return rc;
+}
+
+void AsyncFileReader::Stop() {
+  std::unique_lock<std::mutex> lck(mux_);
+  quit_ = true;
+  submit_cv_.NotifyAll();
+}
+
+Status AsyncFileReader::ReaderEntry() {
+  TaskManager::FindMe()->Post();
+  while (true) {
+    std::string path;
+    {
+      std::unique_lock<std::mutex> lck(mux_);
+      RETURN_IF_NOT_OK(submit_cv_.Wait(&lck, [this]() -> bool { return !pending_.empty() || quit_; }));
+      if (pending_.empty()) {
+        return Status::OK();
+      }
+      path = std::move(pending_.front());
+      pending_.pop_front();
+      entries_[path].state = kReading;
+    }
+    std::shared_ptr<Tensor> data;
+    Status rc = ReadFile(path, &data);
+    {
+      std::unique_lock<std::mutex> lck(mux_);
+      Entry &entry = entries_[path];
+      entry.data = std::move(data);
+      entry.rc = rc;
+      entry.state = kDone;
+    }
+    done_cv_.NotifyAll();
+  }
+}
+
+Status AsyncFileReader::ReadFile(const std::string &path, std::shared_ptr<Tensor> *out) {
+#if defined(_WIN32) || defined(_WIN64)
+  int fd = open(path.c_str(), O_RDONLY | O_BINARY);
+#else
+  int fd = open(path.c_str(), O_RDONLY);
+#endif
+  CHECK_FAIL_RETURN_UNEXPECTED(fd >= 0, "Fail to open file: " + path);
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || file_stat.st_size > kDeMaxDim) {
+    close(fd);
+    RETURN_STATUS_UNEXPECTED("Invalid file to allocate tensor memory, check path: " + path);
+  }
+  int64_t num_bytes = file_stat.st_size;
+  Status rc = Tensor::CreateEmpty(TensorShape{num_bytes}, DataType(DataType::DE_UINT8), out);
+  int64_t offset = 0;
+  while (rc.IsOk() && offset < num_bytes) {
+    auto read_bytes = read(fd, (*out)->GetMutableBuffer() + offset, num_bytes - offset);
+    if (read_bytes <= 0) {
+      rc = Status(StatusCode::kUnexpectedError, __LINE__, __FILE__, "Error in reading file: " + path);
+    } else {
+      offset += read_bytes;
+    }
+  }
+  close(fd);
+  return rc;
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,102 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_ASYNC_FILE_READER_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_ASYNC_FILE_READER_H_
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/util/cond_var.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+class TaskGroup;
+
+// Reads files ahead of the workers of a leaf op. The master thread of the op submits the files of the rows in the
+// order its sampler gives them, before it hands the rows to the workers, and the workers take the content of the
+// files when they load the rows. A pool of threads reads the submitted files, so that up to depth reads are in
+// flight instead of one per worker. A file that is taken without being submitted is read on the spot.
+class AsyncFileReader {
+ public:
+  // Most threads reading files of one op
+  static constexpr int32_t kMaxThreads = 16;
+
+  // Constructor
+  // @param depth - Number of files submitted and not taken yet above which Submit blocks
+  explicit AsyncFileReader(int32_t depth);
+
+  ~AsyncFileReader() = default;
+
+  // Launch the reading threads in the task group, min(depth, kMaxThreads) of them
+  // @param vg - The task group of the execution tree
+  // @return Status - The error code return
+  Status Launch(TaskGroup *vg);
+
+  // Queue the reads of files. Blocks while depth files are submitted and not taken, all the files of a call are
+  // admitted at once so that the caller never has to wait for the rows of its own call to be taken.
+  // @param paths - The files, in the order they are going to be taken
+  // @return Status - The error code return
+  Status Submit(const std::vector<std::string> &paths);
+
+  // Take the content of a file, waits for its read if it is not done yet
+  // @param path - The file
+  // @param out - A 1D uint8 tensor of the bytes of the file
+  // @return Status - The error code return
+  Status Take(const std::string &path, std::shared_ptr<Tensor> *out);
+
+  // Let the reading threads quit once they are done with the files submitted so far
+  void Stop();
+
+  // Read a whole file into a 1D uint8 tensor, what Tensor::CreateFromFile does with a single read call
+  // @param path - The file
+  // @param out - The tensor
+  // @return Status - The error code return
+  static Status ReadFile(const std::string &path, std::shared_ptr<Tensor> *out);
+
+ private:
+  // State of a submitted file
+  static constexpr int32_t kPending = 0;
+  static constexpr int32_t kReading = 1;
+  static constexpr int32_t kDone = 2;
+
+  struct Entry {
+    int32_t state = kPending;
+    int32_t num_takes = 0;  // Number of times the file was submitted and not taken yet
+    std::shared_ptr<Tensor> data;
+    Status rc;
+  };
+
+  // Entry point of a reading thread
+  Status ReaderEntry();
+
+  int32_t depth_;
+  int32_t num_submitted_;  // Number of files submitted and not taken, counting a file as many times as submitted
+  bool quit_;
+  std::mutex mux_;
+  CondVar submit_cv_;  // Wakes up the reading threads and the submitter
+  CondVar done_cv_;    // Wakes up the threads taking files
+  std::deque<std::string> pending_;
+  std::unordered_map<std::string, Entry> entries_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_ASYNC_FILE_READER_H_
@@ -44,7 +44,7 @@ class Queue {
   using const_reference = const T &;
 
   explicit Queue(int sz)
-      : sz_(sz), arr_(Services::GetAllocator<T>()), head_(0), tail_(0), my_name_(Services::GetUniqueID()) {
+      : sz_(sz), cap_(sz), arr_(Services::GetAllocator<T>()), head_(0), tail_(0), my_name_(Services::GetUniqueID()) {
     Status rc = arr_.allocate(sz);
     if (rc.IsError()) {
       MS_LOG(ERROR) << "Fail to create a queue.";
@@ -61,7 +61,7 @@ class Queue {
     return (v >= 0) ? v : 0;
   }
 
-  size_t capacity() const { return sz_; }
+  size_t capacity() const { return cap_; }
 
   bool empty() const { return head_ == tail_; }
 
@@ -71,7 +71,7 @@ class Queue {
   Status Add(const_reference ele) noexcept {
     std::unique_lock<std::mutex> _lock(mux_);
     // Block when full
-    Status rc = full_cv_.Wait(&_lock, [this]() -> bool { return (size() != capacity()); });
+    Status rc = full_cv_.Wait(&_lock, [this]() -> bool { return (size() < capacity()); });
     if (rc.IsOk()) {
       auto k = tail_++ % sz_;
       *(arr_[k]) = ele;
@@ -86,7 +86,7 @@ class Queue {
   Status Add(T &&ele) noexcept {
     std::unique_lock<std::mutex> _lock(mux_);
     // Block when full
-    Status rc = full_cv_.Wait(&_lock, [this]() -> bool { return (size() != capacity()); });
+    Status rc = full_cv_.Wait(&_lock, [this]() -> bool { return (size() < capacity()); });
     if (rc.IsOk()) {
       auto k = tail_++ % sz_;
       *(arr_[k]) = std::forward<T>(ele);
@@ -102,7 +102,7 @@ class Queue {
   Status EmplaceBack(Ts &&... args) noexcept {
     std::unique_lock<std::mutex> _lock(mux_);
     // Block when full
-    Status rc = full_cv_.Wait(&_lock, [this]() -> bool { return (size() != capacity()); });
+    Status rc = full_cv_.Wait(&_lock, [this]() -> bool { return (size() < capacity()); });
     if (rc.IsOk()) {
       auto k = tail_++ % sz_;
       new (arr_[k]) T(std::forward<Ts>(args)...);
@@ -130,6 +130,27 @@ class Queue {
     return rc;
   }
 
+  // Change the capacity of the queue while it is in use. The elements in the queue are kept, if there are more of
+  // them than the new capacity the producers block until enough of them are popped.
+  Status Resize(size_t sz) {
+    CHECK_FAIL_RETURN_UNEXPECTED(sz > 0, "Queue capacity must be positive.");
+    std::unique_lock<std::mutex> _lock(mux_);
+    if (sz > sz_) {
+      MemGuard<T, Allocator<T>> arr(Services::GetAllocator<T>());
+      RETURN_IF_NOT_OK(arr.allocate(sz));
+      for (auto i = head_; i < tail_; ++i) {
+        *(arr[i - head_]) = std::move(*(arr_[i % sz_]));
+      }
+      tail_ -= head_;
+      head_ = 0;
+      arr_ = std::move(arr);
+      sz_ = sz;
+    }
+    cap_ = sz;
+    full_cv_.NotifyAll();
+    return Status::OK();
+  }
+
   void ResetQue() noexcept {
     std::unique_lock<std::mutex> _lock(mux_);
     // If there are elements in the queue, drain them. We won't call PopFront directly
@@ -159,7 +180,8 @@ class Queue {
   }
 
  private:
-  size_t sz_;
+  size_t sz_;   // number of elements allocated
+  size_t cap_;  // number of elements the queue holds before blocking the producers, at most sz_
   MemGuard<T, Allocator<T>> arr_;
   size_t head_;
   size_t tail_;
@@ -171,7 +193,7 @@ class Queue {
 
 // A container of queues with [] operator accessors.  Basically this is a wrapper over of a vector of queues
 // to help abstract/simplify code that is maintaining multiple queues.
-template <typename T>
+template <typename T, typename Q = Queue<T>>
 class QueueList {
  public:
   QueueList() {}
@@ -179,7 +201,7 @@ class QueueList {
   void Init(int num_queues, int capacity) {
     queue_list_.reserve(num_queues);
     for (int i = 0; i < num_queues; i++) {
-      queue_list_.emplace_back(std::make_unique<Queue<T>>(capacity));
+      queue_list_.emplace_back(std::make_unique<Q>(capacity));
     }
   }
 
@@ -195,9 +217,9 @@ class QueueList {
 
   auto size() const { return queue_list_.size(); }
 
-  std::unique_ptr<Queue<T>> &operator[](const int index) { return queue_list_[index]; }
+  std::unique_ptr<Q> &operator[](const int index) { return queue_list_[index]; }
 
-  const std::unique_ptr<Queue<T>> &operator[](const int index) const { return queue_list_[index]; }
+  const std::unique_ptr<Q> &operator[](const int index) const { return queue_list_[index]; }
 
   ~QueueList() = default;
 
@@ -205,7 +227,7 @@ class QueueList {
   // Queue contains non-copyable objects, so it cannot be added to a vector due to the vector
   // requirement that objects must have copy semantics.  To resolve this, we use a vector of unique
   // pointers.  This allows us to provide dynamic creation of queues in a container.
-  std::vector<std::unique_ptr<Queue<T>>> queue_list_;
+  std::vector<std::unique_ptr<Q>> queue_list_;
 };
 }  // namespace dataset
 }  // namespace mindspore
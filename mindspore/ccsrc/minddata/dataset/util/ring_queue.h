@@ -0,0 +1,273 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_RING_QUEUE_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_RING_QUEUE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "utils/log_adapter.h"
+#include "minddata/dataset/util/allocator.h"
+#include "minddata/dataset/util/services.h"
+#include "minddata/dataset/util/cond_var.h"
+#include "minddata/dataset/util/task_manager.h"
+
+namespace mindspore {
+namespace dataset {
+// A bounded lock free queue with the same interface as Queue. Any number of threads can push and pop at the same
+// time (the algorithm is Dmitry Vyukov's bounded MPMC queue: every slot carries a sequence number telling whether it
+// is ready to be written or read, so a push or pop is one CAS on the position plus one store on the slot).
+//
+// A thread that finds the queue full (or empty) spins for a while, then yields, and only then parks on a CondVar.
+// The other side only takes the lock to wake the parked threads when there are some, so a queue that is neither
+// full nor empty never locks. The CondVars are registered with the TaskGroup like the ones of Queue, so a parked
+// thread is woken up by an interrupt.
+template <typename T>
+class RingQueue {
+ public:
+  using value_type = T;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using reference = T &;
+  using const_reference = const T &;
+
+  static constexpr int kSpinCount = 256;   // tries with a cpu pause before yielding
+  static constexpr int kYieldCount = 64;   // tries with a yield before parking
+  static constexpr size_t kGrowFactor = 8;  // Resize can grow the capacity up to this times the initial one
+
+  explicit RingQueue(int sz)
+      : cap_(sz),
+        slots_(Services::GetAllocator<Slot>()),
+        mask_(0),
+        head_(0),
+        tail_(0),
+        num_parked_producers_(0),
+        num_parked_consumers_(0),
+        my_name_(Services::GetUniqueID()) {
+    // The slots are sized for the largest capacity Resize allows, rounded up to a power of 2
+    size_t n = 2;
+    while (n < static_cast<size_t>(sz) * kGrowFactor) {
+      n <<= 1;
+    }
+    Status rc = slots_.allocate(n);
+    if (rc.IsError()) {
+      MS_LOG(ERROR) << "Fail to create a ring queue.";
+      std::terminate();
+    }
+    mask_ = n - 1;
+    for (size_t i = 0; i < n; ++i) {
+      slots_[i]->seq.store(i, std::memory_order_relaxed);
+    }
+    MS_LOG(DEBUG) << "Create RingQueue " << my_name_ << " with capacity of " << cap_ << ".";
+  }
+
+  virtual ~RingQueue() { ResetQue(); }
+
+  size_t size() const {
+    size_t tail = tail_.load(std::memory_order_acquire);
+    size_t head = head_.load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0;
+  }
+
+  size_t capacity() const { return cap_.load(std::memory_order_relaxed); }
+
+  bool empty() const { return size() == 0; }
+
+  void Reset() { ResetQue(); }
+
+  // Producer
+  Status Add(const_reference ele) noexcept {
+    return Push([&ele](T *slot) { *slot = ele; });
+  }
+
+  Status Add(T &&ele) noexcept {
+    return Push([&ele](T *slot) { *slot = std::forward<T>(ele); });
+  }
+
+  template <typename... Ts>
+  Status EmplaceBack(Ts &&... args) noexcept {
+    return Push([&args...](T *slot) { *slot = T(std::forward<Ts>(args)...); });
+  }
+
+  // Consumer
+  Status PopFront(pointer p) {
+    for (int i = 0;; ++i) {
+      if (TryPop(p)) {
+        WakeUp(&num_parked_producers_, &full_cv_);
+        return Status::OK();
+      }
+      Status rc = Backoff(i, &num_parked_consumers_, &empty_cv_, [this]() { return !empty(); });
+      if (rc.IsError()) {
+        full_cv_.Interrupt();
+        return rc;
+      }
+    }
+  }
+
+  // Change the capacity of the queue while it is in use, up to kGrowFactor times the initial capacity. The elements in
+  // the queue are kept, if there are more of them than the new capacity the producers wait until enough are popped.
+  Status Resize(size_t sz) {
+    CHECK_FAIL_RETURN_UNEXPECTED(sz > 0, "Queue capacity must be positive.");
+    CHECK_FAIL_RETURN_UNEXPECTED(sz <= mask_ + 1, "RingQueue can't grow beyond " + std::to_string(mask_ + 1) + ".");
+    cap_.store(sz, std::memory_order_relaxed);
+    WakeUp(&num_parked_producers_, &full_cv_);
+    return Status::OK();
+  }
+
+  void ResetQue() noexcept {
+    // Drain the elements so that their destructors run, the same way Queue does
+    T val;
+    while (TryPop(&val)) {
+      val = T();
+    }
+    empty_cv_.ResetIntrpState();
+    full_cv_.ResetIntrpState();
+  }
+
+  Status Register(TaskGroup *vg) {
+    Status rc1 = empty_cv_.Register(vg->GetIntrpService());
+    Status rc2 = full_cv_.Register(vg->GetIntrpService());
+    if (rc1.IsOk()) {
+      return rc2;
+    } else {
+      return rc1;
+    }
+  }
+
+ private:
+  struct Slot {
+    std::atomic<size_t> seq;  // == position: free to write, == position + 1: ready to read
+    T data;
+  };
+
+  // Claim the slot at the tail, fill it with fill and publish it, waiting while the queue is full
+  template <typename F>
+  Status Push(F &&fill) noexcept {
+    for (int i = 0;; ++i) {
+      if (TryPush(fill)) {
+        WakeUp(&num_parked_consumers_, &empty_cv_);
+        return Status::OK();
+      }
+      Status rc = Backoff(i, &num_parked_producers_, &full_cv_, [this]() { return size() < capacity(); });
+      if (rc.IsError()) {
+        empty_cv_.Interrupt();
+        return rc;
+      }
+    }
+  }
+
+  template <typename F>
+  bool TryPush(F &&fill) {
+    size_t pos = tail_.load(std::memory_order_relaxed);
+    while (true) {
+      Slot *slot = slots_[pos & mask_];
+      size_t seq = slot->seq.load(std::memory_order_acquire);
+      auto dif = static_cast<int64_t>(seq) - static_cast<int64_t>(pos);
+      if (dif == 0) {
+        if (pos - head_.load(std::memory_order_acquire) >= capacity()) {
+          return false;
+        }
+        if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          fill(&slot->data);
+          slot->seq.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (dif < 0) {
+        return false;
+      } else {
+        pos = tail_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  bool TryPop(pointer p) {
+    size_t pos = head_.load(std::memory_order_relaxed);
+    while (true) {
+      Slot *slot = slots_[pos & mask_];
+      size_t seq = slot->seq.load(std::memory_order_acquire);
+      auto dif = static_cast<int64_t>(seq) - static_cast<int64_t>(pos + 1);
+      if (dif == 0) {
+        if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          *p = std::move(slot->data);
+          slot->seq.store(pos + mask_ + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (dif < 0) {
+        return false;
+      } else {
+        pos = head_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Wait a little before the next try: spin, then yield, then park until ready() holds. There is no point in
+  // spinning on a single cpu, the other side can't make progress until we give the cpu up.
+  template <typename F>
+  Status Backoff(int i, std::atomic<int32_t> *num_parked, CondVar *cv, F &&ready) {
+    static const int spin_count = std::thread::hardware_concurrency() > 1 ? kSpinCount : 0;
+    if (i < spin_count) {
+      CpuRelax();
+      return Status::OK();
+    }
+    if (i < spin_count + kYieldCount) {
+      std::this_thread::yield();
+      return Status::OK();
+    }
+    std::unique_lock<std::mutex> lck(park_mux_);
+    num_parked->fetch_add(1);
+    // Pairs with the fence in WakeUp, either the waker sees us parked or we see its update
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    Status rc = cv->Wait(&lck, ready);
+    num_parked->fetch_sub(1);
+    return rc;
+  }
+
+  void WakeUp(std::atomic<int32_t> *num_parked, CondVar *cv) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (num_parked->load(std::memory_order_relaxed) > 0) {
+      std::lock_guard<std::mutex> lck(park_mux_);
+      cv->NotifyAll();
+    }
+  }
+
+  static void CpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+  }
+
+  std::atomic<size_t> cap_;
+  MemGuard<Slot, Allocator<Slot>> slots_;
+  size_t mask_;
+  // head_ and tail_ are written by different threads, keep them on different cache lines
+  alignas(64) std::atomic<size_t> head_;
+  alignas(64) std::atomic<size_t> tail_;
+  alignas(64) std::atomic<int32_t> num_parked_producers_;
+  std::atomic<int32_t> num_parked_consumers_;
+  std::string my_name_;
+  std::mutex park_mux_;
+  CondVar empty_cv_;
+  CondVar full_cv_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_RING_QUEUE_H_
@@ -0,0 +1,403 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/util/size_class_pool.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "./securec.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+// Header in front of every block, the address handed out is right after it
+struct BlockHeader {
+  int32_t size_class;  // kNumClasses for the blocks too large for any class
+  int32_t op_id;       // operator the block is counted for
+  uint64_t size;       // usable size of the block
+};
+constexpr size_t kHeaderSize = sizeof(BlockHeader);
+static_assert(kHeaderSize == 16, "the header must keep the alignment of malloc");
+
+BlockHeader *GetHeader(void *p) { return reinterpret_cast<BlockHeader *>(reinterpret_cast<char *>(p) - kHeaderSize); }
+
+void *GetUserAddr(void *raw) { return reinterpret_cast<char *>(raw) + kHeaderSize; }
+
+thread_local int32_t thread_op_id = SizeClassPool::kNoOperator;
+
+enum class Source { kThread, kCentral, kSystem };
+
+struct Counters {
+  std::atomic<int64_t> num_alloc{0};
+  std::atomic<int64_t> num_free{0};
+  std::atomic<int64_t> num_thread_hit{0};
+  std::atomic<int64_t> num_central_hit{0};
+  std::atomic<int64_t> num_system_alloc{0};
+  std::atomic<int64_t> bytes_allocated{0};
+  std::atomic<int64_t> bytes_in_use{0};
+  std::atomic<int64_t> peak_bytes_in_use{0};
+
+  void OnAllocate(size_t n, size_t block_size, Source source) {
+    num_alloc.fetch_add(1, std::memory_order_relaxed);
+    bytes_allocated.fetch_add(static_cast<int64_t>(n), std::memory_order_relaxed);
+    if (source == Source::kThread) {
+      num_thread_hit.fetch_add(1, std::memory_order_relaxed);
+    } else if (source == Source::kCentral) {
+      num_central_hit.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      num_system_alloc.fetch_add(1, std::memory_order_relaxed);
+    }
+    auto size = static_cast<int64_t>(block_size);
+    int64_t in_use = bytes_in_use.fetch_add(size, std::memory_order_relaxed) + size;
+    int64_t peak = peak_bytes_in_use.load(std::memory_order_relaxed);
+    while (in_use > peak && !peak_bytes_in_use.compare_exchange_weak(peak, in_use, std::memory_order_relaxed)) {
+    }
+  }
+
+  void OnDeallocate(size_t block_size) {
+    num_free.fetch_add(1, std::memory_order_relaxed);
+    bytes_in_use.fetch_sub(static_cast<int64_t>(block_size), std::memory_order_relaxed);
+  }
+};
+}  // namespace
+
+// Free blocks shared by all the threads, and the counters of the operators
+class SizeClassPool::Central {
+ public:
+  Central(size_t thread_cache_bytes, size_t central_cache_bytes)
+      : thread_cache_bytes_(thread_cache_bytes), central_cache_bytes_(central_cache_bytes), cached_bytes_(0) {}
+
+  ~Central() {
+    for (auto &blocks : free_blocks_) {
+      for (auto raw : blocks) {
+        free(raw);
+      }
+    }
+  }
+
+  // Move a few free blocks of a class to the cache of a thread
+  // @return false if there is no free block of the class
+  bool Take(int size_class, std::vector<void *> *out) {
+    std::lock_guard<std::mutex> lck(mux_);
+    auto &blocks = free_blocks_[size_class];
+    if (blocks.empty()) {
+      return false;
+    }
+    size_t n = std::min(blocks.size(), std::max<size_t>(1, kTransferBytes / ClassSize(size_class)));
+    out->insert(out->end(), blocks.end() - n, blocks.end());
+    blocks.resize(blocks.size() - n);
+    cached_bytes_ -= n * ClassSize(size_class);
+    return true;
+  }
+
+  // Take the last n blocks of a list of free blocks, the ones that don't fit in the central cache are freed
+  void Give(int size_class, std::vector<void *> *blocks, size_t n) {
+    std::unique_lock<std::mutex> lck(mux_);
+    auto first = blocks->end() - n;
+    auto it = first;
+    for (; it != blocks->end() && cached_bytes_ + ClassSize(size_class) <= central_cache_bytes(); ++it) {
+      free_blocks_[size_class].push_back(*it);
+      cached_bytes_ += ClassSize(size_class);
+    }
+    lck.unlock();
+    std::for_each(it, blocks->end(), [](void *raw) { free(raw); });
+    blocks->erase(first, blocks->end());
+  }
+
+  Counters *GetCounters(int32_t op_id) {
+    std::lock_guard<std::mutex> lck(mux_);
+    auto &counters = counters_[op_id];
+    if (counters == nullptr) {
+      counters = std::make_unique<Counters>();
+    }
+    return counters.get();
+  }
+
+  std::map<int32_t, Stats> GetStats() const {
+    std::lock_guard<std::mutex> lck(mux_);
+    std::map<int32_t, Stats> stats;
+    for (auto &item : counters_) {
+      Stats &s = stats[item.first];
+      s.num_alloc = item.second->num_alloc.load(std::memory_order_relaxed);
+      s.num_free = item.second->num_free.load(std::memory_order_relaxed);
+      s.num_thread_hit = item.second->num_thread_hit.load(std::memory_order_relaxed);
+      s.num_central_hit = item.second->num_central_hit.load(std::memory_order_relaxed);
+      s.num_system_alloc = item.second->num_system_alloc.load(std::memory_order_relaxed);
+      s.bytes_allocated = item.second->bytes_allocated.load(std::memory_order_relaxed);
+      s.bytes_in_use = item.second->bytes_in_use.load(std::memory_order_relaxed);
+      s.peak_bytes_in_use = item.second->peak_bytes_in_use.load(std::memory_order_relaxed);
+    }
+    return stats;
+  }
+
+  int64_t cached_bytes() const {
+    std::lock_guard<std::mutex> lck(mux_);
+    return static_cast<int64_t>(cached_bytes_);
+  }
+
+  size_t thread_cache_bytes() const { return thread_cache_bytes_.load(std::memory_order_relaxed); }
+
+  size_t central_cache_bytes() const { return central_cache_bytes_.load(std::memory_order_relaxed); }
+
+  // Only store the limits that changed, the line is read by every deallocation
+  void SetCacheLimits(size_t thread_cache_bytes, size_t central_cache_bytes) {
+    if (thread_cache_bytes_.load(std::memory_order_relaxed) != thread_cache_bytes) {
+      thread_cache_bytes_.store(thread_cache_bytes, std::memory_order_relaxed);
+    }
+    if (central_cache_bytes_.load(std::memory_order_relaxed) != central_cache_bytes) {
+      central_cache_bytes_.store(central_cache_bytes, std::memory_order_relaxed);
+    }
+  }
+
+ private:
+  std::atomic<size_t> thread_cache_bytes_;
+  std::atomic<size_t> central_cache_bytes_;
+  mutable std::mutex mux_;
+  size_t cached_bytes_;
+  std::array<std::vector<void *>, kNumClasses> free_blocks_;
+  std::map<int32_t, std::unique_ptr<Counters>> counters_;
+};
+
+// Free blocks of a pool kept by a thread
+class SizeClassPool::ThreadCache {
+ public:
+  explicit ThreadCache(std::shared_ptr<Central> central) : central_(std::move(central)), cached_bytes_(0) {}
+
+  ~ThreadCache() { Flush(); }
+
+  Status Allocate(int size_class, void **raw, Source *source) {
+    auto &blocks = free_blocks_[size_class];
+    if (blocks.empty() && central_->Take(size_class, &blocks)) {
+      cached_bytes_ += blocks.size() * ClassSize(size_class);
+      *source = Source::kCentral;
+    } else if (blocks.empty()) {
+      *source = Source::kSystem;
+      return DeMalloc(ClassSize(size_class) + kHeaderSize, raw, false);
+    } else {
+      *source = Source::kThread;
+    }
+    *raw = blocks.back();
+    blocks.pop_back();
+    cached_bytes_ -= ClassSize(size_class);
+    return Status::OK();
+  }
+
+  void Deallocate(int size_class, void *raw) {
+    free_blocks_[size_class].push_back(raw);
+    cached_bytes_ += ClassSize(size_class);
+    if (cached_bytes_ <= central_->thread_cache_bytes()) {
+      return;
+    }
+    // Give half of the blocks of the class to the other threads, and half of every class if it isn't enough
+    Release(size_class);
+    for (int c = 0; c < kNumClasses && cached_bytes_ > central_->thread_cache_bytes(); ++c) {
+      Release(c);
+    }
+  }
+
+  void Flush() {
+    for (int c = 0; c < kNumClasses; ++c) {
+      if (!free_blocks_[c].empty()) {
+        central_->Give(c, &free_blocks_[c], free_blocks_[c].size());
+      }
+    }
+    cached_bytes_ = 0;
+  }
+
+  Counters *GetCounters(int32_t op_id) {
+    auto it = counters_.find(op_id);
+    if (it == counters_.end()) {
+      it = counters_.emplace(op_id, central_->GetCounters(op_id)).first;
+    }
+    return it->second;
+  }
+
+ private:
+  void Release(int size_class) {
+    auto &blocks = free_blocks_[size_class];
+    size_t n = (blocks.size() + 1) / 2;
+    if (n > 0) {
+      central_->Give(size_class, &blocks, n);
+      cached_bytes_ -= n * ClassSize(size_class);
+    }
+  }
+
+  std::shared_ptr<Central> central_;
+  size_t cached_bytes_;
+  std::array<std::vector<void *>, kNumClasses> free_blocks_;
+  std::unordered_map<int32_t, Counters *> counters_;  // counters of the operators, cached to avoid the lock
+};
+
+namespace {
+// The caches of a thread, one per pool. A cache keeps its pool's Central alive so the key can't be reused.
+struct ThreadCaches {
+  ~ThreadCaches() { destroyed = true; }
+
+  SizeClassPool::ThreadCache *Find(SizeClassPool::Central *central) {
+    if (central != last_central) {
+      auto it = caches.find(central);
+      last_central = central;
+      last_cache = it == caches.end() ? nullptr : it->second.get();
+    }
+    return last_cache;
+  }
+
+  std::unordered_map<SizeClassPool::Central *, std::unique_ptr<SizeClassPool::ThreadCache>> caches;
+  SizeClassPool::Central *last_central = nullptr;
+  SizeClassPool::ThreadCache *last_cache = nullptr;
+  static thread_local bool destroyed;
+};
+
+thread_local bool ThreadCaches::destroyed = false;
+thread_local ThreadCaches thread_caches;
+
+// @return the cache of the calling thread for a pool, nullptr if the thread is exiting
+SizeClassPool::ThreadCache *GetThreadCache(const std::shared_ptr<SizeClassPool::Central> &central) {
+  // Tensors held by thread_local variables may be freed after the caches of the thread are destroyed
+  if (ThreadCaches::destroyed) {
+    return nullptr;
+  }
+  auto cache = thread_caches.Find(central.get());
+  if (cache == nullptr) {
+    auto new_cache = std::make_unique<SizeClassPool::ThreadCache>(central);
+    cache = new_cache.get();
+    thread_caches.caches.emplace(central.get(), std::move(new_cache));
+    thread_caches.last_cache = cache;
+  }
+  return cache;
+}
+}  // namespace
+
+SizeClassPool::SizeClassPool(size_t thread_cache_bytes, size_t central_cache_bytes)
+    : central_(std::make_shared<Central>(thread_cache_bytes, central_cache_bytes)) {}
+
+SizeClassPool::~SizeClassPool() {
+  // The cache of the calling thread is dropped now, the others when their thread exits
+  if (!ThreadCaches::destroyed) {
+    (void)thread_caches.caches.erase(central_.get());
+    thread_caches.last_central = nullptr;
+    thread_caches.last_cache = nullptr;
+  }
+}
+
+int SizeClassPool::SizeClass(size_t n) {
+  int size_class = 0;
+  while (size_class < kNumClasses && ClassSize(size_class) < n) {
+    ++size_class;
+  }
+  return size_class;
+}
+
+Status SizeClassPool::Allocate(size_t n, void **p) {
+  RETURN_UNEXPECTED_IF_NULL(p);
+  int size_class = SizeClass(n);
+  size_t block_size = size_class < kNumClasses ? ClassSize(size_class) : n;
+  void *raw = nullptr;
+  Source source = Source::kSystem;
+  ThreadCache *cache = GetThreadCache(central_);
+  if (size_class == kNumClasses) {
+    RETURN_IF_NOT_OK(DeMalloc(n + kHeaderSize, &raw, false));
+  } else if (cache != nullptr) {
+    RETURN_IF_NOT_OK(cache->Allocate(size_class, &raw, &source));
+  } else {
+    std::vector<void *> blocks;
+    if (central_->Take(size_class, &blocks)) {
+      raw = blocks.back();
+      blocks.pop_back();
+      central_->Give(size_class, &blocks, blocks.size());
+      source = Source::kCentral;
+    } else {
+      RETURN_IF_NOT_OK(DeMalloc(block_size + kHeaderSize, &raw, false));
+    }
+  }
+  auto header = reinterpret_cast<BlockHeader *>(raw);
+  header->size_class = size_class;
+  header->op_id = thread_op_id;
+  header->size = block_size;
+  Counters *counters = cache != nullptr ? cache->GetCounters(thread_op_id) : central_->GetCounters(thread_op_id);
+  counters->OnAllocate(n, block_size, source);
+  *p = GetUserAddr(raw);
+  return Status::OK();
+}
+
+Status SizeClassPool::Reallocate(void **p, size_t old_sz, size_t new_sz) {
+  RETURN_UNEXPECTED_IF_NULL(p);
+  if (*p != nullptr && new_sz <= GetHeader(*p)->size) {
+    return Status::OK();
+  }
+  void *q = nullptr;
+  RETURN_IF_NOT_OK(Allocate(new_sz, &q));
+  if (*p != nullptr) {
+    int ret_code = memcpy_s(q, new_sz, *p, std::min(old_sz, new_sz));
+    if (ret_code != 0) {
+      Deallocate(q);
+      RETURN_STATUS_UNEXPECTED("Failed to copy data into the reallocated block.");
+    }
+    Deallocate(*p);
+  }
+  *p = q;
+  return Status::OK();
+}
+
+void SizeClassPool::Deallocate(void *p) {
+  if (p == nullptr) {
+    return;
+  }
+  BlockHeader *header = GetHeader(p);
+  int size_class = header->size_class;
+  ThreadCache *cache = GetThreadCache(central_);
+  Counters *counters = cache != nullptr ? cache->GetCounters(header->op_id) : central_->GetCounters(header->op_id);
+  counters->OnDeallocate(header->size);
+  void *raw = header;
+  if (size_class == kNumClasses) {
+    free(raw);
+  } else if (cache != nullptr) {
+    cache->Deallocate(size_class, raw);
+  } else {
+    std::vector<void *> blocks{raw};
+    central_->Give(size_class, &blocks, 1);
+  }
+}
+
+uint64_t SizeClassPool::get_max_size() const { return std::numeric_limits<uint64_t>::max() - kHeaderSize; }
+
+int SizeClassPool::PercentFree() const { return 100; }
+
+std::map<int32_t, SizeClassPool::Stats> SizeClassPool::GetStats() const { return central_->GetStats(); }
+
+int64_t SizeClassPool::CentralCacheBytes() const { return central_->cached_bytes(); }
+
+void SizeClassPool::SetCacheLimits(size_t thread_cache_bytes, size_t central_cache_bytes) {
+  central_->SetCacheLimits(thread_cache_bytes, central_cache_bytes);
+}
+
+void SizeClassPool::FlushThreadCache() {
+  ThreadCache *cache = GetThreadCache(central_);
+  if (cache != nullptr) {
+    cache->Flush();
+  }
+}
+
+void SizeClassPool::SetThreadOperatorId(int32_t op_id) { thread_op_id = op_id; }
+
+int32_t SizeClassPool::ThreadOperatorId() { return thread_op_id; }
+}  // namespace dataset
+}  // namespace mindspore
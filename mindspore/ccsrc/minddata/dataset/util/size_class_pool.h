@@ -0,0 +1,115 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_SIZE_CLASS_POOL_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_SIZE_CLASS_POOL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include "minddata/dataset/util/memory_pool.h"
+
+namespace mindspore {
+namespace dataset {
+// A memory pool for the data of tensors. Requests are rounded up to a power of two size class and freed blocks are
+// kept for the next request of the same class instead of going back to the system. Each thread keeps its own cache
+// of free blocks so that most requests don't take any lock. A thread whose cache is full (typically the consumer of
+// the rows) gives half of it to a central cache, from which the threads with an empty cache (typically the
+// producers) take a few blocks at a time. Requests larger than the biggest class go straight to the system.
+//
+// The pool also counts the allocations of every operator of the pipeline. An operator is identified by the id set
+// on the thread with SetThreadOperatorId, the execution tree sets it on the threads it launches for an operator.
+class SizeClassPool : public MemoryPool {
+ public:
+  static constexpr int kNumClasses = 20;             // 64 bytes to 32MB
+  static constexpr size_t kMinClassSize = 64;        // size of the smallest class
+  static constexpr int32_t kNoOperator = -1;         // operator id of the threads not launched for an operator
+  static constexpr size_t kTransferBytes = 1 << 20;  // bytes moved from the central cache to a thread at once
+
+  // Allocation counters of an operator
+  struct Stats {
+    int64_t num_alloc = 0;          // number of allocations
+    int64_t num_free = 0;           // number of deallocations
+    int64_t num_thread_hit = 0;     // allocations served by the cache of the thread
+    int64_t num_central_hit = 0;    // allocations served by the central cache
+    int64_t num_system_alloc = 0;   // allocations that went to the system
+    int64_t bytes_allocated = 0;    // total bytes requested
+    int64_t bytes_in_use = 0;       // bytes of the blocks currently allocated, rounded up to the class size
+    int64_t peak_bytes_in_use = 0;  // highest value of bytes_in_use
+  };
+
+  // Constructor
+  // @param thread_cache_bytes - bytes of free blocks a thread keeps before giving some to the central cache
+  // @param central_cache_bytes - bytes of free blocks kept by the central cache before freeing them to the system
+  explicit SizeClassPool(size_t thread_cache_bytes = 32 * 1024 * 1024, size_t central_cache_bytes = 512 * 1024 * 1024);
+
+  SizeClassPool(const SizeClassPool &) = delete;
+
+  SizeClassPool &operator=(const SizeClassPool &) = delete;
+
+  // Destructor. The blocks cached by threads still running are freed when those threads exit.
+  ~SizeClassPool() override;
+
+  Status Allocate(size_t n, void **p) override;
+
+  Status Reallocate(void **p, size_t old_sz, size_t new_sz) override;
+
+  void Deallocate(void *p) override;
+
+  uint64_t get_max_size() const override;
+
+  int PercentFree() const override;
+
+  // @return the allocation counters of every operator that used the pool
+  std::map<int32_t, Stats> GetStats() const;
+
+  // @return the bytes of free blocks kept by the central cache
+  int64_t CentralCacheBytes() const;
+
+  // Change the limits of the caches. The blocks already cached above the new limits are kept until they are reused.
+  // @param thread_cache_bytes - bytes of free blocks a thread keeps before giving some to the central cache
+  // @param central_cache_bytes - bytes of free blocks kept by the central cache before freeing them to the system
+  void SetCacheLimits(size_t thread_cache_bytes, size_t central_cache_bytes);
+
+  // Give the blocks cached by the calling thread back to the central cache
+  void FlushThreadCache();
+
+  // Set the operator the allocations of the calling thread are counted for
+  // @param op_id - id of the operator, kNoOperator if none
+  static void SetThreadOperatorId(int32_t op_id);
+
+  // @return the operator the allocations of the calling thread are counted for
+  static int32_t ThreadOperatorId();
+
+  // @param n - size of a request
+  // @return the size class serving the request, kNumClasses if the request is too large for any class
+  static int SizeClass(size_t n);
+
+  // @param size_class - a size class
+  // @return the size of the blocks of the class
+  static size_t ClassSize(int size_class) { return kMinClassSize << size_class; }
+
+  // Implementation classes, only defined in the source file
+  class Central;
+  class ThreadCache;
+
+ private:
+  std::shared_ptr<Central> central_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_SIZE_CLASS_POOL_H_
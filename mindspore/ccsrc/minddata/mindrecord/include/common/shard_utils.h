@@ -66,7 +66,11 @@ const int kUnsignedInt4 = 4;
 enum LabelCategory { kSchemaLabel, kStatisticsLabel, kIndexLabel };
 
 const char kVersion[] = "3.0";
-const std::vector<std::string> kSupportedVersion = {"2.0", kVersion};
+// version of the files whose fixed width label columns are stored in label pages
+const char kLabelPageVersion[] = "3.1";
+// version of the files whose blob pages are compressed
+const char kCompressedPageVersion[] = "3.2";
+const std::vector<std::string> kSupportedVersion = {"2.0", kVersion, kLabelPageVersion, kCompressedPageVersion};
 
 enum ShardType {
   kNLP = 0,
@@ -0,0 +1,153 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_BINARY_INDEX_H_
+#define MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_BINARY_INDEX_H_
+
+#include <array>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include "minddata/mindrecord/include/common/shard_utils.h"
+#include "minddata/mindrecord/include/shard_header.h"
+
+namespace mindspore {
+namespace mindrecord {
+// suffix of the binary index file of a shard, it is next to the sqlite index file
+const char kBinaryIndexSuffix[] = ".idx";
+
+// magic number at the start of the binary index file, the last byte is the version of the layout
+const char kBinaryIndexMagic[] = "MRINDEX\x02";
+
+// columns of one row of the binary index, the same as the fixed columns of the INDEXES table of the sqlite index
+enum IndexRowColumn : int {
+  kIndexRowId = 0,
+  kIndexPageIdRaw,
+  kIndexPageOffsetRaw,
+  kIndexPageOffsetRawEnd,
+  kIndexRowGroupId,
+  kIndexPageIdBlob,
+  kIndexPageOffsetBlob,
+  kIndexPageOffsetBlobEnd,
+  kIndexRowColumnCount
+};
+
+// type of the keys of an index field
+enum IndexKeyType : uint64_t { kIndexKeyInt64 = 0, kIndexKeyDouble, kIndexKeyString };
+
+using INDEX_ROW = std::array<uint64_t, kIndexRowColumnCount>;
+
+/// \brief binary index of one shard, a replacement of the sqlite index for the lookups of the reader.
+///
+/// The file holds, after a header and the field descriptors, the rows of the shard ordered by row id and then
+/// for each index field its typed value of every row, the rows ordered by (value, row) and the bytes of the string
+/// values. Every block is 8 bytes aligned, so the file is used in place once it is mapped into memory.
+/// The header records the name and the size of the shard file and its page and row counts in the shard header,
+/// an index which does not match all of them is stale and is not loaded.
+class ShardBinaryIndex {
+ public:
+  ShardBinaryIndex() = default;
+
+  ~ShardBinaryIndex();
+
+  ShardBinaryIndex(const ShardBinaryIndex &) = delete;
+
+  ShardBinaryIndex &operator=(const ShardBinaryIndex &) = delete;
+
+  /// \brief get the page count and the row count of a shard in the header, the binary index is checked against them
+  /// \param[in] header header of the shard files
+  /// \param[in] shard_id id of the shard
+  /// \return pair of the page count and the row count
+  static std::pair<uint64_t, uint64_t> CountPagesAndRows(ShardHeader *header, int shard_id);
+
+  /// \brief write the binary index of a shard
+  /// \param[in] shard_path path of the shard file, the index is written to shard_path + kBinaryIndexSuffix
+  /// \param[in] page_count page count of the shard in the header
+  /// \param[in] fields name and key type of the index fields
+  /// \param[in] rows rows of the shard, ordered by row id
+  /// \param[in] values text of the index field values of each row, in the order of fields
+  /// \return MSRStatus the status of MSRStatus
+  static MSRStatus Write(const std::string &shard_path, uint64_t page_count,
+                         const std::vector<std::pair<std::string, IndexKeyType>> &fields,
+                         const std::vector<INDEX_ROW> &rows, const std::vector<std::vector<std::string>> &values);
+
+  /// \brief map the binary index of a shard, it fails when the index is missing or does not match the shard
+  /// \param[in] shard_path path of the shard file
+  /// \param[in] page_count expected page count of the shard, from the header
+  /// \param[in] row_count expected row count of the shard, from the header
+  /// \param[in] field_names expected names of the index fields
+  /// \return MSRStatus the status of MSRStatus
+  MSRStatus Load(const std::string &shard_path, uint64_t page_count, uint64_t row_count,
+                 const std::vector<std::string> &field_names);
+
+  /// \brief get the number of rows
+  uint64_t GetRowCount() const { return row_count_; }
+
+  /// \brief get a row of the index, the columns are indexed by IndexRowColumn
+  const uint64_t *GetRow(uint64_t row) const { return rows_ + row * kIndexRowColumnCount; }
+
+  /// \brief get the names of the index fields
+  const std::vector<std::string> &GetFieldNames() const { return field_names_; }
+
+  /// \brief get the position of an index field, -1 if there is no such field
+  int GetFieldId(const std::string &field_name) const;
+
+  /// \brief get the value of an index field of a row as a number or a string
+  json GetValue(int field_id, uint64_t row) const;
+
+  /// \brief get the value of an index field of a row as the sqlite index prints it
+  std::string GetValueString(int field_id, uint64_t row) const;
+
+  /// \brief get the rows stored in a blob page, ordered by row id
+  /// \param[in] page_id id of the blob page
+  /// \param[in] field_id index field of the criteria, -1 for all the rows of the page
+  /// \param[in] value value of the criteria
+  /// \param[out] rows the rows
+  void GetRowsOfPage(uint64_t page_id, int field_id, const std::string &value, std::vector<uint64_t> *rows) const;
+
+  /// \brief count the rows of each distinct value of an index field
+  void CountValues(int field_id, std::map<std::string, int> *counter) const;
+
+ private:
+  struct Field {
+    IndexKeyType type;
+    const uint64_t *values;   // value of every row, strings are (offset << 32 | length) in the pool
+    const uint32_t *order;    // rows ordered by (value, row)
+    const char *pool;         // bytes of the string values
+  };
+
+  /// \brief compare the value of a row with a criteria, <0, 0 or >0
+  int Compare(const Field &field, uint64_t row, const std::string &value, int64_t int_value,
+              double double_value) const;
+
+  void Unmap();
+
+  std::vector<std::string> field_names_;
+  std::vector<Field> fields_;
+  const uint64_t *rows_ = nullptr;
+  uint64_t row_count_ = 0;
+  std::map<uint64_t, std::pair<uint64_t, uint64_t>> page_rows_;  // blob page id to the range of its rows
+  const uint8_t *data_ = nullptr;
+  uint64_t data_size_ = 0;
+#if defined(_WIN32) || defined(_WIN64)
+  std::vector<uint8_t> buffer_;  // there is no mmap, the file is read into memory
+#endif
+};
+}  // namespace mindrecord
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_BINARY_INDEX_H_
@@ -17,6 +17,7 @@
 #ifndef MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_COLUMN_H_
 #define MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_COLUMN_H_
 
+#include <fstream>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -71,6 +72,14 @@ class ShardColumn {
                                  ColumnDataType *column_data_type, uint64_t *column_data_type_size,
                                  std::vector<int64_t> *column_shape);
 
+  /// \brief get column value by column name, the label columns are taken from the packed label columns of the row
+  ///        when they are given
+  MSRStatus GetColumnValueByName(const std::string &column_name, const std::vector<uint8_t> &columns_blob,
+                                 const json &columns_json, const std::vector<uint8_t> &columns_label,
+                                 const unsigned char **data, std::unique_ptr<unsigned char[]> *data_ptr,
+                                 uint64_t *const n_bytes, ColumnDataType *column_data_type,
+                                 uint64_t *column_data_type_size, std::vector<int64_t> *column_shape);
+
   /// \brief compress blob
   std::vector<uint8_t> CompressBlob(const std::vector<uint8_t> &blob, int64_t *compression_size);
 
@@ -104,10 +113,70 @@ class ShardColumn {
   MSRStatus GetColumnFromJson(const std::string &column_name, const json &columns_json,
                               std::unique_ptr<unsigned char[]> *data_ptr, uint64_t *n_bytes);
 
+  /// \brief check if the file keeps label columns, the fixed width scalar columns it stores in label pages instead
+  ///        of in the msgpack of the raw pages
+  bool HasLabelColumn() const { return !label_column_.empty(); }
+
+  /// \brief check if the column is a label column
+  bool IsLabelColumn(const std::string &column_name) const { return label_column_id_.count(column_name) > 0; }
+
+  /// \brief getter
+  std::vector<std::string> GetLabelColumn() const { return label_column_; }
+
+  /// \brief getter, the size of the label columns of a row, also the size of the packed label columns of a row
+  uint64_t GetLabelRowSize() const { return label_row_size_; }
+
+  /// \brief getter
+  std::vector<uint64_t> GetLabelColumnSize() const { return label_column_size_; }
+
+  /// \brief get the number of rows of a label page. A label page keeps each label column in a typed block, the
+  ///        column i starts at the number of rows times the size of the label columns before i.
+  /// \param[in] page_size the size of the pages of the file
+  /// \return number of rows
+  uint64_t GetLabelPageRows(const uint64_t &page_size) const;
+
+  /// \brief get the offset of a label column in a label page
+  uint64_t GetLabelPageOffset(const uint64_t &label_id, const uint64_t &page_size) const;
+
+  /// \brief move the label columns of a raw row into typed blocks
+  /// \param[in] columns_json the raw columns of the row
+  /// \param[in] row the row in the blocks
+  /// \param[out] label_data the typed block of each label column
+  /// \param[out] rest_json the raw columns that are not label columns
+  MSRStatus SplitLabel(const json &columns_json, const uint64_t &row, std::vector<std::vector<uint8_t>> *label_data,
+                       json *rest_json);
+
+  /// \brief read the label columns of all the rows of a shard from its label pages
+  /// \param[in] shard_header the header of the file
+  /// \param[in] shard_id the shard
+  /// \param[in] in the stream of the shard
+  /// \param[out] label_data the typed block of each label column, indexed by the row id of the shard
+  MSRStatus ReadLabelPages(ShardHeader *shard_header, const int &shard_id, std::fstream *in,
+                           std::vector<std::vector<uint8_t>> *label_data);
+
+  /// \brief pack the label columns of a row, in the order of GetLabelColumn
+  MSRStatus GetLabelRow(const std::vector<std::vector<uint8_t>> &label_data, const uint64_t &row,
+                        std::vector<uint8_t> *columns_label);
+
+  /// \brief add the label columns of a row to its json
+  /// \param[in] label_data the typed block of each label column
+  /// \param[in] row the row in the blocks
+  /// \param[in] columns the columns to add, all of them when empty
+  /// \param[out] columns_json the json of the row
+  MSRStatus LabelToJson(const std::vector<std::vector<uint8_t>> &label_data, const uint64_t &row,
+                        const std::vector<std::string> &columns, json *columns_json);
+
+  /// \brief get column value from the packed label columns of a row
+  MSRStatus GetColumnFromLabel(const std::string &column_name, const std::vector<uint8_t> &columns_label,
+                               const unsigned char **data, uint64_t *n_bytes);
+
  private:
   /// \brief intialization
   void Init(const json &schema_json, bool compress_integer = true);
 
+  /// \brief intialization of the label columns
+  void InitLabel(const std::vector<std::string> &label_column);
+
   /// \brief get float value from json
   template <typename T>
   MSRStatus GetFloat(std::unique_ptr<unsigned char[]> *data_ptr, const json &json_column_value, bool use_double);
@@ -169,6 +238,13 @@ class ShardColumn {
   std::unordered_map<std::string, uint64_t> blob_column_id_;  // blob column name id map
   bool has_compress_blob_;                                    // if has compress blob
   uint64_t num_blob_column_;                                  // number of blob columns
+
+  std::vector<std::string> label_column_;                      // label column list
+  std::vector<ColumnDataType> label_column_type_;              // label column data type list
+  std::vector<uint64_t> label_column_size_;                    // label column size list
+  std::vector<uint64_t> label_column_offset_;                  // label column offset in a packed row
+  std::unordered_map<std::string, uint64_t> label_column_id_;  // label column name id map
+  uint64_t label_row_size_ = 0;                                // size of the label columns of a row
 };
 }  // namespace mindrecord
 }  // namespace mindspore
@@ -0,0 +1,179 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_COMPRESSION_H_
+#define MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_COMPRESSION_H_
+
+#include <deque>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "minddata/mindrecord/include/common/shard_utils.h"
+#include "minddata/mindrecord/include/shard_file.h"
+#include "minddata/mindrecord/include/shard_page.h"
+
+namespace mindspore {
+namespace mindrecord {
+// compression of the blob pages
+const char kPageCompressionNone[] = "none";
+const char kPageCompressionZlib[] = "zlib";
+const int kDefaultPageCompressionLevel = 1;
+
+// a chunk holds whole blobs, at least this many bytes of them unless it is the last of the page
+const uint64_t kPageChunkSize = 1 << 18;  // 256KB
+
+// number of pages whose chunk table is kept by a reader
+const int kChunkTableCacheSize = 1024;
+
+/// \brief codec of the compressed blob pages. A compressed page is stored in the file as
+///        [chunk count][uncompressed end, stored end of each chunk][stored chunks], the ends being offsets in the
+///        page and in the stored page. A chunk which does not get smaller is stored as it is, its two sizes are equal
+///        then. The stored page takes only its own size, the pages of the file being packed one after another.
+class ShardCompression {
+ public:
+  /// \brief whether the compression is known, kPageCompressionNone and empty are
+  static bool IsValid(const std::string &compression);
+
+  /// \brief compress the blobs of a page chunk by chunk
+  /// \param[in] compression the compression of the page
+  /// \param[in] level the compression level, from 1 (fastest) to 9 (smallest)
+  /// \param[in] page the [size][blob] rows of the page
+  /// \param[in] blob_ends offset of the end of each row in the page
+  /// \param[out] stored the bytes of the stored page
+  /// \return MSRStatus the status of MSRStatus
+  static MSRStatus CompressPage(const std::string &compression, const int &level, const std::vector<uint8_t> &page,
+                                const std::vector<uint64_t> &blob_ends, std::vector<uint8_t> *stored);
+
+  /// \brief decompress a whole page
+  /// \param[in] compression the compression of the page
+  /// \param[in] stored the bytes of the stored page
+  /// \param[in] page_bytes the size of the uncompressed page
+  /// \param[out] page the [size][blob] rows of the page
+  /// \return MSRStatus the status of MSRStatus
+  static MSRStatus DecompressPage(const std::string &compression, const std::vector<uint8_t> &stored,
+                                  const uint64_t &page_bytes, std::vector<uint8_t> *page);
+
+  /// \brief decompress one chunk into a buffer of its uncompressed size
+  static MSRStatus Decompress(const std::string &compression, const unsigned char *src, const uint64_t &src_bytes,
+                              unsigned char *dst, const uint64_t &dst_bytes);
+
+  /// \brief parse the chunk table at the head of a stored page
+  static MSRStatus ParseChunkTable(const unsigned char *data, const uint64_t &n_bytes,
+                                   std::vector<std::pair<uint64_t, uint64_t>> *table);
+};
+
+/// \brief cache whose entries are loaded once, the threads asking for an entry being loaded wait for it instead of
+///        loading it again. The oldest entry is dropped when it is full.
+template <typename K, typename V>
+class ShardLoadCache {
+ public:
+  explicit ShardLoadCache(size_t capacity) : capacity_(capacity > 0 ? capacity : 1) {}
+
+  /// \brief get the entry of a key, loading it by the loader when missing. A failed load returns null and is not
+  ///        kept.
+  template <typename L>
+  std::shared_ptr<V> Get(const K &key, L loader) {
+    std::promise<std::shared_ptr<V>> promise;
+    std::shared_future<std::shared_ptr<V>> future;
+    uint64_t load_id = 0;
+    {
+      std::lock_guard<std::mutex> lock(mtx_);
+      auto it = entries_.find(key);
+      if (it != entries_.end()) {
+        future = it->second.second;
+      } else {
+        load_id = ++last_load_id_;
+        future = promise.get_future().share();
+        entries_[key] = std::make_pair(load_id, future);
+        order_.push_back(key);
+        if (order_.size() > capacity_) {
+          (void)entries_.erase(order_.front());
+          order_.pop_front();
+        }
+      }
+    }
+    if (load_id == 0) {
+      return future.get();
+    }
+
+    std::shared_ptr<V> value = loader();
+    promise.set_value(value);
+    if (value == nullptr) {
+      std::lock_guard<std::mutex> lock(mtx_);
+      auto it = entries_.find(key);
+      if (it != entries_.end() && it->second.first == load_id) {
+        (void)entries_.erase(it);
+      }
+    }
+    return value;
+  }
+
+ private:
+  size_t capacity_;
+  std::mutex mtx_;
+  uint64_t last_load_id_ = 0;
+  std::map<K, std::pair<uint64_t, std::shared_future<std::shared_ptr<V>>>> entries_;
+  std::deque<K> order_;  // keys in the order they were loaded, an erased key may stay until it is the oldest
+};
+
+/// \brief reads blobs out of the compressed pages of the shards. It is shared by the threads reading the shards, which
+///        decompress different chunks at once, and keeps the chunks decompressed lately for the rows next to each
+///        other.
+class ShardPageReader {
+ public:
+  /// \brief constructor
+  /// \param[in] compression the compression of the pages
+  /// \param[in] header_size the size of the header of the shards
+  /// \param[in] page_size the size of the pages of the shards
+  /// \param[in] cache_size the number of decompressed chunks kept
+  ShardPageReader(const std::string &compression, const uint64_t &header_size, const uint64_t &page_size,
+                  const int &cache_size);
+
+  ~ShardPageReader() = default;
+
+  /// \brief read a range of a blob page, as if it was not compressed
+  /// \param[in] shard_file the file of the shard
+  /// \param[in] shard_id the id of the shard
+  /// \param[in] page the blob page
+  /// \param[in] begin offset of the range in the uncompressed page
+  /// \param[in] end offset of the end of the range in the uncompressed page
+  /// \param[out] data buffer of end - begin bytes the range is read into
+  /// \return MSRStatus the status of MSRStatus
+  MSRStatus Read(const std::shared_ptr<ShardFile> &shard_file, const int &shard_id, const std::shared_ptr<Page> &page,
+                 const uint64_t &begin, const uint64_t &end, unsigned char *data);
+
+ private:
+  using ChunkTable = std::vector<std::pair<uint64_t, uint64_t>>;
+
+  /// \brief get the chunk table of a page, read from the file the first time
+  std::shared_ptr<ChunkTable> GetChunkTable(const std::shared_ptr<ShardFile> &shard_file, const int &shard_id,
+                                            const std::shared_ptr<Page> &page);
+
+  std::string compression_;
+  uint64_t header_size_;
+  uint64_t page_size_;
+  ShardLoadCache<std::pair<int, int>, ChunkTable> tables_;                    // by shard id, page id
+  ShardLoadCache<std::tuple<int, int, size_t>, std::vector<uint8_t>> chunks_;  // by shard id, page id, chunk id
+};
+}  // namespace mindrecord
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_COMPRESSION_H_
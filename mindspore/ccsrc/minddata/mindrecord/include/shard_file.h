@@ -0,0 +1,71 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_FILE_H_
+#define MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_FILE_H_
+
+#include <fstream>
+#include <mutex>
+#include <string>
+#include "minddata/mindrecord/include/common/shard_utils.h"
+
+namespace mindspore {
+namespace mindrecord {
+/// \brief read only handle of a shard file, shared by all the threads reading the shard. The reads are positional,
+/// the threads do not share a file position, so that they neither seek nor lock.
+class ShardFile {
+ public:
+  ShardFile() = default;
+
+  ~ShardFile();
+
+  ShardFile(const ShardFile &) = delete;
+
+  ShardFile &operator=(const ShardFile &) = delete;
+
+  /// \brief open the shard file
+  /// \param[in] file_path path of the file
+  /// \return MSRStatus the status of MSRStatus
+  MSRStatus Open(const std::string &file_path);
+
+  /// \brief close the shard file
+  void Close();
+
+  /// \brief read a range of the file, may be called by many threads at once
+  /// \param[in] offset offset of the range in the file
+  /// \param[in] n_bytes size of the range
+  /// \param[out] data buffer of n_bytes bytes the range is read into
+  /// \return MSRStatus the status of MSRStatus
+  MSRStatus Read(const uint64_t &offset, const uint64_t &n_bytes, unsigned char *data);
+
+  /// \brief ask the system to bring a range of the file into the page cache, it does not wait for the read
+  /// \param[in] offset offset of the range in the file
+  /// \param[in] n_bytes size of the range
+  void ReadAhead(const uint64_t &offset, const uint64_t &n_bytes);
+
+ private:
+  std::string file_path_;
+#if defined(_WIN32) || defined(_WIN64)
+  std::fstream fs_;  // there is no positional read, the reads take turns on one stream
+  std::mutex mtx_;
+#else
+  int fd_ = -1;
+#endif
+};
+}  // namespace mindrecord
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_FILE_H_
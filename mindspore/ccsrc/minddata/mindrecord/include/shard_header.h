@@ -105,6 +105,13 @@ class ShardHeader {
 
   int64_t GetLastPageId(const int &shard_id);
 
+  /// \brief get the offset of a page in the file of its shard
+  uint64_t GetPageOffset(const int &shard_id, const int &page_id);
+
+  /// \brief get the offset in the file of the page added next to a shard. The pages of a file with compressed pages
+  ///        are packed, a compressed page taking only its compressed size.
+  uint64_t GetNextPageOffset(const int &shard_id);
+
   int GetLastPageIdByType(const int &shard_id, const std::string &page_type);
 
   const std::pair<MSRStatus, std::shared_ptr<Page>> GetPageByGroupId(const int &group_id, const int &shard_id);
@@ -127,6 +134,17 @@ class ShardHeader {
 
   void SetCompressionSize(const uint64_t &compression_size) { compression_size_ = compression_size; }
 
+  /// \brief get the fixed width label columns stored in label pages, empty when all the raw columns are in the raw
+  ///        pages
+  std::vector<std::string> GetLabelColumns() const { return label_columns_; }
+
+  void SetLabelColumns(const std::vector<std::string> &label_columns) { label_columns_ = label_columns; }
+
+  /// \brief get the compression of the blob pages, empty when they are not compressed
+  std::string GetPageCompression() const { return page_compression_; }
+
+  void SetPageCompression(const std::string &page_compression) { page_compression_ = page_compression; }
+
   std::vector<std::string> SerializeHeader();
 
   MSRStatus PagesToFile(const std::string dump_file_name);
@@ -187,6 +205,8 @@ class ShardHeader {
   uint64_t header_size_;
   uint64_t page_size_;
   uint64_t compression_size_;
+  std::vector<std::string> label_columns_;
+  std::string page_compression_;
 
   std::shared_ptr<Index> index_;
   std::vector<std::string> shard_addresses_;
@@ -25,6 +25,9 @@
 #include <tuple>
 #include <utility>
 #include <vector>
+#include "minddata/mindrecord/include/shard_binary_index.h"
+#include "minddata/mindrecord/include/shard_column.h"
+#include "minddata/mindrecord/include/shard_compression.h"
 #include "minddata/mindrecord/include/shard_header.h"
 #include "./sqlite3.h"
 
@@ -79,9 +82,10 @@ class ShardIndexGenerator {
   /// \param blob_id_to_page_id
   /// \param raw_page_id
   /// \param in
+  /// \param label_data typed blocks of the label columns of the shard, empty when the file has no label pages
   /// \return field name, db type, field value
   ROW_DATA GenerateRowData(int shard_no, const std::map<int, int> &blob_id_to_page_id, int raw_page_id,
-                           std::fstream &in);
+                           std::fstream &in, const std::vector<std::vector<uint8_t>> &label_data);
   ///
   /// \param db
   /// \param sql
@@ -98,18 +102,37 @@ class ShardIndexGenerator {
 
   MSRStatus CreateShardNameTable(sqlite3 *db, const std::string &shard_name);
 
+  /// \brief add the blob offsets of a row, the blob sizes are read from the decompressed page when it is given
   MSRStatus AddBlobPageInfo(std::vector<std::tuple<std::string, std::string, std::string>> &row_data,
                             const std::shared_ptr<Page> cur_blob_page, uint64_t &cur_blob_page_offset,
-                            std::fstream &in);
+                            std::fstream &in, const std::vector<uint8_t> *blob_page_data = nullptr);
+
+  /// \brief read and decompress a compressed blob page
+  MSRStatus ReadCompressedBlobPage(const std::shared_ptr<Page> &blob_page, std::fstream &in,
+                                   std::vector<uint8_t> *blob_page_data);
 
   void AddIndexFieldByRawData(const std::vector<json> &schema_detail,
                               std::vector<std::tuple<std::string, std::string, std::string>> &row_data);
 
+  /// \brief get the name and key type of the index fields for the binary index
+  std::pair<MSRStatus, std::vector<std::pair<std::string, IndexKeyType>>> GetBinaryIndexFields();
+
+  /// \brief add the rows bound to the sqlite statement to the rows of the binary index
+  void AddBinaryIndexRows(const std::vector<std::pair<std::string, IndexKeyType>> &fields,
+                          const std::vector<std::vector<std::tuple<std::string, std::string, std::string>>> &data,
+                          std::vector<INDEX_ROW> *rows, std::vector<std::vector<std::string>> *values);
+
+  /// \brief write the binary index of a shard, the sqlite index stays the reference when it fails
+  void WriteBinaryIndex(int shard_no, const std::string &shard_address,
+                        const std::vector<std::pair<std::string, IndexKeyType>> &fields, std::vector<INDEX_ROW> *rows,
+                        std::vector<std::vector<std::string>> *values);
+
   void DatabaseWriter();  // worker thread
 
   std::string file_path_;
   bool append_;
   ShardHeader shard_header_;
+  std::shared_ptr<ShardColumn> shard_column_;
   uint64_t page_size_;
   uint64_t header_size_;
   int schema_count_;
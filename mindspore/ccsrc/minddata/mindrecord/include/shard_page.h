@@ -32,6 +32,7 @@ namespace mindrecord {
 const std::string kPageTypeRaw = "RAW_DATA";
 const std::string kPageTypeBlob = "BLOB_DATA";
 const std::string kPageTypeNewColumn = "NEW_COLUMN_DATA";
+const std::string kPageTypeLabel = "LABEL_DATA";
 
 class Page {
  public:
@@ -71,6 +72,21 @@ class Page {
 
   void SetPageSize(const uint64_t &page_size) { page_size_ = page_size; }
 
+  /// \brief get the size of the compressed page in the file, 0 when the page is not compressed
+  uint64_t GetCompressedSize() const { return compressed_size_; }
+
+  void SetCompressedSize(const uint64_t &compressed_size) { compressed_size_ = compressed_size; }
+
+  /// \brief get the offset of the page in its file. The files with compressed pages pack the pages one after another
+  ///        and record their offsets, the other files keep each page in the slot of its page id.
+  /// \param[in] header_size the size of the header of the file
+  /// \param[in] page_size the size of the pages of the file
+  uint64_t GetPageOffset(const uint64_t &header_size, const uint64_t &page_size) const {
+    return page_offset_ > 0 ? page_offset_ : header_size + page_size * page_id_;
+  }
+
+  void SetPageOffset(const uint64_t &page_offset) { page_offset_ = page_offset; }
+
   std::pair<int, uint64_t> GetLastRowGroupID() const { return row_group_ids_.back(); }
 
   std::vector<std::pair<int, uint64_t>> GetRowGroupIds() const { return row_group_ids_; }
@@ -90,15 +106,19 @@ class Page {
   uint64_t end_row_id_;
   std::vector<std::pair<int, uint64_t>> row_group_ids_;
   uint64_t page_size_;
+  uint64_t compressed_size_ = 0;
+  uint64_t page_offset_ = 0;  // 0 when the page is in the slot of its page id
   // JSON page: {
   //            "page_id":X,
   //            "shard_id":X,
-  //            "page_type":"XXX", (enum "raw_data", "blob_data", "new_column")
+  //            "page_type":"XXX", (enum "raw_data", "blob_data", "new_column", "label_data")
   //            "page_type_id":X,
   //            "start_row_id":X,
   //            "end_row_id":X,
   //            "row_group_ids":[{"id":X, "offset":X}],
   //            "page_size":X,
+  //            "compressed_size":X, (only the compressed pages)
+  //            "page_offset":X, (only the files with compressed pages)
 };
 }  // namespace mindrecord
 }  // namespace mindspore
@@ -43,10 +43,13 @@
 #include <utility>
 #include <vector>
 #include "minddata/mindrecord/include/common/shard_utils.h"
+#include "minddata/mindrecord/include/shard_binary_index.h"
 #include "minddata/mindrecord/include/shard_category.h"
 #include "minddata/mindrecord/include/shard_column.h"
+#include "minddata/mindrecord/include/shard_compression.h"
 #include "minddata/mindrecord/include/shard_distributed_sample.h"
 #include "minddata/mindrecord/include/shard_error.h"
+#include "minddata/mindrecord/include/shard_file.h"
 #include "minddata/mindrecord/include/shard_index_generator.h"
 #include "minddata/mindrecord/include/shard_operator.h"
 #include "minddata/mindrecord/include/shard_pk_sample.h"
@@ -102,9 +105,14 @@ class ShardReader {
   MSRStatus Open();
 
   /// \brief read the file, get schema meta,statistics and index, multiple-thread mode
+  /// \param[in] n_consumer number of consumer threads, they share one handle of each shard
   /// \return MSRStatus the status of MSRStatus
   MSRStatus Open(int n_consumer);
 
+  /// \brief set the number of tasks ahead of the consumers whose blobs are read ahead
+  /// \param[in] read_ahead number of tasks, 0 turns the read ahead off
+  void SetReadAhead(const int64_t &read_ahead);
+
   /// \brief launch threads to get batches
   /// \param[in] is_simple_reader trigger threads if false; do nothing if true
   /// \return MSRStatus the status of MSRStatus
@@ -183,6 +191,12 @@ class ShardReader {
   std::pair<TaskType, std::vector<std::tuple<std::vector<uint8_t>, json>>> GetNextById(const int64_t &task_id,
                                                                                        const int32_t &consumer_id);
 
+  /// \brief return a row by id, the label columns of files with label pages are packed apart from the json
+  /// \param[out] columns_label the packed label columns of the row, empty when they are in the json
+  /// \return a batch of images and image data
+  std::pair<TaskType, std::vector<std::tuple<std::vector<uint8_t>, json>>> GetNextById(
+    const int64_t &task_id, const int32_t &consumer_id, std::vector<uint8_t> *columns_label);
+
   /// \brief return a batch, given that one is ready, python API
   /// \return a batch of images and image data
   std::vector<std::tuple<std::vector<std::vector<uint8_t>>, pybind11::object>> GetNextPy();
@@ -219,13 +233,30 @@ class ShardReader {
   ROW_GROUPS ReadAllRowGroup(std::vector<std::string> &columns);
 
   /// \brief read all rows in one shard
-  MSRStatus ReadAllRowsInShard(int shard_id, const std::string &sql, const std::vector<std::string> &columns,
+  MSRStatus ReadAllRowsInShard(int shard_id, const std::string &sql, bool read_raw,
+                               const std::vector<std::string> &columns,
                                std::vector<std::vector<std::vector<uint64_t>>> &offsets,
                                std::vector<std::vector<json>> &column_values);
 
+  /// \brief read all rows in one shard from its binary index
+  MSRStatus ReadAllRowsInBinaryIndex(int shard_id, bool read_raw, const std::vector<std::string> &columns,
+                                     std::vector<std::vector<std::vector<uint64_t>>> &offsets,
+                                     std::vector<std::vector<json>> &column_values);
+
+  /// \brief read the label json of a row from the raw page, keeping the given columns only
+  MSRStatus ReadLabelFromRawPage(std::shared_ptr<std::fstream> fs, int shard_id, uint64_t raw_page_id,
+                                 uint64_t label_start, uint64_t label_end, const std::vector<std::string> &columns,
+                                 json *label);
+
   /// \brief initialize reader
   MSRStatus Init(const std::vector<std::string> &file_paths, bool load_dataset);
 
+  /// \brief open the index of each shard, the binary index if there is a valid one, the sqlite index otherwise
+  MSRStatus OpenIndexes();
+
+  /// \brief read the label columns of all the shards from their label pages
+  MSRStatus ReadLabelPages();
+
   /// \brief validate column list
   MSRStatus CheckColumnList(const std::vector<std::string> &selected_columns);
 
@@ -236,6 +267,10 @@ class ShardReader {
   std::vector<std::vector<uint64_t>> GetImageOffset(int group_id, int shard_id,
                                                     const std::pair<std::string, std::string> &criteria = {"", ""});
 
+  /// \brief get the rows of a blob page from the binary index of a shard, following an index field criteria
+  MSRStatus GetRowsOfPage(int page_id, int shard_id, const std::pair<std::string, std::string> &criteria,
+                          std::vector<uint64_t> *rows);
+
   /// \brief execute sqlite query with prepare statement
   MSRStatus QueryWithCriteria(sqlite3 *db, string &sql, string criteria, std::vector<std::vector<std::string>> &labels);
 
@@ -267,16 +302,23 @@ class ShardReader {
   /// \brief open multiple file handle
   void FileStreamsOperator();
 
-  /// \brief read one row by one task
-  TASK_RETURN_CONTENT ConsumerOneTask(int task_id, uint32_t consumer_id);
+  /// \brief read ahead the blobs of the tasks following task_id, up to read_ahead_ tasks ahead
+  void ReadAheadTasks(int task_id);
+
+  /// \brief read one row by one task, the label columns are added to the json unless columns_label is given
+  TASK_RETURN_CONTENT ConsumerOneTask(int task_id, uint32_t consumer_id,
+                                      std::vector<uint8_t> *columns_label = nullptr);
 
   /// \brief get labels from binary file
   std::pair<MSRStatus, std::vector<json>> GetLabelsFromBinaryFile(
-    int shard_id, const std::vector<std::string> &columns, const std::vector<std::vector<std::string>> &label_offsets);
+    int shard_id, const std::vector<std::string> &columns, const std::vector<std::vector<uint64_t>> &label_offsets);
 
   /// \brief get classes in one shard
   void GetClassesInShard(sqlite3 *db, int shard_id, const std::string sql, std::set<std::string> &categories);
 
+  /// \brief get classes in one shard from its binary index
+  void GetClassesInBinaryIndex(int shard_id, const std::string &field_name, std::set<std::string> &categories);
+
   /// \brief get number of classes
   int64_t GetNumClasses(const std::string &category_field);
 
@@ -287,6 +329,10 @@ class ShardReader {
   std::pair<MSRStatus, std::vector<std::vector<uint8_t>>> UnCompressBlob(const std::vector<uint8_t> &raw_blob_data);
 
  protected:
+  /// \brief read a range of a blob page, decompressing it when the page is compressed
+  MSRStatus ReadBlob(const int &shard_id, const std::shared_ptr<Page> &page, const uint64_t &begin,
+                     const uint64_t &end, unsigned char *data);
+
   uint64_t header_size_;                       // header size
   uint64_t page_size_;                         // page size
   int shard_count_;                            // number of shards
@@ -294,9 +340,11 @@ class ShardReader {
   std::shared_ptr<ShardColumn> shard_column_;  // shard column
 
   std::vector<sqlite3 *> database_paths_;                                        // sqlite handle list
+  std::vector<std::shared_ptr<ShardBinaryIndex>> binary_indexes_;  // binary index list, null for sqlite index
   std::vector<string> file_paths_;                                               // file paths
-  std::vector<std::shared_ptr<std::fstream>> file_streams_;                      // single-file handle list
-  std::vector<std::vector<std::shared_ptr<std::fstream>>> file_streams_random_;  // multiple-file handle list
+  std::vector<std::shared_ptr<std::fstream>> file_streams_;  // single-file handle list
+  std::vector<std::shared_ptr<ShardFile>> shard_files_;      // multiple-thread handle list, one per shard
+  std::shared_ptr<ShardPageReader> page_reader_;             // reader of the compressed blob pages
 
  private:
   int n_consumer_;                                         // number of workers (threads)
@@ -306,6 +354,8 @@ class ShardReader {
   ShardTask tasks_;                                        // shard task
   std::mutex shard_locker_;                                // locker of shard
 
+  std::vector<std::vector<std::vector<uint8_t>>> label_data_;  // typed blocks of the label columns of each shard
+
   // flags
   bool all_in_index_ = true;  // if all columns are stored in index-table
   bool interrupt_ = false;    // reader interrupted
@@ -322,6 +372,8 @@ class ShardReader {
   std::condition_variable cv_iterator_;          // conditional variable for iterator
   std::atomic<int> task_id_;                     // task ID which is working
   std::atomic<int> deliver_id_;                  // delivery ID which is picked up by iterator
+  int64_t read_ahead_;                           // number of tasks whose blobs are read ahead
+  std::atomic<int64_t> read_ahead_id_;           // tasks before this ID are read ahead
   // map of delivery
   std::unordered_map<int, std::shared_ptr<std::vector<std::tuple<std::vector<uint8_t>, json>>>> delivery_map_;
   // Delivery/Iterator mode end
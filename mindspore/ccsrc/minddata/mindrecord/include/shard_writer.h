@@ -23,9 +23,12 @@
 #include <algorithm>
 #include <array>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <exception>
 #include <fstream>
 #include <functional>
+#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -37,6 +40,7 @@
 #include <vector>
 #include "minddata/mindrecord/include/common/shard_utils.h"
 #include "minddata/mindrecord/include/shard_column.h"
+#include "minddata/mindrecord/include/shard_compression.h"
 #include "minddata/mindrecord/include/shard_error.h"
 #include "minddata/mindrecord/include/shard_header.h"
 #include "minddata/mindrecord/include/shard_index.h"
@@ -77,15 +81,39 @@ class ShardWriter {
   /// \return MSRStatus the status of MSRStatus
   MSRStatus SetPageSize(const uint64_t &page_size);
 
+  /// \brief Store the fixed width scalar columns in label pages, a typed block per column, instead of in the msgpack
+  ///        of the raw pages
+  /// \param[in] columnar_label store the label columns in label pages or not
+  ///        WARNING, only called before the shard header is set
+  /// \return MSRStatus the status of MSRStatus
+  MSRStatus SetColumnarLabel(const bool &columnar_label);
+
+  /// \brief Set the number of workers of each stage of writing data: checking, serializing and compressing the rows
+  ///        and compressing the blob pages. The pages of a shard are written while the workers compress the next ones,
+  ///        and the rows of a WriteRawData call are written while the next call checks and serializes its rows.
+  /// \param[in] num_workers the number of workers, between 1 and 32
+  /// \return MSRStatus the status of MSRStatus
+  MSRStatus SetParallelWorkers(const int &num_workers);
+
+  /// \brief Compress the blob pages, a chunk of whole blobs at a time, so that reading a blob only decompresses its
+  ///        chunk
+  /// \param[in] compression the compression of the blob pages, "none" or "zlib"
+  /// \param[in] level the compression level, from 1 (fastest) to 9 (smallest)
+  ///        WARNING, only called before the shard header is set
+  /// \return MSRStatus the status of MSRStatus
+  MSRStatus SetPageCompression(const std::string &compression, const int &level = kDefaultPageCompressionLevel);
+
   /// \brief Set shard header
   /// \param[in] header_data the info of header
   ///        WARNING, only called when file is empty
   /// \return MSRStatus the status of MSRStatus
   MSRStatus SetShardHeader(std::shared_ptr<ShardHeader> header_data);
 
-  /// \brief write raw data by group size
+  /// \brief write raw data by group size. The rows are checked and serialized by the call, then written by the writer
+  ///        thread while the next call checks and serializes its rows. A failure of the writer thread is returned by
+  ///        the next call or by Commit.
   /// \param[in] raw_data the vector of raw json data, vector format
-  /// \param[in] blob_data the vector of image data
+  /// \param[in] blob_data the vector of image data, the rows are written from a copy of it
   /// \param[in] sign validate data or not
   /// \return MSRStatus the status of MSRStatus to judge if write successfully
   MSRStatus WriteRawData(std::map<uint64_t, std::vector<json>> &raw_data, vector<vector<uint8_t>> &blob_data,
@@ -135,19 +163,45 @@ class ShardWriter {
 
   /// \brief fill data array in multiple thread run
   void FillArray(int start, int end, std::map<uint64_t, vector<json>> &raw_data,
-                 std::vector<std::vector<uint8_t>> &bin_data);
+                 std::vector<std::vector<uint8_t>> &bin_data, std::vector<std::vector<uint8_t>> *label_data);
 
-  /// \brief serialized raw data
+  /// \brief serialized raw data, the label columns going to the typed blocks of label_data when it is given
   MSRStatus SerializeRawData(std::map<uint64_t, std::vector<json>> &raw_data,
-                             std::vector<std::vector<uint8_t>> &bin_data, uint32_t row_count);
+                             std::vector<std::vector<uint8_t>> &bin_data, uint32_t row_count,
+                             std::vector<std::vector<uint8_t>> *label_data = nullptr);
+
+  /// \brief the rows of a WriteRawData call, checked and serialized, waiting to be written
+  struct RowBatch {
+    std::vector<std::vector<uint8_t>> blob_data;
+    std::vector<std::vector<uint8_t>> bin_raw_data;
+    std::vector<std::vector<uint8_t>> label_data;
+    std::vector<uint64_t> raw_data_size;
+    std::vector<uint64_t> blob_data_size;
+  };
+
+  /// \brief check and serialize the rows, then queue them to the writer thread. A parallel writer writes them at once,
+  ///        between loading and saving the pages of the other writers.
+  MSRStatus WriteRows(std::map<uint64_t, std::vector<json>> &raw_data, std::vector<std::vector<uint8_t>> blob_data,
+                      bool sign, bool parallel_writer);
+
+  /// \brief write a batch of rows to the shards
+  MSRStatus WriteBatch(RowBatch *batch);
+
+  /// \brief the writer thread, it writes the queued batches in order
+  void WriterThread();
+
+  /// \brief wait for the queued batches to be written
+  /// \param[in] stop stop the writer thread too
+  /// \return MSRStatus FAILED when a batch failed to be written
+  MSRStatus WaitForWriter(bool stop = false);
 
   /// \brief write all data parallel
   MSRStatus ParallelWriteData(const std::vector<std::vector<uint8_t>> &blob_data,
                               const std::vector<std::vector<uint8_t>> &bin_raw_data);
 
-  /// \brief write data shard by shard
+  /// \brief write data shard by shard, compressing up to num_compress blob pages ahead
   MSRStatus WriteByShard(int shard_id, int start_row, int end_row, const std::vector<std::vector<uint8_t>> &blob_data,
-                         const std::vector<std::vector<uint8_t>> &bin_raw_data);
+                         const std::vector<std::vector<uint8_t>> &bin_raw_data, int num_compress);
 
   /// \brief break image data up into multiple row groups
   MSRStatus CutRowGroup(int start_row, int end_row, const std::vector<std::vector<uint8_t>> &blob_data,
@@ -162,7 +216,14 @@ class ShardWriter {
   /// \brief write new blob data page to disk
   MSRStatus NewBlobPage(const int &shard_id, const std::vector<std::vector<uint8_t>> &blob_data,
                         const std::vector<std::pair<int, int>> &rows_in_group,
-                        const std::shared_ptr<Page> &last_blob_page);
+                        const std::shared_ptr<Page> &last_blob_page, const int &num_compress);
+
+  /// \brief compress the rows of a blob page, empty when the page does not get smaller
+  std::pair<MSRStatus, std::vector<uint8_t>> CompressBlobPage(const std::vector<std::vector<uint8_t>> &blob_data,
+                                                              const std::pair<int, int> &blob_row);
+
+  /// \brief compress the blobs of the rows by the columns in multiple thread run
+  void CompressBlobs(std::vector<std::vector<uint8_t>> &blob_data);
 
   /// \brief shift last row group to next raw page for new appending
   MSRStatus ShiftRawPage(const int &shard_id, const std::vector<std::pair<int, int>> &rows_in_group,
@@ -172,6 +233,9 @@ class ShardWriter {
   MSRStatus WriteRawPage(const int &shard_id, const std::vector<std::pair<int, int>> &rows_in_group,
                          std::shared_ptr<Page> &last_raw_page, const std::vector<std::vector<uint8_t>> &bin_raw_data);
 
+  /// \brief write the label columns of rows to the label pages
+  MSRStatus WriteLabelPage(const int &shard_id, const int &start_row, const int &end_row);
+
   /// \brief generate empty raw data page
   void EmptyRawPage(const int &shard_id, std::shared_ptr<Page> &last_raw_page);
 
@@ -193,10 +257,10 @@ class ShardWriter {
   std::vector<std::pair<int, int>> BreakIntoShards();
 
   /// \brief calculate raw data size row by row
-  MSRStatus SetRawDataSize(const std::vector<std::vector<uint8_t>> &bin_raw_data);
+  MSRStatus SetRawDataSize(const std::vector<std::vector<uint8_t>> &bin_raw_data, std::vector<uint64_t> *raw_data_size);
 
   /// \brief calculate blob data size row by row
-  MSRStatus SetBlobDataSize(const std::vector<std::vector<uint8_t>> &blob_data);
+  MSRStatus SetBlobDataSize(const std::vector<std::vector<uint8_t>> &blob_data, std::vector<uint64_t> *blob_data_size);
 
   /// \brief populate last raw page pointer
   void SetLastRawPage(const int &shard_id, std::shared_ptr<Page> &last_raw_page);
@@ -236,17 +300,32 @@ class ShardWriter {
  private:
   const std::string kLockFileSuffix = "_Locker";
   const std::string kPageFileSuffix = "_Pages";
+  const size_t kMaxQueuedBatches = 1;  // batches checked and serialized ahead of the one being written
   std::string lock_file_;   // lock file for parallel run
   std::string pages_file_;  // temporary file of pages info for parallel run
 
-  int shard_count_;        // number of files
-  uint64_t header_size_;   // header size
-  uint64_t page_size_;     // page size
-  uint32_t row_count_;     // count of rows
-  uint32_t schema_count_;  // count of schemas
-
-  std::vector<uint64_t> raw_data_size_;   // Raw data size
-  std::vector<uint64_t> blob_data_size_;  // Blob data size
+  int shard_count_;                     // number of files
+  uint64_t header_size_;                // header size
+  uint64_t page_size_;                  // page size
+  uint32_t row_count_;                  // count of rows
+  std::atomic<uint32_t> schema_count_;  // count of schemas, read by the writer thread
+  bool columnar_label_;                 // store label columns in label pages
+  int num_workers_;                     // number of workers of each stage
+  std::string page_compression_;        // compression of the blob pages
+  int page_compression_level_;          // compression level of the blob pages
+
+  // The rows being written by the writer thread
+  std::vector<uint64_t> raw_data_size_;           // Raw data size
+  std::vector<uint64_t> blob_data_size_;          // Blob data size
+  std::vector<std::vector<uint8_t>> label_data_;  // Typed block of each label column
+
+  std::thread writer_thread_;         // writes the batches queued by WriteRawData
+  std::deque<RowBatch> write_queue_;  // batches waiting for the writer thread
+  bool writing_ = false;              // the writer thread is writing a batch
+  bool stop_writer_ = false;          // the writer thread stops once the queue is empty
+  MSRStatus write_status_ = SUCCESS;  // FAILED once a batch failed to be written, the next ones are dropped
+  std::mutex write_mutex_;
+  std::condition_variable write_cv_;
 
   std::vector<std::string> file_paths_;                      // file paths
   std::vector<std::shared_ptr<std::fstream>> file_streams_;  // file handles
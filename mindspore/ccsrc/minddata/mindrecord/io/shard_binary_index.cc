@@ -0,0 +1,450 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/mindrecord/include/shard_binary_index.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <sys/mman.h>
+#endif
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include "utils/ms_utils.h"
+
+using mindspore::LogStream;
+using mindspore::ExceptionType::NoExceptionType;
+using mindspore::MsLogLevel::DEBUG;
+using mindspore::MsLogLevel::ERROR;
+
+namespace mindspore {
+namespace mindrecord {
+namespace {
+const uint64_t kMagicLen = 8;
+const uint64_t kAlignment = 8;
+
+uint64_t AlignUp(uint64_t size) { return (size + kAlignment - 1) / kAlignment * kAlignment; }
+
+int64_t ToInt64(uint64_t bits) {
+  int64_t value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+double ToDouble(uint64_t bits) {
+  double value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+template <typename T>
+int Compare3Way(const T &a, const T &b) {
+  return a < b ? -1 : (b < a ? 1 : 0);
+}
+
+// compare two stored values of a field
+int CompareValues(IndexKeyType type, uint64_t a, uint64_t b, const char *pool) {
+  if (type == kIndexKeyInt64) {
+    return Compare3Way(ToInt64(a), ToInt64(b));
+  }
+  if (type == kIndexKeyDouble) {
+    return Compare3Way(ToDouble(a), ToDouble(b));
+  }
+  return std::string(pool + (a >> 32), a & 0xffffffff).compare(std::string(pool + (b >> 32), b & 0xffffffff));
+}
+
+// parse the text of a number value, a failure means no value of the field equals to the text
+bool ParseNumber(const std::string &text, int64_t *int_value, double *double_value) {
+  try {
+    size_t pos = 0;
+    *double_value = std::stod(text, &pos);
+    if (pos != text.size()) {
+      return false;
+    }
+    pos = 0;
+    auto value = std::stoll(text, &pos);
+    *int_value = pos == text.size() ? value : static_cast<int64_t>(*double_value);
+  } catch (const std::exception &e) {
+    return false;
+  }
+  return true;
+}
+
+void WriteUint64(std::ofstream &out, uint64_t value) { out.write(reinterpret_cast<const char *>(&value), kInt64Len); }
+
+void WritePadded(std::ofstream &out, const char *data, uint64_t size) {
+  out.write(data, size);
+  const char padding[kAlignment] = {0};
+  out.write(padding, AlignUp(size) - size);
+}
+}  // namespace
+
+ShardBinaryIndex::~ShardBinaryIndex() { Unmap(); }
+
+std::pair<uint64_t, uint64_t> ShardBinaryIndex::CountPagesAndRows(ShardHeader *header, int shard_id) {
+  uint64_t page_count = static_cast<uint64_t>(header->GetLastPageId(shard_id) + 1);
+  uint64_t row_count = 0;
+  // every row is in one blob page, as in the row group summary of the reader
+  for (uint64_t page_id = 0; page_id < page_count; ++page_id) {
+    auto page = header->GetPage(shard_id, static_cast<int>(page_id));
+    if (page.second != SUCCESS || page.first->GetPageType() != kPageTypeBlob) {
+      continue;
+    }
+    row_count += page.first->GetEndRowID() - page.first->GetStartRowID();
+  }
+  return {page_count, row_count};
+}
+
+MSRStatus ShardBinaryIndex::Write(const std::string &shard_path, uint64_t page_count,
+                                  const std::vector<std::pair<std::string, IndexKeyType>> &fields,
+                                  const std::vector<INDEX_ROW> &rows,
+                                  const std::vector<std::vector<std::string>> &values) {
+  auto shard_name = GetFileName(shard_path);
+  struct stat shard_stat;
+  if (shard_name.first != SUCCESS || stat(common::SafeCStr(shard_path), &shard_stat) != 0) {
+    MS_LOG(ERROR) << "Invalid file, failed to stat file: " << shard_path;
+    return FAILED;
+  }
+  if (rows.size() > std::numeric_limits<uint32_t>::max() || values.size() != rows.size()) {
+    MS_LOG(ERROR) << "Invalid data, the binary index can not hold " << rows.size() << " rows.";
+    return FAILED;
+  }
+
+  // the typed values, the order of the rows and the string pool of each field
+  std::vector<std::vector<uint64_t>> field_values(fields.size(), std::vector<uint64_t>(rows.size()));
+  std::vector<std::vector<uint32_t>> field_orders(fields.size(), std::vector<uint32_t>(rows.size()));
+  std::vector<std::string> field_pools(fields.size());
+  for (size_t f = 0; f < fields.size(); ++f) {
+    auto type = fields[f].second;
+    auto &pool = field_pools[f];
+    for (size_t r = 0; r < rows.size(); ++r) {
+      if (values[r].size() != fields.size()) {
+        MS_LOG(ERROR) << "Invalid data, row " << rows[r][kIndexRowId] << " misses index fields.";
+        return FAILED;
+      }
+      const auto &text = values[r][f];
+      if (type == kIndexKeyString) {
+        if (pool.size() + text.size() > std::numeric_limits<uint32_t>::max()) {
+          MS_LOG(ERROR) << "Invalid data, the string values of field " << fields[f].first << " are too large.";
+          return FAILED;
+        }
+        field_values[f][r] = (static_cast<uint64_t>(pool.size()) << 32) | text.size();
+        pool += text;
+        continue;
+      }
+      int64_t int_value = 0;
+      double double_value = 0;
+      if (!ParseNumber(text, &int_value, &double_value)) {
+        MS_LOG(ERROR) << "Invalid data, value " << text << " of field " << fields[f].first << " is not a number.";
+        return FAILED;
+      }
+      if (type == kIndexKeyInt64) {
+        memcpy(&field_values[f][r], &int_value, kInt64Len);
+      } else {
+        memcpy(&field_values[f][r], &double_value, kInt64Len);
+      }
+    }
+    auto &order = field_orders[f];
+    const auto &stored = field_values[f];
+    for (uint32_t r = 0; r < order.size(); ++r) {
+      order[r] = r;
+    }
+    std::sort(order.begin(), order.end(), [type, &stored, &pool](uint32_t a, uint32_t b) {
+      int result = CompareValues(type, stored[a], stored[b], pool.data());
+      return result < 0 || (result == 0 && a < b);
+    });
+  }
+
+  std::string index_path = shard_path + kBinaryIndexSuffix;
+  std::ofstream out(common::SafeCStr(index_path), std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!out.good()) {
+    MS_LOG(ERROR) << "Invalid file, failed to open file: " << index_path;
+    return FAILED;
+  }
+  out.write(kBinaryIndexMagic, kMagicLen);
+  WriteUint64(out, static_cast<uint64_t>(shard_stat.st_size));
+  WriteUint64(out, page_count);
+  WriteUint64(out, rows.size());
+  WriteUint64(out, fields.size());
+  WriteUint64(out, shard_name.second.size());
+  WritePadded(out, shard_name.second.data(), shard_name.second.size());
+  for (size_t f = 0; f < fields.size(); ++f) {
+    WriteUint64(out, fields[f].second);
+    WriteUint64(out, fields[f].first.size());
+    WriteUint64(out, field_pools[f].size());
+    WritePadded(out, fields[f].first.data(), fields[f].first.size());
+  }
+  for (const auto &row : rows) {
+    out.write(reinterpret_cast<const char *>(row.data()), kIndexRowColumnCount * kInt64Len);
+  }
+  for (size_t f = 0; f < fields.size(); ++f) {
+    out.write(reinterpret_cast<const char *>(field_values[f].data()), rows.size() * kInt64Len);
+    WritePadded(out, reinterpret_cast<const char *>(field_orders[f].data()), rows.size() * sizeof(uint32_t));
+    WritePadded(out, field_pools[f].data(), field_pools[f].size());
+  }
+  out.close();
+  if (!out.good()) {
+    MS_LOG(ERROR) << "File write failed, file: " << index_path;
+    (void)remove(common::SafeCStr(index_path));
+    return FAILED;
+  }
+  return SUCCESS;
+}
+
+MSRStatus ShardBinaryIndex::Load(const std::string &shard_path, uint64_t page_count, uint64_t row_count,
+                                 const std::vector<std::string> &field_names) {
+  Unmap();
+  std::string index_path = shard_path + kBinaryIndexSuffix;
+  struct stat shard_stat;
+  auto shard_name = GetFileName(shard_path);
+  if (shard_name.first != SUCCESS || stat(common::SafeCStr(shard_path), &shard_stat) != 0) {
+    return FAILED;
+  }
+#if defined(_WIN32) || defined(_WIN64)
+  std::ifstream in(common::SafeCStr(index_path), std::ios::in | std::ios::binary | std::ios::ate);
+  if (!in.good()) {
+    return FAILED;
+  }
+  buffer_.resize(static_cast<uint64_t>(in.tellg()));
+  in.seekg(0, std::ios::beg);
+  if (!in.read(reinterpret_cast<char *>(buffer_.data()), buffer_.size()).good()) {
+    buffer_.clear();
+    return FAILED;
+  }
+  data_ = buffer_.data();
+  data_size_ = buffer_.size();
+#else
+  int fd = open(common::SafeCStr(index_path), O_RDONLY);
+  if (fd < 0) {
+    return FAILED;
+  }
+  struct stat index_stat;
+  if (fstat(fd, &index_stat) != 0 || index_stat.st_size == 0) {
+    (void)close(fd);
+    return FAILED;
+  }
+  void *addr = mmap(nullptr, static_cast<size_t>(index_stat.st_size), PROT_READ, MAP_SHARED, fd, 0);
+  (void)close(fd);
+  if (addr == MAP_FAILED) {
+    MS_LOG(ERROR) << "Failed to map binary index file: " << index_path;
+    return FAILED;
+  }
+  data_ = static_cast<const uint8_t *>(addr);
+  data_size_ = static_cast<uint64_t>(index_stat.st_size);
+#endif
+
+  // walk the blocks of the file, failing as soon as one is out of the file
+  uint64_t cursor = 0;
+  auto take = [this, &cursor](uint64_t size) -> const uint8_t * {
+    if (cursor + size > data_size_ || cursor + size < cursor) {
+      return nullptr;
+    }
+    auto block = data_ + cursor;
+    cursor += AlignUp(size);
+    return block;
+  };
+  auto take_uint64 = [&take](uint64_t *value) {
+    auto block = take(kInt64Len);
+    if (block != nullptr) {
+      *value = *reinterpret_cast<const uint64_t *>(block);
+    }
+    return block != nullptr;
+  };
+  auto magic = take(kMagicLen);
+  uint64_t shard_size = 0, index_page_count = 0, field_count = 0, name_len = 0;
+  if (magic == nullptr || memcmp(magic, kBinaryIndexMagic, kMagicLen) != 0 || !take_uint64(&shard_size) ||
+      !take_uint64(&index_page_count) || !take_uint64(&row_count_) || !take_uint64(&field_count) ||
+      !take_uint64(&name_len)) {
+    MS_LOG(DEBUG) << "Invalid binary index file: " << index_path;
+    Unmap();
+    return FAILED;
+  }
+  auto name = reinterpret_cast<const char *>(take(name_len));
+  if (name == nullptr || std::string(name, name_len) != shard_name.second ||
+      shard_size != static_cast<uint64_t>(shard_stat.st_size) || index_page_count != page_count ||
+      row_count_ != row_count || field_count != field_names.size()) {
+    MS_LOG(DEBUG) << "Binary index file does not match the shard: " << index_path;
+    Unmap();
+    return FAILED;
+  }
+  std::vector<uint64_t> pool_sizes;
+  for (uint64_t f = 0; f < field_count; ++f) {
+    uint64_t type = 0, field_name_len = 0, pool_size = 0;
+    if (!take_uint64(&type) || !take_uint64(&field_name_len) || !take_uint64(&pool_size) ||
+        type > kIndexKeyString) {
+      Unmap();
+      return FAILED;
+    }
+    auto field_name = reinterpret_cast<const char *>(take(field_name_len));
+    if (field_name == nullptr || std::string(field_name, field_name_len) != field_names[f]) {
+      MS_LOG(DEBUG) << "Binary index file does not match the index fields of the shard: " << index_path;
+      Unmap();
+      return FAILED;
+    }
+    fields_.push_back({static_cast<IndexKeyType>(type), nullptr, nullptr, nullptr});
+    pool_sizes.push_back(pool_size);
+  }
+  if (row_count_ > std::numeric_limits<uint32_t>::max() ||
+      (rows_ = reinterpret_cast<const uint64_t *>(take(row_count_ * kIndexRowColumnCount * kInt64Len))) == nullptr) {
+    Unmap();
+    return FAILED;
+  }
+  for (uint64_t f = 0; f < field_count; ++f) {
+    auto &field = fields_[f];
+    field.values = reinterpret_cast<const uint64_t *>(take(row_count_ * kInt64Len));
+    field.order = reinterpret_cast<const uint32_t *>(take(row_count_ * sizeof(uint32_t)));
+    field.pool = reinterpret_cast<const char *>(take(pool_sizes[f]));
+    if (field.values == nullptr || field.order == nullptr || field.pool == nullptr) {
+      Unmap();
+      return FAILED;
+    }
+  }
+
+  // the rows of a blob page are next to each other
+  for (uint64_t row = 0; row < row_count_; ++row) {
+    auto page_id = GetRow(row)[kIndexPageIdBlob];
+    auto it = page_rows_.find(page_id);
+    if (it == page_rows_.end()) {
+      page_rows_[page_id] = {row, row + 1};
+    } else if (it->second.second == row) {
+      it->second.second++;
+    } else {
+      MS_LOG(DEBUG) << "Invalid binary index file, the rows of page " << page_id << " are apart: " << index_path;
+      Unmap();
+      return FAILED;
+    }
+  }
+  field_names_ = field_names;
+  return SUCCESS;
+}
+
+void ShardBinaryIndex::Unmap() {
+#if defined(_WIN32) || defined(_WIN64)
+  buffer_.clear();
+#else
+  if (data_ != nullptr) {
+    (void)munmap(const_cast<uint8_t *>(data_), data_size_);
+  }
+#endif
+  data_ = nullptr;
+  data_size_ = 0;
+  rows_ = nullptr;
+  row_count_ = 0;
+  field_names_.clear();
+  fields_.clear();
+  page_rows_.clear();
+}
+
+int ShardBinaryIndex::GetFieldId(const std::string &field_name) const {
+  auto it = std::find(field_names_.begin(), field_names_.end(), field_name);
+  return it == field_names_.end() ? -1 : static_cast<int>(it - field_names_.begin());
+}
+
+json ShardBinaryIndex::GetValue(int field_id, uint64_t row) const {
+  const auto &field = fields_[field_id];
+  auto value = field.values[row];
+  if (field.type == kIndexKeyInt64) {
+    return ToInt64(value);
+  }
+  if (field.type == kIndexKeyDouble) {
+    return ToDouble(value);
+  }
+  return std::string(field.pool + (value >> 32), value & 0xffffffff);
+}
+
+std::string ShardBinaryIndex::GetValueString(int field_id, uint64_t row) const {
+  const auto &field = fields_[field_id];
+  auto value = field.values[row];
+  if (field.type == kIndexKeyInt64) {
+    return std::to_string(ToInt64(value));
+  }
+  if (field.type == kIndexKeyDouble) {
+    // the same text as sqlite gives for a NUMERIC column
+    char text[32] = {0};
+    (void)snprintf(text, sizeof(text), "%.15g", ToDouble(value));
+    return text;
+  }
+  return std::string(field.pool + (value >> 32), value & 0xffffffff);
+}
+
+int ShardBinaryIndex::Compare(const Field &field, uint64_t row, const std::string &value, int64_t int_value,
+                              double double_value) const {
+  auto stored = field.values[row];
+  if (field.type == kIndexKeyInt64) {
+    return Compare3Way(ToInt64(stored), int_value);
+  }
+  if (field.type == kIndexKeyDouble) {
+    return Compare3Way(ToDouble(stored), double_value);
+  }
+  return std::string(field.pool + (stored >> 32), stored & 0xffffffff).compare(value);
+}
+
+void ShardBinaryIndex::GetRowsOfPage(uint64_t page_id, int field_id, const std::string &value,
+                                     std::vector<uint64_t> *rows) const {
+  auto it = page_rows_.find(page_id);
+  if (it == page_rows_.end()) {
+    return;
+  }
+  auto row_begin = it->second.first;
+  auto row_end = it->second.second;
+  if (field_id < 0) {
+    for (auto row = row_begin; row < row_end; ++row) {
+      rows->push_back(row);
+    }
+    return;
+  }
+  const auto &field = fields_[field_id];
+  int64_t int_value = 0;
+  double double_value = 0;
+  if (field.type != kIndexKeyString && !ParseNumber(value, &int_value, &double_value)) {
+    return;
+  }
+  if (field.type == kIndexKeyInt64 && static_cast<double>(int_value) != double_value) {
+    return;
+  }
+  // rows of the value, then the rows of the page among them, both ranges are found by binary search
+  auto order_end = field.order + row_count_;
+  auto first = std::lower_bound(field.order, order_end, row_begin, [&](uint32_t row, uint64_t begin) {
+    int result = Compare(field, row, value, int_value, double_value);
+    return result < 0 || (result == 0 && row < begin);
+  });
+  for (auto it_row = first; it_row != order_end && *it_row < row_end; ++it_row) {
+    if (Compare(field, *it_row, value, int_value, double_value) != 0) {
+      break;
+    }
+    rows->push_back(*it_row);
+  }
+}
+
+void ShardBinaryIndex::CountValues(int field_id, std::map<std::string, int> *counter) const {
+  const auto &field = fields_[field_id];
+  uint64_t run_begin = 0;
+  for (uint64_t i = 1; i <= row_count_; ++i) {
+    if (i < row_count_ &&
+        CompareValues(field.type, field.values[field.order[i]], field.values[field.order[run_begin]], field.pool) ==
+          0) {
+      continue;
+    }
+    (*counter)[GetValueString(field_id, field.order[run_begin])] += static_cast<int>(i - run_begin);
+    run_begin = i;
+  }
+}
+}  // namespace mindrecord
+}  // namespace mindspore
@@ -0,0 +1,247 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/mindrecord/include/shard_compression.h"
+
+#include <algorithm>
+#include "zlib.h"
+
+using mindspore::LogStream;
+using mindspore::ExceptionType::NoExceptionType;
+using mindspore::MsLogLevel::ERROR;
+
+namespace mindspore {
+namespace mindrecord {
+bool ShardCompression::IsValid(const std::string &compression) {
+  return compression.empty() || compression == kPageCompressionNone || compression == kPageCompressionZlib;
+}
+
+MSRStatus ShardCompression::CompressPage(const std::string &compression, const int &level,
+                                         const std::vector<uint8_t> &page, const std::vector<uint64_t> &blob_ends,
+                                         std::vector<uint8_t> *stored) {
+  if (compression != kPageCompressionZlib) {
+    MS_LOG(ERROR) << "Unsupported page compression: " << compression;
+    return FAILED;
+  }
+
+  // Cut the page into chunks at the ends of the rows
+  std::vector<uint64_t> chunk_ends;
+  uint64_t chunk_start = 0;
+  for (const auto &blob_end : blob_ends) {
+    if (blob_end - chunk_start >= kPageChunkSize) {
+      chunk_ends.push_back(blob_end);
+      chunk_start = blob_end;
+    }
+  }
+  if (chunk_start < page.size()) {
+    chunk_ends.push_back(page.size());
+  }
+
+  // The chunk table is filled in once the stored size of each chunk is known
+  std::vector<uint64_t> table(1, chunk_ends.size());
+  stored->assign(kInt64Len * (1 + 2 * chunk_ends.size()), 0);
+  uint64_t raw_start = 0;
+  for (const auto &raw_end : chunk_ends) {
+    uint64_t raw_bytes = raw_end - raw_start;
+    uLongf stored_bytes = compressBound(raw_bytes);
+    size_t stored_start = stored->size();
+    stored->resize(stored_start + stored_bytes);
+    if (compress2(stored->data() + stored_start, &stored_bytes, page.data() + raw_start, raw_bytes, level) != Z_OK) {
+      MS_LOG(ERROR) << "Compress page failed, level: " << level;
+      return FAILED;
+    }
+    if (stored_bytes >= raw_bytes) {
+      // Blobs already compressed, like images, are stored as they are
+      std::copy(page.begin() + raw_start, page.begin() + raw_end, stored->begin() + stored_start);
+      stored_bytes = raw_bytes;
+    }
+    stored->resize(stored_start + stored_bytes);
+    table.push_back(raw_end);
+    table.push_back(stored->size());
+    raw_start = raw_end;
+  }
+  std::copy(reinterpret_cast<const uint8_t *>(table.data()),
+            reinterpret_cast<const uint8_t *>(table.data() + table.size()), stored->begin());
+  return SUCCESS;
+}
+
+MSRStatus ShardCompression::DecompressPage(const std::string &compression, const std::vector<uint8_t> &stored,
+                                           const uint64_t &page_bytes, std::vector<uint8_t> *page) {
+  std::vector<std::pair<uint64_t, uint64_t>> table;
+  if (ParseChunkTable(stored.data(), stored.size(), &table) == FAILED) {
+    return FAILED;
+  }
+  if ((table.empty() && page_bytes != 0) || (!table.empty() && table.back().first != page_bytes) ||
+      (!table.empty() && table.back().second > stored.size())) {
+    MS_LOG(ERROR) << "Invalid data, the chunk table does not match the page.";
+    return FAILED;
+  }
+
+  page->resize(page_bytes);
+  uint64_t raw_start = 0;
+  uint64_t stored_start = kInt64Len * (1 + 2 * table.size());
+  for (const auto &chunk : table) {
+    if (chunk.second - stored_start == chunk.first - raw_start) {
+      std::copy(stored.begin() + stored_start, stored.begin() + chunk.second, page->begin() + raw_start);
+    } else if (Decompress(compression, stored.data() + stored_start, chunk.second - stored_start,
+                          page->data() + raw_start, chunk.first - raw_start) == FAILED) {
+      return FAILED;
+    }
+    raw_start = chunk.first;
+    stored_start = chunk.second;
+  }
+  return SUCCESS;
+}
+
+MSRStatus ShardCompression::Decompress(const std::string &compression, const unsigned char *src,
+                                       const uint64_t &src_bytes, unsigned char *dst, const uint64_t &dst_bytes) {
+  if (compression != kPageCompressionZlib) {
+    MS_LOG(ERROR) << "Unsupported page compression: " << compression;
+    return FAILED;
+  }
+  uLongf n_bytes = dst_bytes;
+  if (uncompress(dst, &n_bytes, src, src_bytes) != Z_OK || n_bytes != dst_bytes) {
+    MS_LOG(ERROR) << "Invalid data, decompress chunk failed.";
+    return FAILED;
+  }
+  return SUCCESS;
+}
+
+MSRStatus ShardCompression::ParseChunkTable(const unsigned char *data, const uint64_t &n_bytes,
+                                            std::vector<std::pair<uint64_t, uint64_t>> *table) {
+  if (n_bytes < kInt64Len) {
+    MS_LOG(ERROR) << "Invalid data, the chunk table is truncated.";
+    return FAILED;
+  }
+  uint64_t chunk_count = *reinterpret_cast<const uint64_t *>(data);
+  if (chunk_count > (n_bytes - kInt64Len) / (2 * kInt64Len)) {
+    MS_LOG(ERROR) << "Invalid data, the chunk table is truncated.";
+    return FAILED;
+  }
+
+  const uint64_t *ends = reinterpret_cast<const uint64_t *>(data) + 1;
+  uint64_t raw_end = 0;
+  uint64_t stored_end = kInt64Len * (1 + 2 * chunk_count);
+  table->clear();
+  for (uint64_t i = 0; i < chunk_count; ++i) {
+    if (ends[2 * i] < raw_end || ends[2 * i + 1] < stored_end) {
+      MS_LOG(ERROR) << "Invalid data, the chunks of the chunk table are out of order.";
+      return FAILED;
+    }
+    raw_end = ends[2 * i];
+    stored_end = ends[2 * i + 1];
+    table->emplace_back(raw_end, stored_end);
+  }
+  return SUCCESS;
+}
+
+ShardPageReader::ShardPageReader(const std::string &compression, const uint64_t &header_size,
+                                 const uint64_t &page_size, const int &cache_size)
+    : compression_(compression),
+      header_size_(header_size),
+      page_size_(page_size),
+      tables_(kChunkTableCacheSize),
+      chunks_(cache_size) {}
+
+std::shared_ptr<ShardPageReader::ChunkTable> ShardPageReader::GetChunkTable(
+  const std::shared_ptr<ShardFile> &shard_file, const int &shard_id, const std::shared_ptr<Page> &page) {
+  return tables_.Get(std::make_pair(shard_id, page->GetPageID()), [&]() -> std::shared_ptr<ChunkTable> {
+    uint64_t page_offset = page->GetPageOffset(header_size_, page_size_);
+    uint64_t chunk_count = 0;
+    if (shard_file->Read(page_offset, kInt64Len, reinterpret_cast<unsigned char *>(&chunk_count)) == FAILED) {
+      return nullptr;
+    }
+    if (chunk_count > page->GetCompressedSize() / (2 * kInt64Len)) {
+      MS_LOG(ERROR) << "Invalid data, the chunk table of page " << page->GetPageID() << " is truncated.";
+      return nullptr;
+    }
+
+    std::vector<uint8_t> buf(kInt64Len * (1 + 2 * chunk_count));
+    if (shard_file->Read(page_offset, buf.size(), buf.data()) == FAILED) {
+      return nullptr;
+    }
+    auto table = std::make_shared<ChunkTable>();
+    if (ShardCompression::ParseChunkTable(buf.data(), buf.size(), table.get()) == FAILED) {
+      return nullptr;
+    }
+    if (!table->empty() && (table->back().first != page->GetPageSize() ||
+                            table->back().second != page->GetCompressedSize())) {
+      MS_LOG(ERROR) << "Invalid data, the chunk table of page " << page->GetPageID() << " does not match the page.";
+      return nullptr;
+    }
+    return table;
+  });
+}
+
+MSRStatus ShardPageReader::Read(const std::shared_ptr<ShardFile> &shard_file, const int &shard_id,
+                                const std::shared_ptr<Page> &page, const uint64_t &begin, const uint64_t &end,
+                                unsigned char *data) {
+  auto table = GetChunkTable(shard_file, shard_id, page);
+  if (table == nullptr) {
+    return FAILED;
+  }
+
+  // The first chunk ending after the range begins
+  size_t chunk_id = std::upper_bound(table->begin(), table->end(), begin,
+                                     [](const uint64_t &offset, const std::pair<uint64_t, uint64_t> &chunk) {
+                                       return offset < chunk.first;
+                                     }) -
+                    table->begin();
+  uint64_t page_offset = page->GetPageOffset(header_size_, page_size_);
+  uint64_t pos = begin;
+  while (pos < end) {
+    if (chunk_id >= table->size()) {
+      MS_LOG(ERROR) << "Invalid data, the range is out of page " << page->GetPageID() << ".";
+      return FAILED;
+    }
+    uint64_t raw_start = chunk_id == 0 ? 0 : (*table)[chunk_id - 1].first;
+    uint64_t raw_end = (*table)[chunk_id].first;
+    uint64_t stored_start = chunk_id == 0 ? kInt64Len * (1 + 2 * table->size()) : (*table)[chunk_id - 1].second;
+    uint64_t stored_end = (*table)[chunk_id].second;
+    uint64_t n_bytes = std::min(end, raw_end) - pos;
+
+    if (stored_end - stored_start == raw_end - raw_start) {
+      // A chunk stored as it is is read in place
+      if (shard_file->Read(page_offset + stored_start + pos - raw_start, n_bytes, data + pos - begin) == FAILED) {
+        return FAILED;
+      }
+    } else {
+      auto chunk = chunks_.Get(std::make_tuple(shard_id, page->GetPageID(), chunk_id),
+                               [&]() -> std::shared_ptr<std::vector<uint8_t>> {
+                                 std::vector<uint8_t> stored(stored_end - stored_start);
+                                 if (shard_file->Read(page_offset + stored_start, stored.size(), stored.data()) ==
+                                     FAILED) {
+                                   return nullptr;
+                                 }
+                                 auto raw = std::make_shared<std::vector<uint8_t>>(raw_end - raw_start);
+                                 if (ShardCompression::Decompress(compression_, stored.data(), stored.size(),
+                                                                  raw->data(), raw->size()) == FAILED) {
+                                   return nullptr;
+                                 }
+                                 return raw;
+                               });
+      if (chunk == nullptr) {
+        return FAILED;
+      }
+      std::copy(chunk->begin() + (pos - raw_start), chunk->begin() + (pos - raw_start + n_bytes), data + pos - begin);
+    }
+    pos += n_bytes;
+    chunk_id++;
+  }
+  return SUCCESS;
+}
+}  // namespace mindrecord
+}  // namespace mindspore
@@ -0,0 +1,108 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/mindrecord/include/shard_file.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include "utils/ms_utils.h"
+
+using mindspore::LogStream;
+using mindspore::ExceptionType::NoExceptionType;
+using mindspore::MsLogLevel::ERROR;
+
+namespace mindspore {
+namespace mindrecord {
+ShardFile::~ShardFile() { Close(); }
+
+#if defined(_WIN32) || defined(_WIN64)
+MSRStatus ShardFile::Open(const std::string &file_path) {
+  Close();
+  file_path_ = file_path;
+  fs_.open(common::SafeCStr(file_path), std::ios::in | std::ios::binary);
+  if (!fs_.good()) {
+    MS_LOG(ERROR) << "Invalid file, failed to open file: " << file_path;
+    return FAILED;
+  }
+  return SUCCESS;
+}
+
+void ShardFile::Close() {
+  if (fs_.is_open()) {
+    fs_.close();
+  }
+}
+
+MSRStatus ShardFile::Read(const uint64_t &offset, const uint64_t &n_bytes, unsigned char *data) {
+  std::lock_guard<std::mutex> lck(mtx_);
+  auto &io_seekg = fs_.seekg(offset, std::ios::beg);
+  if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
+    MS_LOG(ERROR) << "File seekg failed, file: " << file_path_;
+    fs_.clear();
+    return FAILED;
+  }
+  auto &io_read = fs_.read(reinterpret_cast<char *>(data), n_bytes);
+  if (!io_read.good() || io_read.fail() || io_read.bad()) {
+    MS_LOG(ERROR) << "File read failed, file: " << file_path_;
+    fs_.clear();
+    return FAILED;
+  }
+  return SUCCESS;
+}
+
+void ShardFile::ReadAhead(const uint64_t &offset, const uint64_t &n_bytes) {}
+#else
+MSRStatus ShardFile::Open(const std::string &file_path) {
+  Close();
+  file_path_ = file_path;
+  fd_ = open(common::SafeCStr(file_path), O_RDONLY);
+  if (fd_ < 0) {
+    MS_LOG(ERROR) << "Invalid file, failed to open file: " << file_path;
+    return FAILED;
+  }
+  return SUCCESS;
+}
+
+void ShardFile::Close() {
+  if (fd_ >= 0) {
+    (void)close(fd_);
+    fd_ = -1;
+  }
+}
+
+MSRStatus ShardFile::Read(const uint64_t &offset, const uint64_t &n_bytes, unsigned char *data) {
+  uint64_t n_read = 0;
+  while (n_read < n_bytes) {
+    auto ret = pread(fd_, data + n_read, n_bytes - n_read, static_cast<off_t>(offset + n_read));
+    if (ret < 0 && errno == EINTR) continue;
+    if (ret <= 0) {
+      MS_LOG(ERROR) << "File read failed, file: " << file_path_ << ", offset: " << offset + n_read;
+      return FAILED;
+    }
+    n_read += static_cast<uint64_t>(ret);
+  }
+  return SUCCESS;
+}
+
+void ShardFile::ReadAhead(const uint64_t &offset, const uint64_t &n_bytes) {
+#ifdef POSIX_FADV_WILLNEED
+  (void)posix_fadvise(fd_, static_cast<off_t>(offset), static_cast<off_t>(n_bytes), POSIX_FADV_WILLNEED);
+#endif
+}
+#endif
+}  // namespace mindrecord
+}  // namespace mindspore
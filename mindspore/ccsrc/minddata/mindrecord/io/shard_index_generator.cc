@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
 #include <thread>
 
 #include "minddata/mindrecord/include/shard_index_generator.h"
@@ -23,6 +24,7 @@ using mindspore::ExceptionType::NoExceptionType;
 using mindspore::MsLogLevel::DEBUG;
 using mindspore::MsLogLevel::ERROR;
 using mindspore::MsLogLevel::INFO;
+using mindspore::MsLogLevel::WARNING;
 
 namespace mindspore {
 namespace mindrecord {
@@ -56,6 +58,7 @@ MSRStatus ShardIndexGenerator::Build() {
     return FAILED;
   }
   shard_header_ = header;
+  shard_column_ = std::make_shared<ShardColumn>(std::make_shared<ShardHeader>(header));
   MS_LOG(INFO) << "Init header from mindrecord file for index successfully.";
   return SUCCESS;
 }
@@ -372,13 +375,26 @@ MSRStatus ShardIndexGenerator::BindParameterExecuteSQL(
 
 MSRStatus ShardIndexGenerator::AddBlobPageInfo(std::vector<std::tuple<std::string, std::string, std::string>> &row_data,
                                                const std::shared_ptr<Page> cur_blob_page,
-                                               uint64_t &cur_blob_page_offset, std::fstream &in) {
+                                               uint64_t &cur_blob_page_offset, std::fstream &in,
+                                               const std::vector<uint8_t> *blob_page_data) {
   row_data.emplace_back(":PAGE_ID_BLOB", "INTEGER", std::to_string(cur_blob_page->GetPageID()));
 
   // blob data start
   row_data.emplace_back(":PAGE_OFFSET_BLOB", "INTEGER", std::to_string(cur_blob_page_offset));
+
+  // the offsets of a compressed page are the ones in the decompressed page
+  if (blob_page_data != nullptr) {
+    if (cur_blob_page_offset + kInt64Len > blob_page_data->size()) {
+      MS_LOG(ERROR) << "Invalid data, the blob is out of page " << cur_blob_page->GetPageID();
+      return FAILED;
+    }
+    uint64_t image_size = *reinterpret_cast<const uint64_t *>(blob_page_data->data() + cur_blob_page_offset);
+    cur_blob_page_offset += (kInt64Len + image_size);
+    row_data.emplace_back(":PAGE_OFFSET_BLOB_END", "INTEGER", std::to_string(cur_blob_page_offset));
+    return SUCCESS;
+  }
   auto &io_seekg_blob =
-    in.seekg(page_size_ * cur_blob_page->GetPageID() + header_size_ + cur_blob_page_offset, std::ios::beg);
+    in.seekg(cur_blob_page->GetPageOffset(header_size_, page_size_) + cur_blob_page_offset, std::ios::beg);
   if (!io_seekg_blob.good() || io_seekg_blob.fail() || io_seekg_blob.bad()) {
     MS_LOG(ERROR) << "File seekg failed";
     in.close();
@@ -400,6 +416,26 @@ MSRStatus ShardIndexGenerator::AddBlobPageInfo(std::vector<std::tuple<std::strin
   return SUCCESS;
 }
 
+MSRStatus ShardIndexGenerator::ReadCompressedBlobPage(const std::shared_ptr<Page> &blob_page, std::fstream &in,
+                                                      std::vector<uint8_t> *blob_page_data) {
+  auto &io_seekg = in.seekg(blob_page->GetPageOffset(header_size_, page_size_), std::ios::beg);
+  if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
+    MS_LOG(ERROR) << "File seekg failed";
+    in.close();
+    return FAILED;
+  }
+
+  std::vector<uint8_t> stored(blob_page->GetCompressedSize());
+  auto &io_read = in.read(reinterpret_cast<char *>(stored.data()), stored.size());
+  if (!io_read.good() || io_read.fail() || io_read.bad()) {
+    MS_LOG(ERROR) << "File read failed";
+    in.close();
+    return FAILED;
+  }
+  return ShardCompression::DecompressPage(shard_header_.GetPageCompression(), stored, blob_page->GetPageSize(),
+                                          blob_page_data);
+}
+
 void ShardIndexGenerator::AddIndexFieldByRawData(
   const std::vector<json> &schema_detail, std::vector<std::tuple<std::string, std::string, std::string>> &row_data) {
   auto result = GenerateIndexFields(schema_detail);
@@ -414,7 +450,8 @@ void ShardIndexGenerator::AddIndexFieldByRawData(
 }
 
 ROW_DATA ShardIndexGenerator::GenerateRowData(int shard_no, const std::map<int, int> &blob_id_to_page_id,
-                                              int raw_page_id, std::fstream &in) {
+                                              int raw_page_id, std::fstream &in,
+                                              const std::vector<std::vector<uint8_t>> &label_data) {
   std::vector<std::vector<std::tuple<std::string, std::string, std::string>>> full_data;
 
   // current raw data page
@@ -428,6 +465,13 @@ ROW_DATA ShardIndexGenerator::GenerateRowData(int shard_no, const std::map<int,
     // get blob data page according to row_group id
     std::shared_ptr<Page> cur_blob_page = shard_header_.GetPage(shard_no, blob_id_to_page_id.at(blob_ids.first)).first;
 
+    // the blob sizes of a compressed page are read from the decompressed page
+    std::vector<uint8_t> blob_page_data;
+    if (cur_blob_page->GetCompressedSize() > 0 &&
+        ReadCompressedBlobPage(cur_blob_page, in, &blob_page_data) != SUCCESS) {
+      return {FAILED, {}};
+    }
+
     // offset in current raw data page
     auto cur_raw_page_offset = static_cast<uint64_t>(blob_ids.second);
     uint64_t cur_blob_page_offset = 0;
@@ -442,7 +486,7 @@ ROW_DATA ShardIndexGenerator::GenerateRowData(int shard_no, const std::map<int,
 
       // calculate raw data end
       auto &io_seekg =
-        in.seekg(page_size_ * (cur_raw_page->GetPageID()) + header_size_ + cur_raw_page_offset, std::ios::beg);
+        in.seekg(cur_raw_page->GetPageOffset(header_size_, page_size_) + cur_raw_page_offset, std::ios::beg);
       if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
         MS_LOG(ERROR) << "File seekg failed";
         in.close();
@@ -473,8 +517,15 @@ ROW_DATA ShardIndexGenerator::GenerateRowData(int shard_no, const std::map<int,
         return {FAILED, {}};
       }
 
+      // the label columns are in the label pages
+      if (!label_data.empty() && !st_schema_detail.second.empty() &&
+          shard_column_->LabelToJson(label_data, i, {}, &st_schema_detail.second[0]) != SUCCESS) {
+        return {FAILED, {}};
+      }
+
       // start blob page info
-      if (AddBlobPageInfo(row_data, cur_blob_page, cur_blob_page_offset, in) != SUCCESS) {
+      if (AddBlobPageInfo(row_data, cur_blob_page, cur_blob_page_offset, in,
+                          cur_blob_page->GetCompressedSize() > 0 ? &blob_page_data : nullptr) != SUCCESS) {
         return {FAILED, {}};
       }
 
@@ -532,6 +583,15 @@ MSRStatus ShardIndexGenerator::ExecuteTransaction(const int &shard_no, std::pair
     MS_LOG(ERROR) << "Invalid file, failed to open file: " << shard_address;
     return FAILED;
   }
+  std::vector<std::vector<uint8_t>> label_data;
+  if (shard_column_->HasLabelColumn() &&
+      shard_column_->ReadLabelPages(&shard_header_, shard_no, &in, &label_data) != SUCCESS) {
+    MS_LOG(ERROR) << "Read label pages failed";
+    return FAILED;
+  }
+  auto binary_fields = GetBinaryIndexFields();
+  std::vector<INDEX_ROW> binary_rows;
+  std::vector<std::vector<std::string>> binary_values;
   (void)sqlite3_exec(db.second, "BEGIN TRANSACTION;", nullptr, nullptr, nullptr);
   for (int raw_page_id : raw_page_ids) {
     auto sql = GenerateRawSQL(fields_);
@@ -539,7 +599,7 @@ MSRStatus ShardIndexGenerator::ExecuteTransaction(const int &shard_no, std::pair
       MS_LOG(ERROR) << "Generate raw SQL failed";
       return FAILED;
     }
-    auto data = GenerateRowData(shard_no, blob_id_to_page_id, raw_page_id, in);
+    auto data = GenerateRowData(shard_no, blob_id_to_page_id, raw_page_id, in, label_data);
     if (data.first != SUCCESS) {
       MS_LOG(ERROR) << "Generate raw data failed";
       return FAILED;
@@ -549,9 +609,15 @@ MSRStatus ShardIndexGenerator::ExecuteTransaction(const int &shard_no, std::pair
       return FAILED;
     }
     MS_LOG(INFO) << "Insert " << data.second.size() << " rows to index db.";
+    if (binary_fields.first == SUCCESS) {
+      AddBinaryIndexRows(binary_fields.second, data.second, &binary_rows, &binary_values);
+    }
   }
   (void)sqlite3_exec(db.second, "END TRANSACTION;", nullptr, nullptr, nullptr);
   in.close();
+  if (binary_fields.first == SUCCESS) {
+    WriteBinaryIndex(shard_no, shard_address, binary_fields.second, &binary_rows, &binary_values);
+  }
 
   // Close database
   if (sqlite3_close(db.second) != SQLITE_OK) {
@@ -562,6 +628,96 @@ MSRStatus ShardIndexGenerator::ExecuteTransaction(const int &shard_no, std::pair
   return SUCCESS;
 }
 
+std::pair<MSRStatus, std::vector<std::pair<std::string, IndexKeyType>>> ShardIndexGenerator::GetBinaryIndexFields() {
+  std::vector<std::pair<std::string, IndexKeyType>> binary_fields;
+  for (const auto &field : fields_) {
+    auto result = shard_header_.GetSchemaByID(field.first);
+    if (result.second != SUCCESS) {
+      return {FAILED, {}};
+    }
+    auto ret = GenerateFieldName(field);
+    if (ret.first != SUCCESS) {
+      return {FAILED, {}};
+    }
+    std::string type = ConvertJsonToSQL(TakeFieldType(field.second, result.first->GetSchema()["schema"]));
+    if (type == "INTEGER") {
+      binary_fields.emplace_back(ret.second, kIndexKeyInt64);
+    } else if (type == "NUMERIC") {
+      binary_fields.emplace_back(ret.second, kIndexKeyDouble);
+    } else {
+      binary_fields.emplace_back(ret.second, kIndexKeyString);
+    }
+  }
+  return {SUCCESS, std::move(binary_fields)};
+}
+
+void ShardIndexGenerator::AddBinaryIndexRows(
+  const std::vector<std::pair<std::string, IndexKeyType>> &fields,
+  const std::vector<std::vector<std::tuple<std::string, std::string, std::string>>> &data,
+  std::vector<INDEX_ROW> *rows, std::vector<std::vector<std::string>> *values) {
+  static const std::map<std::string, int> kRowColumns = {
+    {":ROW_ID", kIndexRowId},
+    {":PAGE_ID_RAW", kIndexPageIdRaw},
+    {":PAGE_OFFSET_RAW", kIndexPageOffsetRaw},
+    {":PAGE_OFFSET_RAW_END", kIndexPageOffsetRawEnd},
+    {":ROW_GROUP_ID", kIndexRowGroupId},
+    {":PAGE_ID_BLOB", kIndexPageIdBlob},
+    {":PAGE_OFFSET_BLOB", kIndexPageOffsetBlob},
+    {":PAGE_OFFSET_BLOB_END", kIndexPageOffsetBlobEnd}};
+  std::map<std::string, int> field_ids;
+  for (size_t i = 0; i < fields.size(); ++i) {
+    field_ids[":" + fields[i].first] = static_cast<int>(i);
+  }
+  for (const auto &row_data : data) {
+    INDEX_ROW row{};
+    std::vector<std::string> row_values;
+    for (const auto &field : row_data) {
+      const auto &place_holder = std::get<0>(field);
+      auto column = kRowColumns.find(place_holder);
+      if (column != kRowColumns.end()) {
+        row[column->second] = std::stoull(std::get<2>(field));
+        continue;
+      }
+      auto field_id = field_ids.find(place_holder);
+      if (field_id != field_ids.end()) {
+        row_values.resize(fields.size());
+        row_values[field_id->second] = std::get<2>(field);
+      }
+    }
+    rows->push_back(row);
+    values->push_back(std::move(row_values));
+  }
+}
+
+void ShardIndexGenerator::WriteBinaryIndex(int shard_no, const std::string &shard_address,
+                                           const std::vector<std::pair<std::string, IndexKeyType>> &fields,
+                                           std::vector<INDEX_ROW> *rows,
+                                           std::vector<std::vector<std::string>> *values) {
+  // the binary index keeps the rows in row id order
+  std::vector<size_t> order(rows->size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  std::sort(order.begin(), order.end(),
+            [rows](size_t a, size_t b) { return (*rows)[a][kIndexRowId] < (*rows)[b][kIndexRowId]; });
+  std::vector<INDEX_ROW> sorted_rows;
+  std::vector<std::vector<std::string>> sorted_values;
+  sorted_rows.reserve(order.size());
+  sorted_values.reserve(order.size());
+  for (auto i : order) {
+    sorted_rows.push_back((*rows)[i]);
+    sorted_values.push_back(std::move((*values)[i]));
+  }
+  auto page_count = ShardBinaryIndex::CountPagesAndRows(&shard_header_, shard_no).first;
+  if (ShardBinaryIndex::Write(shard_address, page_count, fields, sorted_rows, sorted_values) != SUCCESS) {
+    // a stale binary index would not match the shard anyway, it is removed so that it is not loaded and checked
+    (void)remove(common::SafeCStr(shard_address + kBinaryIndexSuffix));
+    MS_LOG(WARNING) << "Failed to write binary index of shard: " << shard_address << ", sqlite index is used.";
+    return;
+  }
+  MS_LOG(INFO) << "Generate binary index for shard: " << shard_address << " successfully.";
+}
+
 MSRStatus ShardIndexGenerator::WriteToDatabase() {
   fields_ = shard_header_.GetFields();
   page_size_ = shard_header_.GetPageSize();
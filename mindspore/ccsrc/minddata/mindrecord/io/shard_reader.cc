@@ -35,6 +35,20 @@ Type StringToNum(const std::string &str) {
   return num;
 }
 
+// convert a value of the binary index to exactly the type of the field in schema, like StringToNum
+json ConvertIndexValue(const json &value, const std::string &type) {
+  if (type == "int32") {
+    return value.get<int32_t>();
+  } else if (type == "int64") {
+    return value.get<int64_t>();
+  } else if (type == "float32") {
+    return value.get<float>();
+  } else if (type == "float64") {
+    return value.get<double>();
+  }
+  return value;
+}
+
 ShardReader::ShardReader()
     : header_size_(0),
       page_size_(0),
@@ -44,7 +58,9 @@ ShardReader::ShardReader()
       num_rows_(0),
       total_blob_size_(0),
       task_id_(0),
-      deliver_id_(0) {}
+      deliver_id_(0),
+      read_ahead_(0),
+      read_ahead_id_(0) {}
 
 std::pair<MSRStatus, std::vector<std::string>> ShardReader::GetMeta(const std::string &file_path, json &meta_data) {
   if (!IsLegalFile(file_path)) {
@@ -97,6 +113,64 @@ MSRStatus ShardReader::Init(const std::vector<std::string> &file_paths, bool loa
       MS_LOG(ERROR) << "Mindrecord files meta information is different.";
       return FAILED;
     }
+  }
+  ShardHeader sh = ShardHeader();
+  if (sh.BuildDataset(file_paths_, load_dataset) == FAILED) {
+    return FAILED;
+  }
+  shard_header_ = std::make_shared<ShardHeader>(sh);
+  header_size_ = shard_header_->GetHeaderSize();
+  page_size_ = shard_header_->GetPageSize();
+  // version < 3.0
+  if (first_meta_data["version"] < kVersion) {
+    shard_column_ = std::make_shared<ShardColumn>(shard_header_, false);
+  } else {
+    shard_column_ = std::make_shared<ShardColumn>(shard_header_, true);
+  }
+  if (OpenIndexes() == FAILED) {
+    return FAILED;
+  }
+  if (shard_column_->HasLabelColumn() && ReadLabelPages() == FAILED) {
+    MS_LOG(ERROR) << "Read label pages failed.";
+    return FAILED;
+  }
+  num_rows_ = 0;
+  auto row_group_summary = ReadRowGroupSummary();
+  for (const auto &rg : row_group_summary) {
+    num_rows_ += std::get<3>(rg);
+  }
+  auto disk_size = page_size_ * row_group_summary.size();
+  auto compression_size = shard_header_->GetCompressionSize();
+  total_blob_size_ = disk_size + compression_size;
+  MS_LOG(INFO) << "Blob data size, on disk: " << disk_size << " , addtional uncompression: " << compression_size
+               << " , Total: " << total_blob_size_;
+
+  MS_LOG(INFO) << "Get meta from mindrecord file & index file successfully.";
+
+  return SUCCESS;
+}
+
+MSRStatus ShardReader::OpenIndexes() {
+  std::vector<std::string> field_names;
+  for (const auto &field : shard_header_->GetFields()) {
+    auto ret = ShardIndexGenerator::GenerateFieldName(field);
+    if (ret.first != SUCCESS) {
+      return FAILED;
+    }
+    field_names.push_back(ret.second);
+  }
+  for (size_t shard_id = 0; shard_id < file_paths_.size(); ++shard_id) {
+    const auto &file = file_paths_[shard_id];
+    // the binary index is used when it is there and matches the shard, the sqlite index otherwise
+    auto binary_index = std::make_shared<ShardBinaryIndex>();
+    auto counts = ShardBinaryIndex::CountPagesAndRows(shard_header_.get(), static_cast<int>(shard_id));
+    if (binary_index->Load(file, counts.first, counts.second, field_names) == SUCCESS) {
+      MS_LOG(DEBUG) << "Loaded binary index successfully";
+      binary_indexes_.push_back(binary_index);
+      database_paths_.push_back(nullptr);
+      continue;
+    }
+    binary_indexes_.push_back(nullptr);
     sqlite3 *db = nullptr;
     // sqlite3_open create a database if not found, use sqlite3_open_v2 instead of it
     int rc = sqlite3_open_v2(common::SafeCStr(file + ".db"), &db, SQLITE_OPEN_READONLY, nullptr);
@@ -129,33 +203,29 @@ MSRStatus ShardReader::Init(const std::vector<std::string> &file_paths, bool loa
     }
     database_paths_.push_back(db);
   }
-  ShardHeader sh = ShardHeader();
-  if (sh.BuildDataset(file_paths_, load_dataset) == FAILED) {
-    return FAILED;
-  }
-  shard_header_ = std::make_shared<ShardHeader>(sh);
-  header_size_ = shard_header_->GetHeaderSize();
-  page_size_ = shard_header_->GetPageSize();
-  // version < 3.0
-  if (first_meta_data["version"] < kVersion) {
-    shard_column_ = std::make_shared<ShardColumn>(shard_header_, false);
-  } else {
-    shard_column_ = std::make_shared<ShardColumn>(shard_header_, true);
+  return SUCCESS;
+}
+
+MSRStatus ShardReader::ReadLabelPages() {
+  label_data_ = std::vector<std::vector<std::vector<uint8_t>>>(file_paths_.size());
+  std::vector<MSRStatus> status(file_paths_.size(), FAILED);
+  std::vector<std::thread> threads = std::vector<std::thread>(file_paths_.size());
+  for (int x = 0; x < static_cast<int>(file_paths_.size()); x++) {
+    threads[x] = std::thread([this, x, &status]() {
+      std::fstream in;
+      in.open(common::SafeCStr(file_paths_[x]), std::ios::in | std::ios::binary);
+      if (!in.good()) {
+        MS_LOG(ERROR) << "Invalid file, failed to open file: " << file_paths_[x];
+        return;
+      }
+      status[x] = shard_column_->ReadLabelPages(shard_header_.get(), x, &in, &label_data_[x]);
+      in.close();
+    });
   }
-  num_rows_ = 0;
-  auto row_group_summary = ReadRowGroupSummary();
-  for (const auto &rg : row_group_summary) {
-    num_rows_ += std::get<3>(rg);
+  for (int x = 0; x < static_cast<int>(file_paths_.size()); x++) {
+    threads[x].join();
   }
-  auto disk_size = page_size_ * row_group_summary.size();
-  auto compression_size = shard_header_->GetCompressionSize();
-  total_blob_size_ = disk_size + compression_size;
-  MS_LOG(INFO) << "Blob data size, on disk: " << disk_size << " , addtional uncompression: " << compression_size
-               << " , Total: " << total_blob_size_;
-
-  MS_LOG(INFO) << "Get meta from mindrecord file & index file successfully.";
-
-  return SUCCESS;
+  return std::all_of(status.begin(), status.end(), [](MSRStatus rc) { return rc == SUCCESS; }) ? SUCCESS : FAILED;
 }
 
 MSRStatus ShardReader::CheckColumnList(const std::vector<std::string> &selected_columns) {
@@ -193,35 +263,49 @@ MSRStatus ShardReader::Open() {
 }
 
 MSRStatus ShardReader::Open(int n_consumer) {
-  file_streams_random_ =
-    std::vector<std::vector<std::shared_ptr<std::fstream>>>(n_consumer, std::vector<std::shared_ptr<std::fstream>>());
+  shard_files_.clear();
   for (const auto &file : file_paths_) {
-    for (int j = 0; j < n_consumer; ++j) {
-      std::shared_ptr<std::fstream> fs = std::make_shared<std::fstream>();
-      fs->open(common::SafeCStr(file), std::ios::in | std::ios::binary);
-      if (!fs->good()) {
-        MS_LOG(ERROR) << "Invalid file, failed to open file: " << file;
-        return FAILED;
-      }
-      file_streams_random_[j].push_back(fs);
+    std::shared_ptr<ShardFile> shard_file = std::make_shared<ShardFile>();
+    if (shard_file->Open(file) == FAILED) {
+      return FAILED;
     }
+    shard_files_.push_back(shard_file);
     MS_LOG(INFO) << "Open shard file successfully.";
   }
 
+  // The consumers share the decompressed chunks, each keeps the chunk of its row and of the next rows
+  page_reader_ = nullptr;
+  if (!shard_header_->GetPageCompression().empty()) {
+    page_reader_ = std::make_shared<ShardPageReader>(shard_header_->GetPageCompression(), header_size_, page_size_,
+                                                     kInt2 * std::max(n_consumer, kMinConsumerCount));
+  }
   return SUCCESS;
 }
 
+MSRStatus ShardReader::ReadBlob(const int &shard_id, const std::shared_ptr<Page> &page, const uint64_t &begin,
+                                const uint64_t &end, unsigned char *data) {
+  if (page->GetCompressedSize() > 0) {
+    if (page_reader_ == nullptr) {
+      MS_LOG(ERROR) << "Invalid data, page " << page->GetPageID() << " is compressed but no page compression is set.";
+      return FAILED;
+    }
+    return page_reader_->Read(shard_files_[shard_id], shard_id, page, begin, end, data);
+  }
+  auto file_offset = page->GetPageOffset(header_size_, page_size_) + begin;
+  return shard_files_[shard_id]->Read(file_offset, end - begin, data);
+}
+
+void ShardReader::SetReadAhead(const int64_t &read_ahead) { read_ahead_ = read_ahead > 0 ? read_ahead : 0; }
+
 void ShardReader::FileStreamsOperator() {
   for (int i = static_cast<int>(file_streams_.size()) - 1; i >= 0; --i) {
     if (file_streams_[i] != nullptr) {
       file_streams_[i]->close();
     }
   }
-  for (int i = static_cast<int>(file_streams_random_.size()) - 1; i >= 0; --i) {
-    for (int j = static_cast<int>(file_streams_random_[i].size()) - 1; j >= 0; --j) {
-      if (file_streams_random_[i][j] != nullptr) {
-        file_streams_random_[i][j]->close();
-      }
+  for (int i = static_cast<int>(shard_files_.size()) - 1; i >= 0; --i) {
+    if (shard_files_[i] != nullptr) {
+      shard_files_[i]->Close();
     }
   }
   for (int i = static_cast<int>(database_paths_.size()) - 1; i >= 0; --i) {
@@ -308,34 +392,21 @@ MSRStatus ShardReader::ConvertLabelToJson(const std::vector<std::vector<std::str
     offsets[shard_id].emplace_back(
       std::vector<uint64_t>{static_cast<uint64_t>(shard_id), group_id, offset_start, offset_end});
     if (!all_in_index_) {
-      int raw_page_id = std::stoi(labels[i][3]);
-      uint64_t label_start = std::stoull(labels[i][4]) + kInt64Len;
-      uint64_t label_end = std::stoull(labels[i][5]);
-      auto len = label_end - label_start;
-      auto label_raw = std::vector<uint8_t>(len);
-      auto &io_seekg = fs->seekg(page_size_ * raw_page_id + header_size_ + label_start, std::ios::beg);
-      if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
-        MS_LOG(ERROR) << "File seekg failed";
-        fs->close();
-        return FAILED;
-      }
-
-      auto &io_read = fs->read(reinterpret_cast<char *>(&label_raw[0]), len);
-      if (!io_read.good() || io_read.fail() || io_read.bad()) {
-        MS_LOG(ERROR) << "File read failed";
-        fs->close();
-        return FAILED;
+      // the label columns of files with label pages are read by row id when the task is consumed
+      uint32_t raw_field = kInt3;
+      if (shard_column_->HasLabelColumn()) {
+        offsets[shard_id].back().push_back(std::stoull(labels[i][raw_field++]));
+        if (labels[i].size() <= raw_field) {
+          column_values[shard_id].emplace_back(json());
+          continue;
+        }
       }
-      json label_json = json::from_msgpack(label_raw);
+      uint64_t raw_page_id = std::stoull(labels[i][raw_field]);
+      uint64_t label_start = std::stoull(labels[i][raw_field + 1]) + kInt64Len;
+      uint64_t label_end = std::stoull(labels[i][raw_field + 2]);
       json tmp;
-      if (!columns.empty()) {
-        for (auto &col : columns) {
-          if (label_json.find(col) != label_json.end()) {
-            tmp[col] = label_json[col];
-          }
-        }
-      } else {
-        tmp = label_json;
+      if (ReadLabelFromRawPage(fs, shard_id, raw_page_id, label_start, label_end, columns, &tmp) == FAILED) {
+        return FAILED;
       }
       column_values[shard_id].emplace_back(tmp);
     } else {
@@ -364,9 +435,100 @@ MSRStatus ShardReader::ConvertLabelToJson(const std::vector<std::vector<std::str
   return SUCCESS;
 }
 
-MSRStatus ShardReader::ReadAllRowsInShard(int shard_id, const std::string &sql, const std::vector<std::string> &columns,
+MSRStatus ShardReader::ReadLabelFromRawPage(std::shared_ptr<std::fstream> fs, int shard_id, uint64_t raw_page_id,
+                                            uint64_t label_start, uint64_t label_end,
+                                            const std::vector<std::string> &columns, json *label) {
+  auto len = label_end - label_start;
+  auto label_raw = std::vector<uint8_t>(len);
+  auto &io_seekg = fs->seekg(shard_header_->GetPageOffset(shard_id, raw_page_id) + label_start, std::ios::beg);
+  if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
+    MS_LOG(ERROR) << "File seekg failed";
+    fs->close();
+    return FAILED;
+  }
+
+  auto &io_read = fs->read(reinterpret_cast<char *>(&label_raw[0]), len);
+  if (!io_read.good() || io_read.fail() || io_read.bad()) {
+    MS_LOG(ERROR) << "File read failed";
+    fs->close();
+    return FAILED;
+  }
+  json label_json = json::from_msgpack(label_raw);
+  if (!columns.empty()) {
+    for (auto &col : columns) {
+      if (label_json.find(col) != label_json.end()) {
+        (*label)[col] = label_json[col];
+      }
+    }
+  } else {
+    *label = std::move(label_json);
+  }
+  return SUCCESS;
+}
+
+MSRStatus ShardReader::ReadAllRowsInBinaryIndex(int shard_id, bool read_raw, const std::vector<std::string> &columns,
+                                                std::vector<std::vector<std::vector<uint64_t>>> &offsets,
+                                                std::vector<std::vector<json>> &column_values) {
+  const auto &binary_index = binary_indexes_[shard_id];
+  std::vector<int> field_ids;
+  std::vector<std::string> field_types;
+  if (all_in_index_) {
+    auto schema = shard_header_->GetSchemas()[0]->GetSchema()["schema"];
+    for (const auto &col : columns) {
+      auto ret = ShardIndexGenerator::GenerateFieldName(std::make_pair(column_schema_id_[col], col));
+      if (ret.first != SUCCESS || binary_index->GetFieldId(ret.second) < 0) {
+        MS_LOG(ERROR) << "Index field " << col << " is not in the binary index of shard " << shard_id;
+        return FAILED;
+      }
+      field_ids.push_back(binary_index->GetFieldId(ret.second));
+      field_types.push_back(schema[col]["type"]);
+    }
+  }
+
+  std::string file_name = file_paths_[shard_id];
+  std::shared_ptr<std::fstream> fs = std::make_shared<std::fstream>();
+  if (read_raw) {
+    fs->open(common::SafeCStr(file_name), std::ios::in | std::ios::binary);
+    if (!fs->good()) {
+      MS_LOG(ERROR) << "Invalid file, failed to open file: " << file_name;
+      return FAILED;
+    }
+  }
+  for (uint64_t i = 0; i < binary_index->GetRowCount(); ++i) {
+    const uint64_t *row = binary_index->GetRow(i);
+    offsets[shard_id].emplace_back(std::vector<uint64_t>{static_cast<uint64_t>(shard_id), row[kIndexRowGroupId],
+                                                         row[kIndexPageOffsetBlob] + kInt64Len,
+                                                         row[kIndexPageOffsetBlobEnd]});
+    if (all_in_index_) {
+      json construct_json;
+      for (size_t j = 0; j < columns.size(); ++j) {
+        construct_json[columns[j]] = ConvertIndexValue(binary_index->GetValue(field_ids[j], i), field_types[j]);
+      }
+      column_values[shard_id].emplace_back(construct_json);
+      continue;
+    }
+    // the label columns of files with label pages are read by row id when the task is consumed
+    if (shard_column_->HasLabelColumn()) {
+      offsets[shard_id].back().push_back(row[kIndexRowId]);
+    }
+    json label;
+    if (read_raw && ReadLabelFromRawPage(fs, shard_id, row[kIndexPageIdRaw], row[kIndexPageOffsetRaw] + kInt64Len,
+                                         row[kIndexPageOffsetRawEnd], columns, &label) == FAILED) {
+      return FAILED;
+    }
+    column_values[shard_id].emplace_back(label);
+  }
+  MS_LOG(INFO) << "Get " << binary_index->GetRowCount() << " records from shard " << shard_id << " binary index.";
+  return SUCCESS;
+}
+
+MSRStatus ShardReader::ReadAllRowsInShard(int shard_id, const std::string &sql, bool read_raw,
+                                          const std::vector<std::string> &columns,
                                           std::vector<std::vector<std::vector<uint64_t>>> &offsets,
                                           std::vector<std::vector<json>> &column_values) {
+  if (binary_indexes_[shard_id] != nullptr) {
+    return ReadAllRowsInBinaryIndex(shard_id, read_raw, columns, offsets, column_values);
+  }
   auto db = database_paths_[shard_id];
   std::vector<std::vector<std::string>> labels;
   char *errmsg = nullptr;
@@ -409,15 +571,38 @@ MSRStatus ShardReader::GetAllClasses(const std::string &category_field, std::set
   std::string sql = "SELECT DISTINCT " + ret.second + " FROM INDEXES";
   std::vector<std::thread> threads = std::vector<std::thread>(shard_count_);
   for (int x = 0; x < shard_count_; x++) {
-    threads[x] = std::thread(&ShardReader::GetClassesInShard, this, database_paths_[x], x, sql, std::ref(categories));
+    if (binary_indexes_[x] != nullptr) {
+      GetClassesInBinaryIndex(x, ret.second, categories);
+    } else {
+      threads[x] = std::thread(&ShardReader::GetClassesInShard, this, database_paths_[x], x, sql, std::ref(categories));
+    }
   }
 
   for (int x = 0; x < shard_count_; x++) {
-    threads[x].join();
+    if (threads[x].joinable()) {
+      threads[x].join();
+    }
   }
   return SUCCESS;
 }
 
+void ShardReader::GetClassesInBinaryIndex(int shard_id, const std::string &field_name,
+                                          std::set<std::string> &categories) {
+  const auto &binary_index = binary_indexes_[shard_id];
+  int field_id = binary_index->GetFieldId(field_name);
+  if (field_id < 0) {
+    MS_LOG(ERROR) << "Index field " << field_name << " is not in the binary index of shard " << shard_id;
+    return;
+  }
+  std::map<std::string, int> counter;
+  binary_index->CountValues(field_id, &counter);
+  MS_LOG(INFO) << "Get " << counter.size() << " classes from shard " << shard_id << " binary index.";
+  std::lock_guard<std::mutex> lck(shard_locker_);
+  for (const auto &item : counter) {
+    categories.emplace(item.first);
+  }
+}
+
 void ShardReader::GetClassesInShard(sqlite3 *db, int shard_id, const std::string sql,
                                     std::set<std::string> &categories) {
   if (nullptr == db) {
@@ -442,6 +627,7 @@ void ShardReader::GetClassesInShard(sqlite3 *db, int shard_id, const std::string
 
 ROW_GROUPS ShardReader::ReadAllRowGroup(std::vector<std::string> &columns) {
   std::string fields = "ROW_GROUP_ID, PAGE_OFFSET_BLOB, PAGE_OFFSET_BLOB_END";
+  bool read_raw = false;
   std::vector<std::vector<std::vector<uint64_t>>> offsets(shard_count_, std::vector<std::vector<uint64_t>>{});
   std::vector<std::vector<json>> column_values(shard_count_, std::vector<json>{});
   if (all_in_index_) {
@@ -453,16 +639,29 @@ ROW_GROUPS ShardReader::ReadAllRowGroup(std::vector<std::string> &columns) {
       }
       fields += ret.second;
     }
+  } else if (shard_column_->HasLabelColumn()) {  // fetch the labels from label pages by row id
+    fields += ", ROW_ID";
+    auto loaded_columns = columns.empty() ? shard_column_->GetColumnName() : columns;
+    auto blob_fields = GetBlobFields().second;
+    // raw page is only read when some loaded column is neither in label pages nor in blob pages
+    if (std::any_of(loaded_columns.begin(), loaded_columns.end(), [this, &blob_fields](const std::string &col) {
+          return !shard_column_->IsLabelColumn(col) &&
+                 std::find(blob_fields.begin(), blob_fields.end(), col) == blob_fields.end();
+        })) {
+      fields += ", PAGE_ID_RAW, PAGE_OFFSET_RAW, PAGE_OFFSET_RAW_END ";
+      read_raw = true;
+    }
   } else {  // fetch raw data from Raw page while some field is not index.
     fields += ", PAGE_ID_RAW, PAGE_OFFSET_RAW, PAGE_OFFSET_RAW_END ";
+    read_raw = true;
   }
 
   std::string sql = "SELECT " + fields + " FROM INDEXES ORDER BY ROW_ID ;";
 
   std::vector<std::thread> thread_read_db = std::vector<std::thread>(shard_count_);
   for (int x = 0; x < shard_count_; x++) {
-    thread_read_db[x] =
-      std::thread(&ShardReader::ReadAllRowsInShard, this, x, sql, columns, std::ref(offsets), std::ref(column_values));
+    thread_read_db[x] = std::thread(&ShardReader::ReadAllRowsInShard, this, x, sql, read_raw, columns,
+                                    std::ref(offsets), std::ref(column_values));
   }
 
   for (int x = 0; x < shard_count_; x++) {
@@ -479,7 +678,7 @@ ROW_GROUP_BRIEF ShardReader::ReadRowGroupBrief(int group_id, int shard_id, const
   const std::shared_ptr<Page> &page = ret.second;
   std::string file_name = file_paths_[shard_id];
   uint64_t page_length = page->GetPageSize();
-  uint64_t page_offset = page_size_ * page->GetPageID() + header_size_;
+  uint64_t page_offset = page->GetPageOffset(header_size_, page_size_);
   std::vector<std::vector<uint64_t>> image_offset = GetImageOffset(page->GetPageID(), shard_id);
 
   auto status_labels = GetLabels(page->GetPageID(), shard_id, columns);
@@ -504,7 +703,7 @@ ROW_GROUP_BRIEF ShardReader::ReadRowGroupCriteria(int group_id, int shard_id,
   const std::shared_ptr<Page> &page = ret.second;
   std::string file_name = file_paths_[shard_id];
   uint64_t page_length = page->GetPageSize();
-  uint64_t page_offset = page_size_ * page->GetPageID() + header_size_;
+  uint64_t page_offset = page->GetPageOffset(header_size_, page_size_);
   std::vector<std::vector<uint64_t>> image_offset = GetImageOffset(page->GetPageID(), shard_id, criteria);
 
   auto status_labels = GetLabels(page->GetPageID(), shard_id, columns, criteria);
@@ -528,6 +727,18 @@ int ShardReader::SelectCallback(void *p_data, int num_fields, char **p_fields, c
 
 std::vector<std::vector<uint64_t>> ShardReader::GetImageOffset(int page_id, int shard_id,
                                                                const std::pair<std::string, std::string> &criteria) {
+  if (binary_indexes_[shard_id] != nullptr) {
+    std::vector<uint64_t> rows;
+    if (GetRowsOfPage(page_id, shard_id, criteria, &rows) == FAILED) {
+      return std::vector<std::vector<uint64_t>>();
+    }
+    std::vector<std::vector<uint64_t>> res;
+    for (auto row_no : rows) {
+      const uint64_t *row = binary_indexes_[shard_id]->GetRow(row_no);
+      res.emplace_back(std::vector<uint64_t>{row[kIndexPageOffsetBlob] + kInt64Len, row[kIndexPageOffsetBlobEnd]});
+    }
+    return res;
+  }
   auto db = database_paths_[shard_id];
 
   std::string sql =
@@ -598,6 +809,22 @@ void ShardReader::CheckIfColumnInIndex(const std::vector<std::string> &columns)
   }
 }
 
+MSRStatus ShardReader::GetRowsOfPage(int page_id, int shard_id, const std::pair<std::string, std::string> &criteria,
+                                     std::vector<uint64_t> *rows) {
+  const auto &binary_index = binary_indexes_[shard_id];
+  int field_id = -1;
+  if (!criteria.first.empty()) {
+    field_id = binary_index->GetFieldId(criteria.first + "_" + std::to_string(column_schema_id_[criteria.first]));
+    if (field_id < 0) {
+      MS_LOG(ERROR) << "Index field " << criteria.first << " is not in the binary index of shard " << shard_id;
+      return FAILED;
+    }
+  }
+  binary_index->GetRowsOfPage(page_id, field_id, criteria.second, rows);
+  MS_LOG(DEBUG) << "Get " << rows->size() << " records from binary index.";
+  return SUCCESS;
+}
+
 MSRStatus ShardReader::QueryWithCriteria(sqlite3 *db, string &sql, string criteria,
                                          std::vector<std::vector<std::string>> &labels) {
   sqlite3_stmt *stmt = nullptr;
@@ -625,7 +852,7 @@ MSRStatus ShardReader::QueryWithCriteria(sqlite3 *db, string &sql, string criter
 }
 
 std::pair<MSRStatus, std::vector<json>> ShardReader::GetLabelsFromBinaryFile(
-  int shard_id, const std::vector<std::string> &columns, const std::vector<std::vector<std::string>> &label_offsets) {
+  int shard_id, const std::vector<std::string> &columns, const std::vector<std::vector<uint64_t>> &label_offsets) {
   std::string file_name = file_paths_[shard_id];
   std::vector<json> res;
   std::shared_ptr<std::fstream> fs = std::make_shared<std::fstream>();
@@ -642,12 +869,12 @@ std::pair<MSRStatus, std::vector<json>> ShardReader::GetLabelsFromBinaryFile(
 
   for (unsigned int i = 0; i < label_offsets.size(); ++i) {
     const auto &labelOffset = label_offsets[i];
-    uint64_t label_start = std::stoull(labelOffset[1]) + kInt64Len;
-    uint64_t label_end = std::stoull(labelOffset[2]);
-    int raw_page_id = std::stoi(labelOffset[0]);
+    uint64_t label_start = labelOffset[1] + kInt64Len;
+    uint64_t label_end = labelOffset[2];
+    uint64_t raw_page_id = labelOffset[0];
     auto len = label_end - label_start;
     auto label_raw = std::vector<uint8_t>(len);
-    auto &io_seekg = fs->seekg(page_size_ * raw_page_id + header_size_ + label_start, std::ios::beg);
+    auto &io_seekg = fs->seekg(shard_header_->GetPageOffset(shard_id, raw_page_id) + label_start, std::ios::beg);
     if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
       MS_LOG(ERROR) << "File seekg failed";
       fs->close();
@@ -668,6 +895,11 @@ std::pair<MSRStatus, std::vector<json>> ShardReader::GetLabelsFromBinaryFile(
         tmp[col] = label_json[col];
       }
     }
+    if (shard_column_->HasLabelColumn() && labelOffset.size() > kInt3 &&
+        shard_column_->LabelToJson(label_data_[shard_id], labelOffset[kInt3], {}, &tmp) == FAILED) {
+      fs->close();
+      return {FAILED, {}};
+    }
     res[i] = tmp;
   }
   return {SUCCESS, res};
@@ -676,10 +908,28 @@ std::pair<MSRStatus, std::vector<json>> ShardReader::GetLabelsFromBinaryFile(
 std::pair<MSRStatus, std::vector<json>> ShardReader::GetLabelsFromPage(
   int page_id, int shard_id, const std::vector<std::string> &columns,
   const std::pair<std::string, std::string> &criteria) {
+  if (binary_indexes_[shard_id] != nullptr) {
+    std::vector<uint64_t> rows;
+    if (GetRowsOfPage(page_id, shard_id, criteria, &rows) == FAILED) {
+      return {FAILED, {}};
+    }
+    std::vector<std::vector<uint64_t>> label_offsets;
+    for (auto row_no : rows) {
+      const uint64_t *row = binary_indexes_[shard_id]->GetRow(row_no);
+      label_offsets.emplace_back(
+        std::vector<uint64_t>{row[kIndexPageIdRaw], row[kIndexPageOffsetRaw], row[kIndexPageOffsetRawEnd]});
+      if (shard_column_->HasLabelColumn()) {
+        label_offsets.back().push_back(row[kIndexRowId]);
+      }
+    }
+    return GetLabelsFromBinaryFile(shard_id, columns, label_offsets);
+  }
+
   // get page info from sqlite
   auto db = database_paths_[shard_id];
-  std::string sql = "SELECT PAGE_ID_RAW, PAGE_OFFSET_RAW,PAGE_OFFSET_RAW_END FROM INDEXES WHERE PAGE_ID_BLOB = " +
-                    std::to_string(page_id);
+  std::string sql = "SELECT PAGE_ID_RAW, PAGE_OFFSET_RAW,PAGE_OFFSET_RAW_END" +
+                    std::string(shard_column_->HasLabelColumn() ? ", ROW_ID" : "") +
+                    " FROM INDEXES WHERE PAGE_ID_BLOB = " + std::to_string(page_id);
   std::vector<std::vector<std::string>> label_offsets;
   if (!criteria.first.empty()) {
     sql += " AND " + criteria.first + "_" + std::to_string(column_schema_id_[criteria.first]) + " = :criteria";
@@ -701,12 +951,45 @@ std::pair<MSRStatus, std::vector<json>> ShardReader::GetLabelsFromPage(
     sqlite3_free(errmsg);
   }
   // get labels from binary file
-  return GetLabelsFromBinaryFile(shard_id, columns, label_offsets);
+  std::vector<std::vector<uint64_t>> offsets;
+  for (const auto &label_offset : label_offsets) {
+    offsets.emplace_back();
+    for (const auto &offset : label_offset) {
+      offsets.back().push_back(std::stoull(offset));
+    }
+  }
+  return GetLabelsFromBinaryFile(shard_id, columns, offsets);
 }
 
 std::pair<MSRStatus, std::vector<json>> ShardReader::GetLabels(int page_id, int shard_id,
                                                                const std::vector<std::string> &columns,
                                                                const std::pair<std::string, std::string> &criteria) {
+  if (all_in_index_ && binary_indexes_[shard_id] != nullptr) {
+    const auto &binary_index = binary_indexes_[shard_id];
+    std::vector<uint64_t> rows;
+    if (GetRowsOfPage(page_id, shard_id, criteria, &rows) == FAILED) {
+      return {FAILED, {}};
+    }
+    auto schema = shard_header_->GetSchemas()[0]->GetSchema()["schema"];
+    std::vector<int> field_ids;
+    for (const auto &col : columns) {
+      field_ids.push_back(binary_index->GetFieldId(col + "_" + std::to_string(column_schema_id_[col])));
+      if (field_ids.back() < 0) {
+        MS_LOG(ERROR) << "Index field " << col << " is not in the binary index of shard " << shard_id;
+        return {FAILED, {}};
+      }
+    }
+    std::vector<json> ret;
+    for (auto row_no : rows) {
+      json construct_json;
+      for (unsigned int j = 0; j < columns.size(); ++j) {
+        construct_json[columns[j]] =
+          ConvertIndexValue(binary_index->GetValue(field_ids[j], row_no), schema[columns[j]]["type"]);
+      }
+      ret.push_back(std::move(construct_json));
+    }
+    return {SUCCESS, ret};
+  }
   if (all_in_index_) {
     auto db = database_paths_[shard_id];
     std::string fields;
@@ -792,6 +1075,10 @@ int64_t ShardReader::GetNumClasses(const std::string &category_field) {
   std::vector<std::thread> threads = std::vector<std::thread>(shard_count);
   std::set<std::string> categories;
   for (int x = 0; x < shard_count; x++) {
+    if (binary_indexes_[x] != nullptr) {
+      GetClassesInBinaryIndex(x, ret.second, categories);
+      continue;
+    }
     sqlite3 *db = nullptr;
     int rc = sqlite3_open_v2(common::SafeCStr(file_paths_[x] + ".db"), &db, SQLITE_OPEN_READONLY, nullptr);
     if (SQLITE_OK != rc) {
@@ -803,7 +1090,9 @@ int64_t ShardReader::GetNumClasses(const std::string &category_field) {
   }
 
   for (int x = 0; x < shard_count; x++) {
-    threads[x].join();
+    if (threads[x].joinable()) {
+      threads[x].join();
+    }
   }
   return categories.size();
 }
@@ -1033,6 +1322,10 @@ MSRStatus ShardReader::CreateTasksByCategory(const std::vector<std::tuple<int, i
 MSRStatus ShardReader::CreateTasksByRow(const std::vector<std::tuple<int, int, int, uint64_t>> &row_group_summary,
                                         const std::vector<std::shared_ptr<ShardOperator>> &operators) {
   CheckIfColumnInIndex(selected_columns_);
+  // typed label pages are cheaper to read than the string values of the index
+  if (shard_column_->HasLabelColumn()) {
+    all_in_index_ = false;
+  }
 
   auto ret = ReadAllRowGroup(selected_columns_);
   if (std::get<0>(ret) != SUCCESS) {
@@ -1044,7 +1337,7 @@ MSRStatus ShardReader::CreateTasksByRow(const std::vector<std::tuple<int, int, i
     for (int shard_id = 0; shard_id < shard_count_; shard_id++) {
       for (uint32_t i = 0; i < offsets[shard_id].size(); i += 1) {
         tasks_.InsertTask(TaskType::kCommonTask, offsets[shard_id][i][0], offsets[shard_id][i][1],
-                          std::vector<uint64_t>{offsets[shard_id][i][2], offsets[shard_id][i][3]},
+                          std::vector<uint64_t>(offsets[shard_id][i].begin() + kInt2, offsets[shard_id][i].end()),
                           local_columns[shard_id][i]);
       }
     }
@@ -1093,7 +1386,8 @@ MSRStatus ShardReader::CreateTasks(const std::vector<std::tuple<int, int, int, u
   return SUCCESS;
 }
 
-TASK_RETURN_CONTENT ShardReader::ConsumerOneTask(int task_id, uint32_t consumer_id) {
+TASK_RETURN_CONTENT ShardReader::ConsumerOneTask(int task_id, uint32_t consumer_id,
+                                                 std::vector<uint8_t> *columns_label) {
   // All tasks are done
   if (task_id >= static_cast<int>(tasks_.Size())) {
     return std::make_pair(FAILED,
@@ -1120,34 +1414,85 @@ TASK_RETURN_CONTENT ShardReader::ConsumerOneTask(int task_id, uint32_t consumer_
   }
   const std::shared_ptr<Page> &page = ret.second;
 
+  ReadAheadTasks(task_id);
+
   // Pack image list
   std::vector<uint8_t> images(addr[1] - addr[0]);
-  auto file_offset = header_size_ + page_size_ * (page->GetPageID()) + addr[0];
-
-  auto &io_seekg = file_streams_random_[consumer_id][shard_id]->seekg(file_offset, std::ios::beg);
-  if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
-    MS_LOG(ERROR) << "File seekg failed";
-    file_streams_random_[consumer_id][shard_id]->close();
+  if (ReadBlob(shard_id, page, addr[0], addr[1], images.data()) == FAILED) {
     return std::make_pair(FAILED,
                           std::make_pair(TaskType::kCommonTask, std::vector<std::tuple<std::vector<uint8_t>, json>>()));
   }
 
-  auto &io_read =
-    file_streams_random_[consumer_id][shard_id]->read(reinterpret_cast<char *>(&images[0]), addr[1] - addr[0]);
-  if (!io_read.good() || io_read.fail() || io_read.bad()) {
-    MS_LOG(ERROR) << "File read failed";
-    file_streams_random_[consumer_id][shard_id]->close();
-    return std::make_pair(FAILED,
-                          std::pair(TaskType::kCommonTask, std::vector<std::tuple<std::vector<uint8_t>, json>>()));
+  // Fetch the label columns of files with label pages by row id
+  json label = std::move(std::get<3>(task));
+  if (addr.size() > kInt2) {
+    MSRStatus rc = SUCCESS;
+    if (columns_label != nullptr) {
+      rc = shard_column_->GetLabelRow(label_data_[shard_id], addr[2], columns_label);
+    } else {
+      rc = shard_column_->LabelToJson(label_data_[shard_id], addr[2], selected_columns_, &label);
+    }
+    if (rc != SUCCESS) {
+      return std::make_pair(
+        FAILED, std::make_pair(TaskType::kCommonTask, std::vector<std::tuple<std::vector<uint8_t>, json>>()));
+    }
   }
 
   // Deliver batch data to output map
   std::vector<std::tuple<std::vector<uint8_t>, json>> batch;
-  batch.emplace_back(std::move(images), std::move(std::get<3>(task)));
+  batch.emplace_back(std::move(images), std::move(label));
 
   return std::make_pair(SUCCESS, std::make_pair(TaskType::kCommonTask, std::move(batch)));
 }
 
+void ShardReader::ReadAheadTasks(int task_id) {
+  if (read_ahead_ <= 0) {
+    return;
+  }
+  // Take the tasks not read ahead yet, the consumer that moves the window issues their reads
+  int64_t end = std::min(static_cast<int64_t>(task_id) + 1 + read_ahead_, static_cast<int64_t>(tasks_.Size()));
+  int64_t start = read_ahead_id_.load();
+  do {
+    if (start >= end) {
+      return;
+    }
+  } while (!read_ahead_id_.compare_exchange_weak(start, end));
+  start = std::max(start, static_cast<int64_t>(task_id) + 1);
+
+  // Blobs stored one after another in a shard are read ahead at once, whole pages when the tasks are in order
+  int run_shard_id = -1;
+  uint64_t run_start = 0;
+  uint64_t run_end = 0;
+  for (int64_t i = start; i < end; ++i) {
+    const auto &task = tasks_.GetTaskByID(tasks_.permutation_[i]);
+    if (std::get<0>(task) != TaskType::kCommonTask) continue;
+    auto shard_id = std::get<0>(std::get<1>(task));
+    const auto &addr = std::get<2>(task);
+    const auto &ret = shard_header_->GetPageByGroupId(std::get<1>(std::get<1>(task)), shard_id);
+    if (ret.first != SUCCESS) continue;
+    auto blob_start = ret.second->GetPageOffset(header_size_, page_size_) + addr[0];
+    auto blob_end = blob_start + addr[1] - addr[0];
+    if (ret.second->GetCompressedSize() > 0) {
+      // The offsets are the ones in the decompressed page, the whole compressed page is read ahead
+      blob_start = ret.second->GetPageOffset(header_size_, page_size_);
+      blob_end = blob_start + ret.second->GetCompressedSize();
+    }
+    if (shard_id == run_shard_id && blob_start >= run_start && blob_start <= run_end) {
+      run_end = std::max(run_end, blob_end);
+      continue;
+    }
+    if (run_shard_id >= 0) {
+      shard_files_[run_shard_id]->ReadAhead(run_start, run_end - run_start);
+    }
+    run_shard_id = shard_id;
+    run_start = blob_start;
+    run_end = blob_end;
+  }
+  if (run_shard_id >= 0) {
+    shard_files_[run_shard_id]->ReadAhead(run_start, run_end - run_start);
+  }
+}
+
 MSRStatus ShardReader::ConsumerByRow(int consumer_id) {
   // Set thread name
 #if !defined(_WIN32) && !defined(_WIN64)
@@ -1211,10 +1556,18 @@ std::vector<std::tuple<std::vector<uint8_t>, json>> ShardReader::GetNext() {
 
 std::pair<TaskType, std::vector<std::tuple<std::vector<uint8_t>, json>>> ShardReader::GetNextById(
   const int64_t &task_id, const int32_t &consumer_id) {
+  return GetNextById(task_id, consumer_id, nullptr);
+}
+
+std::pair<TaskType, std::vector<std::tuple<std::vector<uint8_t>, json>>> ShardReader::GetNextById(
+  const int64_t &task_id, const int32_t &consumer_id, std::vector<uint8_t> *columns_label) {
   if (interrupt_) {
     return std::make_pair(TaskType::kCommonTask, std::vector<std::tuple<std::vector<uint8_t>, json>>());
   }
-  const auto &ret = ConsumerOneTask(task_id, consumer_id);
+  if (columns_label != nullptr) {
+    columns_label->clear();
+  }
+  const auto &ret = ConsumerOneTask(task_id, consumer_id, columns_label);
   if (SUCCESS != ret.first) {
     return std::make_pair(TaskType::kCommonTask, std::vector<std::tuple<std::vector<uint8_t>, json>>());
   }
@@ -1263,6 +1616,7 @@ void ShardReader::Reset() {
     std::lock_guard<std::mutex> lck(mtx_delivery_);
     task_id_ = 0;
     deliver_id_ = 0;
+    read_ahead_id_ = 0;
   }
   cv_delivery_.notify_all();
 }
@@ -1287,6 +1641,7 @@ void ShardReader::ShuffleTask() {
     }
   }
   if (tasks_.permutation_.empty()) tasks_.MakePerm();
+  read_ahead_id_ = 0;
 }
 
 }  // namespace mindrecord
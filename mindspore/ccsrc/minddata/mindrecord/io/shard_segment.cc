@@ -34,6 +34,11 @@ std::pair<MSRStatus, vector<std::string>> ShardSegment::GetCategoryFields() {
   // Skip if already populated
   if (!candidate_category_fields_.empty()) return {SUCCESS, candidate_category_fields_};
 
+  if (binary_indexes_[0] != nullptr) {
+    candidate_category_fields_ = binary_indexes_[0]->GetFieldNames();
+    return {SUCCESS, candidate_category_fields_};
+  }
+
   std::string sql = "PRAGMA table_info(INDEXES);";
   std::vector<std::vector<std::string>> field_names;
 
@@ -100,7 +105,17 @@ std::pair<MSRStatus, std::vector<std::tuple<int, std::string, int>>> ShardSegmen
   std::string sql = "SELECT " + current_category_field_ + ", COUNT(" + current_category_field_ +
                     ") AS `value_occurrence` FROM indexes GROUP BY " + current_category_field_ + ";";
 
-  for (auto &db : database_paths_) {
+  for (size_t shard_id = 0; shard_id < database_paths_.size(); ++shard_id) {
+    if (binary_indexes_[shard_id] != nullptr) {
+      int field_id = binary_indexes_[shard_id]->GetFieldId(current_category_field_);
+      if (field_id < 0) {
+        MS_LOG(ERROR) << "Field " << current_category_field_ << " is not in the binary index of shard " << shard_id;
+        return {FAILED, std::vector<std::tuple<int, std::string, int>>()};
+      }
+      binary_indexes_[shard_id]->CountValues(field_id, &counter);
+      continue;
+    }
+    auto &db = database_paths_[shard_id];
     std::vector<std::vector<std::string>> field_count;
 
     char *errmsg = nullptr;
@@ -214,18 +229,7 @@ std::pair<MSRStatus, std::vector<uint8_t>> ShardSegment::PackImages(int group_id
 
   // Pack image list
   std::vector<uint8_t> images(offset[1] - offset[0]);
-  auto file_offset = header_size_ + page_size_ * (blob_page->GetPageID()) + offset[0];
-  auto &io_seekg = file_streams_random_[0][shard_id]->seekg(file_offset, std::ios::beg);
-  if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
-    MS_LOG(ERROR) << "File seekg failed";
-    file_streams_random_[0][shard_id]->close();
-    return {FAILED, {}};
-  }
-
-  auto &io_read = file_streams_random_[0][shard_id]->read(reinterpret_cast<char *>(&images[0]), offset[1] - offset[0]);
-  if (!io_read.good() || io_read.fail() || io_read.bad()) {
-    MS_LOG(ERROR) << "File read failed";
-    file_streams_random_[0][shard_id]->close();
+  if (ReadBlob(shard_id, blob_page, offset[0], offset[1], images.data()) == FAILED) {
     return {FAILED, {}};
   }
 
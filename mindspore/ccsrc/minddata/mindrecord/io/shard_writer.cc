@@ -15,6 +15,7 @@
  */
 
 #include "minddata/mindrecord/include/shard_writer.h"
+#include "minddata/mindrecord/include/shard_binary_index.h"
 #include "utils/ms_utils.h"
 #include "minddata/mindrecord/include/common/shard_utils.h"
 #include "./securec.h"
@@ -28,11 +29,22 @@ using mindspore::MsLogLevel::INFO;
 namespace mindspore {
 namespace mindrecord {
 ShardWriter::ShardWriter()
-    : shard_count_(1), header_size_(kDefaultHeaderSize), page_size_(kDefaultPageSize), row_count_(0), schema_count_(1) {
+    : shard_count_(1),
+      header_size_(kDefaultHeaderSize),
+      page_size_(kDefaultPageSize),
+      row_count_(0),
+      schema_count_(1),
+      columnar_label_(false),
+      page_compression_(kPageCompressionNone),
+      page_compression_level_(kDefaultPageCompressionLevel) {
   compression_size_ = 0;
+  num_workers_ = static_cast<int>(std::thread::hardware_concurrency());
+  if (num_workers_ <= 0) num_workers_ = kThreadNumber;
+  num_workers_ = std::min(num_workers_, kMaxThreadCount);
 }
 
 ShardWriter::~ShardWriter() {
+  (void)WaitForWriter(true);
   for (int i = static_cast<int>(file_streams_.size()) - 1; i >= 0; i--) {
     file_streams_[i]->close();
   }
@@ -93,6 +105,10 @@ MSRStatus ShardWriter::OpenDataFiles(bool append) {
         MS_LOG(ERROR) << "MindRecord file could not opened: " << file;
         return FAILED;
       }
+      // a binary index left by a former file of the same name does not match the new file, remove it
+      if (std::remove(common::SafeCStr(file + kBinaryIndexSuffix)) == 0) {
+        MS_LOG(INFO) << "Remove binary index of a former file: " << file + kBinaryIndexSuffix;
+      }
     } else {
       // open the mindrecord file to append
       fs->open(common::SafeCStr(file), std::ios::out | std::ios::in | std::ios::binary);
@@ -210,6 +226,12 @@ MSRStatus ShardWriter::OpenForAppend(const std::string &path) {
 }
 
 MSRStatus ShardWriter::Commit() {
+  // Wait for the rows queued to the writer thread
+  if (WaitForWriter(true) == FAILED) {
+    MS_LOG(ERROR) << "Write raw data failed";
+    return FAILED;
+  }
+
   // Read pages file
   std::ifstream page_file(pages_file_.c_str());
   if (page_file.good()) {
@@ -268,6 +290,22 @@ MSRStatus ShardWriter::SetShardHeader(std::shared_ptr<ShardHeader> header_data)
     }
   }
 
+  // set label columns, the fixed width scalar columns
+  if (columnar_label_ && !header_data->GetSchemas().empty()) {
+    std::vector<std::string> label_columns;
+    json jsonSchema = header_data->GetSchemas()[0]->GetSchema()["schema"];
+    for (const auto &el : jsonSchema.items()) {
+      if (kNumberFieldTypeSet.count(el.value()["type"].get<std::string>()) > 0 &&
+          el.value().find("shape") == el.value().end()) {
+        label_columns.emplace_back(el.key());
+      }
+    }
+    header_data->SetLabelColumns(label_columns);
+  }
+
+  // set compression of the blob pages
+  header_data->SetPageCompression(page_compression_ == kPageCompressionNone ? "" : page_compression_);
+
   shard_header_ = header_data;
   shard_header_->SetHeaderSize(header_size_);
   shard_header_->SetPageSize(page_size_);
@@ -304,6 +342,43 @@ MSRStatus ShardWriter::SetPageSize(const uint64_t &page_size) {
   return SUCCESS;
 }
 
+MSRStatus ShardWriter::SetColumnarLabel(const bool &columnar_label) {
+  if (shard_header_ != nullptr) {
+    MS_LOG(ERROR) << "Columnar label should be set before the shard header.";
+    return FAILED;
+  }
+  columnar_label_ = columnar_label;
+  return SUCCESS;
+}
+
+MSRStatus ShardWriter::SetParallelWorkers(const int &num_workers) {
+  if (num_workers < 1 || num_workers > kMaxThreadCount) {
+    MS_LOG(ERROR) << "Parallel workers should between 1 and " << kMaxThreadCount << ", but got " << num_workers;
+    return FAILED;
+  }
+  num_workers_ = num_workers;
+  return SUCCESS;
+}
+
+MSRStatus ShardWriter::SetPageCompression(const std::string &compression, const int &level) {
+  if (shard_header_ != nullptr) {
+    MS_LOG(ERROR) << "Page compression should be set before the shard header.";
+    return FAILED;
+  }
+  if (compression.empty() || !ShardCompression::IsValid(compression)) {
+    MS_LOG(ERROR) << "Page compression should be " << kPageCompressionNone << " or " << kPageCompressionZlib
+                  << ", but got " << compression;
+    return FAILED;
+  }
+  if (level < 1 || level > 9) {
+    MS_LOG(ERROR) << "Page compression level should between 1 and 9, but got " << level;
+    return FAILED;
+  }
+  page_compression_ = compression;
+  page_compression_level_ = level;
+  return SUCCESS;
+}
+
 void ShardWriter::DeleteErrorData(std::map<uint64_t, std::vector<json>> &raw_data,
                                   std::vector<std::vector<uint8_t>> &blob_data) {
   // get wrong data location
@@ -418,14 +493,14 @@ MSRStatus ShardWriter::CheckData(const std::map<uint64_t, std::vector<json>> &ra
     std::vector<json> sub_raw_data = rawdata_iter->second;
 
     // calculate start position and end position for each thread
-    int batch_size = rawdata_iter->second.size() / shard_count_;
-    int thread_num = shard_count_;
+    int thread_num = std::max(1, std::min(num_workers_, static_cast<int>(rawdata_iter->second.size())));
     if (thread_num <= 0) {
       return FAILED;
     }
     if (thread_num > kMaxThreadCount) {
       thread_num = kMaxThreadCount;
     }
+    int batch_size = rawdata_iter->second.size() / thread_num;
     std::vector<std::thread> thread_set(thread_num);
 
     // start multiple thread
@@ -519,7 +594,8 @@ std::tuple<MSRStatus, int, int> ShardWriter::ValidateRawData(std::map<uint64_t,
 }
 
 void ShardWriter::FillArray(int start, int end, std::map<uint64_t, vector<json>> &raw_data,
-                            std::vector<std::vector<uint8_t>> &bin_data) {
+                            std::vector<std::vector<uint8_t>> &bin_data,
+                            std::vector<std::vector<uint8_t>> *label_data) {
   // Prevent excessive thread opening and cause cross-border
   if (start >= end) {
     flag_ = true;
@@ -531,7 +607,18 @@ void ShardWriter::FillArray(int start, int end, std::map<uint64_t, vector<json>>
     int cnt = 0;
     for (rawdata_iter = raw_data.begin(); rawdata_iter != raw_data.end(); ++rawdata_iter) {
       const json &line = raw_data.at(rawdata_iter->first)[x];
-      std::vector<std::uint8_t> bline = json::to_msgpack(line);
+      std::vector<std::uint8_t> bline;
+      if (cnt == 0 && label_data != nullptr && !label_data->empty()) {
+        // The label columns go to the typed blocks of the label pages
+        json rest_line;
+        if (shard_column_->SplitLabel(line, x, label_data, &rest_line) == FAILED) {
+          flag_ = true;
+          return;
+        }
+        bline = json::to_msgpack(rest_line);
+      } else {
+        bline = json::to_msgpack(line);
+      }
 
       // Storage form is [Sample1-Schema1, Sample1-Schema2, Sample2-Schema1, Sample2-Schema2]
       bin_data[x * schema_count + cnt] = bline;
@@ -612,11 +699,7 @@ MSRStatus ShardWriter::WriteRawDataPreCheck(std::map<uint64_t, std::vector<json>
 
   // compress blob
   if (shard_column_->CheckCompressBlob()) {
-    for (auto &blob : blob_data) {
-      int64_t compression_bytes = 0;
-      blob = shard_column_->CompressBlob(blob, &compression_bytes);
-      compression_size_ += compression_bytes;
-    }
+    CompressBlobs(blob_data);
   }
 
   // Add 4-bytes dummy blob data if no any blob fields
@@ -638,6 +721,34 @@ MSRStatus ShardWriter::WriteRawDataPreCheck(std::map<uint64_t, std::vector<json>
   *row_count = std::get<2>(v);
   return SUCCESS;
 }
+
+void ShardWriter::CompressBlobs(std::vector<std::vector<uint8_t>> &blob_data) {
+  int row_count = static_cast<int>(blob_data.size());
+  int thread_num = std::min(num_workers_, row_count);
+  if (thread_num <= 0) {
+    return;
+  }
+  int group_num = ceil(row_count * 1.0 / thread_num);
+  std::vector<std::thread> thread_set;
+  for (int x = 0; x < thread_num; ++x) {
+    int start_num = x * group_num;
+    int end_num = std::min((x + 1) * group_num, row_count);
+    if (start_num >= end_num) {
+      break;
+    }
+    thread_set.emplace_back([this, &blob_data, start_num, end_num]() {
+      for (int i = start_num; i < end_num; ++i) {
+        int64_t compression_bytes = 0;
+        blob_data[i] = shard_column_->CompressBlob(blob_data[i], &compression_bytes);
+        compression_size_ += compression_bytes;
+      }
+    });
+  }
+  for (auto &thread : thread_set) {
+    thread.join();
+  }
+}
+
 MSRStatus ShardWriter::MergeBlobData(const std::vector<string> &blob_fields,
                                      const std::map<std::string, std::unique_ptr<std::vector<uint8_t>>> &row_bin_data,
                                      std::shared_ptr<std::vector<uint8_t>> *output) {
@@ -677,18 +788,17 @@ MSRStatus ShardWriter::MergeBlobData(const std::vector<string> &blob_fields,
 
 MSRStatus ShardWriter::WriteRawData(std::map<uint64_t, std::vector<json>> &raw_data,
                                     std::vector<std::vector<uint8_t>> &blob_data, bool sign, bool parallel_writer) {
-  // Lock Writer if loading data parallel
-  int fd = LockWriter(parallel_writer);
-  if (fd < 0) {
-    MS_LOG(ERROR) << "Lock writer failed";
-    return FAILED;
-  }
+  // The blob data of the caller is copied, the rows are written after the call returns
+  return WriteRows(raw_data, blob_data, sign, parallel_writer);
+}
 
+MSRStatus ShardWriter::WriteRows(std::map<uint64_t, std::vector<json>> &raw_data,
+                                 std::vector<std::vector<uint8_t>> blob_data, bool sign, bool parallel_writer) {
   // Get the count of schemas and rows
   int schema_count = 0;
   int row_count = 0;
 
-  // Serialize raw data
+  // Check raw data, while the writer thread writes the rows of the former calls
   if (WriteRawDataPreCheck(raw_data, blob_data, sign, &schema_count, &row_count) == FAILED) {
     MS_LOG(ERROR) << "Check raw data failed";
     return FAILED;
@@ -699,32 +809,60 @@ MSRStatus ShardWriter::WriteRawData(std::map<uint64_t, std::vector<json>> &raw_d
     return SUCCESS;
   }
 
-  std::vector<std::vector<uint8_t>> bin_raw_data(row_count * schema_count);
+  RowBatch batch;
+  batch.bin_raw_data.resize(row_count * schema_count);
 
   // Serialize raw data
-  if (SerializeRawData(raw_data, bin_raw_data, row_count) == FAILED) {
+  if (SerializeRawData(raw_data, batch.bin_raw_data, row_count, &batch.label_data) == FAILED) {
     MS_LOG(ERROR) << "Serialize raw data failed";
     return FAILED;
   }
 
   // Set row size of raw data
-  if (SetRawDataSize(bin_raw_data) == FAILED) {
+  if (SetRawDataSize(batch.bin_raw_data, &batch.raw_data_size) == FAILED) {
     MS_LOG(ERROR) << "Set raw data size failed";
     return FAILED;
   }
 
   // Set row size of blob data
-  if (SetBlobDataSize(blob_data) == FAILED) {
+  if (SetBlobDataSize(blob_data, &batch.blob_data_size) == FAILED) {
     MS_LOG(ERROR) << "Set blob data size failed";
     return FAILED;
   }
+  batch.blob_data = std::move(blob_data);
 
-  // Write data to disk with multi threads
-  if (ParallelWriteData(blob_data, bin_raw_data) == FAILED) {
-    MS_LOG(ERROR) << "Parallel write data failed";
+  if (!parallel_writer) {
+    // Queue the rows to the writer thread, waiting while the queue is full
+    {
+      std::unique_lock<std::mutex> lock(write_mutex_);
+      write_cv_.wait(lock, [this] { return write_queue_.size() < kMaxQueuedBatches || write_status_ == FAILED; });
+      if (write_status_ == FAILED) {
+        MS_LOG(ERROR) << "Write the rows of a former call failed";
+        return FAILED;
+      }
+      write_queue_.push_back(std::move(batch));
+      if (!writer_thread_.joinable()) {
+        writer_thread_ = std::thread(&ShardWriter::WriterThread, this);
+      }
+    }
+    write_cv_.notify_all();
+    return SUCCESS;
+  }
+
+  // Lock Writer if loading data parallel, the queued rows are written before the pages are saved
+  if (WaitForWriter() == FAILED) {
+    MS_LOG(ERROR) << "Write the rows of a former call failed";
+    return FAILED;
+  }
+  int fd = LockWriter(parallel_writer);
+  if (fd < 0) {
+    MS_LOG(ERROR) << "Lock writer failed";
+    return FAILED;
+  }
+
+  if (WriteBatch(&batch) == FAILED) {
     return FAILED;
   }
-  MS_LOG(INFO) << "Write " << bin_raw_data.size() << " records successfully.";
 
   if (UnlockWriter(fd, parallel_writer) == FAILED) {
     MS_LOG(ERROR) << "Unlock writer failed";
@@ -734,6 +872,60 @@ MSRStatus ShardWriter::WriteRawData(std::map<uint64_t, std::vector<json>> &raw_d
   return SUCCESS;
 }
 
+MSRStatus ShardWriter::WriteBatch(RowBatch *batch) {
+  raw_data_size_ = std::move(batch->raw_data_size);
+  blob_data_size_ = std::move(batch->blob_data_size);
+  label_data_ = std::move(batch->label_data);
+
+  // Write data to disk with multi threads
+  if (ParallelWriteData(batch->blob_data, batch->bin_raw_data) == FAILED) {
+    MS_LOG(ERROR) << "Parallel write data failed";
+    return FAILED;
+  }
+  MS_LOG(INFO) << "Write " << batch->bin_raw_data.size() << " records successfully.";
+  return SUCCESS;
+}
+
+void ShardWriter::WriterThread() {
+  std::unique_lock<std::mutex> lock(write_mutex_);
+  while (true) {
+    write_cv_.wait(lock, [this] { return !write_queue_.empty() || stop_writer_; });
+    if (write_queue_.empty()) {
+      return;
+    }
+    RowBatch batch = std::move(write_queue_.front());
+    write_queue_.pop_front();
+    bool failed = write_status_ == FAILED;
+    writing_ = true;
+    write_cv_.notify_all();
+
+    // The next call checks and serializes its rows meanwhile
+    lock.unlock();
+    auto ret = failed ? FAILED : WriteBatch(&batch);
+    lock.lock();
+
+    writing_ = false;
+    if (ret == FAILED) {
+      write_status_ = FAILED;
+    }
+    write_cv_.notify_all();
+  }
+}
+
+MSRStatus ShardWriter::WaitForWriter(bool stop) {
+  std::unique_lock<std::mutex> lock(write_mutex_);
+  write_cv_.wait(lock, [this] { return write_queue_.empty() && !writing_; });
+  if (stop && writer_thread_.joinable()) {
+    stop_writer_ = true;
+    write_cv_.notify_all();
+    lock.unlock();
+    writer_thread_.join();
+    lock.lock();
+    stop_writer_ = false;
+  }
+  return write_status_;
+}
+
 MSRStatus ShardWriter::WriteRawData(std::map<uint64_t, std::vector<py::handle>> &raw_data,
                                     std::map<uint64_t, std::vector<py::handle>> &blob_data, bool sign,
                                     bool parallel_writer) {
@@ -770,7 +962,7 @@ MSRStatus ShardWriter::WriteRawData(std::map<uint64_t, std::vector<py::handle>>
     MS_LOG(ERROR) << "Serialize raw data failed in write raw data";
     return FAILED;
   }
-  return WriteRawData(raw_data_json, bin_blob_data, sign, parallel_writer);
+  return WriteRows(raw_data_json, std::move(bin_blob_data), sign, parallel_writer);
 }
 
 MSRStatus ShardWriter::WriteRawData(std::map<uint64_t, std::vector<py::handle>> &raw_data,
@@ -784,7 +976,8 @@ MSRStatus ShardWriter::WriteRawData(std::map<uint64_t, std::vector<py::handle>>
                                               [](const py::handle &obj) { return nlohmann::detail::ToJsonImpl(obj); });
                          return std::make_pair(pair.first, std::move(json_raw_data));
                        });
-  return WriteRawData(raw_data_json, blob_data, sign, parallel_writer);
+  // blob_data is the copy converted from python, it is taken as it is
+  return WriteRows(raw_data_json, std::move(blob_data), sign, parallel_writer);
 }
 
 MSRStatus ShardWriter::ParallelWriteData(const std::vector<std::vector<uint8_t>> &blob_data,
@@ -798,6 +991,9 @@ MSRStatus ShardWriter::ParallelWriteData(const std::vector<std::vector<uint8_t>>
   if (thread_num > kMaxThreadCount) {
     thread_num = kMaxThreadCount;
   }
+  // The workers left by the shards compress the blob pages ahead of the one being written
+  int num_compress =
+    shard_header_->GetPageCompression().empty() ? 0 : std::max(1, num_workers_ / std::max(thread_num, 1));
   int left_thread = shard_count_;
   int current_thread = 0;
   while (left_thread) {
@@ -811,7 +1007,7 @@ MSRStatus ShardWriter::ParallelWriteData(const std::vector<std::vector<uint8_t>>
         int start_row = shards[current_thread + x].first;
         int end_row = shards[current_thread + x].second;
         thread_set[x] = std::thread(&ShardWriter::WriteByShard, this, current_thread + x, start_row, end_row,
-                                    std::ref(blob_data), std::ref(bin_raw_data));
+                                    std::ref(blob_data), std::ref(bin_raw_data), num_compress);
       }
       // Wait for threads done
       for (int x = 0; x < thread_num; ++x) {
@@ -826,7 +1022,7 @@ MSRStatus ShardWriter::ParallelWriteData(const std::vector<std::vector<uint8_t>>
 
 MSRStatus ShardWriter::WriteByShard(int shard_id, int start_row, int end_row,
                                     const std::vector<std::vector<uint8_t>> &blob_data,
-                                    const std::vector<std::vector<uint8_t>> &bin_raw_data) {
+                                    const std::vector<std::vector<uint8_t>> &bin_raw_data, int num_compress) {
   MS_LOG(DEBUG) << "Shard: " << shard_id << ", start: " << start_row << ", end: " << end_row
                 << ", schema size: " << schema_count_;
   if (start_row == end_row) {
@@ -848,7 +1044,7 @@ MSRStatus ShardWriter::WriteByShard(int shard_id, int start_row, int end_row,
     return FAILED;
   }
 
-  if (NewBlobPage(shard_id, blob_data, rows_in_group, last_blob_page) == FAILED) {
+  if (NewBlobPage(shard_id, blob_data, rows_in_group, last_blob_page, num_compress) == FAILED) {
     MS_LOG(ERROR) << "New blob page failed";
     return FAILED;
   }
@@ -863,6 +1059,11 @@ MSRStatus ShardWriter::WriteByShard(int shard_id, int start_row, int end_row,
     return FAILED;
   }
 
+  if (WriteLabelPage(shard_id, start_row, end_row) == FAILED) {
+    MS_LOG(ERROR) << "Write label page failed";
+    return FAILED;
+  }
+
   return SUCCESS;
 }
 
@@ -870,7 +1071,8 @@ MSRStatus ShardWriter::CutRowGroup(int start_row, int end_row, const std::vector
                                    std::vector<std::pair<int, int>> &rows_in_group,
                                    const std::shared_ptr<Page> &last_raw_page,
                                    const std::shared_ptr<Page> &last_blob_page) {
-  auto n_byte_blob = last_blob_page ? last_blob_page->GetPageSize() : 0;
+  // a compressed page is not appended, the rows start a new one
+  auto n_byte_blob = last_blob_page && last_blob_page->GetCompressedSize() == 0 ? last_blob_page->GetPageSize() : 0;
 
   auto last_raw_page_size = last_raw_page ? last_raw_page->GetPageSize() : 0;
   auto last_raw_offset = last_raw_page ? last_raw_page->GetLastRowGroupID().second : 0;
@@ -909,9 +1111,9 @@ MSRStatus ShardWriter::AppendBlobPage(const int &shard_id, const std::vector<std
   if (blob_row.first == blob_row.second) return SUCCESS;
 
   // Write disk
-  auto page_id = last_blob_page->GetPageID();
   auto bytes_page = last_blob_page->GetPageSize();
-  auto &io_seekp = file_streams_[shard_id]->seekp(page_size_ * page_id + header_size_ + bytes_page, std::ios::beg);
+  auto &io_seekp = file_streams_[shard_id]->seekp(
+    last_blob_page->GetPageOffset(header_size_, page_size_) + bytes_page, std::ios::beg);
   if (!io_seekp.good() || io_seekp.fail() || io_seekp.bad()) {
     MS_LOG(ERROR) << "File seekp failed";
     file_streams_[shard_id]->close();
@@ -931,23 +1133,51 @@ MSRStatus ShardWriter::AppendBlobPage(const int &shard_id, const std::vector<std
 
 MSRStatus ShardWriter::NewBlobPage(const int &shard_id, const std::vector<std::vector<uint8_t>> &blob_data,
                                    const std::vector<std::pair<int, int>> &rows_in_group,
-                                   const std::shared_ptr<Page> &last_blob_page) {
+                                   const std::shared_ptr<Page> &last_blob_page, const int &num_compress) {
   auto page_id = shard_header_->GetLastPageId(shard_id);
   auto page_type_id = last_blob_page ? last_blob_page->GetPageTypeID() : -1;
   auto current_row = last_blob_page ? last_blob_page->GetEndRowID() : 0;
+  // pages being compressed, in the order they are written
+  std::deque<std::future<std::pair<MSRStatus, std::vector<uint8_t>>>> compressed_pages;
+  uint32_t next_compress = 1;
   // index(0) indicate appendBlobPage
   for (uint32_t i = 1; i < rows_in_group.size(); ++i) {
     auto blob_row = rows_in_group[i];
 
-    // Write 1 blob page to disk
-    auto &io_seekp = file_streams_[shard_id]->seekp(page_size_ * (page_id + 1) + header_size_, std::ios::beg);
+    std::vector<uint8_t> compressed;
+    if (num_compress > 0) {
+      for (; next_compress < rows_in_group.size() && static_cast<int>(compressed_pages.size()) < num_compress;
+           ++next_compress) {
+        compressed_pages.push_back(std::async(std::launch::async, &ShardWriter::CompressBlobPage, this,
+                                              std::cref(blob_data), rows_in_group[next_compress]));
+      }
+      auto ret = compressed_pages.front().get();
+      compressed_pages.pop_front();
+      if (ret.first != SUCCESS) {
+        MS_LOG(ERROR) << "Compress blob page failed";
+        return FAILED;
+      }
+      compressed = std::move(ret.second);
+    }
+
+    // Write 1 blob page to disk, a compressed one takes only its compressed size
+    auto &io_seekp = file_streams_[shard_id]->seekp(shard_header_->GetNextPageOffset(shard_id), std::ios::beg);
     if (!io_seekp.good() || io_seekp.fail() || io_seekp.bad()) {
       MS_LOG(ERROR) << "File seekp failed";
       file_streams_[shard_id]->close();
       return FAILED;
     }
 
-    (void)FlushBlobChunk(file_streams_[shard_id], blob_data, blob_row);
+    if (compressed.empty()) {
+      (void)FlushBlobChunk(file_streams_[shard_id], blob_data, blob_row);
+    } else {
+      auto &io_handle = file_streams_[shard_id]->write(reinterpret_cast<char *>(&compressed[0]), compressed.size());
+      if (!io_handle.good() || io_handle.fail() || io_handle.bad()) {
+        MS_LOG(ERROR) << "File write failed";
+        file_streams_[shard_id]->close();
+        return FAILED;
+      }
+    }
     // Create new page info for header
     auto page_size =
       std::accumulate(blob_data_size_.begin() + blob_row.first, blob_data_size_.begin() + blob_row.second, 0);
@@ -955,12 +1185,40 @@ MSRStatus ShardWriter::NewBlobPage(const int &shard_id, const std::vector<std::v
     auto start_row = current_row;
     auto end_row = start_row + blob_row.second - blob_row.first;
     auto page = Page(++page_id, shard_id, kPageTypeBlob, ++page_type_id, start_row, end_row, row_group_ids, page_size);
+    page.SetCompressedSize(compressed.size());
     (void)shard_header_->AddPage(std::make_shared<Page>(page));
     current_row = end_row;
   }
   return SUCCESS;
 }
 
+std::pair<MSRStatus, std::vector<uint8_t>> ShardWriter::CompressBlobPage(
+  const std::vector<std::vector<uint8_t>> &blob_data, const std::pair<int, int> &blob_row) {
+  // Lay out the rows of the page as FlushBlobChunk writes them
+  std::vector<uint8_t> page;
+  page.reserve(std::accumulate(blob_data_size_.begin() + blob_row.first, blob_data_size_.begin() + blob_row.second,
+                               static_cast<uint64_t>(0)));
+  std::vector<uint64_t> blob_ends;
+  for (int j = blob_row.first; j < blob_row.second; ++j) {
+    uint64_t line_len = blob_data[j].size();
+    auto len_bytes = reinterpret_cast<const uint8_t *>(&line_len);
+    (void)page.insert(page.end(), len_bytes, len_bytes + kInt64Len);
+    (void)page.insert(page.end(), blob_data[j].begin(), blob_data[j].end());
+    blob_ends.push_back(page.size());
+  }
+
+  std::vector<uint8_t> compressed;
+  if (ShardCompression::CompressPage(shard_header_->GetPageCompression(), page_compression_level_, page, blob_ends,
+                                     &compressed) == FAILED) {
+    return {FAILED, {}};
+  }
+  // The page is written as it is when it does not get smaller
+  if (compressed.size() >= page.size()) {
+    compressed.clear();
+  }
+  return {SUCCESS, std::move(compressed)};
+}
+
 MSRStatus ShardWriter::ShiftRawPage(const int &shard_id, const std::vector<std::pair<int, int>> &rows_in_group,
                                     std::shared_ptr<Page> &last_raw_page) {
   auto blob_row = rows_in_group[0];
@@ -973,7 +1231,6 @@ MSRStatus ShardWriter::ShiftRawPage(const int &shard_id, const std::vector<std::
   }
   auto page_id = shard_header_->GetLastPageId(shard_id);
   auto last_row_group_id_offset = last_raw_page->GetLastRowGroupID().second;
-  auto last_raw_page_id = last_raw_page->GetPageID();
   auto shift_size = last_raw_page_size - last_row_group_id_offset;
 
   std::vector<uint8_t> buf(shift_size);
@@ -984,7 +1241,7 @@ MSRStatus ShardWriter::ShiftRawPage(const int &shard_id, const std::vector<std::
   }
 
   auto &io_seekg = file_streams_[shard_id]->seekg(
-    page_size_ * last_raw_page_id + header_size_ + last_row_group_id_offset, std::ios::beg);
+    last_raw_page->GetPageOffset(header_size_, page_size_) + last_row_group_id_offset, std::ios::beg);
   if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
     MS_LOG(ERROR) << "File seekg failed";
     file_streams_[shard_id]->close();
@@ -999,7 +1256,7 @@ MSRStatus ShardWriter::ShiftRawPage(const int &shard_id, const std::vector<std::
   }
 
   // Merge into new row group at new raw data page
-  auto &io_seekp = file_streams_[shard_id]->seekp(page_size_ * (page_id + 1) + header_size_, std::ios::beg);
+  auto &io_seekp = file_streams_[shard_id]->seekp(shard_header_->GetNextPageOffset(shard_id), std::ios::beg);
   if (!io_seekp.good() || io_seekp.fail() || io_seekp.bad()) {
     MS_LOG(ERROR) << "File seekp failed";
     file_streams_[shard_id]->close();
@@ -1051,6 +1308,63 @@ MSRStatus ShardWriter::WriteRawPage(const int &shard_id, const std::vector<std::
   return SUCCESS;
 }
 
+MSRStatus ShardWriter::WriteLabelPage(const int &shard_id, const int &start_row, const int &end_row) {
+  if (!shard_column_->HasLabelColumn()) return SUCCESS;
+  auto page_rows = shard_column_->GetLabelPageRows(page_size_);
+  auto label_column_size = shard_column_->GetLabelColumnSize();
+
+  std::shared_ptr<Page> last_label_page = nullptr;
+  auto last_label_page_id = shard_header_->GetLastPageIdByType(shard_id, kPageTypeLabel);
+  if (last_label_page_id >= 0) {
+    last_label_page = shard_header_->GetPage(shard_id, last_label_page_id).first;
+  }
+
+  int row = start_row;
+  while (row < end_row) {
+    // Add a label page when the last one is full, it holds the rows following the ones of the last one
+    if (!last_label_page || last_label_page->GetEndRowID() - last_label_page->GetStartRowID() >= page_rows) {
+      auto page_id = shard_header_->GetLastPageId(shard_id);
+      auto page_type_id = last_label_page ? last_label_page->GetPageTypeID() : -1;
+      uint64_t start_row_id = last_label_page ? last_label_page->GetEndRowID() : 0;
+      std::vector<std::pair<int, uint64_t>> row_group_ids;
+      auto page =
+        Page(++page_id, shard_id, kPageTypeLabel, ++page_type_id, start_row_id, start_row_id, row_group_ids, 0);
+      last_label_page = std::make_shared<Page>(page);
+      (void)shard_header_->AddPage(last_label_page);
+    }
+
+    // Fill the typed block of each column of the page
+    uint64_t page_row = last_label_page->GetEndRowID() - last_label_page->GetStartRowID();
+    uint64_t num_rows = std::min(static_cast<uint64_t>(end_row - row), page_rows - page_row);
+    for (uint64_t i = 0; i < label_column_size.size(); ++i) {
+      auto size = label_column_size[i];
+      auto offset = last_label_page->GetPageOffset(header_size_, page_size_) +
+                    shard_column_->GetLabelPageOffset(i, page_size_) + page_row * size;
+      auto &io_seekp = file_streams_[shard_id]->seekp(offset, std::ios::beg);
+      if (!io_seekp.good() || io_seekp.fail() || io_seekp.bad()) {
+        MS_LOG(ERROR) << "File seekp failed";
+        file_streams_[shard_id]->close();
+        return FAILED;
+      }
+
+      auto &io_handle = file_streams_[shard_id]->write(reinterpret_cast<char *>(&label_data_[i][row * size]),
+                                                       num_rows * size);
+      if (!io_handle.good() || io_handle.fail() || io_handle.bad()) {
+        MS_LOG(ERROR) << "File write failed";
+        file_streams_[shard_id]->close();
+        return FAILED;
+      }
+    }
+
+    // Update last label page
+    last_label_page->SetEndRowID(last_label_page->GetEndRowID() + num_rows);
+    last_label_page->SetPageSize(last_label_page->GetPageSize() + num_rows * shard_column_->GetLabelRowSize());
+    (void)shard_header_->SetPage(last_label_page);
+    row += num_rows;
+  }
+  return SUCCESS;
+}
+
 void ShardWriter::EmptyRawPage(const int &shard_id, std::shared_ptr<Page> &last_raw_page) {
   auto row_group_ids = std::vector<std::pair<int, uint64_t>>();
   auto page_id = shard_header_->GetLastPageId(shard_id);
@@ -1064,12 +1378,11 @@ MSRStatus ShardWriter::AppendRawPage(const int &shard_id, const std::vector<std:
                                      const int &chunk_id, int &last_row_group_id, std::shared_ptr<Page> last_raw_page,
                                      const std::vector<std::vector<uint8_t>> &bin_raw_data) {
   std::vector<std::pair<int, uint64_t>> row_group_ids = last_raw_page->GetRowGroupIds();
-  auto last_raw_page_id = last_raw_page->GetPageID();
   auto n_bytes = last_raw_page->GetPageSize();
 
   //  previous raw data page
   auto &io_seekp =
-    file_streams_[shard_id]->seekp(page_size_ * last_raw_page_id + header_size_ + n_bytes, std::ios::beg);
+    file_streams_[shard_id]->seekp(last_raw_page->GetPageOffset(header_size_, page_size_) + n_bytes, std::ios::beg);
   if (!io_seekp.good() || io_seekp.fail() || io_seekp.bad()) {
     MS_LOG(ERROR) << "File seekp failed";
     file_streams_[shard_id]->close();
@@ -1151,8 +1464,10 @@ MSRStatus ShardWriter::FlushRawChunk(const std::shared_ptr<std::fstream> &out,
 // Allocate data to shards evenly
 std::vector<std::pair<int, int>> ShardWriter::BreakIntoShards() {
   std::vector<std::pair<int, int>> shards;
-  int row_in_shard = row_count_ / shard_count_;
-  int remains = row_count_ % shard_count_;
+  // the rows being written, row_count_ is the count of the rows of the call being checked
+  int row_count = static_cast<int>(raw_data_size_.size());
+  int row_in_shard = row_count / shard_count_;
+  int remains = row_count % shard_count_;
 
   std::vector<int> v_list(shard_count_);
   std::iota(v_list.begin(), v_list.end(), 0);
@@ -1224,10 +1539,18 @@ MSRStatus ShardWriter::WriteShardHeader() {
 }
 
 MSRStatus ShardWriter::SerializeRawData(std::map<uint64_t, std::vector<json>> &raw_data,
-                                        std::vector<std::vector<uint8_t>> &bin_data, uint32_t row_count) {
+                                        std::vector<std::vector<uint8_t>> &bin_data, uint32_t row_count,
+                                        std::vector<std::vector<uint8_t>> *label_data) {
+  // Typed blocks of the label columns of the rows
+  if (label_data != nullptr) {
+    label_data->clear();
+    for (const auto &size : shard_column_->GetLabelColumnSize()) {
+      label_data->emplace_back(row_count * size);
+    }
+  }
+
   // define the number of thread
-  uint32_t thread_num = std::thread::hardware_concurrency();
-  if (thread_num == 0) thread_num = kThreadNumber;
+  uint32_t thread_num = num_workers_;
   // Set the number of samples processed by each thread
   int group_num = ceil(row_count * 1.0 / thread_num);
   std::vector<std::thread> thread_set(thread_num);
@@ -1239,8 +1562,8 @@ MSRStatus ShardWriter::SerializeRawData(std::map<uint64_t, std::vector<json>> &r
       continue;
     }
     // Define the run boundary and start the child thread
-    thread_set[x] =
-      std::thread(&ShardWriter::FillArray, this, start_num, end_num, std::ref(raw_data), std::ref(bin_data));
+    thread_set[x] = std::thread(&ShardWriter::FillArray, this, start_num, end_num, std::ref(raw_data),
+                                std::ref(bin_data), label_data);
     work_thread_num++;
   }
   for (uint32_t x = 0; x < work_thread_num; ++x) {
@@ -1250,25 +1573,27 @@ MSRStatus ShardWriter::SerializeRawData(std::map<uint64_t, std::vector<json>> &r
   return flag_ == true ? FAILED : SUCCESS;
 }
 
-MSRStatus ShardWriter::SetRawDataSize(const std::vector<std::vector<uint8_t>> &bin_raw_data) {
-  raw_data_size_ = std::vector<uint64_t>(row_count_, 0);
+MSRStatus ShardWriter::SetRawDataSize(const std::vector<std::vector<uint8_t>> &bin_raw_data,
+                                      std::vector<uint64_t> *raw_data_size) {
+  *raw_data_size = std::vector<uint64_t>(row_count_, 0);
   for (uint32_t i = 0; i < row_count_; ++i) {
-    raw_data_size_[i] = std::accumulate(
+    (*raw_data_size)[i] = std::accumulate(
       bin_raw_data.begin() + (i * schema_count_), bin_raw_data.begin() + (i * schema_count_) + schema_count_, 0,
       [](uint64_t accumulator, const std::vector<uint8_t> &row) { return accumulator + kInt64Len + row.size(); });
   }
-  if (*std::max_element(raw_data_size_.begin(), raw_data_size_.end()) > page_size_) {
+  if (*std::max_element(raw_data_size->begin(), raw_data_size->end()) > page_size_) {
     MS_LOG(ERROR) << "Page size is too small to save a row!";
     return FAILED;
   }
   return SUCCESS;
 }
 
-MSRStatus ShardWriter::SetBlobDataSize(const std::vector<std::vector<uint8_t>> &blob_data) {
-  blob_data_size_ = std::vector<uint64_t>(row_count_);
-  (void)std::transform(blob_data.begin(), blob_data.end(), blob_data_size_.begin(),
+MSRStatus ShardWriter::SetBlobDataSize(const std::vector<std::vector<uint8_t>> &blob_data,
+                                       std::vector<uint64_t> *blob_data_size) {
+  *blob_data_size = std::vector<uint64_t>(row_count_);
+  (void)std::transform(blob_data.begin(), blob_data.end(), blob_data_size->begin(),
                        [](const std::vector<uint8_t> &row) { return kInt64Len + row.size(); });
-  if (*std::max_element(blob_data_size_.begin(), blob_data_size_.end()) > page_size_) {
+  if (*std::max_element(blob_data_size->begin(), blob_data_size->end()) > page_size_) {
     MS_LOG(ERROR) << "Page size is too small to save a row!";
     return FAILED;
   }
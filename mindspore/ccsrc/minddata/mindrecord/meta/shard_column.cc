@@ -16,16 +16,28 @@
 
 #include "minddata/mindrecord/include/shard_column.h"
 
+#include <algorithm>
+#include <cstring>
 #include "utils/ms_utils.h"
 #include "minddata/mindrecord/include/common/shard_utils.h"
 #include "minddata/mindrecord/include/shard_error.h"
 
 namespace mindspore {
 namespace mindrecord {
+namespace {
+template <typename T>
+T LoadLabel(const unsigned char *data) {
+  T value;
+  memcpy(&value, data, sizeof(T));
+  return value;
+}
+}  // namespace
+
 ShardColumn::ShardColumn(const std::shared_ptr<ShardHeader> &shard_header, bool compress_integer) {
   auto first_schema = shard_header->GetSchemas()[0];
   json schema_json = first_schema->GetSchema();
   Init(schema_json, compress_integer);
+  InitLabel(shard_header->GetLabelColumns());
 }
 
 ShardColumn::ShardColumn(const json &schema_json, bool compress_integer) { Init(schema_json, compress_integer); }
@@ -72,6 +84,28 @@ void ShardColumn::Init(const json &schema_json, bool compress_integer) {
   num_blob_column_ = blob_column_.size();
 }
 
+void ShardColumn::InitLabel(const std::vector<std::string> &label_column) {
+  for (const auto &column_name : label_column) {
+    auto it = column_name_id_.find(column_name);
+    if (it == column_name_id_.end() || !column_shape_[it->second].empty()) {
+      MS_LOG(ERROR) << "Label column " << column_name << " is not a scalar column of the schema.";
+      continue;
+    }
+    auto column_data_type = column_data_type_[it->second];
+    if (column_data_type != ColumnInt32 && column_data_type != ColumnInt64 && column_data_type != ColumnFloat32 &&
+        column_data_type != ColumnFloat64) {
+      MS_LOG(ERROR) << "Label column " << column_name << " is not a fixed width column.";
+      continue;
+    }
+    label_column_id_[column_name] = label_column_.size();
+    label_column_.push_back(column_name);
+    label_column_type_.push_back(column_data_type);
+    label_column_size_.push_back(ColumnDataTypeSize[column_data_type]);
+    label_column_offset_.push_back(label_row_size_);
+    label_row_size_ += ColumnDataTypeSize[column_data_type];
+  }
+}
+
 std::pair<MSRStatus, ColumnCategory> ShardColumn::GetColumnTypeByName(const std::string &column_name,
                                                                       ColumnDataType *column_data_type,
                                                                       uint64_t *column_data_type_size,
@@ -129,6 +163,30 @@ MSRStatus ShardColumn::GetColumnValueByName(const std::string &column_name, cons
   return SUCCESS;
 }
 
+MSRStatus ShardColumn::GetColumnValueByName(const std::string &column_name, const std::vector<uint8_t> &columns_blob,
+                                            const json &columns_json, const std::vector<uint8_t> &columns_label,
+                                            const unsigned char **data, std::unique_ptr<unsigned char[]> *data_ptr,
+                                            uint64_t *const n_bytes, ColumnDataType *column_data_type,
+                                            uint64_t *column_data_type_size, std::vector<int64_t> *column_shape) {
+  if (columns_label.empty() || !IsLabelColumn(column_name)) {
+    return GetColumnValueByName(column_name, columns_blob, columns_json, data, data_ptr, n_bytes, column_data_type,
+                                column_data_type_size, column_shape);
+  }
+
+  // Get data type and size
+  auto column_id = column_name_id_[column_name];
+  *column_data_type = column_data_type_[column_id];
+  *column_data_type_size = ColumnDataTypeSize[*column_data_type];
+  *column_shape = column_shape_[column_id];
+
+  // Retrieve value from the packed label columns
+  if (GetColumnFromLabel(column_name, columns_label, data, n_bytes) == FAILED) {
+    MS_LOG(ERROR) << "Error when get data from label, column name is " << column_name << ".";
+    return FAILED;
+  }
+  return SUCCESS;
+}
+
 MSRStatus ShardColumn::GetColumnFromJson(const std::string &column_name, const json &columns_json,
                                          std::unique_ptr<unsigned char[]> *data_ptr, uint64_t *n_bytes) {
   auto column_id = column_name_id_[column_name];
@@ -279,6 +337,155 @@ MSRStatus ShardColumn::GetColumnFromBlob(const std::string &column_name, const s
   return SUCCESS;
 }
 
+uint64_t ShardColumn::GetLabelPageRows(const uint64_t &page_size) const {
+  return label_row_size_ == 0 ? 0 : page_size / label_row_size_;
+}
+
+uint64_t ShardColumn::GetLabelPageOffset(const uint64_t &label_id, const uint64_t &page_size) const {
+  return GetLabelPageRows(page_size) * label_column_offset_[label_id];
+}
+
+MSRStatus ShardColumn::SplitLabel(const json &columns_json, const uint64_t &row,
+                                  std::vector<std::vector<uint8_t>> *label_data, json *rest_json) {
+  *rest_json = json::object();
+  for (auto it = columns_json.begin(); it != columns_json.end(); ++it) {
+    auto it_label = label_column_id_.find(it.key());
+    if (it_label == label_column_id_.end()) {
+      (*rest_json)[it.key()] = it.value();
+      continue;
+    }
+    auto label_id = it_label->second;
+    std::unique_ptr<unsigned char[]> data_ptr;
+    uint64_t n_bytes = 0;
+    if (GetColumnFromJson(it.key(), columns_json, &data_ptr, &n_bytes) == FAILED) {
+      MS_LOG(ERROR) << "Error when get data from json, column name is " << it.key() << ".";
+      return FAILED;
+    }
+    auto &block = (*label_data)[label_id];
+    if ((row + 1) * label_column_size_[label_id] > block.size()) {
+      MS_LOG(ERROR) << "Row " << row << " is out of the label block of column " << it.key() << ".";
+      return FAILED;
+    }
+    memcpy(&block[row * label_column_size_[label_id]], data_ptr.get(), label_column_size_[label_id]);
+  }
+  return SUCCESS;
+}
+
+MSRStatus ShardColumn::ReadLabelPages(ShardHeader *shard_header, const int &shard_id, std::fstream *in,
+                                      std::vector<std::vector<uint8_t>> *label_data) {
+  auto header_size = shard_header->GetHeaderSize();
+  auto page_size = shard_header->GetPageSize();
+  auto page_rows = GetLabelPageRows(page_size);
+
+  // The label pages of a shard hold its rows in order, without gaps
+  std::vector<std::shared_ptr<Page>> label_pages;
+  uint64_t num_rows = 0;
+  auto last_page_id = shard_header->GetLastPageId(shard_id);
+  for (int64_t page_id = 0; page_id <= last_page_id; ++page_id) {
+    auto page = shard_header->GetPage(shard_id, page_id).first;
+    if (page == nullptr || page->GetPageType() != kPageTypeLabel) continue;
+    if (page->GetStartRowID() != num_rows || page->GetEndRowID() < num_rows ||
+        page->GetEndRowID() - num_rows > page_rows) {
+      MS_LOG(ERROR) << "Invalid data, label page " << page_id << " of shard " << shard_id << " is out of order.";
+      return FAILED;
+    }
+    num_rows = page->GetEndRowID();
+    label_pages.push_back(page);
+  }
+
+  label_data->clear();
+  for (const auto &size : label_column_size_) {
+    label_data->emplace_back(num_rows * size);
+  }
+  for (const auto &page : label_pages) {
+    auto start_row = page->GetStartRowID();
+    auto page_num_rows = page->GetEndRowID() - start_row;
+    if (page_num_rows == 0) continue;
+    for (uint64_t i = 0; i < label_column_.size(); ++i) {
+      auto &io_seekg =
+        in->seekg(page->GetPageOffset(header_size, page_size) + GetLabelPageOffset(i, page_size), std::ios::beg);
+      if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
+        MS_LOG(ERROR) << "File seekg failed";
+        in->close();
+        return FAILED;
+      }
+      auto &io_read = in->read(reinterpret_cast<char *>(&(*label_data)[i][start_row * label_column_size_[i]]),
+                               page_num_rows * label_column_size_[i]);
+      if (!io_read.good() || io_read.fail() || io_read.bad()) {
+        MS_LOG(ERROR) << "File read failed";
+        in->close();
+        return FAILED;
+      }
+    }
+  }
+  return SUCCESS;
+}
+
+MSRStatus ShardColumn::GetLabelRow(const std::vector<std::vector<uint8_t>> &label_data, const uint64_t &row,
+                                   std::vector<uint8_t> *columns_label) {
+  if (label_data.size() != label_column_.size()) {
+    MS_LOG(ERROR) << "Label data does not match the label columns.";
+    return FAILED;
+  }
+  columns_label->resize(label_row_size_);
+  for (uint64_t i = 0; i < label_column_.size(); ++i) {
+    auto size = label_column_size_[i];
+    if ((row + 1) * size > label_data[i].size()) {
+      MS_LOG(ERROR) << "Row " << row << " is out of the label block of column " << label_column_[i] << ".";
+      return FAILED;
+    }
+    memcpy(columns_label->data() + label_column_offset_[i], &label_data[i][row * size], size);
+  }
+  return SUCCESS;
+}
+
+MSRStatus ShardColumn::LabelToJson(const std::vector<std::vector<uint8_t>> &label_data, const uint64_t &row,
+                                   const std::vector<std::string> &columns, json *columns_json) {
+  if (label_data.size() != label_column_.size()) {
+    MS_LOG(ERROR) << "Label data does not match the label columns.";
+    return FAILED;
+  }
+  for (uint64_t i = 0; i < label_column_.size(); ++i) {
+    if (!columns.empty() && std::find(columns.begin(), columns.end(), label_column_[i]) == columns.end()) continue;
+    auto size = label_column_size_[i];
+    if ((row + 1) * size > label_data[i].size()) {
+      MS_LOG(ERROR) << "Row " << row << " is out of the label block of column " << label_column_[i] << ".";
+      return FAILED;
+    }
+    const unsigned char *value = &label_data[i][row * size];
+    switch (label_column_type_[i]) {
+      case ColumnInt32: {
+        (*columns_json)[label_column_[i]] = LoadLabel<int32_t>(value);
+        break;
+      }
+      case ColumnInt64: {
+        (*columns_json)[label_column_[i]] = LoadLabel<int64_t>(value);
+        break;
+      }
+      case ColumnFloat32: {
+        (*columns_json)[label_column_[i]] = LoadLabel<float>(value);
+        break;
+      }
+      default: {
+        (*columns_json)[label_column_[i]] = LoadLabel<double>(value);
+        break;
+      }
+    }
+  }
+  return SUCCESS;
+}
+
+MSRStatus ShardColumn::GetColumnFromLabel(const std::string &column_name, const std::vector<uint8_t> &columns_label,
+                                          const unsigned char **data, uint64_t *n_bytes) {
+  auto it = label_column_id_.find(column_name);
+  if (it == label_column_id_.end() || columns_label.size() != label_row_size_) {
+    return FAILED;
+  }
+  *data = columns_label.data() + label_column_offset_[it->second];
+  *n_bytes = label_column_size_[it->second];
+  return SUCCESS;
+}
+
 ColumnCategory ShardColumn::CheckColumnName(const std::string &column_name) {
   auto it_column = column_name_id_.find(column_name);
   if (it_column == column_name_id_.end()) {
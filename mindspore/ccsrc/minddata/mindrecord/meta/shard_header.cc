@@ -57,6 +57,12 @@ MSRStatus ShardHeader::InitializeHeader(const std::vector<json> &headers, bool l
       header_size_ = header["header_size"].get<uint64_t>();
       page_size_ = header["page_size"].get<uint64_t>();
       compression_size_ = header.contains("compression_size") ? header["compression_size"].get<uint64_t>() : 0;
+      if (header.contains("label_columns")) {
+        label_columns_ = header["label_columns"].get<std::vector<std::string>>();
+      }
+      if (header.contains("page_compression")) {
+        page_compression_ = header["page_compression"].get<std::string>();
+      }
     }
     if (SUCCESS != ParsePage(header["page"], shard_index, load_dataset)) {
       return FAILED;
@@ -159,6 +165,12 @@ std::pair<MSRStatus, json> ShardHeader::BuildSingleHeader(const std::string &fil
                  {"blob_fields", raw_header["schema"][0]["blob_fields"]},
                  {"schema", raw_header["schema"][0]["schema"]},
                  {"version", raw_header["version"]}};
+  if (raw_header.contains("label_columns")) {
+    header["label_columns"] = raw_header["label_columns"];
+  }
+  if (raw_header.contains("page_compression")) {
+    header["page_compression"] = raw_header["page_compression"];
+  }
   return {SUCCESS, header};
 }
 
@@ -282,6 +294,12 @@ MSRStatus ShardHeader::ParsePage(const json &pages, int shard_index, bool load_d
 
     std::shared_ptr<Page> parsed_page = std::make_shared<Page>(page_id, shard_id, page_type, page_type_id, start_row_id,
                                                                end_row_id, row_group_ids, page_size);
+    if (page.contains("compressed_size")) {
+      parsed_page->SetCompressedSize(page["compressed_size"].get<uint64_t>());
+    }
+    if (page.contains("page_offset")) {
+      parsed_page->SetPageOffset(page["page_offset"].get<uint64_t>());
+    }
     if (load_dataset == true) {
       pages_[shard_id].push_back(std::move(parsed_page));
     } else {
@@ -348,13 +366,26 @@ std::vector<std::string> ShardHeader::SerializeHeader() {
       s += "{\"header_size\":" + std::to_string(header_size_) + ",";
       s += "\"index_fields\":" + index + ",";
       s += "\"page\":" + pages[shardId] + ",";
+      if (!page_compression_.empty()) {
+        s += "\"page_compression\":\"" + page_compression_ + "\",";
+      }
       s += "\"page_size\":" + std::to_string(page_size_) + ",";
       s += "\"compression_size\":" + std::to_string(compression_size_) + ",";
+      if (!label_columns_.empty()) {
+        s += "\"label_columns\":" + json(label_columns_).dump() + ",";
+      }
       s += "\"schema\":" + schema + ",";
       s += "\"shard_addresses\":" + address + ",";
       s += "\"shard_id\":" + std::to_string(shardId) + ",";
       s += "\"statistics\":" + stats + ",";
-      s += "\"version\":\"" + std::string(kVersion) + "\"";
+      // readers that do not know label pages or compressed pages have to reject the files using them
+      std::string version = kVersion;
+      if (!page_compression_.empty()) {
+        version = kCompressedPageVersion;
+      } else if (!label_columns_.empty()) {
+        version = kLabelPageVersion;
+      }
+      s += "\"version\":\"" + version + "\"";
       s += "}";
       header.emplace_back(s);
     }
@@ -436,6 +467,10 @@ MSRStatus ShardHeader::AddPage(const std::shared_ptr<Page> &new_page) {
   int shard_id = new_page->GetShardID();
   int page_id = new_page->GetPageID();
   if (shard_id < static_cast<int>(pages_.size()) && page_id == static_cast<int>(pages_[shard_id].size())) {
+    // the pages of a file with compressed pages are packed, each one records its offset
+    if (!page_compression_.empty()) {
+      new_page->SetPageOffset(GetNextPageOffset(shard_id));
+    }
     pages_[shard_id].push_back(new_page);
     return SUCCESS;
   } else {
@@ -450,6 +485,24 @@ int64_t ShardHeader::GetLastPageId(const int &shard_id) {
   return pages_[shard_id].size() - 1;
 }
 
+uint64_t ShardHeader::GetPageOffset(const int &shard_id, const int &page_id) {
+  auto page = GetPage(shard_id, page_id).first;
+  return page ? page->GetPageOffset(header_size_, page_size_) : header_size_ + page_size_ * page_id;
+}
+
+uint64_t ShardHeader::GetNextPageOffset(const int &shard_id) {
+  if (shard_id >= static_cast<int>(pages_.size()) || pages_[shard_id].empty()) {
+    return header_size_;
+  }
+  const auto &last_page = pages_[shard_id].back();
+  if (page_compression_.empty()) {
+    return header_size_ + page_size_ * (last_page->GetPageID() + 1);
+  }
+  // a compressed page takes its compressed size, the others keep a whole page to be appended to
+  auto last_page_bytes = last_page->GetCompressedSize() > 0 ? last_page->GetCompressedSize() : page_size_;
+  return last_page->GetPageOffset(header_size_, page_size_) + last_page_bytes;
+}
+
 int ShardHeader::GetLastPageIdByType(const int &shard_id, const std::string &page_type) {
   if (shard_id >= static_cast<int>(pages_.size())) {
     return 0;
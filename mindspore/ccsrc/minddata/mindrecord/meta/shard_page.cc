@@ -41,6 +41,12 @@ json Page::GetPage() const {
     }
   }
   str_page["page_size"] = page_size_;
+  if (compressed_size_ > 0) {
+    str_page["compressed_size"] = compressed_size_;
+  }
+  if (page_offset_ > 0) {
+    str_page["page_offset"] = page_offset_;
+  }
   return str_page;
 }
 
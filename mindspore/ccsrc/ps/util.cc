@@ -149,15 +149,12 @@ std::map<int, int> Util::AllRankLocalShard(int first_dim, int rank_id, int serve
 void Util::ReduceSparseGradient(float *gradients, int *indices, const size_t indices_size, size_t segment_size,
                                 const size_t first_dim_size, const size_t outer_dim_size,
                                 mindspore::kernel::SparseGradient<int> *unique_sparse_grad) {
-  size_t slice_segment_size = indices_size * segment_size;
-  std::vector<float> workspace_grad(slice_segment_size);
   std::vector<int> workspace_indices(indices_size);
 
   MS_EXCEPTION_IF_NULL(gradients);
   MS_EXCEPTION_IF_NULL(indices);
 
-  mindspore::kernel::SparseGradient<int> workspace_sparse_grad(
-    {workspace_grad.data(), workspace_indices.data(), indices_size});
+  mindspore::kernel::SparseGradient<int> workspace_sparse_grad({nullptr, workspace_indices.data(), indices_size});
   mindspore::kernel::SparseGradient<int> input_sparse_grad({gradients, indices, indices_size});
   mindspore::kernel::ReduceSparseGradientParam<int> param;
   param.input_grad_ = &input_sparse_grad;
@@ -76,6 +76,7 @@ REGISTER_PYBIND_DEFINE(MsContextPy, ([](const py::module *m) {
                          (void)py::enum_<MsCtxParam>(*m, "ms_ctx_param", py::arithmetic())
                            .value("enable_auto_mixed_precision", MsCtxParam::MS_CTX_ENABLE_AUTO_MIXED_PRECISION)
                            .value("check_bprop", MsCtxParam::MS_CTX_CHECK_BPROP_FLAG)
+                           .value("enable_cpu_affinity", MsCtxParam::MS_CTX_ENABLE_CPU_AFFINITY)
                            .value("enable_dump", MsCtxParam::MS_CTX_ENABLE_DUMP)
                            .value("enable_graph_kernel", MsCtxParam::MS_CTX_ENABLE_GRAPH_KERNEL)
                            .value("enable_reduce_precision", MsCtxParam::MS_CTX_ENABLE_REDUCE_PRECISION)
@@ -93,7 +94,9 @@ REGISTER_PYBIND_DEFINE(MsContextPy, ([](const py::module *m) {
                            .value("save_graphs_path", MsCtxParam::MS_CTX_SAVE_GRAPHS_PATH)
                            .value("variable_memory_max_size", MsCtxParam::MS_CTX_VARIABLE_MEMORY_MAX_SIZE)
                            .value("device_id", MsCtxParam::MS_CTX_DEVICE_ID)
-                           .value("max_call_depth", MsCtxParam::MS_CTX_MAX_CALL_DEPTH);
+                           .value("max_call_depth", MsCtxParam::MS_CTX_MAX_CALL_DEPTH)
+                           .value("cpu_thread_num", MsCtxParam::MS_CTX_CPU_THREAD_NUM)
+                           .value("cpu_inter_op_parallel_num", MsCtxParam::MS_CTX_CPU_INTER_OP_PARALLEL_NUM);
 
                          (void)py::class_<mindspore::MsContext, std::shared_ptr<mindspore::MsContext>>(*m, "MSContext")
                            .def_static("get_instance", &mindspore::MsContext::GetInstance, "Get ms context instance.")
@@ -20,7 +20,14 @@
 #include <numeric>
 #include <utility>
 #include <functional>
+#include <algorithm>
+#include <map>
+#include <set>
+#include <deque>
+#include <mutex>
+#include <exception>
 #include "backend/kernel_compiler/kernel.h"
+#include "backend/kernel_compiler/cpu/cpu_thread_pool.h"
 #include "runtime/device/cpu/cpu_device_address.h"
 #include "utils/ms_context.h"
 #include "backend/session/anf_runtime_algorithm.h"
@@ -37,7 +44,15 @@ void CPUKernelRuntime::AssignKernelAddress(session::KernelGraph *kernel_graph) {
   AssignValueNodeAddress(kernel_graph);
   AssignInputNodeAddress(kernel_graph);
   AssignKernelOutputAddress(kernel_graph);
-  resource_manager_.AssignMemory(kernel_graph);
+  auto context_ptr = MsContext::GetInstance();
+  MS_EXCEPTION_IF_NULL(context_ptr);
+  if (context_ptr->get_param<uint32_t>(MS_CTX_CPU_INTER_OP_PARALLEL_NUM) > 1) {
+    // kernels may run out of execution order, memory is malloced at launch and freed by ref count instead
+    resource_manager_.set_graph_dynamic_malloc(kernel_graph->graph_id(), true);
+    return;
+  }
+  bool is_enable_mem_reuse = context_ptr->get_param<bool>(MS_CTX_ENABLE_MEM_REUSE);
+  resource_manager_.AssignMemory(kernel_graph, is_enable_mem_reuse);
 }
 
 void CPUKernelRuntime::AssignValueNodeAddress(session::KernelGraph *kernel_graph) {
@@ -265,6 +280,31 @@ void CPUKernelRuntime::BindInputOutput(session::KernelGraph *kernel_graph, const
   }
 }
 
+void CPUKernelRuntime::RunOpClearMemory(const session::KernelGraph *kernel_graph) {
+  MS_EXCEPTION_IF_NULL(kernel_graph);
+  // inputs and outputs of a cached single op graph are bound again on every run, the memory malloced for them
+  // goes back to the pool while the value nodes and the planned workspaces stay with the graph
+  for (auto &iter : input_param_tensor_map_) {
+    MS_EXCEPTION_IF_NULL(iter.first);
+    if (!iter.first->isa<Parameter>()) {
+      continue;
+    }
+    auto address = AnfAlgo::GetMutableOutputAddr(iter.first, 0);
+    MS_EXCEPTION_IF_NULL(address);
+    resource_manager_.MemFree(address->ptr_);
+    address->ptr_ = nullptr;
+    MS_EXCEPTION_IF_NULL(iter.second);
+    iter.second->set_device_address(nullptr);
+  }
+  input_param_tensor_map_.clear();
+  for (auto &address : bound_addresses_) {
+    MS_EXCEPTION_IF_NULL(address);
+    resource_manager_.MemFree(address->ptr_);
+    address->ptr_ = nullptr;
+  }
+  bound_addresses_.clear();
+}
+
 void CPUKernelRuntime::AddRuntimeAddress(DeviceAddress *address, std::vector<kernel::AddressPtr> *input_list) {
   MS_EXCEPTION_IF_NULL(address);
   MS_EXCEPTION_IF_NULL(input_list);
@@ -279,54 +319,227 @@ void CPUKernelRuntime::AddRuntimeAddress(DeviceAddress *address, std::vector<ker
   input_list->push_back(input);
 }
 
-void CPUKernelRuntime::IncreaseSummaryRefCount(const session::NamedSummaryOutputs &summary_outputs) {
+void CPUKernelRuntime::IncreaseSummaryRefCount(const session::KernelGraph *kernel_graph,
+                                               const session::NamedSummaryOutputs &summary_outputs) {
+  DynamicMallocScope dynamic_malloc_scope(&resource_manager_, kernel_graph);
   resource_manager_.IncreaseSummaryRefCount(summary_outputs);
 }
 
-void CPUKernelRuntime::DecreaseSummaryRefCount(const session::NamedSummaryOutputs &summary_outputs) {
+void CPUKernelRuntime::DecreaseSummaryRefCount(const session::KernelGraph *kernel_graph,
+                                               const session::NamedSummaryOutputs &summary_outputs) {
+  DynamicMallocScope dynamic_malloc_scope(&resource_manager_, kernel_graph);
   resource_manager_.DecreaseSummaryRefCount(summary_outputs);
 }
 
-bool CPUKernelRuntime::Run(session::KernelGraph *kernel_graph, bool is_task_sink, Debugger *debugger) {
-  MS_EXCEPTION_IF_NULL(kernel_graph);
-  resource_manager_.IncreaseAddressRefCount(kernel_graph);
-
-  auto kernels = kernel_graph->execution_order();
-  for (const auto &kernel : kernels) {
+void CPUKernelRuntime::LaunchKernel(const CNodePtr &kernel) {
+  MS_EXCEPTION_IF_NULL(kernel);
+#ifdef ENABLE_PROFILE
+  double start_time = GetTime();
+#endif
+  std::vector<kernel::AddressPtr> kernel_inputs;
+  std::vector<kernel::AddressPtr> kernel_workspaces;
+  std::vector<kernel::AddressPtr> kernel_outputs;
+  size_t input_num = AnfAlgo::GetInputTensorNum(kernel);
+  for (size_t i = 0; i < input_num; ++i) {
+    auto device_address = AnfAlgo::GetPrevNodeMutableOutputAddr(kernel, i).get();
+    MS_EXCEPTION_IF_NULL(device_address);
+    AddRuntimeAddress(device_address, &kernel_inputs);
+  }
+  size_t output_num = AnfAlgo::GetOutputTensorNum(kernel);
+  for (size_t i = 0; i < output_num; ++i) {
+    auto device_address = AnfAlgo::GetMutableOutputAddr(kernel, i).get();
+    MS_EXCEPTION_IF_NULL(device_address);
+    AddRuntimeAddress(device_address, &kernel_outputs);
+  }
+  auto kernel_mod = AnfAlgo::GetKernelMod(kernel);
+  MS_EXCEPTION_IF_NULL(kernel_mod);
+  for (size_t i = 0; i < kernel_mod->GetWorkspaceSizeList().size(); ++i) {
+    auto device_address = AnfAlgo::GetWorkspaceAddr(kernel, i);
+    MS_EXCEPTION_IF_NULL(device_address);
+    AddRuntimeAddress(device_address, &kernel_workspaces);
+  }
+  auto ret = kernel_mod->Launch(kernel_inputs, kernel_workspaces, kernel_outputs, 0);
+  resource_manager_.DecreaseAddressRefCount(kernel);
+  if (!ret) {
+    MS_LOG(EXCEPTION) << "Launch kernel failed.";
+  }
 #ifdef ENABLE_PROFILE
-    double start_time = GetTime();
+  double cost_time = GetTime() - start_time;
+  MS_LOG(INFO) << "cpu kernel: " << kernel->fullname_with_scope() << "  costs " << cost_time * 1e6 << " us";
 #endif
-    std::vector<kernel::AddressPtr> kernel_inputs;
-    std::vector<kernel::AddressPtr> kernel_workspaces;
-    std::vector<kernel::AddressPtr> kernel_outputs;
+}
+
+namespace {
+// Dependencies between the kernels of an execution order: data edges, plus edges keeping the execution order
+// of the kernels sharing a parameter (which may be updated in place) and of the communication kernels.
+std::vector<std::set<size_t>> GetKernelSuccessors(const std::vector<CNodePtr> &kernels) {
+  std::vector<std::set<size_t>> successors(kernels.size());
+  std::map<const DeviceAddress *, size_t> producers;
+  std::map<AnfNodePtr, size_t> last_parameter_users;
+  bool has_communication_kernel = false;
+  size_t last_communication_kernel = 0;
+  for (size_t i = 0; i < kernels.size(); ++i) {
+    const auto &kernel = kernels[i];
+    MS_EXCEPTION_IF_NULL(kernel);
     size_t input_num = AnfAlgo::GetInputTensorNum(kernel);
-    for (size_t i = 0; i < input_num; ++i) {
-      auto device_address = AnfAlgo::GetPrevNodeMutableOutputAddr(kernel, i).get();
-      MS_EXCEPTION_IF_NULL(device_address);
-      AddRuntimeAddress(device_address, &kernel_inputs);
+    for (size_t j = 0; j < input_num; ++j) {
+      auto kernel_with_index = AnfAlgo::GetPrevNodeOutput(kernel, j);
+      MS_EXCEPTION_IF_NULL(kernel_with_index.first);
+      if (kernel_with_index.first->isa<Parameter>()) {
+        auto iter = last_parameter_users.find(kernel_with_index.first);
+        if (iter != last_parameter_users.end() && iter->second != i) {
+          (void)successors[iter->second].insert(i);
+        }
+        last_parameter_users[kernel_with_index.first] = i;
+        continue;
+      }
+      auto address = AnfAlgo::GetPrevNodeMutableOutputAddr(kernel, j);
+      auto iter = producers.find(address.get());
+      if (iter != producers.end() && iter->second != i) {
+        (void)successors[iter->second].insert(i);
+      }
     }
     size_t output_num = AnfAlgo::GetOutputTensorNum(kernel);
-    for (size_t i = 0; i < output_num; ++i) {
-      auto device_address = AnfAlgo::GetMutableOutputAddr(kernel, i).get();
-      MS_EXCEPTION_IF_NULL(device_address);
-      AddRuntimeAddress(device_address, &kernel_outputs);
+    for (size_t j = 0; j < output_num; ++j) {
+      producers[AnfAlgo::GetMutableOutputAddr(kernel, j).get()] = i;
     }
-    auto kernel_mod = AnfAlgo::GetKernelMod(kernel);
-    MS_EXCEPTION_IF_NULL(kernel_mod);
-    for (size_t i = 0; i < kernel_mod->GetWorkspaceSizeList().size(); ++i) {
-      auto device_address = AnfAlgo::GetWorkspaceAddr(kernel, i);
-      MS_EXCEPTION_IF_NULL(device_address);
-      AddRuntimeAddress(device_address, &kernel_workspaces);
+    if (AnfAlgo::IsCommunicationOp(kernel)) {
+      if (has_communication_kernel) {
+        (void)successors[last_communication_kernel].insert(i);
+      }
+      has_communication_kernel = true;
+      last_communication_kernel = i;
+    }
+  }
+  return successors;
+}
+
+// Launches the kernels of an execution order by dataflow on the cpu kernel thread pool. A finished kernel schedules
+// the successors it makes ready, so no thread of the pool is held waiting for the producers of a kernel.
+class DataflowLauncher : public std::enable_shared_from_this<DataflowLauncher> {
+ public:
+  DataflowLauncher(std::vector<std::set<size_t>> successors, size_t parallel_num,
+                   std::function<void(size_t)> launch_kernel)
+      : successors_(std::move(successors)),
+        parallel_num_(parallel_num),
+        launch_kernel_(std::move(launch_kernel)),
+        wait_input_nums_(successors_.size(), 0) {}
+  ~DataflowLauncher() = default;
+
+  // Returns the number of launched kernels once no more kernel can be launched.
+  size_t Run() {
+    for (const auto &kernel_successors : successors_) {
+      for (auto successor : kernel_successors) {
+        wait_input_nums_[successor]++;
+      }
     }
-    auto ret = kernel_mod->Launch(kernel_inputs, kernel_workspaces, kernel_outputs, 0);
-    resource_manager_.DecreaseAddressRefCount(kernel);
-    if (!ret) {
-      MS_LOG(EXCEPTION) << "Launch kernel failed.";
+    std::vector<size_t> launch_kernels;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (size_t i = 0; i < successors_.size(); ++i) {
+        if (wait_input_nums_[i] == 0) {
+          ready_kernels_.push_back(i);
+        }
+      }
+      launch_kernels = TakeReadyKernels();
     }
-#ifdef ENABLE_PROFILE
-    double cost_time = GetTime() - start_time;
-    MS_LOG(INFO) << "cpu kernel: " << kernel->fullname_with_scope() << "  costs " << cost_time * 1e6 << " us";
-#endif
+    Schedule(launch_kernels);
+    // the calling thread helps the pool, it returns when nothing runs and nothing more can be scheduled
+    kernel::CPUThreadPool::GetInstance().RunUntil([this]() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return running_num_ == 0 && (exception_ != nullptr || ready_kernels_.empty());
+    });
+    if (exception_ != nullptr) {
+      std::rethrow_exception(exception_);
+    }
+    return finished_num_;
+  }
+
+ private:
+  // Takes ready kernels up to parallel_num_ running ones, requires mutex_.
+  std::vector<size_t> TakeReadyKernels() {
+    std::vector<size_t> launch_kernels;
+    while (exception_ == nullptr && running_num_ < parallel_num_ && !ready_kernels_.empty()) {
+      launch_kernels.push_back(ready_kernels_.front());
+      ready_kernels_.pop_front();
+      running_num_++;
+    }
+    return launch_kernels;
+  }
+
+  void Schedule(const std::vector<size_t> &launch_kernels) {
+    for (auto index : launch_kernels) {
+      kernel::CPUThreadPool::GetInstance().Schedule(
+        [launcher = shared_from_this(), index]() { launcher->LaunchKernel(index); });
+    }
+  }
+
+  void LaunchKernel(size_t index) {
+    std::exception_ptr exception = nullptr;
+    try {
+      launch_kernel_(index);
+    } catch (...) {
+      exception = std::current_exception();
+    }
+    std::vector<size_t> launch_kernels;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      running_num_--;
+      if (exception != nullptr) {
+        if (exception_ == nullptr) {
+          exception_ = exception;
+        }
+      } else {
+        finished_num_++;
+        for (auto successor : successors_[index]) {
+          if (--wait_input_nums_[successor] == 0) {
+            ready_kernels_.push_back(successor);
+          }
+        }
+      }
+      launch_kernels = TakeReadyKernels();
+    }
+    Schedule(launch_kernels);
+  }
+
+  std::vector<std::set<size_t>> successors_;
+  size_t parallel_num_;
+  std::function<void(size_t)> launch_kernel_;
+  std::mutex mutex_;
+  std::deque<size_t> ready_kernels_;
+  std::vector<size_t> wait_input_nums_;
+  size_t running_num_{0};
+  size_t finished_num_{0};
+  std::exception_ptr exception_{nullptr};
+};
+}  // namespace
+
+void CPUKernelRuntime::LaunchKernelsInParallel(const std::vector<CNodePtr> &kernels, size_t parallel_num) {
+  auto launcher = std::make_shared<DataflowLauncher>(GetKernelSuccessors(kernels), parallel_num,
+                                                     [this, &kernels](size_t index) { LaunchKernel(kernels[index]); });
+  auto finished_num = launcher->Run();
+  if (finished_num != kernels.size()) {
+    MS_LOG(EXCEPTION) << "Only " << finished_num << " of " << kernels.size() << " kernels are launched.";
+  }
+}
+
+bool CPUKernelRuntime::Run(session::KernelGraph *kernel_graph, bool is_task_sink, Debugger *debugger) {
+  MS_EXCEPTION_IF_NULL(kernel_graph);
+  DynamicMallocScope dynamic_malloc_scope(&resource_manager_, kernel_graph);
+  resource_manager_.IncreaseAddressRefCount(kernel_graph);
+
+  auto kernels = kernel_graph->execution_order();
+  auto context_ptr = MsContext::GetInstance();
+  MS_EXCEPTION_IF_NULL(context_ptr);
+  size_t parallel_num = context_ptr->get_param<uint32_t>(MS_CTX_CPU_INTER_OP_PARALLEL_NUM);
+  // without a worker in the pool the kernels would be launched inline, one from the other
+  bool has_worker = kernel::CPUThreadPool::GetInstance().thread_num() > 1;
+  if (parallel_num > 1 && resource_manager_.dynamic_malloc() && has_worker) {
+    LaunchKernelsInParallel(kernels, parallel_num);
+    return true;
+  }
+  for (const auto &kernel : kernels) {
+    LaunchKernel(kernel);
   }
   return true;
 }
@@ -40,8 +40,11 @@ class CPUKernelRuntime : public KernelRuntime {
   void AssignKernelAddress(session::KernelGraph *kernel_graph);
   void BindInputOutput(session::KernelGraph *kernel_graph, const std::vector<tensor::TensorPtr> &inputs,
                        VectorRef *outputs);
-  void IncreaseSummaryRefCount(const session::NamedSummaryOutputs &summary_outputs);
-  void DecreaseSummaryRefCount(const session::NamedSummaryOutputs &summary_outputs);
+  void RunOpClearMemory(const session::KernelGraph *kernel_graph);
+  void IncreaseSummaryRefCount(const session::KernelGraph *kernel_graph,
+                               const session::NamedSummaryOutputs &summary_outputs);
+  void DecreaseSummaryRefCount(const session::KernelGraph *kernel_graph,
+                               const session::NamedSummaryOutputs &summary_outputs);
 
  protected:
   bool SyncStream() override { return true; };
@@ -56,6 +59,8 @@ class CPUKernelRuntime : public KernelRuntime {
   void AssignInputNodeAddress(const session::KernelGraph *kernel_graph);
   void AssignKernelOutputAddress(const session::KernelGraph *kernel_graph);
   void AddRuntimeAddress(DeviceAddress *address, std::vector<kernel::AddressPtr> *input_list);
+  void LaunchKernel(const CNodePtr &kernel);
+  void LaunchKernelsInParallel(const std::vector<CNodePtr> &kernels, size_t parallel_num);
   CPUResourceManager resource_manager_;
   std::set<DeviceAddressPtr> bound_addresses_;
   std::map<AnfNodePtr, tensor::TensorPtr> input_param_tensor_map_;
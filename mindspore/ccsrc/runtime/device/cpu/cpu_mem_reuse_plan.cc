@@ -0,0 +1,187 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "runtime/device/cpu/cpu_mem_reuse_plan.h"
+#include <algorithm>
+#include <limits>
+#include "backend/session/anf_runtime_algorithm.h"
+
+namespace mindspore {
+namespace device {
+namespace cpu {
+namespace {
+size_t AlignMemSize(size_t size) { return (size + kCPUMemAlignSize - 1) / kCPUMemAlignSize * kCPUMemAlignSize; }
+
+bool IsLifetimeOverlap(const CPUMemBlock &a, const CPUMemBlock &b) {
+  return a.first_step <= b.last_step && b.first_step <= a.last_step;
+}
+}  // namespace
+
+void CPUMemReusePlan::Reset() {
+  graph_ = nullptr;
+  blocks_.clear();
+  block_index_.clear();
+  naive_mem_size_ = 0;
+  planned_mem_size_ = 0;
+}
+
+void CPUMemReusePlan::AddBlock(DeviceAddress *address, size_t step) {
+  MS_EXCEPTION_IF_NULL(address);
+  if (address->ptr_ != nullptr) {
+    return;
+  }
+  auto iter = block_index_.find(address);
+  if (iter != block_index_.end()) {
+    auto &block = blocks_[iter->second];
+    block.last_step = std::max(block.last_step, step);
+    return;
+  }
+  CPUMemBlock block;
+  block.address = address;
+  block.size = address->size_;
+  block.first_step = step;
+  block.last_step = step;
+  block_index_[address] = blocks_.size();
+  blocks_.push_back(block);
+  naive_mem_size_ += address->size_;
+}
+
+void CPUMemReusePlan::ExtendBlockToEnd(const AnfNodePtr &node, size_t index, size_t end_step) {
+  MS_EXCEPTION_IF_NULL(node);
+  if (!node->isa<CNode>() || !AnfAlgo::OutputAddrExist(node, index)) {
+    return;
+  }
+  auto address = AnfAlgo::GetMutableOutputAddr(node, index, true);
+  auto iter = block_index_.find(address.get());
+  if (iter != block_index_.end()) {
+    blocks_[iter->second].last_step = end_step;
+  }
+}
+
+size_t CPUMemReusePlan::MemPlan(const session::KernelGraph *graph) {
+  MS_EXCEPTION_IF_NULL(graph);
+  Reset();
+  graph_ = graph;
+  auto kernels = graph->execution_order();
+  for (size_t step = 0; step < kernels.size(); ++step) {
+    const auto &kernel = kernels[step];
+    MS_EXCEPTION_IF_NULL(kernel);
+    size_t input_num = AnfAlgo::GetInputTensorNum(kernel);
+    for (size_t i = 0; i < input_num; ++i) {
+      auto kernel_with_index = AnfAlgo::GetPrevNodeOutput(kernel, i);
+      MS_EXCEPTION_IF_NULL(kernel_with_index.first);
+      if (kernel_with_index.first->isa<Parameter>()) {
+        continue;
+      }
+      auto address = AnfAlgo::GetMutableOutputAddr(kernel_with_index.first, kernel_with_index.second, true);
+      AddBlock(address.get(), step);
+    }
+
+    size_t output_num = AnfAlgo::GetOutputTensorNum(kernel);
+    for (size_t i = 0; i < output_num; ++i) {
+      auto address = AnfAlgo::GetMutableOutputAddr(kernel, i);
+      AddBlock(address.get(), step);
+    }
+
+    auto kernel_mod = AnfAlgo::GetKernelMod(kernel);
+    MS_EXCEPTION_IF_NULL(kernel_mod);
+    for (size_t i = 0; i < kernel_mod->GetWorkspaceSizeList().size(); ++i) {
+      auto address = AnfAlgo::GetWorkspaceAddr(kernel, i);
+      AddBlock(address, step);
+    }
+  }
+
+  // graph outputs and summary tensors are read after the last kernel, keep them alive until the end
+  size_t end_step = kernels.empty() ? 0 : kernels.size() - 1;
+  auto output_nodes = AnfAlgo::GetAllOutput(graph->output(), {prim::kPrimTupleGetItem});
+  for (const auto &output : output_nodes) {
+    auto item_with_index = AnfAlgo::VisitKernelWithReturnType(output, 0, true);
+    ExtendBlockToEnd(item_with_index.first, item_with_index.second, end_step);
+  }
+  for (const auto &summary_item : graph->summary_nodes()) {
+    ExtendBlockToEnd(summary_item.second.first, IntToSize(summary_item.second.second), end_step);
+  }
+
+  planned_mem_size_ = AssignOffsets(&blocks_);
+  return planned_mem_size_;
+}
+
+void CPUMemReusePlan::MemAssign(const session::KernelGraph *graph, uint8_t *base_ptr) {
+  MS_EXCEPTION_IF_NULL(graph);
+  MS_EXCEPTION_IF_NULL(base_ptr);
+  if (graph != graph_) {
+    (void)MemPlan(graph);
+  }
+  for (auto &block : blocks_) {
+    MS_EXCEPTION_IF_NULL(block.address);
+    if (block.address->ptr_ == nullptr) {
+      block.address->ptr_ = base_ptr + block.offset;
+    }
+  }
+  Reset();
+}
+
+size_t CPUMemReusePlan::AssignOffsets(std::vector<CPUMemBlock> *blocks) {
+  MS_EXCEPTION_IF_NULL(blocks);
+  std::vector<size_t> order(blocks->size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  std::stable_sort(order.begin(), order.end(), [blocks](size_t a, size_t b) {
+    const auto &block_a = (*blocks)[a];
+    const auto &block_b = (*blocks)[b];
+    if (block_a.size != block_b.size) {
+      return block_a.size > block_b.size;
+    }
+    return block_a.first_step < block_b.first_step;
+  });
+
+  size_t total_size = 0;
+  std::vector<size_t> placed;
+  for (auto index : order) {
+    auto &block = (*blocks)[index];
+    size_t aligned_size = AlignMemSize(block.size);
+    std::vector<const CPUMemBlock *> live_blocks;
+    for (auto placed_index : placed) {
+      const auto &other = (*blocks)[placed_index];
+      if (IsLifetimeOverlap(block, other)) {
+        live_blocks.push_back(&other);
+      }
+    }
+    std::sort(live_blocks.begin(), live_blocks.end(),
+              [](const CPUMemBlock *a, const CPUMemBlock *b) { return a->offset < b->offset; });
+
+    size_t best_offset = std::numeric_limits<size_t>::max();
+    size_t best_gap = std::numeric_limits<size_t>::max();
+    size_t free_begin = 0;
+    for (auto live_block : live_blocks) {
+      if (live_block->offset > free_begin) {
+        size_t gap = live_block->offset - free_begin;
+        if (gap >= aligned_size && gap < best_gap) {
+          best_gap = gap;
+          best_offset = free_begin;
+        }
+      }
+      free_begin = std::max(free_begin, live_block->offset + AlignMemSize(live_block->size));
+    }
+    block.offset = best_offset != std::numeric_limits<size_t>::max() ? best_offset : free_begin;
+    total_size = std::max(total_size, block.offset + aligned_size);
+    placed.push_back(index);
+  }
+  return total_size;
+}
+}  // namespace cpu
+}  // namespace device
+}  // namespace mindspore
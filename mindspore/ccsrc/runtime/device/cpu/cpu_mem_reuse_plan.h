@@ -0,0 +1,69 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_RUNTIME_DEVICE_CPU_CPU_MEM_REUSE_PLAN_H_
+#define MINDSPORE_CCSRC_RUNTIME_DEVICE_CPU_CPU_MEM_REUSE_PLAN_H_
+
+#include <map>
+#include <vector>
+#include "backend/session/kernel_graph.h"
+#include "runtime/device/device_address.h"
+
+namespace mindspore {
+namespace device {
+namespace cpu {
+constexpr size_t kCPUMemAlignSize = 64;
+
+// A buffer living in the graph memory arena during the steps [first_step, last_step] of the execution order.
+struct CPUMemBlock {
+  DeviceAddress *address{nullptr};
+  size_t size{0};
+  size_t offset{0};
+  size_t first_step{0};
+  size_t last_step{0};
+};
+
+// Liveness based memory plan for cpu kernel graphs: a buffer whose last consumer has run is reused by
+// the buffers defined after it, instead of every output and workspace owning a private slice of the arena.
+class CPUMemReusePlan {
+ public:
+  CPUMemReusePlan() = default;
+  ~CPUMemReusePlan() = default;
+
+  size_t MemPlan(const session::KernelGraph *graph);
+  void MemAssign(const session::KernelGraph *graph, uint8_t *base_ptr);
+  size_t naive_mem_size() const { return naive_mem_size_; }
+  size_t planned_mem_size() const { return planned_mem_size_; }
+
+  // Greedy by size best fit: place the blocks in the arena so that blocks with overlapping lifetimes
+  // never overlap in memory, returns the arena size.
+  static size_t AssignOffsets(std::vector<CPUMemBlock> *blocks);
+
+ private:
+  void Reset();
+  void AddBlock(DeviceAddress *address, size_t step);
+  void ExtendBlockToEnd(const AnfNodePtr &node, size_t index, size_t end_step);
+
+  const session::KernelGraph *graph_{nullptr};
+  std::vector<CPUMemBlock> blocks_;
+  std::map<DeviceAddress *, size_t> block_index_;
+  size_t naive_mem_size_{0};
+  size_t planned_mem_size_{0};
+};
+}  // namespace cpu
+}  // namespace device
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_RUNTIME_DEVICE_CPU_CPU_MEM_REUSE_PLAN_H_
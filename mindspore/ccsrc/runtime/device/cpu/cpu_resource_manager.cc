@@ -19,6 +19,8 @@
 namespace mindspore {
 namespace device {
 namespace cpu {
+constexpr size_t kMaxMemPoolSize = 1UL << 30;
+
 CPUResourceManager::~CPUResourceManager() { MemFree(); }
 
 void CPUResourceManager::MemFree() {
@@ -32,10 +34,26 @@ void CPUResourceManager::MemFree() {
     free(iter.first);
   }
   dynamic_mem_.clear();
+
+  for (auto &&iter : mem_pool_) {
+    for (auto ptr : iter.second) {
+      free(ptr);
+    }
+  }
+  mem_pool_.clear();
+  mem_pool_size_ = 0;
 }
 
-void CPUResourceManager::AssignMemory(const session::KernelGraph *graph) {
-  size_t graph_mem_size = mem_plan_.MemPlan(graph);
+void CPUResourceManager::AssignMemory(const session::KernelGraph *graph, bool enable_mem_reuse) {
+  MS_EXCEPTION_IF_NULL(graph);
+  size_t graph_mem_size = 0;
+  if (enable_mem_reuse) {
+    graph_mem_size = mem_reuse_plan_.MemPlan(graph);
+    MS_LOG(INFO) << "Graph " << graph->graph_id() << " planned memory size: " << graph_mem_size
+                 << ", naive memory size: " << mem_reuse_plan_.naive_mem_size();
+  } else {
+    graph_mem_size = mem_plan_.MemPlan(graph);
+  }
   if (graph_mem_size > mem_size_) {
     if (mem_size_ > 0) {
       dynamic_mem_[mem_ptr_] = mem_size_;
@@ -44,22 +62,47 @@ void CPUResourceManager::AssignMemory(const session::KernelGraph *graph) {
     mem_ptr_ = reinterpret_cast<uint8_t *>(malloc(graph_mem_size));
     if (mem_ptr_ != nullptr) {
       mem_size_ = graph_mem_size;
-      dynamic_malloc_ = false;
     } else {
       MS_LOG(INFO) << "Switch to dynamic malloc";
-      dynamic_malloc_ = true;
     }
   }
-  if (dynamic_malloc_) {
+  bool dynamic_malloc = graph_mem_size > mem_size_;
+  set_graph_dynamic_malloc(graph->graph_id(), dynamic_malloc);
+  if (dynamic_malloc) {
     return;
   }
-  mem_plan_.MemAssign(graph, mem_ptr_);
+  if (enable_mem_reuse) {
+    mem_reuse_plan_.MemAssign(graph, mem_ptr_);
+  } else {
+    mem_plan_.MemAssign(graph, mem_ptr_);
+  }
+}
+
+void CPUResourceManager::set_graph_dynamic_malloc(uint32_t graph_id, bool dynamic_malloc) {
+  if (dynamic_malloc) {
+    (void)dynamic_malloc_graphs_.insert(graph_id);
+  } else {
+    (void)dynamic_malloc_graphs_.erase(graph_id);
+  }
 }
 
 void *CPUResourceManager::MemMalloc(size_t mem_size) {
-  void *ptr = malloc(mem_size);
+  void *ptr = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(mem_mutex_);
+    auto iter = mem_pool_.find(mem_size);
+    if (iter != mem_pool_.end() && !iter->second.empty()) {
+      ptr = iter->second.back();
+      iter->second.pop_back();
+      mem_pool_size_ -= mem_size;
+    }
+  }
+  if (ptr == nullptr) {
+    ptr = malloc(mem_size);
+  }
   if (ptr != nullptr) {
     memset_s(ptr, mem_size, 0, mem_size);
+    std::lock_guard<std::mutex> lock(mem_mutex_);
     dynamic_mem_[ptr] = mem_size;
     return ptr;
   } else {
@@ -68,10 +111,17 @@ void *CPUResourceManager::MemMalloc(size_t mem_size) {
 }
 
 void CPUResourceManager::MemFree(void *ptr) {
+  std::lock_guard<std::mutex> lock(mem_mutex_);
   auto iter = dynamic_mem_.find(ptr);
   if (iter != dynamic_mem_.end()) {
+    auto mem_size = iter->second;
     (void)dynamic_mem_.erase(iter);
-    free(ptr);
+    if (mem_pool_size_ + mem_size > kMaxMemPoolSize) {
+      free(ptr);
+      return;
+    }
+    mem_pool_[mem_size].push_back(ptr);
+    mem_pool_size_ += mem_size;
   }
 }
 
@@ -145,6 +195,7 @@ void CPUResourceManager::DecreaseAddressRefCount(const AnfNodePtr &kernel) {
     return;
   }
   MS_EXCEPTION_IF_NULL(kernel);
+  std::lock_guard<std::mutex> lock(ref_count_mutex_);
   size_t input_num = AnfAlgo::GetInputTensorNum(kernel);
   for (size_t i = 0; i < input_num; ++i) {
     auto address = AnfAlgo::GetPrevNodeMutableOutputAddr(kernel, i);
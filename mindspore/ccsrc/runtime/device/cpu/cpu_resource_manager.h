@@ -18,10 +18,14 @@
 
 #include <vector>
 #include <map>
+#include <set>
+#include <unordered_map>
+#include <mutex>
 #include "backend/session/kernel_graph.h"
 #include "backend/session/session_basic.h"
 #include "runtime/device/device_address.h"
 #include "runtime/device/cpu/cpu_simple_mem_plan.h"
+#include "runtime/device/cpu/cpu_mem_reuse_plan.h"
 namespace mindspore {
 namespace device {
 namespace cpu {
@@ -30,22 +34,53 @@ class CPUResourceManager {
   CPUResourceManager() = default;
   ~CPUResourceManager();
 
-  void AssignMemory(const session::KernelGraph *graph);
+  void AssignMemory(const session::KernelGraph *graph, bool enable_mem_reuse = false);
   void IncreaseAddressRefCount(const session::KernelGraph *graph);
   void DecreaseAddressRefCount(const AnfNodePtr &kernel);
   void *MemMalloc(size_t mem_size);
   void MemFree(void *ptr);
   void IncreaseSummaryRefCount(const session::NamedSummaryOutputs &summary_outputs);
   void DecreaseSummaryRefCount(const session::NamedSummaryOutputs &summary_outputs);
+  // whether the memory of the graph being run is malloced at launch, see DynamicMallocScope
+  bool dynamic_malloc() const { return dynamic_malloc_; }
+  void set_dynamic_malloc(bool dynamic_malloc) { dynamic_malloc_ = dynamic_malloc; }
+  // whether the memory of a graph is malloced at launch instead of being assigned by AssignMemory
+  bool graph_dynamic_malloc(uint32_t graph_id) const { return dynamic_malloc_graphs_.count(graph_id) > 0; }
+  void set_graph_dynamic_malloc(uint32_t graph_id, bool dynamic_malloc);
 
  private:
   void MemFree();
   CPUSimpleMemPlan mem_plan_;
+  CPUMemReusePlan mem_reuse_plan_;
 
   size_t mem_size_{0};
   uint8_t *mem_ptr_{nullptr};
   bool dynamic_malloc_{false};
+  std::set<uint32_t> dynamic_malloc_graphs_;
   std::map<void *, size_t> dynamic_mem_;
+  // released dynamic memory kept by size, single ops run repeatedly with the same shapes reuse it
+  std::unordered_map<size_t, std::vector<void *>> mem_pool_;
+  size_t mem_pool_size_{0};
+  // kernels launched in parallel malloc and release dynamic memory concurrently
+  std::mutex mem_mutex_;
+  std::mutex ref_count_mutex_;
+};
+
+// Switches the resource manager to the memory mode of a graph for the lifetime of the scope
+class DynamicMallocScope {
+ public:
+  DynamicMallocScope(CPUResourceManager *resource_manager, const session::KernelGraph *graph)
+      : resource_manager_(resource_manager), prev_dynamic_malloc_(resource_manager->dynamic_malloc()) {
+    MS_EXCEPTION_IF_NULL(graph);
+    resource_manager_->set_dynamic_malloc(resource_manager_->graph_dynamic_malloc(graph->graph_id()));
+  }
+  ~DynamicMallocScope() { resource_manager_->set_dynamic_malloc(prev_dynamic_malloc_); }
+  DynamicMallocScope(const DynamicMallocScope &) = delete;
+  DynamicMallocScope &operator=(const DynamicMallocScope &) = delete;
+
+ private:
+  CPUResourceManager *resource_manager_;
+  bool prev_dynamic_malloc_;
 };
 }  // namespace cpu
 }  // namespace device
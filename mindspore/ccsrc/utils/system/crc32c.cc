@@ -16,6 +16,12 @@
 
 #include "utils/system/crc32c.h"
 #include <stdint.h>
+#include <cstring>
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <nmmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
 
 namespace mindspore {
 namespace system {
@@ -282,10 +288,59 @@ static inline void CRC32T8(uint32 *crc, const uint8 **p) {
   *p += 4;
 }
 
+#if (defined(__GNUC__) && defined(__x86_64__)) || (defined(__aarch64__) && defined(__ARM_FEATURE_CRC32))
+static inline uint64_t Load64(const uint8_t *p) {
+  uint64_t value;
+  (void)memcpy(&value, p, sizeof(value));
+  return value;
+}
+#endif
+
+#if defined(__GNUC__) && defined(__x86_64__)
+// Use the crc32 instruction of SSE4.2, the caller checks that the cpu has it
+__attribute__((target("sse4.2"))) static uint32_t HardwareCrc32c(uint32_t crc, const uint8_t *bp, const uint8_t *ep) {
+  uint64_t crc64 = crc;
+  while (ep - bp >= 8) {
+    crc64 = _mm_crc32_u64(crc64, Load64(bp));
+    bp += 8;
+  }
+  crc = static_cast<uint32_t>(crc64);
+  while (bp < ep) {
+    crc = _mm_crc32_u8(crc, *bp++);
+  }
+  return crc;
+}
+
+static bool HasHardwareCrc32c() {
+  static const bool has_sse42 = __builtin_cpu_supports("sse4.2");
+  return has_sse42;
+}
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+// Use the crc32c instructions of armv8
+static uint32_t HardwareCrc32c(uint32_t crc, const uint8_t *bp, const uint8_t *ep) {
+  while (ep - bp >= 8) {
+    crc = __crc32cd(crc, Load64(bp));
+    bp += 8;
+  }
+  while (bp < ep) {
+    crc = __crc32cb(crc, *bp++);
+  }
+  return crc;
+}
+
+static bool HasHardwareCrc32c() { return true; }
+#endif
+
 // calc the crc32c value
 uint32 Crc32c::MakeCrc32c(uint32 init_crc, const char *data, size_t size) {
   MS_EXCEPT_CHECK_NULL(data);
   uint32_t crc = init_crc ^ 0xffffffffu;
+#if (defined(__GNUC__) && defined(__x86_64__)) || (defined(__aarch64__) && defined(__ARM_FEATURE_CRC32))
+  if (HasHardwareCrc32c()) {
+    auto *p = reinterpret_cast<const uint8_t *>(data);
+    return HardwareCrc32c(crc, p, p + size) ^ 0xffffffffu;
+  }
+#endif
   const unsigned int OFFSET = 8;
 
   // Get the origin begin and end address(not aligment)
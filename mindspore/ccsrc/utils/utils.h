@@ -48,6 +48,9 @@ constexpr auto kFusedBatchNormExWithActivation = "FusedBatchNormExWithActivation
 constexpr auto kFusedBatchNormExWithAddAndActivation = "FusedBatchNormExWithAddAndActivation";
 constexpr auto kFusedBatchNormGradEx = "FusedBatchNormGradEx";
 constexpr auto kFusedBatchNormGradExWithActivation = "FusedBatchNormGradExWithActivation";
+constexpr auto kFusedConv2DOpName = "FusedConv2D";
+constexpr auto kFusedMatMulOpName = "FusedMatMul";
+constexpr auto kFusedBatchNormWithActivationOpName = "FusedBatchNormWithActivation";
 constexpr auto kFusedBatchNormGradExWithAddAndActivation = "FusedBatchNormGradExWithAddAndActivation";
 constexpr auto kClearZeroOpName = "ClearZero";
 constexpr auto kAtomicAddrCleanOpName = "AtomicAddrClean";
@@ -257,6 +260,8 @@ constexpr auto kAttrFixPrecision = "fix_precision";
 constexpr auto kAttrOutputPrecision = "output_precision";
 constexpr auto kAttrOutputUsedNum = "output_used_num";
 constexpr auto kAttrHasBias = "has_bias";
+constexpr auto kAttrActivationType = "activation_type";
+constexpr auto kAttrDataFormat = "data_format";
 constexpr auto kAttrN = "n";
 constexpr auto kAttrLabelForInsertStreamActive = "label_for_insert_stream_active";
 constexpr auto kAttrFusion = "fusion";
@@ -213,6 +213,16 @@ class _Context:
             raise ValueError(f"Max call depth must be greater than 0, but got {max_call_depth}")
         self.set_param(ms_ctx_param.max_call_depth, max_call_depth)
 
+    def set_cpu_thread_num(self, cpu_thread_num):
+        if cpu_thread_num < 0:
+            raise ValueError(f"Cpu thread num must be greater than or equal to 0, but got {cpu_thread_num}")
+        self.set_param(ms_ctx_param.cpu_thread_num, cpu_thread_num)
+
+    def set_cpu_inter_op_parallel_num(self, cpu_inter_op_parallel_num):
+        if cpu_inter_op_parallel_num <= 0:
+            raise ValueError(f"Cpu inter op parallel num must be greater than 0, but got {cpu_inter_op_parallel_num}")
+        self.set_param(ms_ctx_param.cpu_inter_op_parallel_num, cpu_inter_op_parallel_num)
+
     def set_profiling_options(self, option):
         options = ["training_trace", "task_trace",
                    "task_trace:training_trace", "training_trace:task_trace", "op_trace"]
@@ -264,6 +274,8 @@ class _Context:
         'device_target': set_device_target,
         'device_id': set_device_id,
         'max_call_depth': set_max_call_depth,
+        'cpu_thread_num': set_cpu_thread_num,
+        'cpu_inter_op_parallel_num': set_cpu_inter_op_parallel_num,
         'profiling_options': set_profiling_options,
         'variable_memory_max_size': set_variable_memory_max_size,
         'max_device_memory': set_max_device_memory,
@@ -481,7 +493,8 @@ def _check_target_specific_cfgs(device, arg_key):
                  save_dump_path=str, enable_reduce_precision=bool, variable_memory_max_size=str,
                  enable_profiling=bool, profiling_options=str, enable_auto_mixed_precision=bool,
                  enable_graph_kernel=bool, check_bprop=bool, max_device_memory=str, print_file_path=str,
-                 enable_sparse=bool, max_call_depth=int)
+                 enable_sparse=bool, max_call_depth=int, cpu_thread_num=int, enable_cpu_affinity=bool,
+                 cpu_inter_op_parallel_num=int)
 def set_context(**kwargs):
     """
     Sets context for running environment.
@@ -507,10 +520,13 @@ def set_context(**kwargs):
     Common(CPU/GPU/Ascend)       Ascend                       GPU
     ===========================  ===========================  =================
     check_bprop                  enable_auto_mixed_precision  max_device_memory
-    device_id                    enable_dump
-    device_target                enable_profiling
-    enable_graph_kernel          variable_memory_max_size
-    enable_reduce_precision      print_file_path
+    cpu_inter_op_parallel_num    enable_dump
+    cpu_thread_num               enable_profiling
+    device_id                    variable_memory_max_size
+    device_target                print_file_path
+    enable_cpu_affinity
+    enable_graph_kernel
+    enable_reduce_precision
     enable_sparse
     max_call_depth
     mode
@@ -562,6 +578,13 @@ def set_context(**kwargs):
             suffix to the file. Default: ''.
         enable_sparse (bool): Whether to enable sparsity feature. Default: False.
         max_call_depth(int): Specify the maximum depth of function call. Default: 1000.
+        cpu_thread_num (int): Number of threads used by the intra-op thread pool of CPU kernels, 0 means the
+            number of hardware threads. The pool is created when the first CPU kernel runs, it must be set before
+            and later changes have no effect. Default: 0.
+        enable_cpu_affinity (bool): Whether to bind the threads of the CPU kernel thread pool to cores. Read once
+            like cpu_thread_num. Default: False.
+        cpu_inter_op_parallel_num (int): Maximum number of independent CPU kernels launched at the same time in
+            graph mode, 1 means the kernels are launched one by one in execution order. Default: 1.
 
     Raises:
         ValueError: If input key is not an attribute in context.
@@ -583,6 +606,7 @@ def set_context(**kwargs):
         >>> context.set_context(max_device_memory="3.5GB")
         >>> context.set_context(print_file_path="print.pb")
         >>> context.set_context(max_call_depth=80)
+        >>> context.set_context(cpu_thread_num=16, enable_cpu_affinity=True)
     """
     ctx = _context()
     # set device target first
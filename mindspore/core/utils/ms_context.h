@@ -55,6 +55,7 @@ enum MsCtxParam : unsigned {
   MS_CTX_TYPE_BOOL_BEGIN,
   MS_CTX_ENABLE_AUTO_MIXED_PRECISION = MS_CTX_TYPE_BOOL_BEGIN,
   MS_CTX_CHECK_BPROP_FLAG,
+  MS_CTX_ENABLE_CPU_AFFINITY,
   MS_CTX_ENABLE_DUMP,
   MS_CTX_ENABLE_DYNAMIC_MEM_POOL,
   MS_CTX_ENABLE_GPU_SUMMARY,
@@ -83,6 +84,8 @@ enum MsCtxParam : unsigned {
   // paramater of type uint32
   MS_CTX_TYPE_UINT32_BEGIN = MS_CTX_TYPE_INT_END,
   MS_CTX_DEVICE_ID = MS_CTX_TYPE_UINT32_BEGIN,
+  MS_CTX_CPU_THREAD_NUM,
+  MS_CTX_CPU_INTER_OP_PARALLEL_NUM,
   MS_CTX_GE_REF,
   MS_CTX_MAX_CALL_DEPTH,
   MS_CTX_TSD_REF,
@@ -21,7 +21,13 @@ import numpy
 import mindspore._c_dataengine as cde
 
 __all__ = ['set_seed', 'get_seed', 'set_prefetch_size', 'get_prefetch_size', 'set_num_parallel_workers',
-           'get_num_parallel_workers', 'set_monitor_sampling_interval', 'get_monitor_sampling_interval', 'load']
+           'get_num_parallel_workers', 'set_monitor_sampling_interval', 'get_monitor_sampling_interval',
+           'set_autotune_steps', 'get_autotune_steps', 'set_autotune_memory_budget', 'get_autotune_memory_budget',
+           'set_lock_free_connector', 'get_lock_free_connector', 'set_shuffle_partitions', 'get_shuffle_partitions',
+           'set_file_read_ahead', 'get_file_read_ahead', 'set_tfrecord_verify_crc', 'get_tfrecord_verify_crc',
+           'set_tensor_pool', 'get_tensor_pool', 'set_tensor_pool_thread_cache_size',
+           'get_tensor_pool_thread_cache_size', 'set_tensor_pool_central_cache_size',
+           'get_tensor_pool_central_cache_size', 'load']
 
 INT32_MAX = 2147483647
 UINT32_MAX = 4294967295
@@ -197,6 +203,301 @@ def get_callback_timeout():
     return _config.get_callback_timeout()
 
 
+def set_autotune_steps(steps):
+    """
+    Set the number of steps the pipeline is autotuned for.
+    During these steps the number of parallel workers of the map and batch operations and the size of the
+    connectors are adjusted from the live pipeline statistics. The chosen configuration is written to the log.
+
+    Args:
+        steps (int): Number of steps to autotune for, 0 turns autotuning off.
+
+    Raises:
+        ValueError: If steps is invalid (< 0 or > MAX_INT_32).
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>>
+        >>> # Tune the pipelines created from now on during their first 1000 steps.
+        >>> ds.config.set_autotune_steps(1000)
+    """
+    if steps < 0 or steps > INT32_MAX:
+        raise ValueError("Steps given is not within the required range.")
+    _config.set_autotune_steps(steps)
+
+
+def get_autotune_steps():
+    """
+    Get the number of steps the pipeline is autotuned for.
+
+    Returns:
+        Int, number of steps, 0 if autotuning is off.
+    """
+    return _config.get_autotune_steps()
+
+
+def set_autotune_memory_budget(budget):
+    """
+    Set the memory (in MB) the connectors of a pipeline may hold when autotuning.
+    The autotuner does not grow a connector if the buffers of all the connectors would exceed the budget.
+
+    Args:
+        budget (int): Memory budget in MB.
+
+    Raises:
+        ValueError: If budget is invalid (<= 0 or > MAX_INT_32).
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>>
+        >>> # Let the connectors hold up to 2GB of buffers.
+        >>> ds.config.set_autotune_memory_budget(2048)
+    """
+    if budget <= 0 or budget > INT32_MAX:
+        raise ValueError("Budget given is not within the required range.")
+    _config.set_autotune_memory_budget(budget)
+
+
+def get_autotune_memory_budget():
+    """
+    Get the memory (in MB) the connectors of a pipeline may hold when autotuning.
+
+    Returns:
+        Int, memory budget in MB.
+    """
+    return _config.get_autotune_memory_budget()
+
+
+def set_lock_free_connector(lock_free):
+    """
+    Set whether the connectors between the operations of a pipeline use lock free queues.
+    A lock free queue hands a buffer over without taking a lock, the threads waiting on it spin for a short while
+    before going to sleep. It lowers the hand-off latency of pipelines with many short operations.
+
+    Args:
+        lock_free (bool): Whether to use lock free queues in the pipelines created from now on.
+
+    Raises:
+        TypeError: If lock_free is not a bool.
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>>
+        >>> ds.config.set_lock_free_connector(True)
+    """
+    if not isinstance(lock_free, bool):
+        raise TypeError("lock_free isn't of type bool.")
+    _config.set_lock_free_connector(lock_free)
+
+
+def get_lock_free_connector():
+    """
+    Get whether the connectors between the operations of a pipeline use lock free queues.
+
+    Returns:
+        Bool, whether the connectors use lock free queues.
+    """
+    return _config.get_lock_free_connector()
+
+
+def set_shuffle_partitions(partitions):
+    """
+    Set the number of partitions the buffer of a shuffle operation is split into.
+    Rows are dealt to the partitions in turn, each partition shuffles its share of the buffer in its own thread
+    with its own random generator seeded from the shuffle seed, and the rows are collected from the partitions in
+    turn. The output is the same from run to run for a given seed and number of partitions, but differs from the
+    output of the single threaded shuffle.
+
+    Args:
+        partitions (int): Number of partitions, 1 keeps the single threaded shuffle.
+
+    Raises:
+        ValueError: If partitions is invalid (<= 0 or > MAX_INT_32).
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>>
+        >>> # Shuffle in 4 threads in the pipelines created from now on.
+        >>> ds.config.set_shuffle_partitions(4)
+    """
+    if partitions <= 0 or partitions > INT32_MAX:
+        raise ValueError("Partitions given is not within the required range.")
+    _config.set_shuffle_partitions(partitions)
+
+
+def get_shuffle_partitions():
+    """
+    Get the number of partitions the buffer of a shuffle operation is split into.
+
+    Returns:
+        Int, number of partitions, 1 if the shuffle is single threaded.
+    """
+    return _config.get_shuffle_partitions()
+
+
+def set_file_read_ahead(num_files):
+    """
+    Set the number of image files that ImageFolderDataset, ManifestDataset, CocoDataset and VOCDataset read ahead
+    of their workers.
+    The files are read by a pool of threads in the order given by the sampler, so that many reads are in flight at
+    once instead of one per worker. It helps most on network file systems and fast disks.
+    MindDataset asks the system to read ahead the data of that many rows, in the order given by the sampler.
+
+    Args:
+        num_files (int): Number of files read ahead, 0 turns the read ahead off.
+
+    Raises:
+        ValueError: If num_files is invalid (< 0 or > MAX_INT_32).
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>>
+        >>> # Keep up to 64 image files read ahead in the pipelines created from now on.
+        >>> ds.config.set_file_read_ahead(64)
+    """
+    if num_files < 0 or num_files > INT32_MAX:
+        raise ValueError("Num_files given is not within the required range.")
+    _config.set_file_read_ahead(num_files)
+
+
+def get_file_read_ahead():
+    """
+    Get the number of image files the leaf datasets read ahead of their workers.
+
+    Returns:
+        Int, number of files, 0 if the read ahead is off.
+    """
+    return _config.get_file_read_ahead()
+
+
+def set_tfrecord_verify_crc(verify_crc):
+    """
+    Set whether TFRecordDataset checks the crc of the length and the data of each record it reads.
+    A record whose crc does not match makes the pipeline fail instead of being decoded.
+
+    Args:
+        verify_crc (bool): Whether to check the crc in the pipelines created from now on.
+
+    Raises:
+        TypeError: If verify_crc is not a bool.
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>>
+        >>> ds.config.set_tfrecord_verify_crc(True)
+    """
+    if not isinstance(verify_crc, bool):
+        raise TypeError("verify_crc isn't of type bool.")
+    _config.set_tfrecord_verify_crc(verify_crc)
+
+
+def get_tfrecord_verify_crc():
+    """
+    Get whether TFRecordDataset checks the crc of the records it reads.
+
+    Returns:
+        Bool, whether the crc is checked.
+    """
+    return _config.get_tfrecord_verify_crc()
+
+
+def set_tensor_pool(enable):
+    """
+    Set whether the data of the tensors comes from the size class pool of the pipeline (default=True).
+    The pool keeps the freed blocks of the tensor data, in each thread and in a cache shared by the threads, and
+    hands them out again instead of asking the system. Turn it off to give the memory back to the system as soon as
+    a tensor is freed, the data of the tensors created from then on comes straight from the system.
+
+    Args:
+        enable (bool): Whether to use the size class pool.
+
+    Raises:
+        TypeError: If enable is not a bool.
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>>
+        >>> ds.config.set_tensor_pool(False)
+    """
+    if not isinstance(enable, bool):
+        raise TypeError("enable isn't of type bool.")
+    _config.set_tensor_pool(enable)
+
+
+def get_tensor_pool():
+    """
+    Get whether the data of the tensors comes from the size class pool.
+
+    Returns:
+        Bool, whether the size class pool is used.
+    """
+    return _config.get_tensor_pool()
+
+
+def set_tensor_pool_thread_cache_size(size):
+    """
+    Set the free tensor data (in MB) each thread keeps before giving some to the cache shared by the threads
+    (default=32). The limit applies to the blocks freed from now on.
+
+    Args:
+        size (int): Size of the cache of each thread in MB.
+
+    Raises:
+        ValueError: If size is invalid (< 0 or > MAX_INT_32).
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>>
+        >>> # Keep at most 8 MB of free tensor data in each thread.
+        >>> ds.config.set_tensor_pool_thread_cache_size(8)
+    """
+    if size < 0 or size > INT32_MAX:
+        raise ValueError("Size given is not within the required range.")
+    _config.set_tensor_pool_thread_cache_size(size)
+
+
+def get_tensor_pool_thread_cache_size():
+    """
+    Get the free tensor data (in MB) each thread keeps.
+
+    Returns:
+        Int, size of the cache of each thread in MB.
+    """
+    return _config.get_tensor_pool_thread_cache_size()
+
+
+def set_tensor_pool_central_cache_size(size):
+    """
+    Set the free tensor data (in MB) the cache shared by the threads keeps before freeing it to the system
+    (default=512). The limit applies to the blocks freed from now on.
+
+    Args:
+        size (int): Size of the shared cache in MB.
+
+    Raises:
+        ValueError: If size is invalid (< 0 or > MAX_INT_32).
+
+    Examples:
+        >>> import mindspore.dataset as ds
+        >>>
+        >>> # Keep at most 128 MB of free tensor data shared by the threads.
+        >>> ds.config.set_tensor_pool_central_cache_size(128)
+    """
+    if size < 0 or size > INT32_MAX:
+        raise ValueError("Size given is not within the required range.")
+    _config.set_tensor_pool_central_cache_size(size)
+
+
+def get_tensor_pool_central_cache_size():
+    """
+    Get the free tensor data (in MB) the cache shared by the threads keeps.
+
+    Returns:
+        Int, size of the shared cache in MB.
+    """
+    return _config.get_tensor_pool_central_cache_size()
+
+
 def __str__():
     """
     String representation of the configurations.
@@ -340,6 +340,13 @@ class Dataset:
         A seed can be provided to be used on the first epoch. In every subsequent
         epoch, the seed is changed to a new one, randomly generated value.
 
+        Note:
+            When the shuffle directly follows a dataset with random access (ImageFolderDataset,
+            MnistDataset, Cifar10Dataset, Cifar100Dataset, ManifestDataset, VOCDataset, CocoDataset
+            or AlbumDataset), the sample ids are shuffled instead of the rows. The rows come in the
+            same order, but the shuffle buffer only holds ids, so a large buffer_size takes little memory.
+            It does not apply when set_shuffle_partitions is more than 1.
+
         Args:
             buffer_size (int): The size of the buffer (must be larger than 1) for
                 shuffling. Setting buffer_size equal to the number of rows in the entire
@@ -1164,6 +1171,8 @@ class Dataset:
                 (default=-1, iterator can be iterated infinite number of epochs)
             output_numpy (bool, optional): Whether or not to output NumPy datatype.
                 If output_numpy=False, iterator will output MSTensor (default=False).
+                The NumPy arrays share the memory of the dataset and are read-only, copy them
+                (e.g. item.copy()) to modify them.
 
         Returns:
             Iterator, list of ndarrays.
@@ -1199,6 +1208,8 @@ class Dataset:
                 (default=-1, iterator can be iterated infinite number of epochs).
             output_numpy (bool, optional): Whether or not to output NumPy datatype,
                 if output_numpy=False, iterator will output MSTensor (default=False).
+                The NumPy arrays share the memory of the dataset and are read-only, copy them
+                (e.g. item["column1"].copy()) to modify them.
 
         Returns:
             Iterator, dictionary of column name-ndarray pair.
@@ -340,8 +340,8 @@ class DictIterator(Iterator):
         """
 
         if self.output_numpy:
-            return {k: v.as_array() for k, v in self.depipeline.GetNextAsMap().items()}
-        return {k: Tensor(v.as_array()) for k, v in self.depipeline.GetNextAsMap().items()}
+            return self.depipeline.GetNextAsMap()
+        return {k: Tensor(v) for k, v in self.depipeline.GetNextAsMap().items()}
 
 
 class TupleIterator(Iterator):
@@ -371,8 +371,8 @@ class TupleIterator(Iterator):
         """
 
         if self.output_numpy:
-            return [t.as_array() for t in self.depipeline.GetNextAsList()]
-        return [Tensor(t.as_array()) for t in self.depipeline.GetNextAsList()]
+            return self.depipeline.GetNextAsList()
+        return [Tensor(t) for t in self.depipeline.GetNextAsList()]
 
 
 class DummyIterator():
@@ -36,6 +36,8 @@ struct Model {
   Uint32Vector output_indices_;
   NodePtrVector nodes_;
   char *buf;
+  /// \brief Bytes number of buf when it maps the model file, 0 when buf is a private copy.
+  size_t mapped_size_ = 0;
 
   /// \brief Static method to create a Model pointer.
   ///
@@ -45,6 +47,16 @@ struct Model {
   /// \return Pointer of MindSpore Lite Model.
   static Model *Import(const char *model_buf, size_t size);
 
+  /// \brief Static method to create a Model pointer which maps the model file instead of copying it.
+  ///
+  /// \note Const tensors of the sessions compiled from the model point into the read-only mapping, so the mapping
+  /// is shared by all of them and is kept by Free until the model is destroyed.
+  ///
+  /// \param[in] model_path Define the path of the model file.
+  ///
+  /// \return Pointer of MindSpore Lite Model.
+  static Model *ImportFromFile(const char *model_path);
+
   /// \brief Free meta graph temporary buffer
   virtual void Free();
 
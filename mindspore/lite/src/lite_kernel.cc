@@ -27,7 +27,7 @@ void LiteKernel::InitOutTensorRefCount() {
 int LiteKernel::DecOutTensorRefCount() {
   for (auto *tensor : this->out_tensors_) {
     tensor->decRefCount();
-    if (0 >= tensor->RefCount()) {
+    if (0 >= tensor->RefCount() && (tensor->allocator() == nullptr || !tensor->allocator()->IsStatic())) {
       auto ret = tensor->FreeData();
       if (0 != ret) {
         MS_LOG(ERROR) << "Free tensor data failed";
@@ -87,7 +87,8 @@ int LiteSession::ConvertTensors(const lite::Model *model) {
         dstTensor->set_shape(shape);
       }
       MS_ASSERT(dstTensor->Size() == srcTensor->data()->size());
-      if (WeightTensorNeedCopy(model, i)) {
+      // a mapped model outlives the session, so its weights are used in place
+      if (model->mapped_size_ == 0 && WeightTensorNeedCopy(model, i)) {
         auto dst_data = dstTensor->MutableData();
         if (dst_data == nullptr) {
           MS_LOG(ERROR) << "MutableData from " << i << "th tensor is nullptr";
@@ -287,10 +288,33 @@ int LiteSession::CompileGraph(Model *model) {
     is_running_.store(false);
     return ret;
   }
+#ifndef SUPPORT_TRAIN
+  memory_planner_ = new (std::nothrow) MemoryPlanner(context_->allocator.get());
+  if (memory_planner_ == nullptr) {
+    MS_LOG(WARNING) << "New memory planner failed, tensors are allocated at run time";
+  } else {
+    memory_planner_->Init(this->kernels_, this->outputs_);
+  }
+  PlanMemory();
+#endif
   is_running_.store(false);
   return RET_OK;
 }
 
+void LiteSession::PlanMemory() {
+  if (memory_planner_ == nullptr) {
+    return;
+  }
+  // tensors fall back to the context allocator when the plan fails, so the graph still runs
+  auto ret = memory_planner_->Plan();
+  if (ret == RET_OK) {
+    MS_LOG(INFO) << "Static memory plan: arena size " << memory_planner_->arena_size() << " bytes, sum of tensor sizes "
+                 << memory_planner_->tensors_size() << " bytes";
+  } else if (ret != RET_NOT_SUPPORT) {
+    MS_LOG(WARNING) << "Static memory plan failed: " << ret << ", tensors are allocated at run time";
+  }
+}
+
 std::vector<mindspore::tensor::MSTensor *> LiteSession::GetInputs() const { return this->input_vec_; }
 
 int LiteSession::RunGraph(const session::KernelCallBack &before, const session::KernelCallBack &after) {
@@ -386,6 +410,9 @@ LiteSession::~LiteSession() {
     }
     delete tensor;
   }
+  // the arena is released after the tensors pointing into it
+  delete memory_planner_;
+  memory_planner_ = nullptr;
   // Tensor * in input_map output_map are freed in tensors
   input_map_.clear();
   output_node_map_.clear();
@@ -496,9 +523,12 @@ int LiteSession::Resize(const std::vector<mindspore::tensor::MSTensor *> &inputs
     if (resize_ret != RET_OK) {
       MS_LOG(ERROR) << "restore kernel size fail!ret: " << resize_ret;
     }
+    PlanMemory();
     is_running_.store(false);
     return ret;
   }
+  // lifetimes do not change with the shapes, only the offsets are planned again
+  PlanMemory();
   is_running_.store(false);
   return RET_OK;
 }
@@ -29,6 +29,7 @@
 #include "src/inner_context.h"
 #include "schema/model_generated.h"
 #include "src/executor.h"
+#include "src/runtime/memory_planner.h"
 #include "src/tensor.h"
 
 namespace mindspore {
@@ -84,6 +85,8 @@ class LiteSession : public session::LiteSession {
 
   int ResizeInputs(const std::vector<mindspore::tensor::MSTensor *> &inputs, const std::vector<std::vector<int>> &dims);
 
+  void PlanMemory();
+
  private:
   void ResetInputsShape(const std::vector<std::vector<int>> &dims);
 
@@ -107,6 +110,8 @@ class LiteSession : public session::LiteSession {
   // graph output tensor name -- output tensor
   std::unordered_map<std::string, mindspore::tensor::MSTensor *> output_tensor_map_;
   Executor *executor = nullptr;
+  // static arena of the kernel output tensors, nullptr when tensors are allocated at run time
+  MemoryPlanner *memory_planner_ = nullptr;
   std::atomic<bool> is_running_ = false;
 };
 }  // namespace lite
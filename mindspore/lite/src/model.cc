@@ -13,6 +13,14 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#endif
 #include "src/ops/primitive_c.h"
 #include "include/model.h"
 #include "src/common/log_adapter.h"
@@ -68,33 +76,22 @@ bool ConvertTensors(const schema::MetaGraph *meta_graph, Model *model) {
   return true;
 }
 
-Model *Model::Import(const char *model_buf, size_t size) {
-  if (model_buf == nullptr) {
-    MS_LOG(ERROR) << "The model buf is nullptr";
-    return nullptr;
-  }
+namespace {
+bool VerifyModelBuf(const char *model_buf, size_t size) {
   flatbuffers::Verifier verify((const uint8_t *)model_buf, size);
   if (!schema::VerifyMetaGraphBuffer(verify)) {
     MS_LOG(ERROR) << "The buffer is invalid and fail to create graph.";
-    return nullptr;
-  }
-  auto *model = new (std::nothrow) Model();
-  if (model == nullptr) {
-    MS_LOG(ERROR) << "new model fail!";
-    return nullptr;
-  }
-  model->buf = reinterpret_cast<char *>(malloc(size));
-  if (model->buf == nullptr) {
-    MS_LOG(ERROR) << "new inner model buf fail!";
-    delete (model);
-    return nullptr;
+    return false;
   }
-  memcpy(model->buf, model_buf, size);
+  return true;
+}
+
+// parse the meta graph held by model->buf, tensors of the model point into model->buf afterwards.
+bool ParseModelBuf(Model *model) {
   auto meta_graph = schema::GetMetaGraph(model->buf);
   if (meta_graph == nullptr) {
     MS_LOG(ERROR) << "meta_graph is nullptr!";
-    delete (model);
-    return nullptr;
+    return false;
   }
 
   if (meta_graph->name() != nullptr) {
@@ -118,11 +115,115 @@ Model *Model::Import(const char *model_buf, size_t size) {
     model->output_indices_.push_back(size_t(meta_graph->outputIndex()->GetAs<uint32_t>(i)));
   }
   if (!ConvertNodes(meta_graph, model)) {
+    return false;
+  }
+  return ConvertTensors(meta_graph, model);
+}
+
+#ifndef _WIN32
+char *MapModelFile(const char *model_path, size_t *size) {
+  int fd = open(model_path, O_RDONLY);
+  if (fd < 0) {
+    MS_LOG(ERROR) << "open model file " << model_path << " failed";
+    return nullptr;
+  }
+  struct stat file_stat {};
+  if (fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+    MS_LOG(ERROR) << "stat model file " << model_path << " failed";
+    close(fd);
+    return nullptr;
+  }
+  *size = static_cast<size_t>(file_stat.st_size);
+#ifdef SUPPORT_TRAIN
+  // training updates weights in place, pages written are copied on write and never reach the file.
+  int prot = PROT_READ | PROT_WRITE;
+#else
+  int prot = PROT_READ;
+#endif
+  void *addr = mmap(nullptr, *size, prot, MAP_PRIVATE, fd, 0);
+  // the mapping holds its own reference to the file
+  close(fd);
+  if (addr == MAP_FAILED) {
+    MS_LOG(ERROR) << "mmap model file " << model_path << " failed";
+    return nullptr;
+  }
+  return reinterpret_cast<char *>(addr);
+}
+
+void UnmapModelFile(char *buf, size_t size) { (void)munmap(buf, size); }
+#else
+// no mmap on windows, read the file into a private buffer which is released the same way.
+char *MapModelFile(const char *model_path, size_t *size) {
+  std::ifstream ifs(model_path, std::ios::binary | std::ios::ate);
+  if (!ifs.is_open()) {
+    MS_LOG(ERROR) << "open model file " << model_path << " failed";
+    return nullptr;
+  }
+  *size = static_cast<size_t>(ifs.tellg());
+  auto buf = reinterpret_cast<char *>(malloc(*size));
+  if (buf == nullptr) {
+    MS_LOG(ERROR) << "malloc model buf failed, file: " << model_path;
+    return nullptr;
+  }
+  ifs.seekg(0, std::ios::beg);
+  ifs.read(buf, *size);
+  return buf;
+}
+
+void UnmapModelFile(char *buf, size_t size) { free(buf); }
+#endif
+}  // namespace
+
+Model *Model::Import(const char *model_buf, size_t size) {
+  if (model_buf == nullptr) {
+    MS_LOG(ERROR) << "The model buf is nullptr";
+    return nullptr;
+  }
+  if (!VerifyModelBuf(model_buf, size)) {
+    return nullptr;
+  }
+  auto *model = new (std::nothrow) Model();
+  if (model == nullptr) {
+    MS_LOG(ERROR) << "new model fail!";
+    return nullptr;
+  }
+  model->buf = reinterpret_cast<char *>(malloc(size));
+  if (model->buf == nullptr) {
+    MS_LOG(ERROR) << "new inner model buf fail!";
+    delete (model);
+    return nullptr;
+  }
+  memcpy(model->buf, model_buf, size);
+  if (!ParseModelBuf(model)) {
     delete model;
     return nullptr;
   }
+  return model;
+}
 
-  if (!ConvertTensors(meta_graph, model)) {
+Model *Model::ImportFromFile(const char *model_path) {
+  if (model_path == nullptr) {
+    MS_LOG(ERROR) << "The model path is nullptr";
+    return nullptr;
+  }
+  size_t size = 0;
+  auto model_buf = MapModelFile(model_path, &size);
+  if (model_buf == nullptr) {
+    return nullptr;
+  }
+  if (!VerifyModelBuf(model_buf, size)) {
+    UnmapModelFile(model_buf, size);
+    return nullptr;
+  }
+  auto *model = new (std::nothrow) Model();
+  if (model == nullptr) {
+    MS_LOG(ERROR) << "new model fail!";
+    UnmapModelFile(model_buf, size);
+    return nullptr;
+  }
+  model->buf = model_buf;
+  model->mapped_size_ = size;
+  if (!ParseModelBuf(model)) {
     delete model;
     return nullptr;
   }
@@ -130,6 +231,10 @@ Model *Model::Import(const char *model_buf, size_t size) {
 }
 
 void Model::Free() {
+  // const tensors of sessions point into a mapped buffer, it lives until the model is destroyed
+  if (this->mapped_size_ != 0) {
+    return;
+  }
   if (this->buf != nullptr) {
     free(this->buf);
     this->buf = nullptr;
@@ -137,6 +242,11 @@ void Model::Free() {
 }
 
 void Model::Destroy() {
+  if (this->mapped_size_ != 0) {
+    UnmapModelFile(this->buf, this->mapped_size_);
+    this->buf = nullptr;
+    this->mapped_size_ = 0;
+  }
   Free();
   auto nodes_size = this->nodes_.size();
   for (size_t i = 0; i < nodes_size; ++i) {
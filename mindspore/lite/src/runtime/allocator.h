@@ -42,6 +42,8 @@ class Allocator {
   virtual void Clear() {}
   static std::shared_ptr<Allocator> Create();
   virtual void *Prepare(void *ptr) { return ptr; }
+  // data of a static allocator lives as long as the allocator, tensors keep it when their refcount drops to 0
+  virtual bool IsStatic() { return false; }
   std::string name;
 };
 
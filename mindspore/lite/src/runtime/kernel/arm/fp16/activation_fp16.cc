@@ -69,8 +69,11 @@ void ActivationFp16CPUKernel::FreeTmpBuffer() {
 int ActivationFp16CPUKernel::DoActivation(int task_id) {
   auto length = in_tensors_.at(0)->ElementsNum();
 
-  int stride = UP_DIV(length, thread_count_);
+  int stride = UP_DIV(length, task_num_);
   int count = MSMIN(stride, length - stride * task_id);
+  if (count <= 0) {
+    return RET_OK;
+  }
 
   int error_code;
   if (type_ == schema::ActivationType_RELU) {
@@ -115,7 +118,8 @@ int ActivationFp16CPUKernel::Run() {
     return ret;
   }
 
-  int error_code = ParallelLaunch(this->context_->thread_pool_, ActivationRun, this, thread_count_);
+  task_num_ = ParallelTaskNum(thread_count_, in_tensors_.at(0)->ElementsNum());
+  int error_code = ParallelLaunch(this->context_->thread_pool_, ActivationRun, this, task_num_);
   if (error_code != RET_OK) {
     MS_LOG(ERROR) << "Activation function error error_code[" << error_code << "]";
     FreeTmpBuffer();
@@ -42,6 +42,7 @@ class ActivationFp16CPUKernel : public LiteKernel {
 
  private:
   int thread_count_;
+  int task_num_ = 1;
   int type_;
   float16_t alpha_;
   float16_t *fp16_input_ = nullptr;
@@ -59,7 +59,7 @@ int FullconnectionFP16CPUKernel::ReSize() {
   fc_param_->deep_ = (in_tensors_[1]->shape())[1];
   fc_param_->row_16_ = UP_ROUND(fc_param_->row_, C16NUM);
   fc_param_->col_8_ = UP_ROUND(fc_param_->col_, C8NUM);
-  thread_count_ = MSMIN(thread_count_, UP_DIV(fc_param_->col_, C8NUM));
+  thread_count_ = ParallelTaskNum(ctx_->thread_num_, UP_DIV(fc_param_->col_, C8NUM));
   thread_stride_ = UP_DIV(UP_DIV(fc_param_->col_, C8NUM), thread_count_) * C8NUM;
 
   a_pack_ptr_ =
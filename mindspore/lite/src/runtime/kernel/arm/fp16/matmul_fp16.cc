@@ -72,7 +72,7 @@ int MatmulFP16CPUKernel::ReSize() {
   params_->deep_ = params_->a_transpose_ ? a_shape[a_shape.size() - 2] : a_shape[a_shape.size() - 1];
   params_->row_16_ = UP_ROUND(params_->row_, C16NUM);
   params_->col_8_ = UP_ROUND(params_->col_, C8NUM);
-  thread_count_ = MSMIN(thread_count_, UP_DIV(params_->col_, C8NUM));
+  thread_count_ = ParallelTaskNum(ctx_->thread_num_, UP_DIV(params_->col_, C8NUM));
   thread_stride_ = UP_DIV(UP_DIV(params_->col_, C8NUM), thread_count_) * C8NUM;
 
   a_pack_ptr_ = reinterpret_cast<float16_t *>(
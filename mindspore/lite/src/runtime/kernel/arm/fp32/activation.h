@@ -42,6 +42,7 @@ class ActivationCPUKernel : public LiteKernel {
 
  private:
   int thread_count_;
+  int task_num_ = 1;
   int type_;
   float alpha_;
   float min_val_;
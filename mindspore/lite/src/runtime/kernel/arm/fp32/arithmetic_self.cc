@@ -36,7 +36,7 @@ int ArithmeticSelfCPUKernel::Init() {
 
 int ArithmeticSelfCPUKernel::ReSize() {
   data_size_ = in_tensors_[0]->ElementsNum();
-  thread_sz_count_ = MSMIN(thread_count_, static_cast<int>(data_size_));
+  thread_sz_count_ = ParallelTaskNum(thread_count_, static_cast<int>(data_size_));
   thread_sz_stride_ = UP_DIV(data_size_, thread_sz_count_);
   return RET_OK;
 }
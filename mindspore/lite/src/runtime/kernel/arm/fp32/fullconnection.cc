@@ -53,7 +53,7 @@ int FullconnectionCPUKernel::ReSize() {
   fc_param_->col_8_ = UP_ROUND(fc_param_->col_, C8NUM);
   fc_param_->row_4_ = UP_ROUND(fc_param_->row_, C4NUM);
 
-  thread_count_ = MSMIN(thread_count_, UP_DIV(fc_param_->col_8_, 8));
+  thread_count_ = ParallelTaskNum(ctx_->thread_num_, UP_DIV(fc_param_->col_8_, 8));
   thread_stride_ = UP_DIV(UP_DIV(fc_param_->col_8_, 8), thread_count_);
 
   bias_ptr_ = reinterpret_cast<float *>(malloc(fc_param_->col_8_ * sizeof(float)));
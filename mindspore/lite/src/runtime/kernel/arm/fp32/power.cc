@@ -46,7 +46,8 @@ int PowerCPUKernel::Run() {
     MS_LOG(ERROR) << "Prepare fail!ret: " << prepare_ret;
     return prepare_ret;
   }
-  auto ret = ParallelLaunch(this->context_->thread_pool_, PowerImpl, this, thread_count_);
+  task_num_ = ParallelTaskNum(thread_count_, in_tensors_[0]->ElementsNum());
+  auto ret = ParallelLaunch(this->context_->thread_pool_, PowerImpl, this, task_num_);
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "PowerCPUKernel error: " << ret;
     return RET_ERROR;
@@ -58,8 +59,11 @@ int PowerCPUKernel::RunImpl(int task_id) {
   auto x_addr = reinterpret_cast<float *>(in_tensors_[0]->MutableData());
   auto output_addr = reinterpret_cast<float *>(out_tensors_[0]->MutableData());
   auto size = in_tensors_[0]->ElementsNum();
-  int stride = UP_DIV(size, thread_count_);
+  int stride = UP_DIV(size, task_num_);
   int len = MSMIN(stride, size - stride * task_id);
+  if (len <= 0) {
+    return RET_OK;
+  }
   float *exp_addr = nullptr;
   bool broadcast = true;
   if (in_tensors_.size() == 2) {
@@ -43,6 +43,7 @@ class PowerCPUKernel : public PowerBaseCPUKernel {
 
  private:
   int thread_count_;
+  int task_num_ = 1;
   float power_;
   float scale_;
   float shift_;
@@ -0,0 +1,187 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/runtime/memory_planner.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include "src/common/log_adapter.h"
+#include "include/errorcode.h"
+
+namespace mindspore::lite {
+namespace {
+constexpr size_t kArenaAlignment = 64;
+
+size_t AlignSize(size_t size) { return (size + kArenaAlignment - 1) / kArenaAlignment * kArenaAlignment; }
+}  // namespace
+
+ArenaAllocator::~ArenaAllocator() { free(buf_); }
+
+void *ArenaAllocator::Malloc(size_t size) { return fallback_ == nullptr ? malloc(size) : fallback_->Malloc(size); }
+
+void ArenaAllocator::Free(void *ptr) {
+  if (ptr == nullptr || Contains(ptr)) {
+    return;
+  }
+  if (fallback_ == nullptr) {
+    free(ptr);
+  } else {
+    fallback_->Free(ptr);
+  }
+}
+
+char *ArenaAllocator::Reserve(size_t size) {
+  if (size <= capacity_) {
+    return arena_;
+  }
+  if (size > MAX_MALLOC_SIZE) {
+    MS_LOG(ERROR) << "arena out of max_size, size: " << size;
+    return nullptr;
+  }
+  free(buf_);
+  buf_ = malloc(size + kArenaAlignment);
+  if (buf_ == nullptr) {
+    MS_LOG(ERROR) << "malloc arena failed, size: " << size;
+    arena_ = nullptr;
+    capacity_ = 0;
+    return nullptr;
+  }
+  auto addr = reinterpret_cast<uintptr_t>(buf_);
+  arena_ = reinterpret_cast<char *>(AlignSize(addr));
+  capacity_ = size;
+  return arena_;
+}
+
+bool ArenaAllocator::Contains(void *ptr) const {
+  auto addr = reinterpret_cast<char *>(ptr);
+  return arena_ != nullptr && addr >= arena_ && addr < arena_ + capacity_;
+}
+
+void MemoryPlanner::Init(const std::vector<kernel::LiteKernel *> &kernels,
+                         const std::vector<Tensor *> &graph_outputs) {
+  Release();
+  kernels_ = kernels;
+  lives_.clear();
+  // tensor -- index in lives_
+  std::unordered_map<Tensor *, size_t> life_index;
+  for (size_t i = 0; i < kernels.size(); ++i) {
+    auto kernel = kernels[i];
+    MS_ASSERT(kernel != nullptr);
+    for (auto tensor : kernel->in_tensors()) {
+      auto iter = life_index.find(tensor);
+      if (iter != life_index.end()) {
+        auto &life = lives_[iter->second];
+        life.last = std::max(life.last, i);
+      }
+    }
+    for (auto tensor : kernel->out_tensors()) {
+      MS_ASSERT(tensor != nullptr);
+      // tensors of other devices are allocated by their own subgraph
+      if (tensor->category() != Tensor::Category::VAR || tensor->allocator() != fallback_) {
+        continue;
+      }
+      // outputs of the graph and of model output kernels are read after the run, never reuse them
+      bool keep = kernel->is_model_output() || IsContain(graph_outputs, tensor);
+      life_index[tensor] = lives_.size();
+      lives_.push_back({tensor, i, keep ? std::numeric_limits<size_t>::max() : i, 0, 0});
+    }
+  }
+}
+
+int MemoryPlanner::Plan() {
+  for (auto kernel : kernels_) {
+    auto primitive = kernel->GetPrimitive();
+    if (primitive != nullptr && !primitive->GetInferFlag()) {
+      MS_LOG(INFO) << "shape of kernel " << kernel->name() << " is inferred at run time, skip static memory plan";
+      Release();
+      return RET_NOT_SUPPORT;
+    }
+  }
+  bool size_changed = !planned_;
+  tensors_size_ = 0;
+  for (auto &life : lives_) {
+    auto size = life.tensor->Size();
+    if (size == 0) {
+      MS_LOG(INFO) << "size of tensor is unknown, skip static memory plan";
+      Release();
+      return RET_NOT_SUPPORT;
+    }
+    size_changed = size_changed || AlignSize(size) != life.size;
+    life.size = AlignSize(size);
+    tensors_size_ += size;
+  }
+
+  if (size_changed) {
+    std::vector<TensorLife *> by_size;
+    for (auto &life : lives_) {
+      by_size.push_back(&life);
+    }
+    std::stable_sort(by_size.begin(), by_size.end(),
+                     [](const TensorLife *lhs, const TensorLife *rhs) { return lhs->size > rhs->size; });
+    // placed tensors ordered by offset
+    std::vector<TensorLife *> placed;
+    arena_size_ = 0;
+    for (auto life : by_size) {
+      size_t prev_end = 0;
+      size_t best_offset = std::numeric_limits<size_t>::max();
+      size_t best_gap = std::numeric_limits<size_t>::max();
+      for (auto other : placed) {
+        if (other->last < life->first || life->last < other->first) {
+          continue;
+        }
+        if (other->offset >= prev_end + life->size && other->offset - prev_end < best_gap) {
+          best_gap = other->offset - prev_end;
+          best_offset = prev_end;
+        }
+        prev_end = std::max(prev_end, other->offset + other->size);
+      }
+      life->offset = best_offset == std::numeric_limits<size_t>::max() ? prev_end : best_offset;
+      arena_size_ = std::max(arena_size_, life->offset + life->size);
+      auto pos = std::upper_bound(placed.begin(), placed.end(), life, [](const TensorLife *lhs, const TensorLife *rhs) {
+        return lhs->offset < rhs->offset;
+      });
+      placed.insert(pos, life);
+    }
+  }
+
+  // drop data kernels allocated by themselves before the arena may move
+  for (auto &life : lives_) {
+    life.tensor->FreeData();
+    life.tensor->set_allocator(&allocator_);
+  }
+  auto arena = allocator_.Reserve(arena_size_);
+  if (arena == nullptr && arena_size_ != 0) {
+    Release();
+    return RET_MEMORY_FAILED;
+  }
+  for (auto &life : lives_) {
+    life.tensor->SetData(arena + life.offset);
+  }
+  planned_ = true;
+  return RET_OK;
+}
+
+void MemoryPlanner::Release() {
+  for (auto &life : lives_) {
+    life.tensor->FreeData();
+    life.tensor->set_allocator(fallback_);
+    life.size = 0;
+  }
+  arena_size_ = 0;
+  planned_ = false;
+}
+}  // namespace mindspore::lite
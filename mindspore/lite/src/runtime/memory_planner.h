@@ -0,0 +1,88 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_RUNTIME_MEMORY_PLANNER_H_
+#define MINDSPORE_LITE_SRC_RUNTIME_MEMORY_PLANNER_H_
+
+#include <vector>
+#include "src/runtime/allocator.h"
+#include "src/lite_kernel.h"
+#include "src/tensor.h"
+
+namespace mindspore::lite {
+// Owns the arena of a MemoryPlanner. Tensors placed in the arena keep their data across runs, anything else is
+// forwarded to the fallback allocator.
+class ArenaAllocator : public Allocator {
+ public:
+  explicit ArenaAllocator(Allocator *fallback) : fallback_(fallback) { name = "arena"; }
+  ~ArenaAllocator() override;
+  void *Malloc(size_t size) override;
+  void Free(void *ptr) override;
+  size_t GetTotalSize() override { return capacity_; }
+  bool IsStatic() override { return true; }
+  // make sure the arena holds size bytes, data placed in the arena before is invalid after a reallocation
+  char *Reserve(size_t size);
+
+ private:
+  bool Contains(void *ptr) const;
+
+  Allocator *fallback_ = nullptr;
+  void *buf_ = nullptr;
+  char *arena_ = nullptr;
+  size_t capacity_ = 0;
+};
+
+// Plans the data of the kernel output tensors into one arena before running the graph. Lifetimes come from the
+// sequential execution order of the kernels and offsets are assigned greedily by size with best fit, so tensors
+// whose lifetimes do not overlap share memory and running the graph calls no allocator at all.
+class MemoryPlanner {
+ public:
+  explicit MemoryPlanner(Allocator *fallback) : allocator_(fallback), fallback_(fallback) {}
+  ~MemoryPlanner() = default;
+
+  // collect the planned tensors and their lifetimes, the kernels must be in execution order
+  void Init(const std::vector<kernel::LiteKernel *> &kernels, const std::vector<Tensor *> &graph_outputs);
+
+  // assign offsets with the current tensor sizes and bind the tensors to the arena, call again after a resize.
+  // RET_NOT_SUPPORT means some shape is only known at run time, the tensors are then left to the fallback allocator.
+  int Plan();
+
+  size_t arena_size() const { return arena_size_; }
+
+  size_t tensors_size() const { return tensors_size_; }
+
+ private:
+  struct TensorLife {
+    Tensor *tensor;
+    size_t first;
+    size_t last;
+    size_t size;
+    size_t offset;
+  };
+
+  void Release();
+
+  ArenaAllocator allocator_;
+  Allocator *fallback_ = nullptr;
+  std::vector<kernel::LiteKernel *> kernels_;
+  std::vector<TensorLife> lives_;
+  size_t arena_size_ = 0;
+  size_t tensors_size_ = 0;
+  bool planned_ = false;
+};
+}  // namespace mindspore::lite
+
+#endif  // MINDSPORE_LITE_SRC_RUNTIME_MEMORY_PLANNER_H_
@@ -50,6 +50,10 @@
 typedef struct {
   int (*func)(void *arg, int);
   void *content;
+  int task_num;
+  atomic_int next_task_id;  // the threads take the task ids in turn until there is none left
+  atomic_int unfinished;    // number of worker threads still running the job
+  atomic_int ret;
 } Task;
 
 typedef struct Thread {
@@ -79,6 +83,7 @@ typedef struct ThreadPool {
   int thread_num;
   BindMode mode;
   atomic_bool is_alive;
+  sem_t finished;  // posted by the last worker thread done with a job
 } ThreadPool;
 
 Thread *GetThread(struct ThreadPool *thread_pool, int thread_id) {
@@ -440,26 +445,38 @@ bool PopTaskFromQueue(Thread *thread, Task **task) {
   return true;
 }
 
-void WaitAllThread(struct ThreadPool *thread_pool) {
+void RunTask(Task *task) {
+  while (true) {
+    int task_id = atomic_fetch_add_explicit(&task->next_task_id, 1, memory_order_relaxed);
+    if (task_id >= task->task_num) {
+      break;
+    }
+    if (task->func(task->content, task_id) != RET_TP_OK) {
+      atomic_store_explicit(&task->ret, RET_TP_ERROR, memory_order_relaxed);
+    }
+  }
+}
+
+void FinishTask(struct ThreadPool *thread_pool, Task *task) {
+  // the task lives in the stack of the master thread, it is not touched once the master may go on
+  if (atomic_fetch_sub_explicit(&task->unfinished, 1, memory_order_acq_rel) == 1) {
+    sem_post(&thread_pool->finished);
+  }
+}
+
+void WaitAllThread(struct ThreadPool *thread_pool, Task *task) {
   if (thread_pool == NULL) {
     LOG_ERROR("get thread pool instane failed");
     return;
   }
-  bool k_success_flag = false;
-  while (!k_success_flag) {
-    k_success_flag = true;
-    for (int i = 0; i < thread_pool->thread_num - 1; ++i) {
-      Thread *thread = GetThread(thread_pool, i);
-      if (thread == NULL) {
-        LOG_ERROR("get thread failed, thread_id: %d", i);
-        return;
-      }
-      if (thread->task_size != 0) {
-        k_success_flag = false;
-        break;
-      }
+  // the workers are usually about done when the master is, spin a while before sleeping until the last one posts
+  for (int spin_count = 0; spin_count < DEFAULT_SPIN_COUNT; ++spin_count) {
+    if (atomic_load_explicit(&task->unfinished, memory_order_acquire) == 0) {
+      break;
     }
+    sched_yield();
   }
+  sem_wait(&thread_pool->finished);
 }
 
 int DistributeTask(struct ThreadPool *thread_pool, Task *task, int task_num) {
@@ -467,29 +484,29 @@ int DistributeTask(struct ThreadPool *thread_pool, Task *task, int task_num) {
     LOG_ERROR("get thread pool instane failed");
     return RET_TP_ERROR;
   }
-  if (task_num > thread_pool->thread_num || task_num <= 1) {
+  if (task_num <= 1) {
     LOG_ERROR("invalid task num: %d, thread num: %d", task_num, thread_pool->thread_num);
     return RET_TP_ERROR;
   }
-  bool k_success_flag = false;
-  int size = thread_pool->thread_num < task_num ? thread_pool->thread_num : task_num;
-  for (int i = 0; i < size - 1; ++i) {
-    do {
-      k_success_flag = true;
-      if (!PushTaskToQueue(thread_pool, i, task)) {
-        k_success_flag = false;
-      }
-    } while (!k_success_flag);
-  }
-  // master thread
   if (task->func == NULL) {
     LOG_ERROR("task->func is nullptr");
     return RET_TP_ERROR;
   }
-  task->func(task->content, size - 1);
+  // the task ids are not bound to threads, the threads done early take the ids left by the slow ones
+  int size = thread_pool->thread_num < task_num ? thread_pool->thread_num : task_num;
+  task->task_num = task_num;
+  atomic_init(&task->next_task_id, 0);
+  atomic_init(&task->unfinished, size - 1);
+  atomic_init(&task->ret, RET_TP_OK);
+  for (int i = 0; i < size - 1; ++i) {
+    while (!PushTaskToQueue(thread_pool, i, task)) {
+    }
+  }
+  // master thread
+  RunTask(task);
   // wait
-  WaitAllThread(thread_pool);
-  return RET_TP_OK;
+  WaitAllThread(thread_pool, task);
+  return atomic_load_explicit(&task->ret, memory_order_relaxed);
 }
 
 int AddTask(struct ThreadPool *thread_pool, int func(void *, int), void *content, int task_num) {
@@ -499,10 +516,13 @@ int AddTask(struct ThreadPool *thread_pool, int func(void *, int), void *content
   }
   // if single thread, run master thread
   if (thread_pool->thread_num <= 1 || task_num <= 1) {
+    int ret = RET_TP_OK;
     for (int i = 0; i < task_num; ++i) {
-      func(content, i);
+      if (func(content, i) != RET_TP_OK) {
+        ret = RET_TP_ERROR;
+      }
     }
-    return RET_TP_OK;
+    return ret;
   }
   Task task;
   task.func = func;
@@ -510,6 +530,14 @@ int AddTask(struct ThreadPool *thread_pool, int func(void *, int), void *content
   return DistributeTask(thread_pool, &task, task_num);
 }
 
+int ParallelTaskNum(int thread_num, int work_num) {
+  if (thread_num <= 1 || work_num <= 1) {
+    return 1;
+  }
+  int task_num = thread_num * TASK_NUM_PER_THREAD;
+  return task_num < work_num ? task_num : work_num;
+}
+
 int ParallelLaunch(struct ThreadPool *thread_pool, int (*func)(void *, int), void *content, int task_num) {
   return AddTask(thread_pool, func, content, task_num);
 }
@@ -523,18 +551,14 @@ void ThreadRun(Thread *thread) {
     return;
   }
   Task *task = NULL;
-  int thread_id = thread->thread_id;
   int spin_count = 0;
   sem_post(&thread->sem_inited);
   while (thread_pool->is_alive) {
     while (thread->activate) {
       if (PopTaskFromQueue(thread, &task)) {
-        if (task->func == NULL) {
-          LOG_ERROR("task->func is nullptr");
-          return;
-        }
-        task->func(task->content, thread_id);
+        RunTask(task);
         atomic_fetch_sub_explicit(&thread->task_size, 1, memory_order_relaxed);
+        FinishTask(thread_pool, task);
         spin_count = 0;
         sem_trywait(&thread->sem);
       } else {
@@ -655,6 +679,7 @@ ThreadPool *CreateThreadPool(int thread_num, int mode) {
   thread_pool->is_alive = ATOMIC_VAR_INIT(true);
   thread_pool->mode = mode;
   thread_pool->thread_list = NULL;
+  sem_init(&thread_pool->finished, 0, 0);
   if (thread_num > 1) {
     thread_pool->thread_list = (ThreadList *)malloc(sizeof(ThreadList));
     if (thread_pool->thread_list == NULL) {
@@ -745,6 +770,7 @@ void DestroyThreadPool(struct ThreadPool *thread_pool) {
   }
   free(thread_pool->thread_list);
   thread_pool->thread_list = NULL;
+  sem_destroy(&thread_pool->finished);
   LOG_INFO("destroy thread pool success");
 }
 
@@ -20,6 +20,7 @@
 #include <stdbool.h>
 
 #define MAX_TASK_NUM (2)
+#define TASK_NUM_PER_THREAD (4)
 
 /// \brief BindMode defined for holding bind cpu strategy argument.
 typedef enum {
@@ -48,14 +49,24 @@ struct ThreadPool *CreateThreadPool(int thread_num, int mode);
 int ConfigThreadPool(struct ThreadPool *thread_pool, int thread_num, int mode);
 
 /**
- *
+ * run job(content, task_id) for each task_id in [0, task_num), task_num may exceed the thread num, the threads take
+ * the task ids in turn until there is none left
  * @param session_index, support multi session
  * @param job
  * @param content
  * @param task_num
+ * @return RET_TP_OK, or RET_TP_ERROR when a task did not return 0
  */
 int ParallelLaunch(struct ThreadPool *thread_pool, int (*job)(void *, int), void *content, int task_num);
 
+/**
+ * number of tasks to cut a job of work_num units into, up to TASK_NUM_PER_THREAD a thread so that the fast threads
+ * take over the work of the slow ones
+ * @param thread_num
+ * @param work_num
+ */
+int ParallelTaskNum(int thread_num, int work_num);
+
 /**
  * bind each thread to specified cpu core
  * @param is_bind
@@ -144,6 +144,8 @@ class Tensor : public mindspore::tensor::MSTensor {
 
   void set_allocator(mindspore::lite::Allocator *allocator) { allocator_ = allocator; }
 
+  mindspore::lite::Allocator *allocator() const { return allocator_; }
+
   int MallocData(mindspore::lite::Allocator *allocator = nullptr) {
     if (nullptr != this->data_) {
       return 0;
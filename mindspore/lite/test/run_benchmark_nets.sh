@@ -296,6 +296,7 @@ function Run_arm64() {
     cp -a ${arm64_path}/mindspore-lite-${version}-runtime-arm64-${process_unit_arm64}/lib/libmindspore-lite-fp16.so ${benchmark_test_path}/libmindspore-lite-fp16.so || exit 1
     cp -a ${arm64_path}/mindspore-lite-${version}-runtime-arm64-${process_unit_arm64}/lib/libmindspore-lite-optimize.so ${benchmark_test_path}/libmindspore-lite-optimize.so || exit 1
     cp -a ${arm64_path}/mindspore-lite-${version}-runtime-arm64-${process_unit_arm64}/benchmark/benchmark ${benchmark_test_path}/benchmark || exit 1
+    cp -a ${arm64_path}/mindspore-lite-${version}-runtime-arm64-${process_unit_arm64}/benchmark/thread_pool_benchmark ${benchmark_test_path}/thread_pool_benchmark || exit 1
 
     # adb push all needed files to the phone
     adb -s ${device_id} push ${benchmark_test_path} /data/local/tmp/ > adb_push_log.txt
@@ -304,9 +305,21 @@ function Run_arm64() {
     echo 'cd  /data/local/tmp/benchmark_test' > adb_cmd.txt
     echo 'cp  /data/local/tmp/libc++_shared.so ./' >> adb_cmd.txt
     echo 'chmod 777 benchmark' >> adb_cmd.txt
+    echo 'chmod 777 thread_pool_benchmark' >> adb_cmd.txt
 
     adb -s ${device_id} shell < adb_cmd.txt
 
+    # Run the thread pool launch benchmark, the timing is only logged, a wrong result fails
+    echo 'thread_pool_benchmark' >> "${run_arm64_log_file}"
+    echo 'cd  /data/local/tmp/benchmark_test' > adb_run_cmd.txt
+    echo './thread_pool_benchmark 4 20' >> adb_run_cmd.txt
+    adb -s ${device_id} shell < adb_run_cmd.txt >> "${run_arm64_log_file}"
+    if [ $? = 0 ]; then
+        run_result='arm64: thread_pool_benchmark pass'; echo ${run_result} >> ${run_benchmark_result_file}
+    else
+        run_result='arm64: thread_pool_benchmark failed'; echo ${run_result} >> ${run_benchmark_result_file}; return 1
+    fi
+
     # Run tflite converted models:
     while read line; do
         model_name=${line}
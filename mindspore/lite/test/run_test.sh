@@ -23,6 +23,8 @@ cp -fr $TEST_DATA_DIR/testPK ./data
 ./lite-test --gtest_filter=TestConv1x1Fp32*
 ./lite-test --gtest_filter=TestStrassenFp32*
 ./lite-test --gtest_filter=TestDeConvolutionFp32*
+# the launch timing of the thread pool is measured by tools/benchmark/thread_pool_benchmark in run_benchmark_nets.sh
+./lite-test --gtest_filter="ThreadPoolTest.*"
 
 ./lite-test --gtest_filter=TestPadInt8.*
 ./lite-test --gtest_filter=TestDeconvInt8.*
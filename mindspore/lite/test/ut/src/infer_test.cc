@@ -15,7 +15,10 @@
  */
 
 #include <cmath>
+#include <map>
 #include <memory>
+#include <string>
+#include <vector>
 #include "mindspore/lite/schema/inner/model_generated.h"
 #include "mindspore/lite/include/model.h"
 #include "common/common_test.h"
@@ -354,4 +357,41 @@ TEST_F(InferTest, TestModel) {
   auto outputs = session->GetOutputs();
   MS_LOG(INFO) << "Passed";
 }
+
+TEST_F(InferTest, TestMmapModel) {
+  std::string model_path = "./models/model_hebing_3branch.ms";
+  auto model = lite::Model::ImportFromFile(model_path.c_str());
+  ASSERT_NE(nullptr, model);
+  ASSERT_NE(0, model->mapped_size_);
+  // both sessions share the weights in the mapping, which must survive Free
+  std::vector<float> results[2];
+  for (auto &result : results) {
+    auto context = new lite::InnerContext;
+    context->cpu_bind_mode_ = lite::NO_BIND;
+    context->device_type_ = lite::DT_CPU;
+    context->thread_num_ = 2;
+    ASSERT_EQ(lite::RET_OK, context->Init());
+    auto session = session::LiteSession::CreateSession(context);
+    ASSERT_NE(nullptr, session);
+    ASSERT_EQ(lite::RET_OK, session->CompileGraph(model));
+    model->Free();
+    auto inputs = session->GetInputs();
+    ASSERT_EQ(inputs.size(), 1);
+    auto in_data = reinterpret_cast<float *>(inputs.front()->MutableData());
+    ASSERT_NE(nullptr, in_data);
+    for (int i = 0; i < inputs.front()->ElementsNum(); ++i) {
+      in_data[i] = static_cast<float>(i % 17) / 17;
+    }
+    ASSERT_EQ(lite::RET_OK, session->RunGraph());
+    auto outputs = session->GetOutputs();
+    ASSERT_FALSE(outputs.empty());
+    auto out_tensor = std::map<std::string, tensor::MSTensor *>(outputs.begin(), outputs.end()).begin()->second;
+    auto out_data = reinterpret_cast<float *>(out_tensor->MutableData());
+    result.assign(out_data, out_data + out_tensor->ElementsNum());
+    delete session;
+    delete context;
+  }
+  ASSERT_EQ(results[0], results[1]);
+  delete model;
+}
 }  // namespace mindspore
@@ -0,0 +1,95 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <memory>
+#include <vector>
+#include "common/common_test.h"
+#include "include/errorcode.h"
+#include "src/lite_kernel.h"
+#include "src/runtime/memory_planner.h"
+
+namespace mindspore {
+class MemoryPlannerTest : public mindspore::CommonTest {
+ public:
+  MemoryPlannerTest() {}
+};
+
+namespace {
+bool Overlap(lite::Tensor *lhs, lite::Tensor *rhs) {
+  auto lhs_begin = reinterpret_cast<char *>(lhs->data_c());
+  auto rhs_begin = reinterpret_cast<char *>(rhs->data_c());
+  return lhs_begin < rhs_begin + rhs->Size() && rhs_begin < lhs_begin + lhs->Size();
+}
+}  // namespace
+
+TEST_F(MemoryPlannerTest, TestPlan) {
+  auto allocator = lite::Allocator::Create();
+  // the planner owns the arena, it has to outlive the tensors
+  lite::MemoryPlanner planner(allocator.get());
+  // t0 -> k0 -> t1 -> k1 -> t2 -> k2 -> t3 -> k3 -> t4, t1 is also read by k3
+  std::vector<std::shared_ptr<lite::Tensor>> tensors;
+  std::vector<int> sizes{64, 1024, 256, 2048, 128};
+  for (auto size : sizes) {
+    auto tensor = std::make_shared<lite::Tensor>(kNumberTypeFloat32, std::vector<int>{1, size});
+    tensor->set_allocator(allocator.get());
+    tensors.push_back(tensor);
+  }
+  std::vector<std::shared_ptr<kernel::LiteKernel>> kernels;
+  std::vector<kernel::LiteKernel *> kernel_ptrs;
+  for (size_t i = 0; i < 4; ++i) {
+    std::vector<lite::Tensor *> inputs{tensors[i].get()};
+    if (i == 3) {
+      inputs.push_back(tensors[1].get());
+    }
+    auto kernel =
+      std::make_shared<kernel::LiteKernel>(nullptr, inputs, std::vector<lite::Tensor *>{tensors[i + 1].get()}, nullptr,
+                                           nullptr);
+    kernels.push_back(kernel);
+    kernel_ptrs.push_back(kernel.get());
+  }
+  kernel::LiteKernelUtil::TopologicalSortKernels(kernel_ptrs);
+
+  planner.Init(kernel_ptrs, {tensors[4].get()});
+  ASSERT_EQ(lite::RET_OK, planner.Plan());
+  // t0 is the graph input and isn't planned. t1 lives from k0 to k3, t2 from k1 to k2, t3 from k2 to k3 and t4 from
+  // k3 on, so t2 and t4 are the only tensors never alive at the same time and may share their memory.
+  ASSERT_EQ(planner.tensors_size(), (1024 + 256 + 2048 + 128) * sizeof(float));
+  ASSERT_LT(planner.arena_size(), planner.tensors_size());
+  ASSERT_EQ(nullptr, tensors[0]->data_c());
+  auto check_overlap = [&]() {
+    for (size_t i = 1; i < tensors.size(); ++i) {
+      ASSERT_NE(nullptr, tensors[i]->data_c());
+    }
+    ASSERT_FALSE(Overlap(tensors[1].get(), tensors[2].get()));
+    ASSERT_FALSE(Overlap(tensors[1].get(), tensors[3].get()));
+    ASSERT_FALSE(Overlap(tensors[1].get(), tensors[4].get()));
+    ASSERT_FALSE(Overlap(tensors[2].get(), tensors[3].get()));
+    ASSERT_FALSE(Overlap(tensors[3].get(), tensors[4].get()));
+  };
+  check_overlap();
+
+  // refcount of planned tensors drops without releasing their data
+  auto data = tensors[2]->data_c();
+  kernel::LiteKernelUtil::InitTensorRefCount(kernel_ptrs);
+  ASSERT_EQ(lite::RET_OK, kernel_ptrs[1]->DecOutTensorRefCount());
+  ASSERT_EQ(data, tensors[2]->data_c());
+
+  // plan again after a resize
+  tensors[2]->FreeData();
+  tensors[2]->set_shape({4, 256});
+  ASSERT_EQ(lite::RET_OK, planner.Plan());
+  check_overlap();
+}
+}  // namespace mindspore
@@ -0,0 +1,111 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <vector>
+#include "common/common_test.h"
+#include "src/runtime/runtime_api.h"
+#include "nnacl/op_base.h"
+
+namespace mindspore {
+class ThreadPoolTest : public mindspore::CommonTest {
+ public:
+  ThreadPoolTest() {}
+};
+
+namespace {
+constexpr int kThreadNum = 4;
+
+struct CountJob {
+  std::vector<std::atomic_int> runs;
+  int failed_task_id;
+  explicit CountJob(int task_num) : runs(task_num), failed_task_id(-1) {}
+};
+
+int CountRun(void *cdata, int task_id) {
+  auto job = reinterpret_cast<CountJob *>(cdata);
+  job->runs[task_id]++;
+  return task_id == job->failed_task_id ? 1 : 0;
+}
+
+// work units of uneven cost, the first ones are the heaviest like the tail tiles of a conv on a little core
+struct HeterogeneousJob {
+  int work_num;
+  int task_num;
+  std::vector<double> results;
+  HeterogeneousJob(int work, int task) : work_num(work), task_num(task), results(work) {}
+};
+
+int HeterogeneousRun(void *cdata, int task_id) {
+  auto job = reinterpret_cast<HeterogeneousJob *>(cdata);
+  int stride = UP_DIV(job->work_num, job->task_num);
+  for (int i = task_id * stride; i < job->work_num && i < (task_id + 1) * stride; ++i) {
+    int cost = i < job->work_num / 8 ? 400000 : 20000;
+    double sum = 0;
+    for (int j = 0; j < cost; ++j) {
+      sum += j * 0.5;
+    }
+    job->results[i] = sum;
+  }
+  return 0;
+}
+}  // namespace
+
+TEST_F(ThreadPoolTest, TestTaskNumOverThreadNum) {
+  auto thread_pool = CreateLiteThreadPool(kThreadNum, NO_BIND_MODE);
+  ASSERT_NE(nullptr, thread_pool);
+  for (int task_num = 1; task_num <= 4 * kThreadNum + 3; ++task_num) {
+    CountJob job(task_num);
+    for (int i = 0; i < 10; ++i) {
+      ASSERT_EQ(0, ParallelLaunch(thread_pool, CountRun, &job, task_num));
+    }
+    for (int task_id = 0; task_id < task_num; ++task_id) {
+      ASSERT_EQ(10, job.runs[task_id]);
+    }
+  }
+
+  // a failed task fails the launch, the other tasks still run
+  CountJob job(3 * kThreadNum);
+  job.failed_task_id = 5;
+  ASSERT_NE(0, ParallelLaunch(thread_pool, CountRun, &job, 3 * kThreadNum));
+  for (int task_id = 0; task_id < 3 * kThreadNum; ++task_id) {
+    ASSERT_EQ(1, job.runs[task_id]);
+  }
+  DestroyThreadPool(thread_pool);
+}
+
+TEST_F(ThreadPoolTest, TestParallelTaskNum) {
+  ASSERT_EQ(1, ParallelTaskNum(1, 100));
+  ASSERT_EQ(1, ParallelTaskNum(kThreadNum, 0));
+  ASSERT_EQ(3, ParallelTaskNum(kThreadNum, 3));
+  ASSERT_EQ(kThreadNum * TASK_NUM_PER_THREAD, ParallelTaskNum(kThreadNum, 1000));
+}
+
+TEST_F(ThreadPoolTest, TestHeterogeneousLoad) {
+  auto thread_pool = CreateLiteThreadPool(kThreadNum, NO_BIND_MODE);
+  ASSERT_NE(nullptr, thread_pool);
+  const int work_num = 256;
+  HeterogeneousJob static_job(work_num, kThreadNum);
+  HeterogeneousJob chunked_job(work_num, ParallelTaskNum(kThreadNum, work_num));
+  HeterogeneousJob fine_job(work_num, work_num);
+  ASSERT_EQ(0, ParallelLaunch(thread_pool, HeterogeneousRun, &static_job, static_job.task_num));
+  ASSERT_EQ(0, ParallelLaunch(thread_pool, HeterogeneousRun, &chunked_job, chunked_job.task_num));
+  ASSERT_EQ(0, ParallelLaunch(thread_pool, HeterogeneousRun, &fine_job, fine_job.task_num));
+  ASSERT_EQ(static_job.results, chunked_job.results);
+  ASSERT_EQ(static_job.results, fine_job.results);
+  DestroyThreadPool(thread_pool);
+}
+
+}  // namespace mindspore
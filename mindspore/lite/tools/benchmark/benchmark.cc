@@ -356,20 +356,26 @@ int Benchmark::RunBenchmark() {
 
   MS_LOG(INFO) << "start reading model file";
   std::cout << "start reading model file" << std::endl;
-  size_t size = 0;
-  char *graphBuf = ReadFile(_flags->modelPath.c_str(), &size);
-  if (graphBuf == nullptr) {
-    MS_LOG(ERROR) << "Read model file failed while running " << modelName.c_str();
-    std::cerr << "Read model file failed while running " << modelName.c_str() << std::endl;
-    return RET_ERROR;
+  lite::Model *model = nullptr;
+  if (_flags->enableMmap) {
+    model = lite::Model::ImportFromFile(_flags->modelPath.c_str());
+  } else {
+    size_t size = 0;
+    char *graphBuf = ReadFile(_flags->modelPath.c_str(), &size);
+    if (graphBuf == nullptr) {
+      MS_LOG(ERROR) << "Read model file failed while running " << modelName.c_str();
+      std::cerr << "Read model file failed while running " << modelName.c_str() << std::endl;
+      return RET_ERROR;
+    }
+    model = lite::Model::Import(graphBuf, size);
+    delete[](graphBuf);
   }
-  auto model = lite::Model::Import(graphBuf, size);
-  delete[](graphBuf);
   if (model == nullptr) {
     MS_LOG(ERROR) << "Import model file failed while running " << modelName.c_str();
     std::cerr << "Import model file failed while running " << modelName.c_str() << std::endl;
     return RET_ERROR;
   }
+  auto endLoadTime = GetTimeUs();
   auto context = new (std::nothrow) lite::Context;
   if (context == nullptr) {
     MS_LOG(ERROR) << "New context failed while running " << modelName.c_str();
@@ -398,6 +404,7 @@ int Benchmark::RunBenchmark() {
     std::cout << "CreateSession failed while running ", modelName.c_str();
     return RET_ERROR;
   }
+  auto endCreateSessionTime = GetTimeUs();
   auto ret = session->CompileGraph(model);
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "CompileGraph failed while running ", modelName.c_str();
@@ -406,9 +413,18 @@ int Benchmark::RunBenchmark() {
     delete (model);
     return ret;
   }
+  auto endCompileTime = GetTimeUs();
   model->Free();
   msInputs = session->GetInputs();
   auto endPrepareTime = GetTimeUs();
+  MS_LOG(INFO) << "StartupTime = " << (endCompileTime - startPrepareTime) / 1000 << " ms, LoadModelTime = "
+               << (endLoadTime - startPrepareTime) / 1000 << " ms, CreateSessionTime = "
+               << (endCreateSessionTime - endLoadTime) / 1000
+               << " ms, CompileGraphTime = " << (endCompileTime - endCreateSessionTime) / 1000 << " ms";
+  std::cout << "StartupTime = " << (endCompileTime - startPrepareTime) / 1000 << " ms, LoadModelTime = "
+            << (endLoadTime - startPrepareTime) / 1000 << " ms, CreateSessionTime = "
+            << (endCreateSessionTime - endLoadTime) / 1000
+            << " ms, CompileGraphTime = " << (endCompileTime - endCreateSessionTime) / 1000 << " ms" << std::endl;
   MS_LOG(INFO) << "PrepareTime = " << (endPrepareTime - startPrepareTime) / 1000 << " ms";
   std::cout << "PrepareTime = " << (endPrepareTime - startPrepareTime) / 1000 << " ms" << std::endl;
 
@@ -543,6 +559,7 @@ int Benchmark::Init() {
   MS_LOG(INFO) << "WarmUpLoopCount = " << this->_flags->warmUpLoopCount;
   MS_LOG(INFO) << "NumThreads = " << this->_flags->numThreads;
   MS_LOG(INFO) << "Fp16Priority = " << this->_flags->fp16Priority;
+  MS_LOG(INFO) << "EnableMmap = " << this->_flags->enableMmap;
   MS_LOG(INFO) << "calibDataPath = " << this->_flags->calibDataPath;
 
   if (this->_flags->loopCount < 1) {
@@ -59,6 +59,7 @@ class MS_API BenchmarkFlags : public virtual FlagParser {
     AddFlag(&BenchmarkFlags::device, "device", "CPU | GPU", "CPU");
     AddFlag(&BenchmarkFlags::cpuBindMode, "cpuBindMode",
             "Input -1 for MID_CPU, 1 for HIGHER_CPU, 0 for NO_BIND, defalut value: 1", 1);
+    AddFlag(&BenchmarkFlags::enableMmap, "enableMmap", "Map the model file instead of copying it", false);
     // MarkPerformance
     AddFlag(&BenchmarkFlags::loopCount, "loopCount", "Run loop count", 10);
     AddFlag(&BenchmarkFlags::numThreads, "numThreads", "Run threads number", 2);
@@ -86,6 +87,7 @@ class MS_API BenchmarkFlags : public virtual FlagParser {
   InDataType inDataType;
   std::string inDataTypeIn = "bin";
   int cpuBindMode = 1;
+  bool enableMmap = false;
   // MarkPerformance
   int loopCount;
   int numThreads;
@@ -0,0 +1,88 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "src/runtime/thread_pool.h"
+
+// Launch time of a heterogeneous load cut into one task a thread, ParallelTaskNum tasks and one task a work unit.
+// Usage: thread_pool_benchmark [thread_num] [loops]
+namespace {
+// work units of uneven cost, the first ones are the heaviest like the tail tiles of a conv on a little core
+struct HeterogeneousJob {
+  int work_num;
+  int task_num;
+  std::vector<double> results;
+  HeterogeneousJob(int work, int task) : work_num(work), task_num(task), results(work) {}
+};
+
+int HeterogeneousRun(void *cdata, int task_id) {
+  auto job = reinterpret_cast<HeterogeneousJob *>(cdata);
+  int stride = (job->work_num + job->task_num - 1) / job->task_num;
+  for (int i = task_id * stride; i < job->work_num && i < (task_id + 1) * stride; ++i) {
+    int cost = i < job->work_num / 8 ? 400000 : 20000;
+    double sum = 0;
+    for (int j = 0; j < cost; ++j) {
+      sum += j * 0.5;
+    }
+    job->results[i] = sum;
+  }
+  return 0;
+}
+
+double LaunchMs(ThreadPool *thread_pool, HeterogeneousJob *job) {
+  auto start = std::chrono::steady_clock::now();
+  if (ParallelLaunch(thread_pool, HeterogeneousRun, job, job->task_num) != 0) {
+    printf("launch of %d tasks failed\n", job->task_num);
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+}  // namespace
+
+int main(int argc, const char **argv) {
+  int thread_num = argc > 1 ? atoi(argv[1]) : 4;
+  int loops = argc > 2 ? atoi(argv[2]) : 10;
+  if (thread_num <= 0 || loops <= 0) {
+    printf("usage: %s [thread_num] [loops]\n", argv[0]);
+    return 1;
+  }
+  auto thread_pool = CreateThreadPool(thread_num, NO_BIND_MODE);
+  if (thread_pool == nullptr) {
+    printf("create thread pool of %d threads failed\n", thread_num);
+    return 1;
+  }
+  const int work_num = 256;
+  HeterogeneousJob static_job(work_num, thread_num);
+  HeterogeneousJob chunked_job(work_num, ParallelTaskNum(thread_num, work_num));
+  HeterogeneousJob fine_job(work_num, work_num);
+  // warm up the threads
+  LaunchMs(thread_pool, &static_job);
+  double static_ms = 0;
+  double chunked_ms = 0;
+  double fine_ms = 0;
+  for (int i = 0; i < loops; ++i) {
+    static_ms += LaunchMs(thread_pool, &static_job);
+    chunked_ms += LaunchMs(thread_pool, &chunked_job);
+    fine_ms += LaunchMs(thread_pool, &fine_job);
+  }
+  printf("threads: %d, work units: %d, average ms of a launch - one task a thread: %.3f, %d tasks: %.3f, "
+         "one task a unit: %.3f\n",
+         thread_num, work_num, static_ms / loops, chunked_job.task_num, chunked_ms / loops, fine_ms / loops);
+  DestroyThreadPool(thread_pool);
+  return static_job.results == chunked_job.results && static_job.results == fine_job.results ? 0 : 1;
+}
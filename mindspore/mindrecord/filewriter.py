@@ -276,9 +276,83 @@ class FileWriter:
         """
         return self._writer.set_page_size(page_size)
 
+    def set_columnar_label(self, columnar_label):
+        """
+        Store the scalar int32, int64, float32 and float64 fields, like the labels, \
+        in label pages instead of the raw page. A label page keeps the values of one \
+        field next to each other, so they are read without decoding the raw data. \
+        It must be called before writing data, the files written this way can not be \
+        read by the versions of MindSpore not supporting label pages.
+
+        Args:
+           columnar_label (bool): Whether to store the scalar numeric fields in label pages.
+
+        Returns:
+            MSRStatus, SUCCESS or FAILED.
+
+        Raises:
+            ParamTypeError: If columnar_label is not a bool.
+            MRMSetHeaderError: If data was already written or the writer was opened for append.
+        """
+        if not isinstance(columnar_label, bool):
+            raise ParamTypeError('columnar_label', 'bool')
+        return self._writer.set_columnar_label(columnar_label)
+
+    def set_parallel_workers(self, num_parallel_workers):
+        """
+        Set the number of threads checking, serializing and compressing the data \
+        written by each write_raw_data. It defaults to the number of cores. The data of \
+        a write_raw_data call is written to the files by a writer thread, while the next \
+        call checks and serializes its data, and an error of the writer thread is raised \
+        by the next write_raw_data or by commit.
+
+        Args:
+           num_parallel_workers (int): Number of threads, between 1 and 32.
+
+        Returns:
+            MSRStatus, SUCCESS or FAILED.
+
+        Raises:
+            ParamTypeError: If num_parallel_workers is not an int.
+            MRMSetHeaderError: If num_parallel_workers is out of range.
+        """
+        if not isinstance(num_parallel_workers, int) or isinstance(num_parallel_workers, bool):
+            raise ParamTypeError('num_parallel_workers', 'int')
+        return self._writer.set_parallel_workers(num_parallel_workers)
+
+    def set_page_compression(self, compression, level=1):
+        """
+        Compress the blob pages with the given compression. The pages are cut in chunks \
+        of whole blobs compressed one by one, so a row is read by decompressing its chunk only, \
+        and the blobs which do not get smaller, like encoded images, are stored as they are. \
+        It must be called before writing data, the files written this way can not be \
+        read by the versions of MindSpore not supporting page compression.
+
+        Note:
+            A compressed page takes only its compressed size in the file, the pages being packed one \
+            after another. The raw pages, the label pages and the last blob page left uncompressed still \
+            take a whole page, so that the rows written next are appended to them.
+
+        Args:
+           compression (str): Compression of the blob pages, 'none' or 'zlib'.
+           level (int, optional): Compression level, from 1 (fastest) to 9 (smallest) (default=1).
+
+        Returns:
+            MSRStatus, SUCCESS or FAILED.
+
+        Raises:
+            ParamTypeError: If compression is not a str or level is not an int.
+            MRMSetHeaderError: If the compression or the level is invalid, or data was already written.
+        """
+        if not isinstance(compression, str):
+            raise ParamTypeError('compression', 'str')
+        if not isinstance(level, int) or isinstance(level, bool):
+            raise ParamTypeError('level', 'int')
+        return self._writer.set_page_compression(compression, level)
+
     def commit(self):
         """
-        Flush data to disk and generate the corresponding db files.
+        Flush data to disk and generate the corresponding db files and binary index files.
 
         Returns:
             MSRStatus, SUCCESS or FAILED.
@@ -311,10 +385,10 @@ class FileWriter:
             if os.path.exists(item):
                 os.chmod(item, stat.S_IRUSR | stat.S_IWUSR)
                 mindrecord_files.append(item)
-            index_file = item + ".db"
-            if os.path.exists(index_file):
-                os.chmod(index_file, stat.S_IRUSR | stat.S_IWUSR)
-                index_files.append(index_file)
+            for index_file in [item + ".db", item + ".idx"]:
+                if os.path.exists(index_file):
+                    os.chmod(index_file, stat.S_IRUSR | stat.S_IWUSR)
+                    index_files.append(index_file)
 
         logger.info("The list of mindrecord files created are: {}, and the list of index files are: {}".format(
             mindrecord_files, index_files))
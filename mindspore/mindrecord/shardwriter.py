@@ -113,6 +113,64 @@ class ShardWriter:
             raise MRMInvalidPageSizeError
         return ret
 
+    def set_columnar_label(self, columnar_label):
+        """
+        Store the scalar int32, int64, float32 and float64 fields in label pages.
+
+        Args:
+           columnar_label (bool): Whether to store the scalar numeric fields in label pages.
+
+        Returns:
+            MSRStatus, SUCCESS or FAILED.
+
+        Raises:
+            MRMSetHeaderError: If the header is already set.
+        """
+        ret = self._writer.set_columnar_label(columnar_label)
+        if ret != ms.MSRStatus.SUCCESS:
+            logger.error("Failed to set columnar label.")
+            raise MRMSetHeaderError
+        return ret
+
+    def set_parallel_workers(self, num_workers):
+        """
+        Set the number of threads checking, serializing and compressing the data.
+
+        Args:
+           num_workers (int): Number of threads, between 1 and 32.
+
+        Returns:
+            MSRStatus, SUCCESS or FAILED.
+
+        Raises:
+            MRMSetHeaderError: If the number of threads is out of range.
+        """
+        ret = self._writer.set_parallel_workers(num_workers)
+        if ret != ms.MSRStatus.SUCCESS:
+            logger.error("Failed to set parallel workers.")
+            raise MRMSetHeaderError
+        return ret
+
+    def set_page_compression(self, compression, level):
+        """
+        Compress the blob pages.
+
+        Args:
+           compression (str): Compression of the blob pages, 'none' or 'zlib'.
+           level (int): Compression level, between 1 and 9.
+
+        Returns:
+            MSRStatus, SUCCESS or FAILED.
+
+        Raises:
+            MRMSetHeaderError: If the compression is unknown or the header is already set.
+        """
+        ret = self._writer.set_page_compression(compression, level)
+        if ret != ms.MSRStatus.SUCCESS:
+            logger.error("Failed to set page compression.")
+            raise MRMSetHeaderError
+        return ret
+
     def set_shard_header(self, shard_header):
         """
         Set header which contains schema and index before write raw data.
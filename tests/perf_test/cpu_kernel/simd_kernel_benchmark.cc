@@ -0,0 +1,212 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include "backend/kernel_compiler/cpu/cpu_thread_pool.h"
+#include "backend/kernel_compiler/cpu/simd/simd_kernels.h"
+
+using mindspore::kernel::simd::BinaryType;
+using mindspore::kernel::simd::ISA;
+using mindspore::kernel::simd::ReduceType;
+namespace simd = mindspore::kernel::simd;
+
+namespace {
+using Shape = std::vector<size_t>;
+constexpr size_t kArithmeticGrainSize = 16384;
+
+size_t ShapeSize(const Shape &shape) {
+  return std::accumulate(shape.begin(), shape.end(), size_t(1), std::multiplies<size_t>());
+}
+
+// The per element index decomposition of TransposeCPUFwdKernel and ReduceCPUKernel before the simd kernels.
+void LegacyTranspose(const float *input, const Shape &shape, const Shape &perm, float *output) {
+  size_t size = ShapeSize(shape);
+  size_t shape_size = shape.size();
+  std::vector<size_t> pos_array(shape_size);
+  std::vector<size_t> size_offset(shape_size);
+  size_offset[0] = size / shape[0];
+  for (size_t i = 1; i < shape_size; i++) {
+    size_offset[i] = size_offset[i - 1] / shape[i];
+  }
+  for (size_t position = 0; position < size; position += 1) {
+    size_t temp_position = position;
+    pos_array[0] = temp_position / size_offset[0];
+    for (size_t i = 1; i < shape_size; i++) {
+      temp_position -= pos_array[i - 1] * size_offset[i - 1];
+      pos_array[i] = temp_position / size_offset[i];
+    }
+    size_t new_position = pos_array[perm[shape_size - 1]];
+    size_t new_position_size = 1;
+    for (int j = shape_size - 2; j >= 0; j--) {
+      new_position_size *= shape[perm[j + 1]];
+      new_position += pos_array[perm[j]] * new_position_size;
+    }
+    output[new_position] = input[position];
+  }
+}
+
+// ReduceCPUKernel transposed the reduced axes to the end into a temporary copy, then reduced serially.
+void LegacyReduce(const float *input, const Shape &shape, const Shape &axis, ReduceType type, float *output) {
+  Shape perm;
+  size_t stride = 1;
+  for (size_t i = 0; i < shape.size(); ++i) {
+    if (std::find(axis.begin(), axis.end(), i) == axis.end()) {
+      perm.push_back(i);
+    } else {
+      stride *= shape[i];
+    }
+  }
+  (void)perm.insert(perm.end(), axis.begin(), axis.end());
+  size_t size = ShapeSize(shape);
+  std::vector<float> transposed(size);
+  LegacyTranspose(input, shape, perm, transposed.data());
+  for (size_t i = 0; i < size / stride; ++i) {
+    float value = type == ReduceType::kMax ? transposed[i * stride] : 0;
+    for (size_t k = 0; k < stride; ++k) {
+      value = type == ReduceType::kMax ? std::max(value, transposed[i * stride + k]) : value + transposed[i * stride + k];
+    }
+    output[i] = type == ReduceType::kMean ? value / stride : value;
+  }
+}
+
+// ArithmeticCPUKernel only supported inputs of the same shape or a scalar second input.
+void LegacyBinary(const float *input0, const float *input1, bool is_number, size_t size, float *output) {
+  auto task = [&](size_t start, size_t end) {
+    for (size_t i = start; i < end; i++) {
+      output[i] = input0[i] + (is_number ? *input1 : input1[i]);
+    }
+  };
+  mindspore::kernel::CPUThreadPool::GetInstance().ParallelFor(size, kArithmeticGrainSize, task);
+}
+
+std::vector<float> RandomData(size_t size) {
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<float> distribution(-1, 1);
+  std::vector<float> data(size);
+  for (auto &value : data) {
+    value = distribution(generator);
+  }
+  return data;
+}
+
+double TimeMs(const std::function<void()> &func, int iterations) {
+  func();
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; ++i) {
+    func();
+  }
+  std::chrono::duration<double, std::milli> cost = std::chrono::steady_clock::now() - start;
+  return cost.count() / iterations;
+}
+
+float MaxDiff(const std::vector<float> &lhs, const std::vector<float> &rhs) {
+  float diff = 0;
+  for (size_t i = 0; i < lhs.size(); ++i) {
+    diff = std::max(diff, std::fabs(lhs[i] - rhs[i]));
+  }
+  return diff;
+}
+
+std::string ShapeString(const Shape &shape) {
+  std::string str = "[";
+  for (size_t i = 0; i < shape.size(); ++i) {
+    str += (i == 0 ? "" : ",") + std::to_string(shape[i]);
+  }
+  return str + "]";
+}
+
+// Time the legacy loop once and the simd kernel with every instruction set supported by the cpu.
+void Report(const std::string &name, const std::function<void(float *)> &legacy, const std::function<void(float *)> &simd,
+            size_t out_size, int iterations) {
+  std::vector<float> expect(out_size);
+  std::vector<float> output(out_size);
+  double legacy_ms = legacy ? TimeMs([&]() { legacy(expect.data()); }, iterations) : 0;
+  ISA supported = simd::GetISA();
+  for (auto isa : {ISA::kScalar, ISA::kAVX2, ISA::kAVX512}) {
+    if (isa > supported) {
+      break;
+    }
+    simd::SetISA(isa);
+    double simd_ms = TimeMs([&]() { simd(output.data()); }, iterations);
+    if (legacy) {
+      printf("%-48s %-7s legacy %9.3f ms  simd %9.3f ms  speedup %6.2fx  max diff %g\n", name.c_str(),
+             simd::ISAName(isa).c_str(), legacy_ms, simd_ms, legacy_ms / simd_ms, MaxDiff(output, expect));
+    } else {
+      printf("%-48s %-7s legacy       n/a     simd %9.3f ms\n", name.c_str(), simd::ISAName(isa).c_str(), simd_ms);
+    }
+  }
+  simd::SetISA(supported);
+}
+
+void BenchTranspose(const Shape &shape, const Shape &perm, int iterations) {
+  auto input = RandomData(ShapeSize(shape));
+  Report("transpose " + ShapeString(shape) + " perm " + ShapeString(perm),
+         [&](float *output) { LegacyTranspose(input.data(), shape, perm, output); },
+         [&](float *output) { simd::Transpose(input.data(), shape, perm, output); }, input.size(), iterations);
+}
+
+void BenchReduce(const Shape &shape, const Shape &axis, ReduceType type, int iterations) {
+  auto input = RandomData(ShapeSize(shape));
+  size_t out_size = input.size();
+  for (auto i : axis) {
+    out_size /= shape[i];
+  }
+  std::string type_name = type == ReduceType::kMax ? "max" : (type == ReduceType::kSum ? "sum" : "mean");
+  Report("reduce_" + type_name + " " + ShapeString(shape) + " axis " + ShapeString(axis),
+         [&](float *output) { LegacyReduce(input.data(), shape, axis, type, output); },
+         [&](float *output) { simd::Reduce(input.data(), shape, axis, type, output); }, out_size, iterations);
+}
+
+void BenchAdd(const Shape &shape0, const Shape &shape1, int iterations) {
+  auto input0 = RandomData(ShapeSize(shape0));
+  auto input1 = RandomData(ShapeSize(shape1));
+  size_t out_size = ShapeSize(simd::BroadcastShape(shape0, shape1));
+  std::function<void(float *)> legacy = nullptr;
+  if (shape0 == shape1 || shape1.empty()) {
+    legacy = [&](float *output) { LegacyBinary(input0.data(), input1.data(), shape1.empty(), out_size, output); };
+  }
+  Report("add " + ShapeString(shape0) + " " + ShapeString(shape1), legacy,
+         [&](float *output) {
+           simd::BroadcastBinary(input0.data(), shape0, input1.data(), shape1, BinaryType::kAdd, output);
+         },
+         out_size, iterations);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  int iterations = argc > 1 ? std::max(1, atoi(argv[1])) : 20;
+  printf("simd kernel benchmark, cpu supports %s, %d iterations\n", simd::ISAName(simd::GetISA()).c_str(), iterations);
+  BenchTranspose({1024, 1024}, {1, 0}, iterations);
+  BenchTranspose({32, 64, 56, 56}, {0, 2, 3, 1}, iterations);
+  BenchTranspose({32, 56, 56, 64}, {0, 3, 1, 2}, iterations);
+  BenchTranspose({64, 128, 768}, {1, 0, 2}, iterations);
+  BenchReduce({32, 64, 56, 56}, {2, 3}, ReduceType::kMean, iterations);
+  BenchReduce({32, 64, 56, 56}, {0, 2, 3}, ReduceType::kSum, iterations);
+  BenchReduce({4096, 1024}, {0}, ReduceType::kSum, iterations);
+  BenchReduce({4096, 1024}, {1}, ReduceType::kMax, iterations);
+  BenchAdd({32, 64, 56, 56}, {32, 64, 56, 56}, iterations);
+  BenchAdd({32, 64, 56, 56}, {}, iterations);
+  BenchAdd({32, 64, 56, 56}, {64, 1, 1}, iterations);
+  return 0;
+}
@@ -0,0 +1,72 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include "backend/kernel_compiler/cpu/cpu_thread_pool.h"
+
+using mindspore::kernel::CPUThreadPool;
+
+namespace {
+constexpr size_t kGrainSize = 16384;
+constexpr size_t kSpawnThreadNum = 24;
+
+// Launch overhead of the shared pool against spawning and joining threads on every launch.
+void BenchLaunch(size_t size, int iterations) {
+  auto &pool = CPUThreadPool::GetInstance();
+  std::vector<float> input(size, 1.0f);
+  std::vector<float> output(size, 0.0f);
+  auto task = [&input, &output](size_t start, size_t end) {
+    for (size_t i = start; i < end; ++i) {
+      output[i] = input[i] * input[i];
+    }
+  };
+
+  auto begin = std::chrono::steady_clock::now();
+  for (int n = 0; n < iterations; ++n) {
+    pool.ParallelFor(size, kGrainSize, task);
+  }
+  auto pool_cost = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count();
+
+  begin = std::chrono::steady_clock::now();
+  for (int n = 0; n < iterations; ++n) {
+    std::vector<std::thread> threads;
+    size_t once_compute_size = (size + kSpawnThreadNum - 1) / kSpawnThreadNum;
+    for (size_t start = 0; start < size; start += once_compute_size) {
+      threads.emplace_back(task, start, std::min(start + once_compute_size, size));
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }
+  auto spawn_cost = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count();
+  printf("tensor size %zu: thread pool %.2f us, spawn threads %.2f us per launch\n", size, pool_cost / iterations,
+         spawn_cost / iterations);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  int iterations = argc > 1 ? std::max(1, atoi(argv[1])) : 100;
+  printf("cpu thread pool benchmark, %zu threads, %d iterations\n", CPUThreadPool::GetInstance().thread_num(),
+         iterations);
+  for (size_t size = 64; size <= 4 * 1024 * 1024; size *= 16) {
+    BenchLaunch(size, iterations);
+  }
+  return 0;
+}
@@ -0,0 +1,147 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "minddata/dataset/engine/connector.h"
+#include "minddata/dataset/util/task_manager.h"
+
+using mindspore::dataset::Connector;
+using mindspore::dataset::Status;
+using mindspore::dataset::TaskGroup;
+using mindspore::dataset::TaskManager;
+
+namespace {
+using Clock = std::chrono::steady_clock;
+constexpr int64_t kEof = -1;
+constexpr int32_t kQueueSize = 16;
+
+int64_t NowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+}
+
+struct Result {
+  double throughput;  // buffers per second with the source pushing as fast as it can
+  double p50_us;      // hand-off latency from source to sink with a single buffer in flight
+  double p99_us;
+};
+
+// A chain of ops the way an execution tree runs them: a source, num_ops ops of num_workers workers each, and a
+// single threaded sink, connected by Connectors. A buffer carries the time it left the source.
+// In the throughput run the source pushes all the buffers at once, in the latency run it waits for each buffer to
+// reach the sink before pushing the next one, so every hand-off wakes up a waiting thread.
+Result RunChain(int num_ops, int num_workers, bool lock_free, int64_t num_buffers, bool one_in_flight) {
+  TaskGroup vg;
+  std::vector<std::shared_ptr<Connector<int64_t>>> conns;
+  // The source is a single producer, the sink a single consumer
+  for (int i = 0; i <= num_ops; ++i) {
+    int32_t producers = i == 0 ? 1 : num_workers;
+    int32_t consumers = i == num_ops ? 1 : num_workers;
+    conns.push_back(std::make_shared<Connector<int64_t>>(producers, consumers, kQueueSize, lock_free));
+    if (conns.back()->Register(&vg).IsError()) {
+      printf("Fail to register the connector.\n");
+      exit(1);
+    }
+  }
+  std::atomic<int64_t> received(0);
+  std::vector<int64_t> latencies;
+  latencies.reserve(num_buffers);
+
+  Status rc = vg.CreateAsyncTask("Source", [&]() -> Status {
+    TaskManager::FindMe()->Post();
+    for (int64_t i = 0; i < num_buffers; ++i) {
+      RETURN_IF_NOT_OK(conns[0]->Push(0, NowNs()));
+      while (one_in_flight && received.load(std::memory_order_acquire) <= i) {
+        std::this_thread::yield();
+      }
+    }
+    // One eof for every worker of the first op, it is passed down by each worker
+    for (int w = 0; w < num_workers; ++w) {
+      RETURN_IF_NOT_OK(conns[0]->Push(0, kEof));
+    }
+    return Status::OK();
+  });
+  for (int op = 0; op < num_ops && rc.IsOk(); ++op) {
+    for (int w = 0; w < num_workers && rc.IsOk(); ++w) {
+      rc = vg.CreateAsyncTask("Op worker", [&conns, op, w]() -> Status {
+        TaskManager::FindMe()->Post();
+        int64_t v = 0;
+        while (v != kEof) {
+          RETURN_IF_NOT_OK(conns[op]->Pop(w, &v));
+          RETURN_IF_NOT_OK(conns[op + 1]->Push(w, v));
+        }
+        return Status::OK();
+      });
+    }
+  }
+  auto start = Clock::now();
+  if (rc.IsOk()) {
+    rc = vg.CreateAsyncTask("Sink", [&]() -> Status {
+      TaskManager::FindMe()->Post();
+      int64_t v = 0;
+      int eofs = 0;
+      while (eofs < num_workers) {
+        RETURN_IF_NOT_OK(conns[num_ops]->Pop(0, &v));
+        if (v == kEof) {
+          eofs++;
+        } else {
+          latencies.push_back(NowNs() - v);
+          received.fetch_add(1, std::memory_order_release);
+        }
+      }
+      return Status::OK();
+    });
+  }
+  vg.join_all();
+  if (rc.IsError() || vg.GetTaskErrorIfAny().IsError()) {
+    printf("The chain failed.\n");
+    exit(1);
+  }
+  double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+  Result result{};
+  result.throughput = num_buffers / seconds;
+  std::sort(latencies.begin(), latencies.end());
+  result.p50_us = latencies[latencies.size() / 2] / 1000.0;
+  result.p99_us = latencies[latencies.size() * 99 / 100] / 1000.0;
+  return result;
+}
+
+void BenchChain(int num_ops, int num_workers, int64_t num_buffers) {
+  for (bool lock_free : {false, true}) {
+    Result burst = RunChain(num_ops, num_workers, lock_free, num_buffers, false);
+    Result single = RunChain(num_ops, num_workers, lock_free, num_buffers / 10, true);
+    printf("  ops %2d workers %2d %-9s: %10.0f buffers/s  latency p50 %8.2f us  p99 %8.2f us\n", num_ops,
+           num_workers, lock_free ? "RingQueue" : "Queue", burst.throughput, single.p50_us, single.p99_us);
+  }
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  int64_t num_buffers = argc > 1 ? std::max(100L, atol(argv[1])) : 100000;
+  printf("connector hand-off benchmark, %ld buffers, queue size %d, %u cpus\n", num_buffers, kQueueSize,
+         std::thread::hardware_concurrency());
+  BenchChain(1, 1, num_buffers);
+  BenchChain(4, 1, num_buffers);
+  BenchChain(8, 1, num_buffers);
+  BenchChain(4, 4, num_buffers);
+  return 0;
+}
@@ -0,0 +1,54 @@
+# Copyright 2020 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+"""test rows/s of the dataset iterator handing tensors to numpy with and without a copy"""
+import time
+import numpy as np
+
+import mindspore.dataset as ds
+
+num_rows = 2000
+batch_size = 32
+image_shape = (224, 224, 3)
+
+
+def generator():
+    image = np.random.randint(0, 255, image_shape, dtype=np.uint8)
+    label = np.array(1, dtype=np.int32)
+    for _ in range(num_rows):
+        yield (image, label)
+
+
+def read_rows(zero_copy):
+    data_set = ds.GeneratorDataset(generator, ["image", "label"], shuffle=False)
+    data_set = data_set.batch(batch_size, drop_remainder=True)
+    itr = data_set.create_dict_iterator(num_epochs=1, output_numpy=True)
+    start = time.time()
+    num_iter = 0
+    while itr.depipeline.GetNextAsMap(zero_copy=zero_copy):
+        num_iter += 1
+    end = time.time()
+    itr.stop()
+    return num_iter, end - start
+
+
+def test_numpy_handoff():
+    for zero_copy in (False, True):
+        num_iter, cost = read_rows(zero_copy)
+        print("zero_copy={} - total batches: {}, rows/s: {:.1f}".format(zero_copy, num_iter,
+                                                                        num_iter * batch_size / cost))
+
+
+if __name__ == '__main__':
+    test_numpy_handoff()
@@ -0,0 +1,58 @@
+# Copyright 2020 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+"""test rows/s and peak memory of the shuffle operation, single threaded against partitioned"""
+import resource
+import time
+import numpy as np
+
+import mindspore.dataset as ds
+
+num_rows = 200000
+buffer_size = 50000
+row_shape = (64,)
+
+
+def generator():
+    row = np.zeros(row_shape, dtype=np.float32)
+    for i in range(num_rows):
+        yield (row, np.array(i, dtype=np.int32))
+
+
+def shuffle_rows(partitions):
+    ds.config.set_shuffle_partitions(partitions)
+    data_set = ds.GeneratorDataset(generator, ["data", "label"], shuffle=False)
+    data_set = data_set.shuffle(buffer_size)
+    itr = data_set.create_tuple_iterator(num_epochs=1, output_numpy=True)
+    start = time.time()
+    num_iter = 0
+    for _ in itr:
+        num_iter += 1
+    end = time.time()
+    return num_iter, end - start
+
+
+def test_shuffle():
+    partitions_original = ds.config.get_shuffle_partitions()
+    for partitions in (1, 2, 4, 8):
+        num_iter, cost = shuffle_rows(partitions)
+        # The peak resident memory of the process so far, in MB
+        peak_mb = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss / 1024
+        print("partitions={} - total rows: {}, rows/s: {:.1f}, peak memory: {:.1f} MB".format(
+            partitions, num_iter, num_iter / cost, peak_mb))
+    ds.config.set_shuffle_partitions(partitions_original)
+
+
+if __name__ == '__main__':
+    test_shuffle()
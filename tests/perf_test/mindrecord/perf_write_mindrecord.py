@@ -0,0 +1,79 @@
+# Copyright 2020 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+"""test write MB/s and on-disk ratio of mindrecord, by page compression and number of parallel workers"""
+import os
+import time
+import numpy as np
+
+from mindspore.mindrecord import FileWriter
+
+mindrecord_file_name = "perf_write.mindrecord"
+num_rows = 20000
+batch_rows = 1000
+schema = {"file_name": {"type": "string"},
+          "label": {"type": "int32"},
+          "feature": {"type": "float32", "shape": [-1]},
+          "data": {"type": "bytes"}}
+
+
+def generate_data():
+    """Rows with a compressible feature and random bytes, like the encoded images, as blobs"""
+    data = []
+    for i in range(num_rows):
+        data.append({"file_name": "{:06d}.jpg".format(i), "label": i % 1000,
+                     "feature": np.repeat(np.arange(64, dtype=np.float32), 16) * (i % 7),
+                     "data": np.random.randint(0, 256, 2048 + i % 4096, dtype=np.uint8).tobytes()})
+    return data
+
+
+def remove_files():
+    for suffix in ("", ".db", ".idx"):
+        if os.path.exists(mindrecord_file_name + suffix):
+            os.remove(mindrecord_file_name + suffix)
+
+
+def write_rows(data, compression, num_workers):
+    remove_files()
+    writer = FileWriter(mindrecord_file_name)
+    writer.set_parallel_workers(num_workers)
+    writer.set_page_compression(compression)
+    writer.add_schema(schema, "perf write")
+    writer.add_index(["file_name", "label"])
+    start = time.time()
+    for i in range(0, num_rows, batch_rows):
+        writer.write_raw_data(data[i:i + batch_rows])
+    writer.commit()
+    end = time.time()
+    # The blocks taken on disk and the apparent size, which a copy or an upload takes
+    stat = os.stat(mindrecord_file_name)
+    return end - start, stat.st_blocks * 512, stat.st_size
+
+
+def test_write_mindrecord():
+    data = generate_data()
+    raw_mb = sum(len(x["data"]) + x["feature"].nbytes for x in data) / (1024 * 1024)
+    for compression in ("none", "zlib"):
+        for num_workers in (1, 2, 4, 8):
+            cost, disk_bytes, file_bytes = write_rows(data, compression, num_workers)
+            print("compression={}, workers={} - raw data: {:.1f} MB, write MB/s: {:.1f}, "
+                  "on disk: {:.1f} MB, ratio: {:.3f}, apparent size: {:.1f} MB, ratio: {:.3f}".format(
+                      compression, num_workers, raw_mb, raw_mb / cost,
+                      disk_bytes / (1024 * 1024), disk_bytes / (raw_mb * 1024 * 1024),
+                      file_bytes / (1024 * 1024), file_bytes / (raw_mb * 1024 * 1024)))
+    remove_files()
+
+
+if __name__ == '__main__':
+    test_write_mindrecord()
@@ -0,0 +1,137 @@
+# Copyright 2020 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+"""A graph gives the same outputs with its kernels launched one by one and in parallel by dataflow"""
+import numpy as np
+import pytest
+
+import mindspore.context as context
+import mindspore.nn as nn
+from mindspore import Tensor
+from mindspore.common.initializer import initializer
+from mindspore.common.parameter import Parameter
+from mindspore.ops import operations as P
+
+context.set_context(mode=context.GRAPH_MODE, device_target='CPU')
+
+
+class BranchNet(nn.Cell):
+    """Independent branches joined at the end"""
+    def __init__(self):
+        super(BranchNet, self).__init__()
+        self.matmul = P.MatMul()
+        self.add = P.TensorAdd()
+        self.mul = P.Mul()
+        self.relu = P.ReLU()
+        self.softmax = P.Softmax()
+
+    def construct(self, x, w1, w2, w3):
+        branch1 = self.relu(self.matmul(x, w1))
+        branch2 = self.softmax(self.matmul(x, w2))
+        branch3 = self.mul(self.matmul(x, w3), x)
+        return self.add(self.add(branch1, branch2), branch3), branch2
+
+
+class TrainNet(nn.Cell):
+    """Parameters read by several kernels and updated in place by the optimizer"""
+    def __init__(self):
+        super(TrainNet, self).__init__()
+        self.dense1 = nn.Dense(16, 16, weight_init="ones")
+        self.dense2 = nn.Dense(16, 16, weight_init="ones")
+        self.relu = nn.ReLU()
+        self.add = P.TensorAdd()
+
+    def construct(self, x):
+        return self.add(self.relu(self.dense1(x)), self.dense2(x))
+
+
+class ParameterNet(nn.Cell):
+    def __init__(self):
+        super(ParameterNet, self).__init__()
+        self.w = Parameter(initializer("ones", [16, 16]), name="w")
+        self.matmul = P.MatMul()
+        self.relu = P.ReLU()
+        self.neg = P.Neg()
+        self.add = P.TensorAdd()
+
+    def construct(self, x):
+        return self.add(self.relu(self.matmul(x, self.w)), self.neg(self.matmul(self.w, x)))
+
+
+def run_branch_net(parallel_num, inputs):
+    context.set_context(cpu_inter_op_parallel_num=parallel_num)
+    outputs = BranchNet()(*inputs)
+    return [output.asnumpy() for output in outputs]
+
+
+def run_training(parallel_num, x, label):
+    context.set_context(cpu_inter_op_parallel_num=parallel_num)
+    net = TrainNet()
+    loss = nn.MSELoss()
+    optimizer = nn.Momentum(net.trainable_params(), learning_rate=0.01, momentum=0.9)
+    train_net = nn.TrainOneStepCell(nn.WithLossCell(net, loss), optimizer)
+    train_net.set_train()
+    losses = [train_net(x, label).asnumpy() for _ in range(5)]
+    weights = [param.data.asnumpy() for param in net.trainable_params()]
+    return losses, weights
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+def test_branch_net_parallel_launch():
+    np.random.seed(1)
+    inputs = [Tensor(np.random.randn(16, 16).astype(np.float32)) for _ in range(4)]
+    try:
+        serial = run_branch_net(1, inputs)
+        for _ in range(3):
+            parallel = run_branch_net(4, inputs)
+            for serial_output, parallel_output in zip(serial, parallel):
+                assert np.array_equal(serial_output, parallel_output)
+    finally:
+        context.set_context(cpu_inter_op_parallel_num=1)
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+def test_parameter_net_parallel_launch():
+    np.random.seed(1)
+    x = Tensor(np.random.randn(16, 16).astype(np.float32))
+    try:
+        context.set_context(cpu_inter_op_parallel_num=1)
+        serial = ParameterNet()(x).asnumpy()
+        context.set_context(cpu_inter_op_parallel_num=4)
+        parallel = ParameterNet()(x).asnumpy()
+        assert np.array_equal(serial, parallel)
+    finally:
+        context.set_context(cpu_inter_op_parallel_num=1)
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+def test_training_parallel_launch():
+    np.random.seed(1)
+    x = Tensor(np.random.randn(8, 16).astype(np.float32))
+    label = Tensor(np.random.randn(8, 16).astype(np.float32))
+    try:
+        serial_losses, serial_weights = run_training(1, x, label)
+        parallel_losses, parallel_weights = run_training(4, x, label)
+        for serial_loss, parallel_loss in zip(serial_losses, parallel_losses):
+            assert np.array_equal(serial_loss, parallel_loss)
+        for serial_weight, parallel_weight in zip(serial_weights, parallel_weights):
+            assert np.array_equal(serial_weight, parallel_weight)
+    finally:
+        context.set_context(cpu_inter_op_parallel_num=1)
@@ -0,0 +1,140 @@
+# Copyright 2020 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+"""The fused mkldnn kernels give the same result as the kernels of the ops they replace, run one by one"""
+import numpy as np
+import pytest
+
+import mindspore.context as context
+import mindspore.nn as nn
+from mindspore import Tensor
+from mindspore.ops import operations as P
+
+context.set_context(mode=context.GRAPH_MODE, device_target='CPU')
+
+
+class UnaryNet(nn.Cell):
+    """A single op, nothing to fuse"""
+    def __init__(self, op):
+        super(UnaryNet, self).__init__()
+        self.op = op
+
+    def construct(self, x):
+        return self.op(x)
+
+
+class BinaryNet(nn.Cell):
+    """A single op, nothing to fuse"""
+    def __init__(self, op):
+        super(BinaryNet, self).__init__()
+        self.op = op
+
+    def construct(self, x, y):
+        return self.op(x, y)
+
+
+class BatchNormNet(nn.Cell):
+    def __init__(self):
+        super(BatchNormNet, self).__init__()
+        self.batch_norm = P.BatchNorm(is_training=False)
+
+    def construct(self, x, scale, b, mean, variance):
+        return self.batch_norm(x, scale, b, mean, variance)[0]
+
+
+class ConvBiasReluNet(nn.Cell):
+    def __init__(self):
+        super(ConvBiasReluNet, self).__init__()
+        self.conv = P.Conv2D(out_channel=4, kernel_size=3, pad_mode="same")
+        self.bias_add = P.BiasAdd()
+        self.relu = P.ReLU()
+
+    def construct(self, x, w, b):
+        return self.relu(self.bias_add(self.conv(x, w), b))
+
+
+class MatMulBiasReluNet(nn.Cell):
+    def __init__(self):
+        super(MatMulBiasReluNet, self).__init__()
+        self.matmul = P.MatMul()
+        self.bias_add = P.BiasAdd()
+        self.relu = P.ReLU()
+
+    def construct(self, x, w, b):
+        return self.relu(self.bias_add(self.matmul(x, w), b))
+
+
+class BatchNormReluNet(nn.Cell):
+    def __init__(self):
+        super(BatchNormReluNet, self).__init__()
+        self.batch_norm = P.BatchNorm(is_training=False)
+        self.relu = P.ReLU()
+
+    def construct(self, x, scale, b, mean, variance):
+        return self.relu(self.batch_norm(x, scale, b, mean, variance)[0])
+
+
+def random_tensor(*shape):
+    return Tensor(np.random.uniform(-2, 2, shape).astype(np.float32))
+
+
+def assert_same(fused, unfused):
+    assert fused.shape == unfused.shape
+    assert np.allclose(fused, unfused, rtol=1e-5, atol=1e-5)
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+def test_conv_bias_relu_fusion():
+    np.random.seed(1)
+    x = random_tensor(2, 3, 8, 8)
+    w = random_tensor(4, 3, 3, 3)
+    b = random_tensor(4)
+    fused = ConvBiasReluNet()(x, w, b).asnumpy()
+    conv_out = BinaryNet(P.Conv2D(out_channel=4, kernel_size=3, pad_mode="same"))(x, w)
+    bias_out = BinaryNet(P.BiasAdd())(conv_out, b)
+    unfused = UnaryNet(P.ReLU())(bias_out).asnumpy()
+    assert_same(fused, unfused)
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+def test_matmul_bias_relu_fusion():
+    np.random.seed(1)
+    x = random_tensor(16, 32)
+    w = random_tensor(32, 8)
+    b = random_tensor(8)
+    fused = MatMulBiasReluNet()(x, w, b).asnumpy()
+    matmul_out = BinaryNet(P.MatMul())(x, w)
+    bias_out = BinaryNet(P.BiasAdd())(matmul_out, b)
+    unfused = UnaryNet(P.ReLU())(bias_out).asnumpy()
+    assert_same(fused, unfused)
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+def test_batch_norm_relu_fusion():
+    np.random.seed(1)
+    x = random_tensor(2, 4, 8, 8)
+    scale = random_tensor(4)
+    b = random_tensor(4)
+    mean = random_tensor(4)
+    variance = Tensor(np.random.uniform(0.5, 2, 4).astype(np.float32))
+    fused = BatchNormReluNet()(x, scale, b, mean, variance).asnumpy()
+    batch_norm_out = BatchNormNet()(x, scale, b, mean, variance)
+    unfused = UnaryNet(P.ReLU())(batch_norm_out).asnumpy()
+    assert_same(fused, unfused)
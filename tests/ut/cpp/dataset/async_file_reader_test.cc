@@ -0,0 +1,62 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <memory>
+#include <string>
+#include <vector>
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/util/async_file_reader.h"
+#include "minddata/dataset/util/task_manager.h"
+#include "common/common.h"
+#include "gtest/gtest.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestAsyncFileReader : public UT::DatasetOpTesting {};
+
+TEST_F(MindDataTestAsyncFileReader, TestReadAhead) {
+  std::string folder = datasets_root_path_ + "/testImageNetData/train/class1/";
+  std::vector<std::string> paths = {folder + "1_1.jpg", folder + "1_2.jpg", folder + "1_1.jpg"};
+
+  TaskGroup vg;
+  AsyncFileReader reader(2);
+  ASSERT_TRUE(reader.Launch(&vg).IsOk());
+  // A file submitted twice is taken twice
+  ASSERT_TRUE(reader.Submit(paths).IsOk());
+  for (const auto &path : paths) {
+    std::shared_ptr<Tensor> read_ahead;
+    std::shared_ptr<Tensor> expected;
+    ASSERT_TRUE(reader.Take(path, &read_ahead).IsOk());
+    ASSERT_TRUE(Tensor::CreateFromFile(path, &expected).IsOk());
+    ASSERT_TRUE(*read_ahead == *expected);
+  }
+
+  // A file not submitted is read on the spot
+  std::shared_ptr<Tensor> not_submitted;
+  std::shared_ptr<Tensor> expected;
+  ASSERT_TRUE(reader.Take(paths[1], &not_submitted).IsOk());
+  ASSERT_TRUE(Tensor::CreateFromFile(paths[1], &expected).IsOk());
+  EXPECT_TRUE(*not_submitted == *expected);
+
+  // A missing file fails when it is taken
+  std::string missing = folder + "missing.jpg";
+  ASSERT_TRUE(reader.Submit({missing}).IsOk());
+  std::shared_ptr<Tensor> out;
+  EXPECT_TRUE(reader.Take(missing, &out).IsError());
+
+  reader.Stop();
+  vg.join_all(Task::WaitFlag::kBlocking);
+  EXPECT_TRUE(vg.GetTaskErrorIfAny().IsOk());
+}
@@ -373,3 +373,85 @@ TEST_F(MindDataTestBatchOp, TestSimpleBatchPadding) {
     EXPECT_TRUE(rc.IsOk());
   }
 }
+
+TEST_F(MindDataTestBatchOp, TestBatchRowsFromSlots) {
+  auto pool = std::make_shared<BatchBufferPool>(2);
+  std::shared_ptr<Tensor> base;
+  ASSERT_TRUE(Tensor::CreateEmpty(TensorShape({4, 2}), DataType(DataType::DE_INT32), pool, &base).IsOk());
+  auto table = std::make_unique<TensorQTable>();
+  for (dsize_t i = 0; i < 3; i++) {
+    std::shared_ptr<Tensor> slot;
+    ASSERT_TRUE(Tensor::CreateView(base, {i}, TensorShape({2}), &slot).IsOk());
+    slot->SetItemAt<int32_t>({0}, i);
+    slot->SetItemAt<int32_t>({1}, -i);
+    table->push_back(TensorRow(0, {slot}));
+  }
+  // rows in consecutive slots are handed over without a copy, a partial batch is a view of the first rows
+  auto dest = std::make_unique<TensorQTable>();
+  ASSERT_TRUE(BatchOp::BatchRows(&table, &dest, 3, pool).IsOk());
+  std::shared_ptr<Tensor> batch = dest->front().at(0);
+  ASSERT_EQ(batch->shape(), TensorShape({3, 2}));
+  ASSERT_EQ(batch->GetBuffer(), base->GetBuffer());
+  int32_t value = 0;
+  batch->GetItemAt<int32_t>(&value, {2, 1});
+  ASSERT_EQ(value, -2);
+
+  // a row out of its slot makes BatchRows copy the rows
+  std::shared_ptr<Tensor> row;
+  Tensor::CreateFromVector(std::vector<int32_t>{5, 6}, &row);
+  table->at(1) = TensorRow(0, {row});
+  dest = std::make_unique<TensorQTable>();
+  ASSERT_TRUE(BatchOp::BatchRows(&table, &dest, 3, pool).IsOk());
+  batch = dest->front().at(0);
+  ASSERT_NE(batch->GetBuffer(), base->GetBuffer());
+  batch->GetItemAt<int32_t>(&value, {1, 1});
+  ASSERT_EQ(value, 6);
+}
+
+TEST_F(MindDataTestBatchOp, TestPadColumnsIntoSlots) {
+  std::unordered_map<std::string, int32_t> column_map = {{"col", 0}};
+  auto table = std::make_unique<TensorQTable>();
+  for (int32_t i = 1; i <= 3; i++) {
+    std::shared_ptr<Tensor> row;
+    Tensor::CreateFromVector(std::vector<int32_t>(i, i), &row);
+    table->push_back(TensorRow(0, {row}));
+  }
+  ASSERT_TRUE(BatchOp::PadColumns(&table, {}, column_map).IsOk());
+  // every row lives in its slot of one batch tensor, including the one which needed no padding
+  std::shared_ptr<Tensor> base = table->front().at(0)->base();
+  ASSERT_NE(base, nullptr);
+  for (const auto &row : *table) {
+    ASSERT_EQ(row.at(0)->base(), base);
+  }
+  auto dest = std::make_unique<TensorQTable>();
+  ASSERT_TRUE(BatchOp::BatchRows(&table, &dest, 3).IsOk());
+  ASSERT_EQ(dest->front().at(0), base);
+  std::shared_ptr<Tensor> expect;
+  Tensor::CreateFromVector(std::vector<int32_t>{1, 0, 0, 2, 2, 0, 3, 3, 3}, TensorShape({3, 3}), &expect);
+  ASSERT_TRUE(*expect == *base);
+}
+
+TEST_F(MindDataTestBatchOp, TestBatchBufferPool) {
+  auto pool = std::make_shared<BatchBufferPool>(1);
+  std::shared_ptr<Tensor> t;
+  ASSERT_TRUE(Tensor::CreateEmpty(TensorShape({8, 3}), DataType(DataType::DE_FLOAT32), pool, &t).IsOk());
+  const unsigned char *buffer = t->GetBuffer();
+  t.reset();
+  // a freed block of the same size is handed out again
+  ASSERT_TRUE(Tensor::CreateEmpty(TensorShape({3, 8}), DataType(DataType::DE_FLOAT32), pool, &t).IsOk());
+  ASSERT_EQ(t->GetBuffer(), buffer);
+  ASSERT_EQ(pool->num_reused(), 1);
+
+  BatchSlots slots(2, pool);
+  std::shared_ptr<Tensor> slot, next;
+  ASSERT_TRUE(slots.GetSlot(0, 0, &slot).IsOk());
+  ASSERT_EQ(slot, nullptr);  // shape of the rows is not known yet
+  slots.Observe(t);
+  ASSERT_TRUE(slots.GetSlot(0, 0, &slot).IsOk());
+  ASSERT_TRUE(slots.GetSlot(0, 1, &next).IsOk());
+  ASSERT_EQ(slot->shape(), t->shape());
+  ASSERT_EQ(slot->base(), next->base());
+  ASSERT_EQ(next->GetBuffer(), slot->GetBuffer() + t->SizeInBytes());
+  ASSERT_TRUE(slots.GetSlot(0, 2, &next).IsOk());
+  ASSERT_NE(slot->base(), next->base());
+}
@@ -48,12 +48,20 @@ public:
   // A random sleep/delay can be introduced for each thread. See run().
   Status Run_test_1();
 
+  // Test scenario: multiple producers, single consumer, with the number of producers
+  // in use changing at the start of some rounds (see Connector::ScheduleActiveProducers).
+  Status Run_test_2();
+
   void SetSleepMilliSec(uint32_t ms) { sleep_ms_ = ms; }
 
+  // Use lock free ring queues in the connectors created by the tests
+  void SetLockFree(bool lock_free) { lock_free_ = lock_free; }
+
 private:
   std::unique_ptr<TaskGroup> tg_;
   uint32_t last_input_;
   uint32_t sleep_ms_ = 0;
+  bool lock_free_ = false;
   std::vector<uint32_t> input_;
   WaitPost wp;
 
@@ -74,6 +82,9 @@ private:
                          int start_in,
                          int offset);
 
+  // This worker loop pushes the given elements of input_ in order.
+  Status ListWorkerPush(int tid, std::shared_ptr<Connector<uint32_t> > my_conn, std::vector<uint32_t> elements);
+
   // This worker loop read from a Connector and put the result into another Connector.
   Status MidWorkerJob(
                       int tid,
@@ -123,6 +134,37 @@ TEST_F(MindDataTestConnector, Test2) {
 }
 
 
+// Test3: multiple producers, single consumer, the number of producers in use changes while running
+TEST_F(MindDataTestConnector, Test3) {
+  MS_LOG(INFO) << "MindDataTestConnector Test3.";
+  this->SetSleepMilliSec(5);
+  Status rc = this->Run_test_2();
+  ASSERT_TRUE(rc.IsOk());
+  rc = TaskManager::GetMasterThreadRc();
+  ASSERT_TRUE(rc.IsOk());
+}
+
+// Test4: same as Test2 with lock free queues in the connectors
+TEST_F(MindDataTestConnector, Test4) {
+  MS_LOG(INFO) << "MindDataTestConnector Test4.";
+  this->SetLockFree(true);
+  this->SetSleepMilliSec(30);
+  Status rc = this->Run_test_1();
+  ASSERT_TRUE(rc.IsOk());
+  rc = TaskManager::GetMasterThreadRc();
+  ASSERT_TRUE(rc.IsOk());
+}
+
+// Test5: same as Test3 with lock free queues in the connector
+TEST_F(MindDataTestConnector, Test5) {
+  MS_LOG(INFO) << "MindDataTestConnector Test5.";
+  this->SetLockFree(true);
+  this->SetSleepMilliSec(5);
+  Status rc = this->Run_test_2();
+  ASSERT_TRUE(rc.IsOk());
+  rc = TaskManager::GetMasterThreadRc();
+  ASSERT_TRUE(rc.IsOk());
+}
 
 // Implementation of MindDataTestConnector class and the helper functions.
 MindDataTestConnector::MindDataTestConnector() : tg_(new TaskGroup()) {
@@ -188,11 +230,13 @@ Status MindDataTestConnector::Run_test_1() {
 
   auto conn1 = std::make_shared<Connector<uint32_t>>(l1_threads,  // num of producers
                                                      l2_threads,  // num of consumers
-                                                     conn1_qcap);  // the cap of each queue
+                                                     conn1_qcap,  // the cap of each queue
+                                                     lock_free_);
 
   auto conn2 = std::make_shared<Connector<uint32_t>>(l2_threads,
                                                      l3_threads,
-                                                     conn2_qcap);
+                                                     conn2_qcap,
+                                                     lock_free_);
 
   rc = conn1->Register(tg_.get());
   RETURN_IF_NOT_OK(rc);
@@ -241,6 +285,54 @@ Status MindDataTestConnector::Run_test_1() {
   return ValidateOutput(output);
 }
 
+Status MindDataTestConnector::Run_test_2() {
+  std::vector<uint32_t> output;
+  Status rc;
+  wp.Clear();
+
+  const int num_producers = 4;
+  auto my_conn = std::make_shared<Connector<uint32_t>>(num_producers, 1, 3, lock_free_);
+  rc = my_conn->Register(tg_.get());
+  RETURN_IF_NOT_OK(rc);
+
+  // The number of producers in use asked for from a given element on. The switch is done at the start
+  // of the next round, the same way ParallelOp::NextWorker does it.
+  std::vector<std::pair<int, int>> targets = {{10, 2}, {40, 3}, {70, 1}, {100, 4}};
+  std::vector<std::vector<uint32_t>> elements(num_producers);
+  int active = num_producers;
+  int round_start = 0;
+  auto target = targets.begin();
+  for (int i = 0; i < input_.size(); i++) {
+    if ((i - round_start) % active == 0 && target != targets.end() && i >= target->first) {
+      active = target->second;
+      round_start = i;
+      my_conn->ScheduleActiveProducers(i, active);
+      ++target;
+    }
+    elements[(i - round_start) % active].push_back(input_[i]);
+  }
+
+  for (int i = 0; i < num_producers; i++) {
+    rc = tg_->CreateAsyncTask("List Worker Push", std::bind(&MindDataTestConnector::ListWorkerPush, this, i, my_conn,
+                                                            elements[i]));
+    RETURN_IF_NOT_OK(rc);
+  }
+  rc = tg_->CreateAsyncTask("Worker Pull",
+                            std::bind(&MindDataTestConnector::SerialWorkerPull, this, 0, my_conn, &output));
+  RETURN_IF_NOT_OK(rc);
+  // Wait for the threads to finish.
+  rc = wp.Wait();
+  EXPECT_TRUE(rc.IsOk());
+  tg_->interrupt_all();
+  tg_->join_all(Task::WaitFlag::kNonBlocking);
+  my_conn.reset();
+
+  if (output.size() != input_.size()) {
+    return Status(StatusCode::kUnexpectedError, "Output vector is missing elements.");
+  }
+  return ValidateOutput(output);
+}
+
 Status MindDataTestConnector::SerialWorkerPull(
                                                int tid,
                                                std::shared_ptr<Connector<uint32_t>> my_conn,
@@ -289,6 +381,21 @@ Status MindDataTestConnector::FirstWorkerPush(
   return Status::OK();
 }
 
+Status MindDataTestConnector::ListWorkerPush(int tid, std::shared_ptr<Connector<uint32_t> > my_conn,
+                                             std::vector<uint32_t> elements) {
+  TaskManager::FindMe()->Post();
+  MS_ASSERT(my_conn != nullptr);
+  for (auto el : elements) {
+    RETURN_IF_NOT_OK(my_conn->Push(tid, el));
+
+    // Emulate different processing time for each thread
+    if (sleep_ms_ != 0) {
+      GoToSleep(sleep_ms_);
+    }
+  }
+  return Status::OK();
+}
+
 // This worker loop read from a Connector and put the result into another Connector.
 Status MindDataTestConnector::MidWorkerJob(
                                    int tid,
@@ -0,0 +1,84 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstdlib>
+#include "common/cvop_common.h"
+#include "minddata/dataset/kernels/image/center_crop_op.h"
+#include "minddata/dataset/kernels/image/decode_center_crop_op.h"
+#include "minddata/dataset/kernels/image/decode_op.h"
+#include "minddata/dataset/core/cv_tensor.h"
+#include "utils/log_adapter.h"
+
+using namespace mindspore::dataset;
+using mindspore::LogStream;
+using mindspore::ExceptionType::NoExceptionType;
+using mindspore::MsLogLevel::INFO;
+
+namespace {
+// Pixels of a crop decoded by libjpeg may differ by a few levels from the ones of the decoded image cropped,
+// the same bound as the tests of RandomCropDecodeResizeOp
+constexpr double kMseThreshold = 2.5;
+
+// mean of the absolute difference over the channels which differ, 0 when the images are equal
+double MeanDiff(const std::shared_ptr<Tensor> &output, const std::shared_ptr<Tensor> &expected) {
+  cv::Mat m1 = CVTensor::AsCVTensor(output)->mat();
+  cv::Mat m2 = CVTensor::AsCVTensor(expected)->mat();
+  int64_t diff_sum = 0;
+  int64_t count = 0;
+  for (int i = 0; i < m1.rows; ++i) {
+    for (int j = 0; j < m1.cols; ++j) {
+      for (int c = 0; c < 3; ++c) {
+        int diff = std::abs(static_cast<int>(m1.at<cv::Vec3b>(i, j)[c]) - static_cast<int>(m2.at<cv::Vec3b>(i, j)[c]));
+        diff_sum += diff;
+        count += diff != 0 ? 1 : 0;
+      }
+    }
+  }
+  return count > 0 ? static_cast<double>(diff_sum) / count : 0.0;
+}
+}  // namespace
+
+class MindDataTestDecodeCenterCropOp : public UT::CVOP::CVOpCommon {
+ public:
+  MindDataTestDecodeCenterCropOp() : CVOpCommon() {}
+};
+
+TEST_F(MindDataTestDecodeCenterCropOp, TestOp) {
+  MS_LOG(INFO) << "Doing MindDataTestDecodeCenterCropOp::TestOp.";
+  // A crop within the image is decoded directly, a bigger one is padded the same way as CenterCropOp
+  for (auto size : {std::make_pair(128, 96), std::make_pair(4000, 64)}) {
+    CenterCropOp center_crop(size.first, size.second);
+    std::shared_ptr<Tensor> decoded;
+    std::shared_ptr<Tensor> expected;
+    ASSERT_TRUE(DecodeOp(true).Compute(raw_input_tensor_, &decoded).IsOk());
+    Status s = center_crop.Compute(decoded, &expected);
+
+    DecodeCenterCropOp op(center_crop);
+    std::shared_ptr<Tensor> output_tensor;
+    ASSERT_EQ(op.Compute(raw_input_tensor_, &output_tensor).IsOk(), s.IsOk());
+    if (s.IsOk()) {
+      ASSERT_EQ(output_tensor->shape(), expected->shape());
+      ASSERT_EQ(output_tensor->type(), expected->type());
+      double mse = MeanDiff(output_tensor, expected);
+      MS_LOG(INFO) << "mse: " << mse;
+      if (size.first <= decoded->shape()[0] && size.second <= decoded->shape()[1]) {
+        EXPECT_LT(mse, kMseThreshold);
+      } else {
+        // the padded crop goes through DecodeOp and CenterCropOp, it is the same image
+        EXPECT_EQ(mse, 0.0);
+      }
+    }
+  }
+}
@@ -170,4 +170,35 @@ TEST_F(MindDataTestFillOp, StringToNumeric) {
   ASSERT_TRUE(s.get_code() == StatusCode::kUnexpectedError);
 
   MS_LOG(INFO) << "MindDataTestFillOp-StringToNumeric end.";
+}
+
+TEST_F(MindDataTestFillOp, TestBatch) {
+  MS_LOG(INFO) << "Doing MindDataTestFillOp-TestBatch.";
+  TensorTable input;
+  for (int64_t n : {1, 3, 7}) {
+    std::shared_ptr<Tensor> t;
+    Tensor::CreateFromVector(std::vector<uint64_t>(n, 1), &t);
+    input.emplace_back(TensorRow(1, t));
+  }
+  std::shared_ptr<Tensor> scalar;
+  Tensor::CreateScalar<uint64_t>(1, &scalar);
+  input.emplace_back(TensorRow(1, scalar));
+
+  std::shared_ptr<Tensor> fill_tensor;
+  Tensor::CreateScalar<float>(2.0, &fill_tensor);
+  std::unique_ptr<FillOp> op(new FillOp(fill_tensor));
+  EXPECT_TRUE(op->SupportsBatch());
+  EXPECT_TRUE(op->ExactBatch());
+  TensorTable output;
+  Status s = op->BatchCompute(input, &output, {});
+  EXPECT_TRUE(s.IsOk());
+  ASSERT_EQ(output.size(), input.size());
+  // Same as the output of Compute row by row
+  for (size_t r = 0; r < input.size(); r++) {
+    std::shared_ptr<Tensor> expected;
+    ASSERT_TRUE(op->Compute(input[r][0], &expected).IsOk());
+    ASSERT_EQ(output[r].size(), 1);
+    ASSERT_TRUE(*output[r][0] == *expected);
+  }
+  MS_LOG(INFO) << "MindDataTestFillOp-TestBatch end.";
 }
\ No newline at end of file
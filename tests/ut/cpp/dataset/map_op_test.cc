@@ -21,6 +21,7 @@
 #include "common/common.h"
 #include "minddata/dataset/core/client.h"
 #include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/engine/datasetops/map_op/cpu_map_job.h"
 #include "minddata/dataset/engine/datasetops/source/image_folder_op.h"
 #include "minddata/dataset/kernels/image/decode_op.h"
 #include "minddata/dataset/kernels/image/resize_op.h"
@@ -89,6 +90,42 @@ class OneToThreeOp : public TensorOp {
 
   std::string Name() const override { return "OneToThreeOp"; };
 };
+
+// Adds one to every element of an int32 tensor, counts how it was called
+class CountingAddOp : public TensorOp {
+ public:
+  CountingAddOp(bool supports_batch, bool exact_batch)
+      : supports_batch_(supports_batch), exact_batch_(exact_batch), compute_calls_(0), batch_calls_(0) {}
+
+  ~CountingAddOp() override = default;
+
+  Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override {
+    compute_calls_++;
+    std::vector<int32_t> values(input->begin<int32_t>(), input->end<int32_t>());
+    for (auto &v : values) {
+      v++;
+    }
+    return Tensor::CreateFromVector(values, input->shape(), output);
+  }
+
+  bool SupportsBatch() override { return supports_batch_; }
+
+  bool ExactBatch() override { return exact_batch_; }
+
+  Status BatchCompute(const TensorTable &input, TensorTable *output, const std::vector<TensorPtr> &slots) override {
+    batch_calls_++;
+    return TensorOp::BatchCompute(input, output, slots);
+  }
+
+  void Print(std::ostream &out) const override { out << "CountingAddOp"; };
+
+  std::string Name() const override { return "CountingAddOp"; }
+
+  bool supports_batch_;
+  bool exact_batch_;
+  int32_t compute_calls_;
+  int32_t batch_calls_;
+};
 }  // namespace test
 }  // namespace dataset
 }  // namespace mindspore
@@ -737,3 +774,59 @@ TEST_F(MindDataTestMapOp, ImageFolder_Decode_Repeat_Resize_NoInputColumns) {
   }
   EXPECT_TRUE(i == 88);
 }
+
+namespace {
+// Runs two CountingAddOps in a CpuMapJob on rows {0}, {1}, ... and checks every row got two added
+void RunCountingJob(const std::shared_ptr<mindspore::dataset::test::CountingAddOp> &op1,
+                    const std::shared_ptr<mindspore::dataset::test::CountingAddOp> &op2, bool exact_only) {
+  const int32_t num_rows = 5;
+  std::vector<TensorRow> in;
+  for (int32_t i = 0; i < num_rows; i++) {
+    std::shared_ptr<Tensor> t;
+    Tensor::CreateFromVector(std::vector<int32_t>{i, i * 10}, &t);
+    in.emplace_back(TensorRow(1, t));
+  }
+  CpuMapJob job({op1, op2});
+  job.SetExactBatchOnly(exact_only);
+  std::vector<TensorRow> out;
+  ASSERT_TRUE(job.Run(in, &out).IsOk());
+  ASSERT_EQ(out.size(), static_cast<size_t>(num_rows));
+  for (int32_t i = 0; i < num_rows; i++) {
+    std::shared_ptr<Tensor> expected;
+    Tensor::CreateFromVector(std::vector<int32_t>{i + 2, i * 10 + 2}, &expected);
+    ASSERT_EQ(out[i].size(), 1);
+    ASSERT_TRUE(*out[i][0] == *expected);
+  }
+}
+}  // namespace
+
+TEST_F(MindDataTestMapOp, TestCpuMapJobBatch) {
+  MS_LOG(INFO) << "Doing MindDataTestMapOp-TestCpuMapJobBatch.";
+  using mindspore::dataset::test::CountingAddOp;
+  // All the ops support batching, the job hands the whole batch to each of them once
+  auto op1 = std::make_shared<CountingAddOp>(true, true);
+  auto op2 = std::make_shared<CountingAddOp>(true, true);
+  RunCountingJob(op1, op2, true);
+  EXPECT_EQ(op1->batch_calls_, 1);
+  EXPECT_EQ(op2->batch_calls_, 1);
+
+  // One op lacks batch support, the job falls back to Compute row by row for all of them
+  op1 = std::make_shared<CountingAddOp>(true, true);
+  op2 = std::make_shared<CountingAddOp>(false, true);
+  RunCountingJob(op1, op2, true);
+  EXPECT_EQ(op1->batch_calls_, 0);
+  EXPECT_EQ(op2->batch_calls_, 0);
+  EXPECT_EQ(op1->compute_calls_, 5);
+  EXPECT_EQ(op2->compute_calls_, 5);
+
+  // A batch path that is not bit-exact runs only when the job is not restricted to the exact ones
+  op1 = std::make_shared<CountingAddOp>(true, true);
+  op2 = std::make_shared<CountingAddOp>(true, false);
+  RunCountingJob(op1, op2, true);
+  EXPECT_EQ(op1->batch_calls_, 0);
+  EXPECT_EQ(op2->batch_calls_, 0);
+  RunCountingJob(op1, op2, false);
+  EXPECT_EQ(op1->batch_calls_, 1);
+  EXPECT_EQ(op2->batch_calls_, 1);
+  MS_LOG(INFO) << "MindDataTestMapOp-TestCpuMapJobBatch end.";
+}
@@ -0,0 +1,51 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "common/cvop_common.h"
+#include "minddata/dataset/kernels/image/hwc_to_chw_op.h"
+#include "minddata/dataset/kernels/image/normalize_hwc_to_chw_op.h"
+#include "minddata/dataset/kernels/image/normalize_op.h"
+#include "minddata/dataset/core/cv_tensor.h"
+#include "utils/log_adapter.h"
+
+using namespace mindspore::dataset;
+using mindspore::LogStream;
+using mindspore::ExceptionType::NoExceptionType;
+using mindspore::MsLogLevel::INFO;
+
+class MindDataTestNormalizeHwcToChwOp : public UT::CVOP::CVOpCommon {
+ public:
+  MindDataTestNormalizeHwcToChwOp() : CVOpCommon() {}
+};
+
+TEST_F(MindDataTestNormalizeHwcToChwOp, TestOp) {
+  MS_LOG(INFO) << "Doing MindDataTestNormalizeHwcToChwOp::TestOp.";
+  NormalizeOp normalize(121.0, 115.0, 100.0, 70.0, 68.0, 71.0);
+  HwcToChwOp hwc_to_chw;
+  std::shared_ptr<Tensor> normalized;
+  std::shared_ptr<Tensor> expected;
+  ASSERT_TRUE(normalize.Compute(input_tensor_, &normalized).IsOk());
+  ASSERT_TRUE(hwc_to_chw.Compute(normalized, &expected).IsOk());
+
+  NormalizeHwcToChwOp op(normalize);
+  EXPECT_TRUE(op.OneToOne());
+  std::shared_ptr<Tensor> output_tensor;
+  Status s = op.Compute(input_tensor_, &output_tensor);
+  ASSERT_TRUE(s.IsOk());
+  // The fused op gives the same output bit for bit
+  ASSERT_EQ(output_tensor->shape(), expected->shape());
+  ASSERT_EQ(output_tensor->type(), expected->type());
+  EXPECT_EQ(memcmp(output_tensor->GetBuffer(), expected->GetBuffer(), expected->SizeInBytes()), 0);
+}
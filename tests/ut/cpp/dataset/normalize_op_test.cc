@@ -13,6 +13,8 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
+#include <cmath>
 #include "common/common.h"
 #include "common/cvop_common.h"
 #include "minddata/dataset/kernels/image/normalize_op.h"
@@ -55,3 +57,28 @@ TEST_F(MindDataTestNormalizeOP, TestOp) {
   cv::FileStorage file(output_filename, cv::FileStorage::WRITE);
   file << "imageData" << cv_output_image;
 }
+
+TEST_F(MindDataTestNormalizeOP, TestBatch) {
+  MS_LOG(INFO) << "Doing TestNormalizeOp::TestBatch.";
+  std::unique_ptr<NormalizeOp> op(new NormalizeOp(121.0, 115.0, 100.0, 70.0, 68.0, 71.0));
+  EXPECT_TRUE(op->SupportsBatch());
+  // The loop rounds differently from OpenCV, MapOp uses it only when OPTIMIZE is on
+  EXPECT_FALSE(op->ExactBatch());
+  TensorTable input = {TensorRow(1, input_tensor_), TensorRow(1, input_tensor_)};
+  TensorTable output;
+  Status s = op->BatchCompute(input, &output, {});
+  EXPECT_TRUE(s.IsOk());
+  ASSERT_EQ(output.size(), input.size());
+
+  std::shared_ptr<Tensor> expected;
+  ASSERT_TRUE(op->Compute(input_tensor_, &expected).IsOk());
+  for (const auto &row : output) {
+    ASSERT_EQ(row[0]->shape(), expected->shape());
+    ASSERT_EQ(row[0]->type(), expected->type());
+    // The single pass may only differ from OpenCV by rounding
+    auto out = row[0]->begin<float>();
+    for (auto it = expected->begin<float>(); it != expected->end<float>(); ++it, ++out) {
+      ASSERT_NEAR(*out, *it, 1e-5 * std::max(1.0f, std::fabs(*it)));
+    }
+  }
+}
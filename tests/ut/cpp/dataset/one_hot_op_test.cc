@@ -49,3 +49,39 @@ TEST_F(MindDataTestOneHotOp, TestOp) {
   ASSERT_TRUE(*output == *expected);
   MS_LOG(INFO) << "MindDataTestOneHotOp end.";
 }
+
+TEST_F(MindDataTestOneHotOp, TestBatch) {
+  MS_LOG(INFO) << "Doing MindDataTestOneHotOp-TestBatch.";
+  TensorTable input;
+  for (int32_t label : {3, 0, 4}) {
+    std::shared_ptr<Tensor> t;
+    Tensor::CreateScalar(label, &t);
+    input.emplace_back(TensorRow(1, t));
+  }
+  std::shared_ptr<Tensor> labels;
+  Tensor::CreateFromVector(std::vector<int32_t>{1, 2}, &labels);
+  input.emplace_back(TensorRow(1, labels));
+
+  std::unique_ptr<OneHotOp> op(new OneHotOp(5));
+  EXPECT_TRUE(op->SupportsBatch());
+  EXPECT_TRUE(op->ExactBatch());
+  TensorTable output;
+  Status s = op->BatchCompute(input, &output, {});
+  EXPECT_TRUE(s.IsOk());
+  ASSERT_EQ(output.size(), input.size());
+  // Same as the output of Compute row by row
+  for (size_t r = 0; r < input.size(); r++) {
+    std::shared_ptr<Tensor> expected;
+    ASSERT_TRUE(op->Compute(input[r][0], &expected).IsOk());
+    ASSERT_EQ(output[r].size(), 1);
+    ASSERT_TRUE(*output[r][0] == *expected);
+  }
+
+  // A label out of range fails the batch
+  std::shared_ptr<Tensor> bad_label;
+  Tensor::CreateScalar<int32_t>(5, &bad_label);
+  input.emplace_back(TensorRow(1, bad_label));
+  s = op->BatchCompute(input, &output, {});
+  EXPECT_FALSE(s.IsOk());
+  MS_LOG(INFO) << "MindDataTestOneHotOp-TestBatch end.";
+}
@@ -18,9 +18,11 @@
 #include "gtest/gtest.h"
 #include "minddata/dataset/util/task_manager.h"
 #include "minddata/dataset/util/queue.h"
+#include "minddata/dataset/util/ring_queue.h"
 #include <atomic>
 #include <chrono>
 #include <random>
+#include <thread>
 #include "utils/log_adapter.h"
 
 using namespace mindspore::dataset;
@@ -177,3 +179,128 @@ TEST_F(MindDataTestQueue, Test6) {
   MS_LOG(INFO) << "Popped value " << *pepped_value << " from queue index " << chosen_queue_index;
   ASSERT_EQ(*pepped_value, 99);
 }
+
+TEST_F(MindDataTestQueue, TestResize) {
+  Queue<int> que(3);
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_TRUE(que.Add(i).IsOk());
+  }
+  // Pop one and push one so that the elements wrap around the end of the array
+  int v;
+  ASSERT_TRUE(que.PopFront(&v).IsOk());
+  ASSERT_EQ(v, 0);
+  ASSERT_TRUE(que.Add(3).IsOk());
+  // Growing keeps the elements in order and makes room for more
+  ASSERT_TRUE(que.Resize(6).IsOk());
+  ASSERT_EQ(que.capacity(), 6);
+  ASSERT_EQ(que.size(), 3);
+  for (int i = 4; i < 7; ++i) {
+    ASSERT_TRUE(que.Add(i).IsOk());
+  }
+  // Shrinking below the number of elements keeps them, the producers wait until enough are popped
+  ASSERT_TRUE(que.Resize(2).IsOk());
+  ASSERT_EQ(que.capacity(), 2);
+  ASSERT_EQ(que.size(), 6);
+  for (int i = 1; i < 7; ++i) {
+    ASSERT_TRUE(que.PopFront(&v).IsOk());
+    ASSERT_EQ(v, i);
+  }
+  ASSERT_TRUE(que.Add(7).IsOk());
+  ASSERT_TRUE(que.Add(8).IsOk());
+  ASSERT_EQ(que.size(), que.capacity());
+  ASSERT_FALSE(que.Resize(0).IsOk());
+}
+
+TEST_F(MindDataTestQueue, TestRingQueue) {
+  RingQueue<std::unique_ptr<int>> que(3);
+  ASSERT_TRUE(que.empty());
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_TRUE(que.EmplaceBack(new int(i)).IsOk());
+  }
+  ASSERT_EQ(que.size(), 3);
+  // Go around the ring a few times
+  std::unique_ptr<int> b;
+  for (int i = 3; i < 100; ++i) {
+    ASSERT_TRUE(que.PopFront(&b).IsOk());
+    ASSERT_EQ(*b, i - 3);
+    std::unique_ptr<int> a(new int(i));
+    ASSERT_TRUE(que.Add(std::move(a)).IsOk());
+    ASSERT_EQ(a.get(), nullptr);
+  }
+  ASSERT_EQ(que.size(), que.capacity());
+  // Growing makes room for more, shrinking keeps the elements
+  ASSERT_TRUE(que.Resize(6).IsOk());
+  for (int i = 100; i < 103; ++i) {
+    ASSERT_TRUE(que.EmplaceBack(new int(i)).IsOk());
+  }
+  ASSERT_TRUE(que.Resize(2).IsOk());
+  ASSERT_EQ(que.size(), 6);
+  for (int i = 97; i < 103; ++i) {
+    ASSERT_TRUE(que.PopFront(&b).IsOk());
+    ASSERT_EQ(*b, i);
+  }
+  ASSERT_TRUE(que.empty());
+  ASSERT_FALSE(que.Resize(0).IsOk());
+  ASSERT_FALSE(que.Resize(3 * RingQueue<int>::kGrowFactor + 100).IsOk());
+  // The elements left in the queue are freed by its destructor
+  ASSERT_TRUE(que.EmplaceBack(new int(1000)).IsOk());
+}
+
+TEST_F(MindDataTestQueue, TestRingQueueMultiThread) {
+  // Several producers and consumers on a small queue, so that they often spin and park
+  const int num_producers = 4;
+  const int num_consumers = 4;
+  const int num_elements = 20000;
+  TaskGroup vg;
+  RingQueue<int> que(4);
+  ASSERT_TRUE(que.Register(&vg).IsOk());
+  std::atomic<int64_t> sum(0);
+  std::atomic<int> count(0);
+  for (int t = 0; t < num_producers; ++t) {
+    Status rc = vg.CreateAsyncTask("Producer", [&que, t]() -> Status {
+      TaskManager::FindMe()->Post();
+      for (int i = t; i < num_elements; i += num_producers) {
+        RETURN_IF_NOT_OK(que.Add(i));
+      }
+      return Status::OK();
+    });
+    ASSERT_TRUE(rc.IsOk());
+  }
+  for (int t = 0; t < num_consumers; ++t) {
+    Status rc = vg.CreateAsyncTask("Consumer", [&que, &sum, &count]() -> Status {
+      TaskManager::FindMe()->Post();
+      int v;
+      for (int i = 0; i < num_elements / num_consumers; ++i) {
+        RETURN_IF_NOT_OK(que.PopFront(&v));
+        sum += v;
+        count++;
+      }
+      return Status::OK();
+    });
+    ASSERT_TRUE(rc.IsOk());
+  }
+  vg.join_all(Task::WaitFlag::kBlocking);
+  ASSERT_TRUE(vg.GetTaskErrorIfAny().IsOk());
+  ASSERT_EQ(count, num_elements);
+  ASSERT_EQ(sum, static_cast<int64_t>(num_elements) * (num_elements - 1) / 2);
+  ASSERT_TRUE(que.empty());
+}
+
+TEST_F(MindDataTestQueue, TestRingQueueInterrupt) {
+  // A consumer parked on an empty queue is woken up by the interrupt of its TaskGroup
+  TaskGroup vg;
+  RingQueue<int> que(3);
+  ASSERT_TRUE(que.Register(&vg).IsOk());
+  Status pop_rc;
+  Status rc = vg.CreateAsyncTask("Parked consumer", [&que, &pop_rc]() -> Status {
+    TaskManager::FindMe()->Post();
+    int v;
+    pop_rc = que.PopFront(&v);
+    return pop_rc;
+  });
+  ASSERT_TRUE(rc.IsOk());
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  vg.interrupt_all();
+  vg.join_all(Task::WaitFlag::kNonBlocking);
+  ASSERT_TRUE(pop_rc.IsInterrupted());
+}
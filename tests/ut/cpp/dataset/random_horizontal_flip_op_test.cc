@@ -38,3 +38,22 @@ TEST_F(MindDataTestRandomHorizontalFlipOp, TestOp) {
   CheckImageShapeAndData(input_tensor_, kFlipHorizontal);
   MS_LOG(INFO) << "testHorizontalFlip end.";
 }
+
+TEST_F(MindDataTestRandomHorizontalFlipOp, TestBatch) {
+  MS_LOG(INFO) << "Doing testHorizontalFlipBatch.";
+  // Always flip, the batch must be the same as the flips of OpenCV
+  std::unique_ptr<RandomHorizontalFlipOp> op(new RandomHorizontalFlipOp(1.0));
+  EXPECT_TRUE(op->SupportsBatch());
+  EXPECT_TRUE(op->ExactBatch());
+  TensorTable input = {TensorRow(1, input_tensor_), TensorRow(1, input_tensor_)};
+  TensorTable output;
+  Status s = op->BatchCompute(input, &output, {});
+  EXPECT_TRUE(s.IsOk());
+  ASSERT_EQ(output.size(), input.size());
+  std::shared_ptr<Tensor> expected;
+  ASSERT_TRUE(op->Compute(input_tensor_, &expected).IsOk());
+  for (const auto &row : output) {
+    ASSERT_TRUE(*row[0] == *expected);
+  }
+  MS_LOG(INFO) << "testHorizontalFlipBatch end.";
+}
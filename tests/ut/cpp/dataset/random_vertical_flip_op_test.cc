@@ -38,3 +38,22 @@ TEST_F(MindDataTestRandomVerticalFlipOp, TestOp) {
   CheckImageShapeAndData(input_tensor_, kFlipVertical);
   MS_LOG(INFO) << "testVerticalFlip end.";
 }
+
+TEST_F(MindDataTestRandomVerticalFlipOp, TestBatch) {
+  MS_LOG(INFO) << "Doing testVerticalFlipBatch.";
+  // Always flip, the batch must be the same as the flips of OpenCV
+  std::unique_ptr<RandomVerticalFlipOp> op(new RandomVerticalFlipOp(1.0));
+  EXPECT_TRUE(op->SupportsBatch());
+  EXPECT_TRUE(op->ExactBatch());
+  TensorTable input = {TensorRow(1, input_tensor_), TensorRow(1, input_tensor_)};
+  TensorTable output;
+  Status s = op->BatchCompute(input, &output, {});
+  EXPECT_TRUE(s.IsOk());
+  ASSERT_EQ(output.size(), input.size());
+  std::shared_ptr<Tensor> expected;
+  ASSERT_TRUE(op->Compute(input_tensor_, &expected).IsOk());
+  for (const auto &row : output) {
+    ASSERT_TRUE(*row[0] == *expected);
+  }
+  MS_LOG(INFO) << "testVerticalFlipBatch end.";
+}
@@ -0,0 +1,66 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cmath>
+#include "common/cvop_common.h"
+#include "minddata/dataset/kernels/image/hwc_to_chw_op.h"
+#include "minddata/dataset/kernels/image/normalize_op.h"
+#include "minddata/dataset/kernels/image/rescale_normalize_op.h"
+#include "minddata/dataset/kernels/image/rescale_op.h"
+#include "minddata/dataset/core/cv_tensor.h"
+#include "utils/log_adapter.h"
+
+using namespace mindspore::dataset;
+using mindspore::LogStream;
+using mindspore::ExceptionType::NoExceptionType;
+using mindspore::MsLogLevel::INFO;
+
+class MindDataTestRescaleNormalizeOp : public UT::CVOP::CVOpCommon {
+ public:
+  MindDataTestRescaleNormalizeOp() : CVOpCommon() {}
+
+  // Compares the fused op against RescaleOp, NormalizeOp and optionally HwcToChwOp run one after the other
+  void CheckAgainstUnfused(bool hwc_to_chw) {
+    RescaleOp rescale(1.0 / 255.0, -0.5);
+    NormalizeOp normalize(0.485, 0.456, 0.406, 0.229, 0.224, 0.225);
+    std::shared_ptr<Tensor> expected;
+    ASSERT_TRUE(rescale.Compute(input_tensor_, &expected).IsOk());
+    ASSERT_TRUE(normalize.Compute(expected, &expected).IsOk());
+    if (hwc_to_chw) {
+      ASSERT_TRUE(HwcToChwOp().Compute(expected, &expected).IsOk());
+    }
+
+    RescaleNormalizeOp op(rescale, normalize, hwc_to_chw);
+    std::shared_ptr<Tensor> output_tensor;
+    ASSERT_TRUE(op.Compute(input_tensor_, &output_tensor).IsOk());
+    ASSERT_EQ(output_tensor->shape(), expected->shape());
+    ASSERT_EQ(output_tensor->type(), DataType(DataType::DE_FLOAT32));
+    // The values may only differ by rounding
+    auto out = output_tensor->begin<float>();
+    for (auto it = expected->begin<float>(); it != expected->end<float>(); ++it, ++out) {
+      ASSERT_NEAR(*out, *it, 1e-5 * std::max(1.0f, std::fabs(*it)));
+    }
+  }
+};
+
+TEST_F(MindDataTestRescaleNormalizeOp, TestOpHwc) {
+  MS_LOG(INFO) << "Doing MindDataTestRescaleNormalizeOp::TestOpHwc.";
+  CheckAgainstUnfused(false);
+}
+
+TEST_F(MindDataTestRescaleNormalizeOp, TestOpChw) {
+  MS_LOG(INFO) << "Doing MindDataTestRescaleNormalizeOp::TestOpChw.";
+  CheckAgainstUnfused(true);
+}
@@ -13,6 +13,8 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
+#include <cmath>
 #include "common/common.h"
 #include "common/cvop_common.h"
 #include "minddata/dataset/kernels/image/rescale_op.h"
@@ -46,3 +48,28 @@ TEST_F(MindDataTestRescaleOp, TestOp) {
   CheckImageShapeAndData(output_tensor, kRescale);
   MS_LOG(INFO) << "testRescale end.";
 }
+
+TEST_F(MindDataTestRescaleOp, TestBatch) {
+  MS_LOG(INFO) << "Doing MindDataTestRescaleOp::TestBatch.";
+  std::unique_ptr<RescaleOp> op(new RescaleOp(1.0 / 255, 1.0));
+  EXPECT_TRUE(op->SupportsBatch());
+  // The loop rounds differently from OpenCV, MapOp uses it only when OPTIMIZE is on
+  EXPECT_FALSE(op->ExactBatch());
+  TensorTable input = {TensorRow(1, input_tensor_), TensorRow(1, input_tensor_)};
+  TensorTable output;
+  Status s = op->BatchCompute(input, &output, {});
+  EXPECT_TRUE(s.IsOk());
+  ASSERT_EQ(output.size(), input.size());
+
+  std::shared_ptr<Tensor> expected;
+  ASSERT_TRUE(op->Compute(input_tensor_, &expected).IsOk());
+  for (const auto &row : output) {
+    ASSERT_EQ(row[0]->shape(), expected->shape());
+    ASSERT_EQ(row[0]->type(), expected->type());
+    // The loop may only differ from OpenCV by rounding
+    auto out = row[0]->begin<float>();
+    for (auto it = expected->begin<float>(); it != expected->end<float>(); ++it, ++out) {
+      ASSERT_NEAR(*out, *it, 1e-6 * std::max(1.0f, std::fabs(*it)));
+    }
+  }
+}
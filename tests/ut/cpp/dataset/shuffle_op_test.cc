@@ -14,11 +14,15 @@
  * limitations under the License.
  */
 #include "minddata/dataset/core/client.h"
+#include "minddata/dataset/engine/datasetops/source/image_folder_op.h"
+#include "minddata/dataset/engine/datasetops/source/sampler/shuffle_buffer_sampler.h"
 #include "common/common.h"
 #include "utils/ms_utils.h"
 #include "gtest/gtest.h"
 #include "utils/log_adapter.h"
 #include <memory>
+#include <set>
+#include <string>
 #include <vector>
 #include <iostream>
 
@@ -33,6 +37,12 @@ class MindDataTestShuffleOp : public UT::DatasetOpTesting {
 
 };
 
+std::shared_ptr<ImageFolderOp> ImageFolder(int64_t num_works, int64_t rows, int64_t conns, std::string path,
+                                           bool shuf = false, std::shared_ptr<Sampler> sampler = nullptr,
+                                           std::map<std::string, int32_t> map = {}, bool decode = false);
+
+std::shared_ptr<ExecutionTree> Build(std::vector<std::shared_ptr<DatasetOp>> ops);
+
 
 // Test info:
 // - Dataset from testDataset1 has 10 rows, 2 columns.
@@ -333,3 +343,136 @@ TEST_F(MindDataTestShuffleOp, TestRepeatShuffle) {
   }
   ASSERT_EQ(row_count, 20);
 }
+
+// Test info:
+// - Dataset from testDataset1 has 10 rows, 2 columns.
+// - Shuffle buffer split into 3 partitions, shuffled in their own threads.
+// - Repeat count of 2
+// - Two runs with the same seed give the same rows in the same order.
+//
+// Tree: Repeat over shuffle over TFReader
+//
+//    Repeat
+//       |
+//    ShuffleOp
+//       |
+//    TFReaderOp
+//
+TEST_F(MindDataTestShuffleOp, TestShufflePartitioned) {
+  MS_LOG(INFO) << "UT test TestShufflePartitioned.";
+  auto run = [this](std::vector<std::string> *rows) {
+    auto my_tree = std::make_shared<ExecutionTree>();
+    std::string dataset_path = datasets_root_path_ + "/testDataset1/testDataset1.data";
+    std::shared_ptr<TFReaderOp> my_tfreader_op;
+    Status rc = TFReaderOp::Builder()
+                  .SetDatasetFilesList({dataset_path})
+                  .SetRowsPerBuffer(3)
+                  .SetWorkerConnectorSize(16)
+                  .SetNumWorkers(1)
+                  .Build(&my_tfreader_op);
+    ASSERT_TRUE(rc.IsOk());
+    std::shared_ptr<ShuffleOp> my_shuffle_op;
+    rc = ShuffleOp::Builder()
+           .SetShuffleSize(4)
+           .SetShuffleSeed(100)
+           .SetRowsPerBuffer(3)
+           .SetNumPartitions(3)
+           .Build(&my_shuffle_op);
+    ASSERT_TRUE(rc.IsOk());
+    std::shared_ptr<RepeatOp> my_repeat_op;
+    rc = RepeatOp::Builder(2).Build(&my_repeat_op);
+    ASSERT_TRUE(rc.IsOk());
+    ASSERT_TRUE(my_tree->AssociateNode(my_tfreader_op).IsOk());
+    ASSERT_TRUE(my_tree->AssociateNode(my_shuffle_op).IsOk());
+    ASSERT_TRUE(my_tree->AssociateNode(my_repeat_op).IsOk());
+    ASSERT_TRUE(my_shuffle_op->AddChild(my_tfreader_op).IsOk());
+    ASSERT_TRUE(my_repeat_op->AddChild(my_shuffle_op).IsOk());
+    ASSERT_TRUE(my_tree->AssignRoot(my_repeat_op).IsOk());
+    ASSERT_TRUE(my_tree->Prepare().IsOk());
+    ASSERT_TRUE(my_tree->Launch().IsOk());
+
+    DatasetIterator di(my_tree);
+    TensorRow tensor_list;
+    ASSERT_TRUE(di.FetchNextTensorRow(&tensor_list).IsOk());
+    while (!tensor_list.empty()) {
+      std::ostringstream ss;
+      for (const auto &t : tensor_list) {
+        ss << *t;
+      }
+      rows->push_back(ss.str());
+      ASSERT_TRUE(di.FetchNextTensorRow(&tensor_list).IsOk());
+    }
+  };
+
+  std::vector<std::string> first_run;
+  std::vector<std::string> second_run;
+  run(&first_run);
+  run(&second_run);
+  ASSERT_EQ(first_run.size(), 20);
+  EXPECT_EQ(first_run, second_run);
+
+  // Every epoch has each row once
+  std::set<std::string> epoch1(first_run.begin(), first_run.begin() + 10);
+  std::set<std::string> epoch2(first_run.begin() + 10, first_run.end());
+  EXPECT_EQ(epoch1.size(), 10);
+  EXPECT_EQ(epoch1, epoch2);
+}
+
+// Test info:
+// - The shuffle right above ImageFolderOp is moved into its sampler, which shuffles the sample ids.
+// - The rows come in the same order as with the shuffle of the rows, kept by a ProjectOp in between.
+//
+// Tree:  shuffle over ImageFolder, repeated
+//
+//    RepeatOp
+//       |
+//    ShuffleOp
+//       |
+//   (ProjectOp)
+//       |
+//  ImageFolderOp
+//
+TEST_F(MindDataTestShuffleOp, TestShuffleSampleIds) {
+  MS_LOG(INFO) << "UT test TestShuffleSampleIds.";
+  std::string folder_path = datasets_root_path_ + "/testPK/data";
+  auto run = [&folder_path](bool shuffle_rows, std::vector<std::string> *rows) {
+    std::shared_ptr<ImageFolderOp> my_image_folder_op = ImageFolder(4, 2, 32, folder_path, false);
+    std::shared_ptr<ShuffleOp> my_shuffle_op;
+    Status rc = ShuffleOp::Builder().SetShuffleSize(10).SetShuffleSeed(7).SetNumPartitions(1).Build(&my_shuffle_op);
+    ASSERT_TRUE(rc.IsOk());
+    std::shared_ptr<RepeatOp> my_repeat_op;
+    ASSERT_TRUE(RepeatOp::Builder(2).Build(&my_repeat_op).IsOk());
+    std::vector<std::shared_ptr<DatasetOp>> ops = {my_image_folder_op, my_shuffle_op, my_repeat_op};
+    if (shuffle_rows) {
+      auto my_project_op = std::make_shared<ProjectOp>(std::vector<std::string>{"image", "label"});
+      ops.insert(ops.begin() + 1, my_project_op);
+    }
+    auto my_tree = Build(ops);
+    ASSERT_TRUE(my_tree->Prepare().IsOk());
+    bool has_shuffle_op = false;
+    for (auto itr = my_tree->begin(); itr != my_tree->end(); ++itr) {
+      has_shuffle_op = has_shuffle_op || itr->Name() == kShuffleOp;
+    }
+    EXPECT_EQ(has_shuffle_op, shuffle_rows);
+    EXPECT_EQ(std::dynamic_pointer_cast<ShuffleBufferSampler>(my_image_folder_op->sampler()) == nullptr, shuffle_rows);
+    ASSERT_TRUE(my_tree->Launch().IsOk());
+
+    DatasetIterator di(my_tree);
+    TensorRow tensor_list;
+    ASSERT_TRUE(di.FetchNextTensorRow(&tensor_list).IsOk());
+    while (!tensor_list.empty()) {
+      rows->emplace_back(reinterpret_cast<const char *>(tensor_list[0]->GetBuffer()), tensor_list[0]->SizeInBytes());
+      ASSERT_TRUE(di.FetchNextTensorRow(&tensor_list).IsOk());
+    }
+  };
+
+  std::vector<std::string> id_shuffle;
+  std::vector<std::string> row_shuffle;
+  run(false, &id_shuffle);
+  run(true, &row_shuffle);
+  ASSERT_EQ(id_shuffle.size(), 88);
+  EXPECT_EQ(id_shuffle, row_shuffle);
+  // The second epoch is shuffled again
+  EXPECT_NE(std::vector<std::string>(id_shuffle.begin(), id_shuffle.begin() + 44),
+            std::vector<std::string>(id_shuffle.begin() + 44, id_shuffle.end()));
+}
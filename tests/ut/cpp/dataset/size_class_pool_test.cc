@@ -0,0 +1,158 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <thread>
+#include <vector>
+#include "minddata/dataset/core/config_manager.h"
+#include "minddata/dataset/core/global_context.h"
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/util/allocator.h"
+#include "minddata/dataset/util/size_class_pool.h"
+#include "common/common.h"
+#include "gtest/gtest.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestSizeClassPool : public UT::Common {
+ public:
+  MindDataTestSizeClassPool() {}
+};
+
+TEST_F(MindDataTestSizeClassPool, TestSizeClass) {
+  EXPECT_EQ(SizeClassPool::SizeClass(0), 0);
+  EXPECT_EQ(SizeClassPool::SizeClass(64), 0);
+  EXPECT_EQ(SizeClassPool::SizeClass(65), 1);
+  EXPECT_EQ(SizeClassPool::SizeClass(224 * 224 * 3), 12);
+  EXPECT_EQ(SizeClassPool::ClassSize(12), 262144);
+  EXPECT_EQ(SizeClassPool::SizeClass(SizeClassPool::ClassSize(SizeClassPool::kNumClasses - 1) + 1),
+            SizeClassPool::kNumClasses);
+}
+
+TEST_F(MindDataTestSizeClassPool, TestReuse) {
+  auto pool = std::make_shared<SizeClassPool>();
+  SizeClassPool::SetThreadOperatorId(3);
+  void *p = nullptr;
+  ASSERT_TRUE(pool->Allocate(1000, &p).IsOk());
+  memset(p, 1, 1000);
+  pool->Deallocate(p);
+  void *q = nullptr;
+  ASSERT_TRUE(pool->Allocate(1024, &q).IsOk());
+  // Same size class, the freed block is handed out again
+  EXPECT_EQ(p, q);
+  ASSERT_TRUE(pool->Reallocate(&q, 1024, 1000).IsOk());
+  EXPECT_EQ(p, q);
+  ASSERT_TRUE(pool->Reallocate(&q, 1024, 5000).IsOk());
+  EXPECT_NE(p, q);
+  EXPECT_EQ(reinterpret_cast<uint8_t *>(q)[999], 1);
+  pool->Deallocate(q);
+  // Too large for any class
+  ASSERT_TRUE(pool->Allocate(SizeClassPool::ClassSize(SizeClassPool::kNumClasses - 1) + 1, &p).IsOk());
+  pool->Deallocate(p);
+  SizeClassPool::SetThreadOperatorId(SizeClassPool::kNoOperator);
+
+  auto stats = pool->GetStats();
+  ASSERT_EQ(stats.count(3), 1);
+  EXPECT_EQ(stats[3].num_alloc, 4);
+  EXPECT_EQ(stats[3].num_free, 4);
+  EXPECT_EQ(stats[3].num_thread_hit, 1);
+  EXPECT_EQ(stats[3].num_system_alloc, 3);
+  EXPECT_EQ(stats[3].bytes_in_use, 0);
+  EXPECT_EQ(stats[3].peak_bytes_in_use, SizeClassPool::ClassSize(SizeClassPool::kNumClasses - 1) + 1);
+}
+
+TEST_F(MindDataTestSizeClassPool, TestProducerConsumer) {
+  // The producer allocates, the consumer frees. The blocks go back to the producer through the central cache.
+  auto pool = std::make_shared<SizeClassPool>(1024 * 1024, 64 * 1024 * 1024);
+  const int num_blocks = 1000;
+  const size_t block_size = 100 * 1024;
+  std::vector<void *> blocks(num_blocks, nullptr);
+  for (int round = 0; round < 3; ++round) {
+    std::thread producer([&]() {
+      SizeClassPool::SetThreadOperatorId(1);
+      for (auto &p : blocks) {
+        ASSERT_TRUE(pool->Allocate(block_size, &p).IsOk());
+      }
+    });
+    producer.join();
+    std::thread consumer([&]() {
+      for (auto p : blocks) {
+        pool->Deallocate(p);
+      }
+    });
+    consumer.join();
+  }
+  auto stats = pool->GetStats();
+  EXPECT_EQ(stats[1].num_alloc, 3 * num_blocks);
+  EXPECT_EQ(stats[1].num_free, 3 * num_blocks);
+  EXPECT_EQ(stats[1].bytes_in_use, 0);
+  EXPECT_GT(stats[1].num_central_hit, 0);
+  EXPECT_LT(stats[1].num_system_alloc, 3 * num_blocks);
+  EXPECT_LE(pool->CentralCacheBytes(), 64 * 1024 * 1024);
+}
+
+TEST_F(MindDataTestSizeClassPool, TestTensorData) {
+  std::shared_ptr<Tensor> t;
+  ASSERT_TRUE(Tensor::CreateEmpty(TensorShape({32, 32, 3}), DataType(DataType::DE_UINT8), &t).IsOk());
+  auto pool = GlobalContext::Instance()->tensor_data_pool();
+  ASSERT_NE(pool, nullptr);
+  auto before = pool->GetStats()[SizeClassPool::kNoOperator].num_free;
+  t = nullptr;
+  EXPECT_EQ(pool->GetStats()[SizeClassPool::kNoOperator].num_free, before + 1);
+}
+
+TEST_F(MindDataTestSizeClassPool, TestCacheLimits) {
+  auto pool = std::make_shared<SizeClassPool>(1024 * 1024, 64 * 1024 * 1024);
+  std::vector<void *> blocks(16, nullptr);
+  for (auto &p : blocks) {
+    ASSERT_TRUE(pool->Allocate(100 * 1024, &p).IsOk());
+  }
+  // Nothing is kept by the central cache once its limit is 0, the blocks of the thread go back to the system
+  pool->SetCacheLimits(0, 0);
+  for (auto p : blocks) {
+    pool->Deallocate(p);
+  }
+  pool->FlushThreadCache();
+  EXPECT_EQ(pool->CentralCacheBytes(), 0);
+
+  pool->SetCacheLimits(0, 64 * 1024 * 1024);
+  for (auto &p : blocks) {
+    ASSERT_TRUE(pool->Allocate(100 * 1024, &p).IsOk());
+  }
+  for (auto p : blocks) {
+    pool->Deallocate(p);
+  }
+  EXPECT_EQ(pool->CentralCacheBytes(), 16 * SizeClassPool::ClassSize(SizeClassPool::SizeClass(100 * 1024)));
+}
+
+TEST_F(MindDataTestSizeClassPool, TestTensorPoolConfig) {
+  auto config = GlobalContext::config_manager();
+  bool tensor_pool_original = config->tensor_pool();
+  auto pool = GlobalContext::Instance()->tensor_data_pool();
+  auto before = pool->GetStats()[SizeClassPool::kNoOperator].num_alloc;
+
+  // The data of the tensors comes from the system once the config turns the pool off
+  config->set_tensor_pool(false);
+  std::shared_ptr<Tensor> t;
+  ASSERT_TRUE(Tensor::CreateEmpty(TensorShape({32, 32, 3}), DataType(DataType::DE_UINT8), &t).IsOk());
+  t = nullptr;
+  EXPECT_EQ(pool->GetStats()[SizeClassPool::kNoOperator].num_alloc, before);
+
+  config->set_tensor_pool(true);
+  ASSERT_TRUE(Tensor::CreateEmpty(TensorShape({32, 32, 3}), DataType(DataType::DE_UINT8), &t).IsOk());
+  t = nullptr;
+  EXPECT_EQ(pool->GetStats()[SizeClassPool::kNoOperator].num_alloc, before + 1);
+
+  config->set_tensor_pool(tensor_pool_original);
+}
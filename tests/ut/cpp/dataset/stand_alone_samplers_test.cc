@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <vector>
 #include "common/common.h"
 #include "minddata/dataset/core/client.h"
 #include "minddata/dataset/core/global_context.h"
@@ -21,6 +23,7 @@
 #include "minddata/dataset/engine/datasetops/source/sampler/random_sampler.h"
 #include "minddata/dataset/engine/datasetops/source/sampler/sampler.h"
 #include "minddata/dataset/engine/datasetops/source/sampler/sequential_sampler.h"
+#include "minddata/dataset/engine/datasetops/source/sampler/shuffle_buffer_sampler.h"
 #include "minddata/dataset/util/status.h"
 #include "gtest/gtest.h"
 #include "utils/log_adapter.h"
@@ -99,3 +102,46 @@ TEST_F(MindDataTestStandAloneSampler, TestStandAoneSequentialSampler) {
   db->GetTensor(&tensor, 0, 0);
   EXPECT_TRUE((*tensor) == (*label2));
 }
+
+TEST_F(MindDataTestStandAloneSampler, TestShuffleBufferSampler) {
+  MockStorageOp mock(20);
+  auto sample_epoch = [](std::shared_ptr<Sampler> sampler) {
+    std::unique_ptr<DataBuffer> db;
+    std::shared_ptr<Tensor> tensor;
+    std::vector<int64_t> ids;
+    sampler->GetNextSample(&db);
+    while (!db->eoe()) {
+      db->GetTensor(&tensor, 0, 0);
+      ids.insert(ids.end(), tensor->begin<int64_t>(), tensor->end<int64_t>());
+      sampler->GetNextSample(&db);
+    }
+    sampler->ResetSampler();
+    return ids;
+  };
+
+  // The ids of the child, 5 to 19, go through a shuffle buffer of 4
+  std::shared_ptr<Sampler> sampler = std::make_shared<ShuffleBufferSampler>(4, 5, true, 3);
+  sampler->AddChild(std::make_shared<SequentialSampler>(0, 5));
+  ASSERT_TRUE(sampler->HandshakeRandomAccessOp(&mock).IsOk());
+  std::vector<int64_t> epoch1 = sample_epoch(sampler);
+  std::vector<int64_t> epoch2 = sample_epoch(sampler);
+  ASSERT_EQ(epoch1.size(), 15);
+  for (size_t i = 0; i < epoch1.size(); i++) {
+    // An id can't come out before it is in the buffer
+    EXPECT_LT(epoch1[i], 5 + i + 4);
+  }
+  std::vector<int64_t> sorted_ids(epoch1);
+  std::sort(sorted_ids.begin(), sorted_ids.end());
+  for (size_t i = 0; i < sorted_ids.size(); i++) {
+    EXPECT_EQ(sorted_ids[i], 5 + i);
+  }
+  EXPECT_NE(epoch1, epoch2);
+
+  // Without reshuffle every epoch comes in the same order
+  sampler = std::make_shared<ShuffleBufferSampler>(4, 5, false);
+  ASSERT_TRUE(sampler->HandshakeRandomAccessOp(&mock).IsOk());
+  epoch1 = sample_epoch(sampler);
+  epoch2 = sample_epoch(sampler);
+  ASSERT_EQ(epoch1.size(), 20);
+  EXPECT_EQ(epoch1, epoch2);
+}
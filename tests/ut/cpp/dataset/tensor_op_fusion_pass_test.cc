@@ -20,7 +20,12 @@
 #include "common/common.h"
 #include "gtest/gtest.h"
 #include "minddata/dataset/kernels/image/random_crop_and_resize_op.h"
+#include "minddata/dataset/kernels/image/center_crop_op.h"
 #include "minddata/dataset/kernels/image/decode_op.h"
+#include "minddata/dataset/kernels/image/hwc_to_chw_op.h"
+#include "minddata/dataset/kernels/image/normalize_op.h"
+#include "minddata/dataset/kernels/image/rescale_op.h"
+#include "minddata/dataset/engine/opt/optional/tensor_op_fusion_pass.h"
 #include "minddata/dataset/engine/datasetops/source/image_folder_op.h"
 #include "minddata/dataset/engine/execution_tree.h"
 
@@ -102,4 +107,67 @@ TEST_F(MindDataTestTensorOpFusionPass, RandomCropDecodeResize_fusion_enabled) {
   auto func_it = tfuncs.begin();
   EXPECT_EQ((*func_it)->Name(), kRandomCropDecodeResizeOp);
   EXPECT_EQ(++func_it, tfuncs.end());
-}
\ No newline at end of file
+}
+
+// Runs the fusion pass over a MapOp with the given tensor ops and returns the names of the resulting tensor ops
+std::vector<std::string> FuseTensorOps(std::vector<std::shared_ptr<TensorOp>> func_list, bool exact_only) {
+  std::shared_ptr<MapOp> map_op;
+  MapOp::Builder map_builder;
+  map_builder.SetInColNames({}).SetOutColNames({}).SetTensorFuncs(func_list).SetNumWorkers(1);
+  EXPECT_TRUE(map_builder.Build(&map_op).IsOk());
+  auto tree = std::make_shared<ExecutionTree>();
+  EXPECT_TRUE(tree->AssociateNode(map_op).IsOk());
+  EXPECT_TRUE(tree->AssignRoot(map_op).IsOk());
+  bool modified = false;
+  TensorOpFusionPass pass(exact_only);
+  EXPECT_TRUE(pass.Run(tree.get(), &modified).IsOk());
+  std::vector<std::string> names;
+  for (auto &op : map_op->TFuncs()) {
+    names.push_back(op->Name());
+  }
+  EXPECT_EQ(modified, names.size() != func_list.size());
+  return names;
+}
+
+TEST_F(MindDataTestTensorOpFusionPass, NormalizeHwcToChw_fusion_exact) {
+  MS_LOG(INFO) << "Doing NormalizeHwcToChw_fusion_exact";
+  auto rescale_op = std::make_shared<RescaleOp>(1.0 / 255.0, 0.0);
+  auto normalize_op = std::make_shared<NormalizeOp>(0.485, 0.456, 0.406, 0.229, 0.224, 0.225);
+  auto hwc_to_chw_op = std::make_shared<HwcToChwOp>();
+  // Only Normalize followed by HwcToChw gives the same output once fused
+  auto names = FuseTensorOps({std::make_shared<DecodeOp>(), rescale_op, normalize_op, hwc_to_chw_op}, true);
+  std::vector<std::string> expected = {kDecodeOp, kRescaleOp, kNormalizeHwcToChwOp};
+  EXPECT_EQ(names, expected);
+  names = FuseTensorOps({normalize_op, rescale_op}, true);
+  expected = {kNormalizeOp, kRescaleOp};
+  EXPECT_EQ(names, expected);
+}
+
+TEST_F(MindDataTestTensorOpFusionPass, RescaleNormalize_fusion_enabled) {
+  MS_LOG(INFO) << "Doing RescaleNormalize_fusion_enabled";
+  auto rescale_op = std::make_shared<RescaleOp>(1.0 / 255.0, 0.0);
+  auto normalize_op = std::make_shared<NormalizeOp>(0.485, 0.456, 0.406, 0.229, 0.224, 0.225);
+  auto hwc_to_chw_op = std::make_shared<HwcToChwOp>();
+  auto names = FuseTensorOps({std::make_shared<DecodeOp>(), rescale_op, normalize_op, hwc_to_chw_op}, false);
+  std::vector<std::string> expected = {kDecodeOp, kRescaleNormalizeOp};
+  EXPECT_EQ(names, expected);
+  names = FuseTensorOps({rescale_op, normalize_op, rescale_op, normalize_op}, false);
+  expected = {kRescaleNormalizeOp, kRescaleNormalizeOp};
+  EXPECT_EQ(names, expected);
+}
+
+TEST_F(MindDataTestTensorOpFusionPass, DecodeCrop_fusion_rgb_only) {
+  MS_LOG(INFO) << "Doing DecodeCrop_fusion_rgb_only";
+  auto center_crop_op = std::make_shared<CenterCropOp>(224);
+  auto rcar_op = std::make_shared<RandomCropAndResizeOp>();
+  auto names = FuseTensorOps({std::make_shared<DecodeOp>(true), center_crop_op}, false);
+  std::vector<std::string> expected = {kDecodeCenterCropOp};
+  EXPECT_EQ(names, expected);
+  // The fused ops always decode to RGB, a BGR decode is left alone
+  names = FuseTensorOps({std::make_shared<DecodeOp>(false), center_crop_op}, false);
+  expected = {kDecodeOp, kCenterCropOp};
+  EXPECT_EQ(names, expected);
+  names = FuseTensorOps({std::make_shared<DecodeOp>(false), rcar_op}, false);
+  expected = {kDecodeOp, kRandomCropAndResizeOp};
+  EXPECT_EQ(names, expected);
+}
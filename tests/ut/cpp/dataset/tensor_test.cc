@@ -537,3 +537,43 @@ TEST_F(MindDataTestTensorDE, TensorEmpty) {
   t2->Invalidate();
   ASSERT_TRUE(!t2->HasData());
 }
+
+TEST_F(MindDataTestTensorDE, TensorView) {
+  std::shared_ptr<Tensor> base;
+  Tensor::CreateFromVector(std::vector<float>{0, 1, 2, 3, 4, 5}, TensorShape({3, 2}), &base);
+  std::shared_ptr<Tensor> view;
+  ASSERT_TRUE(Tensor::CreateView(base, {1}, TensorShape({2}), &view).IsOk());
+  ASSERT_EQ(view->base(), base);
+  ASSERT_EQ(view->GetBuffer(), base->GetBuffer() + 2 * sizeof(float));
+  view->SetItemAt<float>({0}, 7);
+  float value = 0;
+  base->GetItemAt<float>(&value, {1, 0});
+  ASSERT_EQ(value, 7);
+  ASSERT_FALSE(Tensor::CreateView(base, {2}, TensorShape({4}), &view).IsOk());
+
+  // the view keeps the memory alive
+  ASSERT_TRUE(Tensor::CreateView(base, {2}, TensorShape({2}), &view).IsOk());
+  base.reset();
+  view->GetItemAt<float>(&value, {1});
+  ASSERT_EQ(value, 5);
+}
+
+TEST_F(MindDataTestTensorDE, TensorOutputSlot) {
+  std::shared_ptr<Tensor> base, slot, t;
+  Tensor::CreateEmpty(TensorShape({2, 3}), DataType(DataType::DE_INT32), &base);
+  Tensor::CreateView(base, {1}, TensorShape({3}), &slot);
+  Tensor::SetOutputSlot(slot);
+  // only a tensor of the same shape and type takes the slot, and only once
+  ASSERT_TRUE(Tensor::CreateEmpty(TensorShape({4}), DataType(DataType::DE_INT32), &t).IsOk());
+  ASSERT_NE(t, slot);
+  ASSERT_TRUE(Tensor::CreateEmpty(TensorShape({3}), DataType(DataType::DE_INT32), &t).IsOk());
+  ASSERT_EQ(t, slot);
+  ASSERT_TRUE(Tensor::CreateEmpty(TensorShape({3}), DataType(DataType::DE_INT32), &t).IsOk());
+  ASSERT_NE(t, slot);
+
+  Tensor::SetOutputSlot(slot);
+  std::shared_ptr<CVTensor> cv_t;
+  ASSERT_TRUE(CVTensor::CreateEmpty(TensorShape({3}), DataType(DataType::DE_INT32), &cv_t).IsOk());
+  ASSERT_EQ(cv_t->GetBuffer(), base->GetBuffer() + 3 * sizeof(int32_t));
+  Tensor::SetOutputSlot(nullptr);
+}
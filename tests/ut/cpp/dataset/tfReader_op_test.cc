@@ -19,6 +19,8 @@
 
 #include "minddata/dataset/core/client.h"
 #include "minddata/dataset/engine/data_schema.h"
+#include "minddata/dataset/engine/datasetops/source/tf_example_decoder.h"
+#include "proto/example.pb.h"
 #include "common/common.h"
 #include "utils/ms_utils.h"
 #include "gtest/gtest.h"
@@ -731,3 +733,112 @@ TEST_F(MindDataTestTFReaderOp, TestTFReaderInvalidFiles) {
   rc = builder.Build(&my_tfreader_op);
   ASSERT_TRUE(!rc.IsOk());
 }
+
+TEST_F(MindDataTestTFReaderOp, TestTFExampleDecoder) {
+  DataSchema schema;
+  TensorShape shape_2({2});
+  TensorImpl flexible = TensorImpl::kFlexible;
+  ASSERT_TRUE(schema.AddColumn(ColDescriptor("ints", DataType(DataType::DE_INT32), flexible, 1, &shape_2)).IsOk());
+  ASSERT_TRUE(schema.AddColumn(ColDescriptor("floats", DataType(DataType::DE_FLOAT32), flexible, 1)).IsOk());
+  ASSERT_TRUE(schema.AddColumn(ColDescriptor("strings", DataType(DataType::DE_STRING), flexible, 1)).IsOk());
+  ASSERT_TRUE(schema.AddColumn(ColDescriptor("bytes", DataType(DataType::DE_UINT8), flexible, 1)).IsOk());
+
+  dataengine::Example example;
+  auto *features = example.mutable_features()->mutable_feature();
+  (*features)["ints"].mutable_int64_list()->add_value(-3);
+  (*features)["ints"].mutable_int64_list()->add_value(300);
+  (*features)["floats"].mutable_float_list()->add_value(1.5);
+  (*features)["floats"].mutable_float_list()->add_value(-2.25);
+  (*features)["floats"].mutable_float_list()->add_value(4);
+  (*features)["strings"].mutable_bytes_list()->add_value("abc");
+  (*features)["strings"].mutable_bytes_list()->add_value("");
+  (*features)["bytes"].mutable_bytes_list()->add_value("xy");
+  (*features)["bytes"].mutable_bytes_list()->add_value("z");
+  (*features)["unused"].mutable_int64_list()->add_value(7);
+  std::string serialized = example.SerializeAsString();
+
+  TFExampleDecoder decoder(&schema);
+  TensorRow row;
+  bool decoded = false;
+  ASSERT_TRUE(decoder.Decode(reinterpret_cast<const unsigned char *>(serialized.data()), serialized.size(), &row,
+                             &decoded)
+                .IsOk());
+  ASSERT_TRUE(decoded);
+  ASSERT_EQ(row.size(), 4);
+
+  std::shared_ptr<Tensor> expected;
+  ASSERT_TRUE(Tensor::CreateFromVector(std::vector<int32_t>{-3, 300}, &expected).IsOk());
+  ASSERT_TRUE(*row[0] == *expected);
+  ASSERT_TRUE(Tensor::CreateFromVector(std::vector<float>{1.5, -2.25, 4}, &expected).IsOk());
+  ASSERT_TRUE(*row[1] == *expected);
+  ASSERT_TRUE(Tensor::CreateFromVector(std::vector<std::string>{"abc", ""}, &expected).IsOk());
+  ASSERT_TRUE(*row[2] == *expected);
+  // Bytes are padded with spaces to the longest value
+  ASSERT_TRUE(Tensor::CreateFromVector(std::vector<uint8_t>{'x', 'y', 'z', ' '}, &expected).IsOk());
+  ASSERT_TRUE(*row[3] == *expected);
+
+  // Values that are not packed decode the same, the Example message is {features {feature {key: "ints" value {
+  // int64_list {value: 5 value: 6}}}}} with each value under its own tag
+  std::string unpacked = std::string("\x0a\x10\x0a\x0e\x0a\x04ints\x12\x06\x1a\x04\x08\x05\x08\x06", 18);
+  DataSchema int_schema;
+  ASSERT_TRUE(int_schema.AddColumn(ColDescriptor("ints", DataType(DataType::DE_INT64), flexible, 1)).IsOk());
+  TFExampleDecoder int_decoder(&int_schema);
+  ASSERT_TRUE(int_decoder.Decode(reinterpret_cast<const unsigned char *>(unpacked.data()), unpacked.size(), &row,
+                                 &decoded)
+                .IsOk());
+  ASSERT_TRUE(decoded);
+  ASSERT_TRUE(Tensor::CreateFromVector(std::vector<int64_t>{5, 6}, &expected).IsOk());
+  ASSERT_TRUE(*row[0] == *expected);
+
+  // A column missing from the record and a type the column can't hold are left to the protobuf path
+  features->erase("bytes");
+  serialized = example.SerializeAsString();
+  ASSERT_TRUE(decoder.Decode(reinterpret_cast<const unsigned char *>(serialized.data()), serialized.size(), &row,
+                             &decoded)
+                .IsOk());
+  ASSERT_FALSE(decoded);
+  (*features)["bytes"].mutable_float_list()->add_value(1);
+  serialized = example.SerializeAsString();
+  ASSERT_TRUE(decoder.Decode(reinterpret_cast<const unsigned char *>(serialized.data()), serialized.size(), &row,
+                             &decoded)
+                .IsOk());
+  ASSERT_FALSE(decoded);
+
+  // So is a record that is not valid protobuf
+  std::string truncated = serialized.substr(0, serialized.size() / 2);
+  ASSERT_TRUE(decoder.Decode(reinterpret_cast<const unsigned char *>(truncated.data()), truncated.size(), &row,
+                             &decoded)
+                .IsOk());
+  ASSERT_FALSE(decoded);
+}
+
+TEST_F(MindDataTestTFReaderOp, TestTFReaderVerifyCrc) {
+  auto config_manager = GlobalContext::config_manager();
+  bool verify_crc_original = config_manager->tfrecord_verify_crc();
+  config_manager->set_tfrecord_verify_crc(true);
+
+  auto my_tree = std::make_shared<ExecutionTree>();
+  std::string dataset_path = datasets_root_path_ + "/testTFTestAllTypes/test.data";
+  std::shared_ptr<TFReaderOp> my_tfreader_op;
+  TFReaderOp::Builder builder;
+  builder.SetDatasetFilesList({dataset_path}).SetRowsPerBuffer(4).SetNumWorkers(1);
+  std::unique_ptr<DataSchema> schema = std::make_unique<DataSchema>();
+  schema->LoadSchemaFile(datasets_root_path_ + "/testTFTestAllTypes/datasetSchema.json", {});
+  builder.SetDataSchema(std::move(schema));
+  ASSERT_TRUE(builder.Build(&my_tfreader_op).IsOk());
+  ASSERT_TRUE(my_tree->AssociateNode(my_tfreader_op).IsOk());
+  ASSERT_TRUE(my_tree->AssignRoot(my_tfreader_op).IsOk());
+  ASSERT_TRUE(my_tree->Prepare().IsOk());
+  ASSERT_TRUE(my_tree->Launch().IsOk());
+
+  DatasetIterator di(my_tree);
+  TensorRow tensor_list;
+  ASSERT_TRUE(di.FetchNextTensorRow(&tensor_list).IsOk());
+  int row_count = 0;
+  while (!tensor_list.empty()) {
+    row_count++;
+    ASSERT_TRUE(di.FetchNextTensorRow(&tensor_list).IsOk());
+  }
+  ASSERT_EQ(row_count, 12);
+  config_manager->set_tfrecord_verify_crc(verify_crc_original);
+}
@@ -0,0 +1,183 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <map>
+#include <memory>
+#include <vector>
+#include "common/common_test.h"
+#include "frontend/operator/ops.h"
+#include "backend/session/anf_runtime_algorithm.h"
+#include "runtime/device/kernel_info.h"
+#include "runtime/device/cpu/cpu_mem_reuse_plan.h"
+
+namespace mindspore {
+namespace device {
+namespace cpu {
+namespace {
+constexpr size_t kTensorSize = 1024;
+
+class TestKernelMod : public kernel::KernelMod {
+ public:
+  explicit TestKernelMod(const std::vector<size_t> &workspace_size_list)
+      : output_size_list_({kTensorSize}), workspace_size_list_(workspace_size_list) {}
+  ~TestKernelMod() override = default;
+
+  const std::vector<size_t> &GetInputSizeList() const override { return input_size_list_; }
+  const std::vector<size_t> &GetOutputSizeList() const override { return output_size_list_; }
+  const std::vector<size_t> &GetWorkspaceSizeList() const override { return workspace_size_list_; }
+  bool Launch(const std::vector<kernel::AddressPtr> &, const std::vector<kernel::AddressPtr> &,
+              const std::vector<kernel::AddressPtr> &, void *) override {
+    return true;
+  }
+
+ private:
+  std::vector<size_t> input_size_list_;
+  std::vector<size_t> output_size_list_;
+  std::vector<size_t> workspace_size_list_;
+};
+
+class TestDeviceAddress : public DeviceAddress {
+ public:
+  explicit TestDeviceAddress(size_t size) : DeviceAddress(nullptr, size) {}
+  ~TestDeviceAddress() override = default;
+
+  bool SyncDeviceToHost(const ShapeVector &, size_t, TypeId, void *) const override { return true; }
+  bool SyncHostToDevice(const ShapeVector &, size_t, TypeId, const void *) const override { return true; }
+};
+}  // namespace
+
+class CPUMemReusePlanTest : public UT::Common {
+ public:
+  CPUMemReusePlanTest() = default;
+
+  static CPUMemBlock CreateBlock(size_t size, size_t first_step, size_t last_step) {
+    CPUMemBlock block;
+    block.size = size;
+    block.first_step = first_step;
+    block.last_step = last_step;
+    return block;
+  }
+
+  static bool IsOverlap(const CPUMemBlock &a, const CPUMemBlock &b) {
+    bool time_overlap = a.first_step <= b.last_step && b.first_step <= a.last_step;
+    bool mem_overlap = a.offset < b.offset + b.size && b.offset < a.offset + a.size;
+    return time_overlap && mem_overlap;
+  }
+
+  // a kernel with one output of kTensorSize and the given workspaces, its addresses are not assigned yet
+  static CNodePtr NewKernel(const KernelGraphPtr &graph, const PrimitivePtr &prim,
+                            const std::vector<AnfNodePtr> &inputs,
+                            const std::vector<size_t> &workspace_size_list = {}) {
+    std::vector<AnfNodePtr> kernel_inputs = {NewValueNode(prim)};
+    kernel_inputs.insert(kernel_inputs.end(), inputs.begin(), inputs.end());
+    auto kernel = graph->NewCNode(kernel_inputs);
+    kernel->set_abstract(std::make_shared<abstract::AbstractTensor>(kFloat32, std::vector<int>{4, 64}));
+    auto kernel_info = dynamic_cast<device::KernelInfo *>(kernel->kernel_info());
+    MS_EXCEPTION_IF_NULL(kernel_info);
+    kernel_info->set_kernel_mod(std::make_shared<TestKernelMod>(workspace_size_list));
+    AnfAlgo::SetOutputAddr(std::make_shared<TestDeviceAddress>(kTensorSize), 0, kernel.get());
+    for (size_t i = 0; i < workspace_size_list.size(); ++i) {
+      AnfAlgo::SetWorkspaceAddr(std::make_shared<TestDeviceAddress>(workspace_size_list[i]), i, kernel.get());
+    }
+    return kernel;
+  }
+
+  // the block of an assigned address, with its offset from the arena base and the given lifetime
+  static CPUMemBlock AssignedBlock(const DeviceAddress *address, const uint8_t *base_ptr, size_t first_step,
+                                   size_t last_step) {
+    auto ptr = reinterpret_cast<const uint8_t *>(address->GetPtr());
+    EXPECT_NE(ptr, nullptr);
+    EXPECT_GE(ptr, base_ptr);
+    CPUMemBlock block = CreateBlock(address->GetSize(), first_step, last_step);
+    block.offset = static_cast<size_t>(ptr - base_ptr);
+    return block;
+  }
+};
+
+TEST_F(CPUMemReusePlanTest, chain_reuse_test) {
+  // a -> b -> c -> d, each buffer dies once its consumer has run
+  std::vector<CPUMemBlock> blocks = {CreateBlock(1024, 0, 1), CreateBlock(1024, 1, 2), CreateBlock(1024, 2, 3),
+                                     CreateBlock(1024, 3, 3)};
+  size_t total_size = CPUMemReusePlan::AssignOffsets(&blocks);
+  EXPECT_EQ(total_size, 2048);
+  EXPECT_EQ(blocks[0].offset, blocks[2].offset);
+  EXPECT_EQ(blocks[1].offset, blocks[3].offset);
+}
+
+TEST_F(CPUMemReusePlanTest, no_overlap_test) {
+  std::vector<CPUMemBlock> blocks = {CreateBlock(100, 0, 4), CreateBlock(4000, 1, 2), CreateBlock(64, 2, 3),
+                                     CreateBlock(2000, 3, 5), CreateBlock(1000, 4, 5), CreateBlock(3000, 0, 1),
+                                     CreateBlock(10, 5, 5)};
+  size_t total_size = CPUMemReusePlan::AssignOffsets(&blocks);
+  size_t naive_size = 0;
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    naive_size += blocks[i].size;
+    EXPECT_EQ(blocks[i].offset % kCPUMemAlignSize, 0);
+    EXPECT_LE(blocks[i].offset + blocks[i].size, total_size);
+    for (size_t j = i + 1; j < blocks.size(); ++j) {
+      EXPECT_FALSE(IsOverlap(blocks[i], blocks[j]));
+    }
+  }
+  EXPECT_LT(total_size, naive_size);
+}
+
+TEST_F(CPUMemReusePlanTest, kernel_graph_test) {
+  /*
+   * step 0: a = relu(x), with a workspace
+   * step 1: b = relu(a)
+   * step 2: c = add(a, b), with a workspace
+   * step 3: d = relu(c)
+   * step 4: e = add(d, b)
+   * return (a, e)
+   */
+  auto graph = std::make_shared<session::KernelGraph>();
+  auto x = graph->add_parameter();
+  x->set_abstract(std::make_shared<abstract::AbstractTensor>(kFloat32, std::vector<int>{4, 64}));
+  auto a = NewKernel(graph, prim::kPrimRelu, {x}, {2048});
+  auto b = NewKernel(graph, prim::kPrimRelu, {a});
+  auto c = NewKernel(graph, prim::kPrimTensorAdd, {a, b}, {512});
+  auto d = NewKernel(graph, prim::kPrimRelu, {c});
+  auto e = NewKernel(graph, prim::kPrimTensorAdd, {d, b});
+  auto make_tuple = graph->NewCNode({NewValueNode(prim::kPrimMakeTuple), a, e});
+  graph->set_return(graph->NewCNode({NewValueNode(prim::kPrimReturn), make_tuple}));
+  graph->set_execution_order({a, b, c, d, e});
+
+  CPUMemReusePlan plan;
+  size_t planned_size = plan.MemPlan(graph.get());
+  EXPECT_EQ(planned_size, plan.planned_mem_size());
+  EXPECT_EQ(plan.naive_mem_size(), 5 * kTensorSize + 2048 + 512);
+  EXPECT_LT(planned_size, plan.naive_mem_size());
+  std::vector<uint8_t> arena(planned_size);
+  plan.MemAssign(graph.get(), arena.data());
+
+  // a is a graph output, it stays alive until the last kernel even though its last consumer is c
+  std::vector<CPUMemBlock> blocks = {AssignedBlock(AnfAlgo::GetOutputAddr(a, 0), arena.data(), 0, 4),
+                                     AssignedBlock(AnfAlgo::GetWorkspaceAddr(a, 0), arena.data(), 0, 0),
+                                     AssignedBlock(AnfAlgo::GetOutputAddr(b, 0), arena.data(), 1, 4),
+                                     AssignedBlock(AnfAlgo::GetOutputAddr(c, 0), arena.data(), 2, 3),
+                                     AssignedBlock(AnfAlgo::GetWorkspaceAddr(c, 0), arena.data(), 2, 2),
+                                     AssignedBlock(AnfAlgo::GetOutputAddr(d, 0), arena.data(), 3, 4),
+                                     AssignedBlock(AnfAlgo::GetOutputAddr(e, 0), arena.data(), 4, 4)};
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    EXPECT_LE(blocks[i].offset + blocks[i].size, planned_size);
+    for (size_t j = i + 1; j < blocks.size(); ++j) {
+      EXPECT_FALSE(IsOverlap(blocks[i], blocks[j]));
+    }
+  }
+}
+}  // namespace cpu
+}  // namespace device
+}  // namespace mindspore
@@ -0,0 +1,59 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/common_test.h"
+#include "runtime/device/cpu/cpu_resource_manager.h"
+
+namespace mindspore {
+namespace device {
+namespace cpu {
+class CPUResourceManagerTest : public UT::Common {
+ public:
+  CPUResourceManagerTest() = default;
+};
+
+TEST_F(CPUResourceManagerTest, test_mem_pool_reuse) {
+  CPUResourceManager resource_manager;
+  auto ptr = reinterpret_cast<float *>(resource_manager.MemMalloc(16 * sizeof(float)));
+  ASSERT_NE(ptr, nullptr);
+  for (size_t i = 0; i < 16; ++i) {
+    ptr[i] = 1.0;
+  }
+  resource_manager.MemFree(ptr);
+
+  auto other_size_ptr = resource_manager.MemMalloc(8 * sizeof(float));
+  EXPECT_NE(other_size_ptr, ptr);
+  auto same_size_ptr = reinterpret_cast<float *>(resource_manager.MemMalloc(16 * sizeof(float)));
+  EXPECT_EQ(same_size_ptr, ptr);
+  for (size_t i = 0; i < 16; ++i) {
+    EXPECT_EQ(same_size_ptr[i], 0);
+  }
+  resource_manager.MemFree(other_size_ptr);
+  resource_manager.MemFree(same_size_ptr);
+}
+
+TEST_F(CPUResourceManagerTest, test_mem_free_ignore_unknown_ptr) {
+  CPUResourceManager resource_manager;
+  float host_data[4] = {0};
+  resource_manager.MemFree(host_data);
+  resource_manager.MemFree(nullptr);
+  auto ptr = resource_manager.MemMalloc(sizeof(host_data));
+  EXPECT_NE(ptr, static_cast<void *>(host_data));
+  resource_manager.MemFree(ptr);
+}
+}  // namespace cpu
+}  // namespace device
+}  // namespace mindspore
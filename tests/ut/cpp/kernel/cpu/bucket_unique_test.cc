@@ -0,0 +1,141 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <random>
+#include <unordered_map>
+#include <vector>
+#include "common/common_test.h"
+#include "backend/kernel_compiler/cpu/bucket_unique.h"
+
+namespace mindspore {
+namespace kernel {
+class BucketUniqueTest : public UT::Common {
+ public:
+  BucketUniqueTest() = default;
+
+  template <typename T>
+  std::vector<T> RandomKeys(size_t size, int64_t max_key) {
+    std::mt19937 generator(1);
+    std::uniform_int_distribution<int64_t> distribution(-3, max_key);
+    std::vector<T> keys(size);
+    for (auto &key : keys) {
+      key = static_cast<T>(distribution(generator));
+    }
+    return keys;
+  }
+
+  // Compare BucketUnique with a serial unique keeping the first occurrence order.
+  template <typename T>
+  void CheckUnique(const std::vector<T> &keys, size_t max_key, bool use_workspace) {
+    std::unordered_map<T, int> unique_map;
+    std::vector<T> expect_output;
+    std::vector<int> expect_inverse;
+    for (auto key : keys) {
+      if (max_key != 0 && (key < 0 || static_cast<size_t>(key) >= max_key)) {
+        expect_inverse.push_back(-1);
+        continue;
+      }
+      auto iter = unique_map.emplace(key, expect_output.size());
+      if (iter.second) {
+        expect_output.push_back(key);
+      }
+      expect_inverse.push_back(iter.first->second);
+    }
+
+    std::vector<T> output(keys.size());
+    std::vector<int> inverse(keys.size());
+    std::vector<size_t> workspace(BucketUniqueWorkspaceSize(keys.size()) / sizeof(size_t));
+    BucketUniqueParam<T, int> param;
+    param.input_ = keys.data();
+    param.input_size_ = keys.size();
+    param.max_key_ = max_key;
+    param.output_ = output.data();
+    param.inverse_ = inverse.data();
+    if (use_workspace) {
+      param.workspace_ = workspace.data();
+      param.workspace_size_ = workspace.size() * sizeof(size_t);
+    }
+    BucketUnique<T, int>(&param).Run();
+
+    ASSERT_EQ(param.output_size_, expect_output.size());
+    output.resize(param.output_size_);
+    EXPECT_TRUE(output == expect_output);
+    EXPECT_TRUE(inverse == expect_inverse);
+  }
+};
+
+TEST_F(BucketUniqueTest, unique_test) {
+  CheckUnique<int>({1, 1, 2, 4, 4, 4, 7, 8, 8}, 0, true);
+  CheckUnique<int>({}, 0, true);
+  CheckUnique<int>(RandomKeys<int>(100000, 5000), 0, true);
+  CheckUnique<int>(RandomKeys<int>(100000, 200000), 0, false);
+  CheckUnique<int64_t>(RandomKeys<int64_t>(50000, 1L << 40), 0, true);
+  CheckUnique<float>(RandomKeys<float>(100000, 3000), 0, true);
+}
+
+TEST_F(BucketUniqueTest, max_key_test) {
+  CheckUnique<int>({0, 0, 1, 1, 0, 6}, 6, true);
+  CheckUnique<int>(RandomKeys<int>(100000, 5000), 4000, true);
+  CheckUnique<int64_t>(RandomKeys<int64_t>(100000, 5000), 1, false);
+}
+
+TEST_F(BucketUniqueTest, float_zero_test) {
+  std::vector<float> keys{0.0f, -0.0f, 1.5f, 0.0f, 1.5f};
+  std::vector<float> output(keys.size());
+  std::vector<int> inverse(keys.size());
+  BucketUniqueParam<float, int> param;
+  param.input_ = keys.data();
+  param.input_size_ = keys.size();
+  param.output_ = output.data();
+  param.inverse_ = inverse.data();
+  BucketUnique<float, int>(&param).Run();
+  EXPECT_EQ(param.output_size_, 2);
+  std::vector<int> expect_inverse{0, 0, 1, 0, 1};
+  EXPECT_TRUE(inverse == expect_inverse);
+}
+
+TEST_F(BucketUniqueTest, for_each_bucket_test) {
+  auto keys = RandomKeys<int>(100000, 3000);
+  std::vector<int> output(keys.size());
+  std::vector<int> inverse(keys.size());
+  BucketUniqueParam<int, int> param;
+  param.input_ = keys.data();
+  param.input_size_ = keys.size();
+  param.max_key_ = 3000;
+  param.output_ = output.data();
+  param.inverse_ = inverse.data();
+  BucketUnique<int, int> unique(&param);
+  unique.Run();
+  // Count every key in its bucket, a key counted by two buckets would break the counts below.
+  std::vector<size_t> counts(param.output_size_, 0);
+  std::vector<size_t> visited(keys.size(), 0);
+  unique.ForEachBucket([&](const size_t *positions, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+      counts[inverse[positions[i]]]++;
+      visited[positions[i]]++;
+    }
+  });
+  std::vector<size_t> expect_counts(param.output_size_, 0);
+  for (size_t i = 0; i < keys.size(); ++i) {
+    bool valid = keys[i] >= 0 && keys[i] < 3000;
+    EXPECT_EQ(visited[i], valid ? 1 : 0);
+    if (valid) {
+      expect_counts[inverse[i]]++;
+    }
+  }
+  EXPECT_TRUE(counts == expect_counts);
+}
+}  // namespace kernel
+}  // namespace mindspore
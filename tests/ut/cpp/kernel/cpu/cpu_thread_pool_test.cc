@@ -0,0 +1,61 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <vector>
+#include "common/common_test.h"
+#include "backend/kernel_compiler/cpu/cpu_thread_pool.h"
+
+namespace mindspore {
+namespace kernel {
+class CPUThreadPoolTest : public UT::Common {
+ public:
+  CPUThreadPoolTest() = default;
+};
+
+TEST_F(CPUThreadPoolTest, parallel_for_test) {
+  auto &pool = CPUThreadPool::GetInstance();
+  EXPECT_GE(pool.thread_num(), 1);
+  std::vector<int> data(10007, 0);
+  pool.ParallelFor(data.size(), 16, [&data](size_t start, size_t end) {
+    for (size_t i = start; i < end; ++i) {
+      data[i] += 1;
+    }
+  });
+  for (auto value : data) {
+    EXPECT_EQ(value, 1);
+  }
+}
+
+TEST_F(CPUThreadPoolTest, nested_parallel_for_test) {
+  auto &pool = CPUThreadPool::GetInstance();
+  std::atomic<size_t> count{0};
+  pool.ParallelLaunch(8, [&pool, &count](size_t, size_t) {
+    pool.ParallelFor(1000, 1, [&count](size_t start, size_t end) { count += end - start; });
+  });
+  EXPECT_EQ(count, 8000);
+}
+
+TEST_F(CPUThreadPoolTest, exception_test) {
+  auto &pool = CPUThreadPool::GetInstance();
+  EXPECT_ANY_THROW(pool.ParallelLaunch(pool.thread_num() + 1, [](size_t start, size_t) {
+    if (start > 0) {
+      MS_LOG(EXCEPTION) << "Task " << start << " failed.";
+    }
+  }));
+}
+}  // namespace kernel
+}  // namespace mindspore
@@ -0,0 +1,213 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <vector>
+#include "common/common_test.h"
+#include "backend/kernel_compiler/cpu/simd/simd_kernels.h"
+
+namespace mindspore {
+namespace kernel {
+namespace simd {
+namespace {
+size_t ShapeSize(const std::vector<size_t> &shape) {
+  return std::accumulate(shape.begin(), shape.end(), size_t(1), std::multiplies<size_t>());
+}
+
+std::vector<size_t> Strides(const std::vector<size_t> &shape) {
+  std::vector<size_t> strides(shape.size(), 1);
+  for (size_t i = shape.size(); i > 1; --i) {
+    strides[i - 2] = strides[i - 1] * shape[i - 1];
+  }
+  return strides;
+}
+
+std::vector<float> RandomData(size_t size) {
+  static std::mt19937 generator(1);
+  std::uniform_real_distribution<float> distribution(-2, 2);
+  std::vector<float> data(size);
+  for (auto &value : data) {
+    value = distribution(generator);
+  }
+  return data;
+}
+
+void ExpectNear(const std::vector<float> &output, const std::vector<float> &expect) {
+  ASSERT_EQ(output.size(), expect.size());
+  for (size_t i = 0; i < output.size(); ++i) {
+    ASSERT_NEAR(output[i], expect[i], 1e-4 * (1 + std::fabs(expect[i])));
+  }
+}
+
+void CheckTranspose(const std::vector<size_t> &shape, const std::vector<size_t> &perm) {
+  auto input = RandomData(ShapeSize(shape));
+  std::vector<size_t> out_shape;
+  for (auto axis : perm) {
+    out_shape.push_back(shape[axis]);
+  }
+  auto in_strides = Strides(shape);
+  auto out_strides = Strides(out_shape);
+  std::vector<float> expect(input.size());
+  for (size_t i = 0; i < expect.size(); ++i) {
+    size_t offset = 0;
+    for (size_t j = 0; j < out_shape.size(); ++j) {
+      offset += (i / out_strides[j] % out_shape[j]) * in_strides[perm[j]];
+    }
+    expect[i] = input[offset];
+  }
+  std::vector<float> output(input.size());
+  Transpose(input.data(), shape, perm, output.data());
+  ExpectNear(output, expect);
+}
+
+void CheckReduce(const std::vector<size_t> &shape, const std::vector<size_t> &axis, ReduceType type) {
+  auto input = RandomData(ShapeSize(shape));
+  std::vector<bool> reduced(shape.size(), false);
+  for (auto i : axis) {
+    reduced[i] = true;
+  }
+  size_t out_size = 1;
+  size_t reduce_size = 1;
+  for (size_t i = 0; i < shape.size(); ++i) {
+    (reduced[i] ? reduce_size : out_size) *= shape[i];
+  }
+  std::vector<float> expect(out_size, type == ReduceType::kMax ? -1e30 : 0);
+  auto strides = Strides(shape);
+  for (size_t i = 0; i < input.size(); ++i) {
+    size_t index = 0;
+    for (size_t j = 0; j < shape.size(); ++j) {
+      if (!reduced[j]) {
+        index = index * shape[j] + i / strides[j] % shape[j];
+      }
+    }
+    expect[index] = type == ReduceType::kMax ? std::max(expect[index], input[i]) : expect[index] + input[i];
+  }
+  if (type == ReduceType::kMean) {
+    for (auto &value : expect) {
+      value /= reduce_size;
+    }
+  }
+  std::vector<float> output(out_size);
+  Reduce(input.data(), shape, axis, type, output.data());
+  ExpectNear(output, expect);
+}
+
+void CheckBroadcastBinary(const std::vector<size_t> &shape0, const std::vector<size_t> &shape1, BinaryType type) {
+  auto input0 = RandomData(ShapeSize(shape0));
+  auto input1 = RandomData(ShapeSize(shape1));
+  auto out_shape = BroadcastShape(shape0, shape1);
+  size_t rank = out_shape.size();
+  std::vector<size_t> padded0(rank - shape0.size(), 1);
+  std::vector<size_t> padded1(rank - shape1.size(), 1);
+  (void)padded0.insert(padded0.end(), shape0.begin(), shape0.end());
+  (void)padded1.insert(padded1.end(), shape1.begin(), shape1.end());
+  auto out_strides = Strides(out_shape);
+  auto strides0 = Strides(padded0);
+  auto strides1 = Strides(padded1);
+  std::vector<float> expect(ShapeSize(out_shape));
+  for (size_t i = 0; i < expect.size(); ++i) {
+    size_t offset0 = 0;
+    size_t offset1 = 0;
+    for (size_t j = 0; j < rank; ++j) {
+      size_t index = i / out_strides[j] % out_shape[j];
+      offset0 += padded0[j] == 1 ? 0 : index * strides0[j];
+      offset1 += padded1[j] == 1 ? 0 : index * strides1[j];
+    }
+    float x = input0[offset0];
+    float y = input1[offset1];
+    if (type == BinaryType::kAdd) {
+      expect[i] = x + y;
+    } else if (type == BinaryType::kSub) {
+      expect[i] = x - y;
+    } else if (type == BinaryType::kMul) {
+      expect[i] = x * y;
+    } else {
+      expect[i] = x / y;
+    }
+  }
+  std::vector<float> output(expect.size());
+  BroadcastBinary(input0.data(), shape0, input1.data(), shape1, type, output.data());
+  ExpectNear(output, expect);
+}
+}  // namespace
+
+class SimdKernelsTest : public UT::Common {
+ public:
+  SimdKernelsTest() = default;
+  void TearDown() override { SetISA(ISA::kAVX512); }
+  const std::vector<ISA> isas_{ISA::kScalar, ISA::kAVX2, ISA::kAVX512};
+};
+
+TEST_F(SimdKernelsTest, transpose_test) {
+  for (auto isa : isas_) {
+    SetISA(isa);
+    CheckTranspose({17, 33}, {1, 0});
+    CheckTranspose({300, 200}, {1, 0});
+    CheckTranspose({2, 3, 4}, {1, 0, 2});
+    CheckTranspose({5, 19, 23}, {0, 2, 1});
+    CheckTranspose({4, 9, 16, 13}, {0, 3, 1, 2});
+    CheckTranspose({4, 1, 16, 13}, {2, 0, 3, 1});
+    CheckTranspose({2, 3, 4, 5}, {3, 2, 1, 0});
+    CheckTranspose({2, 3, 4}, {0, 1, 2});
+    CheckTranspose({7}, {0});
+  }
+}
+
+TEST_F(SimdKernelsTest, reduce_test) {
+  for (auto isa : isas_) {
+    SetISA(isa);
+    for (auto type : {ReduceType::kMax, ReduceType::kSum, ReduceType::kMean}) {
+      CheckReduce({7, 33}, {1}, type);
+      CheckReduce({7, 33}, {0}, type);
+      CheckReduce({100000}, {0}, type);
+      CheckReduce({3, 40000}, {0}, type);
+      CheckReduce({4, 5, 6, 7}, {0, 2}, type);
+      CheckReduce({4, 5, 6, 7}, {1, 3}, type);
+      CheckReduce({4, 1, 6, 37}, {0, 1, 2, 3}, type);
+      CheckReduce({5, 1, 3}, {1}, type);
+      CheckReduce({2, 3}, {}, type);
+    }
+  }
+}
+
+TEST_F(SimdKernelsTest, broadcast_binary_test) {
+  for (auto isa : isas_) {
+    SetISA(isa);
+    for (auto type : {BinaryType::kAdd, BinaryType::kSub, BinaryType::kMul, BinaryType::kDiv}) {
+      CheckBroadcastBinary({4, 37}, {4, 37}, type);
+      CheckBroadcastBinary({4, 37}, {37}, type);
+      CheckBroadcastBinary({4, 37}, {4, 1}, type);
+      CheckBroadcastBinary({1}, {5, 3}, type);
+      CheckBroadcastBinary({3, 1, 5}, {1, 4, 1}, type);
+      CheckBroadcastBinary({2, 3, 19}, {2, 1, 19}, type);
+      CheckBroadcastBinary({100000}, {}, type);
+      CheckBroadcastBinary({}, {}, type);
+    }
+  }
+}
+
+TEST_F(SimdKernelsTest, invalid_shape_test) {
+  std::vector<float> data(6, 0);
+  EXPECT_ANY_THROW(BroadcastShape({2, 3}, {3, 2}));
+  EXPECT_ANY_THROW(Transpose(data.data(), {2, 3}, {0, 0}, data.data()));
+  EXPECT_ANY_THROW(Reduce(data.data(), {2, 3}, {2}, ReduceType::kSum, data.data()));
+}
+}  // namespace simd
+}  // namespace kernel
+}  // namespace mindspore
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include <random>
+#include <unordered_map>
 #include <vector>
 #include "common/common_test.h"
 #include "backend/kernel_compiler/cpu/sparse_optimizer_cpu_kernel.h"
@@ -130,5 +132,61 @@ TEST_F(CommonUtilTest, BucketReduceSparseGradient2) {
     EXPECT_EQ(unique_grad.value_[i], expect_value[i]);
   }
 }
+TEST_F(CommonUtilTest, BucketReduceSparseGradient3) {
+  // Enough indices for several buckets, some of them out of range, reduced into a preallocated unique workspace.
+  size_t indices_size = 50000;
+  size_t value_stride = 3;
+  size_t max_index = 4000;
+  std::mt19937 generator(1);
+  std::uniform_int_distribution<int> distribution(-10, 4010);
+  std::vector<int> indices(indices_size);
+  std::vector<float> grad(indices_size * value_stride);
+  for (size_t i = 0; i < indices_size; ++i) {
+    indices[i] = distribution(generator);
+    for (size_t j = 0; j < value_stride; ++j) {
+      grad[i * value_stride + j] = (i + j) % 7;
+    }
+  }
+  std::unordered_map<int, size_t> expect_rows;
+  std::vector<int> expect_indices;
+  std::vector<float> expect_value;
+  for (size_t i = 0; i < indices_size; ++i) {
+    if (indices[i] < 0 || static_cast<size_t>(indices[i]) >= max_index) {
+      continue;
+    }
+    auto iter = expect_rows.emplace(indices[i], expect_indices.size());
+    if (iter.second) {
+      expect_indices.push_back(indices[i]);
+      expect_value.resize(expect_value.size() + value_stride, 0);
+    }
+    for (size_t j = 0; j < value_stride; ++j) {
+      expect_value[iter.first->second * value_stride + j] += grad[i * value_stride + j];
+    }
+  }
+
+  std::vector<int> unique_indices(indices_size);
+  std::vector<float> summed_grad(indices_size * value_stride);
+  std::vector<int> tmp_indices(indices_size);
+  std::vector<uint8_t> unique_workspace(BucketUniqueWorkspaceSize(indices_size));
+  SparseGradient<int> unique_grad({summed_grad.data(), unique_indices.data(), indices_size});
+  SparseGradient<int> workspace_grad({nullptr, tmp_indices.data(), indices_size});
+  SparseGradient<int> input_grad({grad.data(), indices.data(), indices_size});
+
+  ReduceSparseGradientParam<int> param;
+  param.input_grad_ = &input_grad;
+  param.workspace_grad_ = &workspace_grad;
+  param.output_grad_ = &unique_grad;
+  param.max_index_ = max_index;
+  param.value_stride_ = value_stride;
+  param.unique_workspace_ = unique_workspace.data();
+  param.unique_workspace_size_ = unique_workspace.size();
+  SparseOptimizerCPUKernel::BucketReduceSparseGradient(param);
+
+  ASSERT_EQ(unique_grad.indices_size_, expect_indices.size());
+  unique_indices.resize(unique_grad.indices_size_);
+  summed_grad.resize(unique_grad.indices_size_ * value_stride);
+  EXPECT_TRUE(unique_indices == expect_indices);
+  EXPECT_TRUE(summed_grad == expect_value);
+}
 }  // namespace kernel
 }  // namespace mindspore
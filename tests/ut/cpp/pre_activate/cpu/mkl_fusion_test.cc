@@ -0,0 +1,149 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <memory>
+#include <string>
+#include <vector>
+#include "common/backend_common_test.h"
+#include "common/py_func_graph_fetcher.h"
+#include "backend/session/anf_runtime_algorithm.h"
+#include "backend/optimizer/common/optimizer.h"
+#include "backend/optimizer/cpu/activation_fusion.h"
+#include "backend/optimizer/cpu/batch_norm_activation_fusion.h"
+#include "backend/optimizer/cpu/bias_add_fusion.h"
+#include "utils/utils.h"
+
+namespace mindspore {
+namespace opt {
+class TestMKLFusion : public BackendCommon {
+ public:
+  TestMKLFusion() : get_py_fun_("gtest_input.pre_activate.mkl_fusion_test", true) {}
+  ~TestMKLFusion() override = default;
+
+  // runs the fusion passes in the order of CPUSession::HardwareOptimize
+  FuncGraphPtr RunPasses(const std::string &tag, const std::vector<std::vector<int>> &shapes) {
+    FuncGraphPtr g = get_py_fun_.CallAndParseRet("test_mkl_fusion", tag);
+    EXPECT_NE(g, nullptr);
+    AbstractBasePtrList args_spec_list;
+    for (const auto &shape : shapes) {
+      args_spec_list.push_back(std::make_shared<abstract::AbstractTensor>(kFloat32, shape));
+    }
+    auto kernel_graph = GetKernelGraph(g, args_spec_list);
+    EXPECT_NE(kernel_graph, nullptr);
+
+    auto fused_conv2d = std::make_shared<Primitive>(kFusedConv2DOpName);
+    auto fused_matmul = std::make_shared<Primitive>(kFusedMatMulOpName);
+    auto optimizer = std::make_shared<opt::GraphOptimizer>();
+    auto pm = std::make_shared<opt::PassManager>();
+    pm->AddPass(std::make_shared<opt::BiasAddFusion>(prim::kPrimConv2D, kFusedConv2DOpName));
+    pm->AddPass(std::make_shared<opt::BiasAddFusion>(prim::kPrimMatMul, kFusedMatMulOpName));
+    pm->AddPass(std::make_shared<opt::ActivationFusion>(prim::kPrimConv2D, prim::kPrimRelu, kFusedConv2DOpName));
+    pm->AddPass(std::make_shared<opt::ActivationFusion>(fused_conv2d, prim::kPrimRelu, kFusedConv2DOpName));
+    pm->AddPass(std::make_shared<opt::ActivationFusion>(fused_matmul, prim::kPrimRelu, kFusedMatMulOpName));
+    pm->AddPass(std::make_shared<opt::ActivationFusion>(fused_matmul, prim::kPrimGelu, kFusedMatMulOpName));
+    pm->AddPass(std::make_shared<opt::BatchNormActivationFusion>(prim::kPrimFusedBatchNorm));
+    pm->AddPass(std::make_shared<opt::BatchNormActivationFusion>(prim::kPrimBatchNorm));
+    optimizer->AddPassManager(pm);
+    return optimizer->Optimize(kernel_graph);
+  }
+
+  CNodePtr FindNode(const FuncGraphPtr &graph, const std::string &op_name) {
+    for (const auto &node : TopoSort(graph->get_return())) {
+      if (node->isa<CNode>() && AnfAlgo::GetCNodeName(node) == op_name) {
+        return node->cast<CNodePtr>();
+      }
+    }
+    return nullptr;
+  }
+
+  std::string ActivationType(const CNodePtr &node) {
+    EXPECT_NE(node, nullptr);
+    if (node == nullptr || !AnfAlgo::HasNodeAttr(kAttrActivationType, node)) {
+      return "";
+    }
+    return AnfAlgo::GetNodeAttr<std::string>(node, kAttrActivationType);
+  }
+
+  UT::PyFuncGraphFetcher get_py_fun_;
+  std::vector<int> shp_conv_x_{1, 3, 8, 8};
+  std::vector<int> shp_conv_w_{4, 3, 3, 3};
+  std::vector<int> shp_channel_{4};
+  std::vector<int> shp_matmul_x_{2, 3};
+  std::vector<int> shp_matmul_w_{3, 4};
+  std::vector<int> shp_matmul_out_{2, 4};
+};
+
+TEST_F(TestMKLFusion, test_conv_bias_relu) {
+  auto graph = RunPasses("conv_bias_relu", {shp_conv_x_, shp_conv_w_, shp_channel_});
+  auto fused = FindNode(graph, kFusedConv2DOpName);
+  ASSERT_NE(fused, nullptr);
+  EXPECT_EQ(fused->inputs().size(), 4);
+  EXPECT_TRUE(AnfAlgo::GetNodeAttr<bool>(fused, kAttrHasBias));
+  EXPECT_EQ(ActivationType(fused), prim::kPrimRelu->name());
+  EXPECT_EQ(FindNode(graph, prim::kPrimConv2D->name()), nullptr);
+  EXPECT_EQ(FindNode(graph, kBiasAddOpName), nullptr);
+  EXPECT_EQ(FindNode(graph, prim::kPrimRelu->name()), nullptr);
+}
+
+TEST_F(TestMKLFusion, test_conv_bias_nhwc_not_fused) {
+  // the fused conv adds the bias along the channels of NCHW, a NHWC BiasAdd stays apart
+  auto graph = RunPasses("conv_bias_nhwc", {shp_conv_x_, shp_conv_w_, shp_channel_});
+  EXPECT_NE(FindNode(graph, kBiasAddOpName), nullptr);
+  EXPECT_NE(FindNode(graph, prim::kPrimRelu->name()), nullptr);
+  auto fused = FindNode(graph, kFusedConv2DOpName);
+  EXPECT_TRUE(fused == nullptr || !AnfAlgo::HasNodeAttr(kAttrHasBias, fused));
+}
+
+TEST_F(TestMKLFusion, test_conv_output_shared_not_fused) {
+  auto graph = RunPasses("conv_bias_shared", {shp_conv_x_, shp_conv_w_, shp_channel_});
+  EXPECT_NE(FindNode(graph, prim::kPrimConv2D->name()), nullptr);
+  EXPECT_NE(FindNode(graph, kBiasAddOpName), nullptr);
+  EXPECT_NE(FindNode(graph, prim::kPrimRelu->name()), nullptr);
+  EXPECT_EQ(FindNode(graph, kFusedConv2DOpName), nullptr);
+}
+
+TEST_F(TestMKLFusion, test_matmul_bias_gelu) {
+  auto graph = RunPasses("matmul_bias_gelu", {shp_matmul_x_, shp_matmul_w_, shp_channel_});
+  auto fused = FindNode(graph, kFusedMatMulOpName);
+  ASSERT_NE(fused, nullptr);
+  EXPECT_EQ(fused->inputs().size(), 4);
+  EXPECT_EQ(ActivationType(fused), prim::kPrimGelu->name());
+  EXPECT_EQ(FindNode(graph, prim::kPrimMatMul->name()), nullptr);
+  EXPECT_EQ(FindNode(graph, kBiasAddOpName), nullptr);
+  EXPECT_EQ(FindNode(graph, prim::kPrimGelu->name()), nullptr);
+}
+
+TEST_F(TestMKLFusion, test_gelu_input_read_by_grad_not_fused) {
+  // the bias is still fused, the gelu is kept since GeluGrad reads its input
+  auto graph =
+    RunPasses("matmul_bias_gelu_grad", {shp_matmul_x_, shp_matmul_w_, shp_channel_, shp_matmul_out_});
+  auto fused = FindNode(graph, kFusedMatMulOpName);
+  ASSERT_NE(fused, nullptr);
+  EXPECT_EQ(ActivationType(fused), "");
+  EXPECT_NE(FindNode(graph, prim::kPrimGelu->name()), nullptr);
+}
+
+TEST_F(TestMKLFusion, test_batch_norm_relu) {
+  std::vector<int> shp_x{1, 4, 8, 8};
+  auto graph = RunPasses("batch_norm_relu", {shp_x, shp_channel_, shp_channel_, shp_channel_, shp_channel_});
+  auto fused = FindNode(graph, kFusedBatchNormWithActivationOpName);
+  ASSERT_NE(fused, nullptr);
+  EXPECT_EQ(ActivationType(fused), prim::kPrimRelu->name());
+  EXPECT_FALSE(AnfAlgo::GetNodeAttr<bool>(fused, kAttrIsTraining));
+  EXPECT_EQ(FindNode(graph, prim::kPrimBatchNorm->name()), nullptr);
+  EXPECT_EQ(FindNode(graph, prim::kPrimRelu->name()), nullptr);
+}
+}  // namespace opt
+}  // namespace mindspore
@@ -0,0 +1,95 @@
+/**
+ * Copyright 2020 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <memory>
+#include <string>
+#include <vector>
+#include "common/backend_common_test.h"
+#include "common/py_func_graph_fetcher.h"
+#include "backend/session/anf_runtime_algorithm.h"
+#include "backend/kernel_compiler/cpu/mkldnn/mkl_layout_info.h"
+#include "backend/optimizer/common/optimizer.h"
+#include "backend/optimizer/cpu/mkl_layout_propagation.h"
+
+namespace mindspore {
+namespace opt {
+class TestMKLLayoutPropagation : public BackendCommon {
+ public:
+  TestMKLLayoutPropagation() : get_py_fun_("gtest_input.pre_activate.mkl_layout_propagation_test", true) {}
+  ~TestMKLLayoutPropagation() override = default;
+
+  FuncGraphPtr RunPass(const std::string &tag, size_t input_num) {
+    FuncGraphPtr g = get_py_fun_.CallAndParseRet("test_mkl_layout_propagation", tag);
+    EXPECT_NE(g, nullptr);
+    std::vector<int> shp_x{1, 3, 8, 8};
+    std::vector<int> shp_w{4, 3, 3, 3};
+    std::vector<int> shp_dout{1, 4, 8, 8};
+    AbstractBasePtrList args_spec_list{std::make_shared<abstract::AbstractTensor>(kFloat32, shp_x),
+                                       std::make_shared<abstract::AbstractTensor>(kFloat32, shp_w),
+                                       std::make_shared<abstract::AbstractTensor>(kFloat32, shp_dout)};
+    args_spec_list.resize(input_num);
+    auto kernel_graph = GetKernelGraph(g, args_spec_list);
+    EXPECT_NE(kernel_graph, nullptr);
+
+    auto optimizer = std::make_shared<opt::GraphOptimizer>();
+    auto pm = std::make_shared<opt::PassManager>();
+    pm->AddPass(std::make_shared<opt::MKLLayoutPropagation>());
+    optimizer->AddPassManager(pm);
+    return optimizer->Optimize(kernel_graph);
+  }
+
+  std::shared_ptr<kernel::MKLLayoutInfo> GetLayoutInfo(const FuncGraphPtr &graph, const std::string &op_name) {
+    for (const auto &node : TopoSort(graph->get_return())) {
+      if (node->isa<CNode>() && AnfAlgo::GetCNodeName(node) == op_name) {
+        return node->user_data<kernel::MKLLayoutInfo>();
+      }
+    }
+    return nullptr;
+  }
+
+  bool IsBlocked(const FuncGraphPtr &graph, const std::string &op_name) {
+    auto layout_info = GetLayoutInfo(graph, op_name);
+    EXPECT_NE(layout_info, nullptr);
+    return layout_info != nullptr && layout_info->blocked_outputs[0];
+  }
+
+  UT::PyFuncGraphFetcher get_py_fun_;
+};
+
+TEST_F(TestMKLLayoutPropagation, test_mkl_chain_keeps_blocked_layout) {
+  auto graph = RunPass("inference", 2);
+  EXPECT_TRUE(IsBlocked(graph, "Conv2D"));
+  EXPECT_TRUE(IsBlocked(graph, "ReLU"));
+  // graph output is plain
+  EXPECT_FALSE(IsBlocked(graph, "MaxPool"));
+  EXPECT_TRUE(GetLayoutInfo(graph, "Conv2D")->inference);
+}
+
+TEST_F(TestMKLLayoutPropagation, test_non_mkl_user_stops_propagation) {
+  auto graph = RunPass("boundary", 2);
+  EXPECT_TRUE(IsBlocked(graph, "Conv2D"));
+  EXPECT_FALSE(IsBlocked(graph, "ReLU"));
+  EXPECT_FALSE(IsBlocked(graph, "MaxPool"));
+  EXPECT_EQ(GetLayoutInfo(graph, "TensorAdd"), nullptr);
+}
+
+TEST_F(TestMKLLayoutPropagation, test_training_graph) {
+  auto graph = RunPass("training", 3);
+  EXPECT_TRUE(IsBlocked(graph, "Conv2D"));
+  EXPECT_FALSE(IsBlocked(graph, "ReLU"));
+  EXPECT_FALSE(GetLayoutInfo(graph, "ReLU")->inference);
+}
+}  // namespace opt
+}  // namespace mindspore
@@ -0,0 +1,74 @@
+# Copyright 2020 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+
+from mindspore.ops import Primitive
+from mindspore.ops import operations as P
+from mindspore.ops.operations import _grad_ops as G
+
+make_tuple = Primitive('make_tuple')
+conv = P.Conv2D(out_channel=4, kernel_size=3, pad_mode="same")
+matmul = P.MatMul()
+bias_add = P.BiasAdd()
+bias_add_nhwc = P.BiasAdd()
+bias_add_nhwc.add_prim_attr('data_format', 'NHWC')
+relu = P.ReLU()
+gelu = P.Gelu()
+gelu_grad = G.GeluGrad()
+batch_norm = P.BatchNorm(is_training=False)
+
+
+class FnDict:
+    def __init__(self):
+        self.fnDict = {}
+
+    def __call__(self, fn):
+        self.fnDict[fn.__name__] = fn
+
+    def __getitem__(self, name):
+        return self.fnDict[name]
+
+
+def test_mkl_fusion(tag):
+    """ test_mkl_fusion """
+    fns = FnDict()
+
+    @fns
+    def conv_bias_relu(x, w, b):
+        return relu(bias_add(conv(x, w), b))
+
+    @fns
+    def conv_bias_nhwc(x, w, b):
+        return relu(bias_add_nhwc(conv(x, w), b))
+
+    @fns
+    def conv_bias_shared(x, w, b):
+        conv_out = conv(x, w)
+        return make_tuple(bias_add(conv_out, b), relu(conv_out))
+
+    @fns
+    def matmul_bias_gelu(x, w, b):
+        return gelu(bias_add(matmul(x, w), b))
+
+    @fns
+    def matmul_bias_gelu_grad(x, w, b, dout):
+        matmul_out = bias_add(matmul(x, w), b)
+        gelu_out = gelu(matmul_out)
+        return make_tuple(gelu_out, gelu_grad(dout, matmul_out, gelu_out))
+
+    @fns
+    def batch_norm_relu(x, scale, b, mean, variance):
+        return relu(batch_norm(x, scale, b, mean, variance)[0])
+
+    return fns[tag]
@@ -0,0 +1,57 @@
+# Copyright 2020 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+
+from mindspore.ops import Primitive
+from mindspore.ops import operations as P
+from mindspore.ops.operations import _grad_ops as G
+
+make_tuple = Primitive('make_tuple')
+conv = P.Conv2D(out_channel=4, kernel_size=3, pad_mode="same")
+relu = P.ReLU()
+max_pool = P.MaxPool(ksize=2, strides=2)
+add = P.TensorAdd()
+relu_grad = G.ReluGrad()
+
+
+class FnDict:
+    def __init__(self):
+        self.fnDict = {}
+
+    def __call__(self, fn):
+        self.fnDict[fn.__name__] = fn
+
+    def __getitem__(self, name):
+        return self.fnDict[name]
+
+
+def test_mkl_layout_propagation(tag):
+    """ test_mkl_layout_propagation """
+    fns = FnDict()
+
+    @fns
+    def inference(x, w):
+        return max_pool(relu(conv(x, w)))
+
+    @fns
+    def boundary(x, w):
+        relu_out = relu(conv(x, w))
+        return make_tuple(max_pool(relu_out), add(relu_out, relu_out))
+
+    @fns
+    def training(x, w, dout):
+        relu_out = relu(conv(x, w))
+        return relu_grad(dout, relu_out)
+
+    return fns[tag]
@@ -12,7 +12,11 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 # ==============================================================================
+import numpy as np
+
+import mindspore.common.dtype as mstype
 import mindspore.dataset as ds
+import mindspore.dataset.transforms.c_transforms as C
 from mindspore import log as logger
 from util import save_and_check_dict
 
@@ -476,6 +480,40 @@ def test_batch_exception_14():
         assert "per_batch_map and input_columns need to be passed in together." in str(e)
 
 
+def map_batch_into_slots(drop_remainder):
+    """
+    map writes its rows into the slots of the batch tensors, the last batch of each epoch is partial
+    """
+    data = np.arange(30, dtype=np.int64).reshape(10, 3)
+    data1 = ds.NumpySlicesDataset({"col": data}, shuffle=False)
+    data1 = data1.map(operations=[C.TypeCast(mstype.int32)], input_columns=["col"], num_parallel_workers=2)
+    data1 = data1.batch(4, drop_remainder=drop_remainder)
+    expected = [data[0:4], data[4:8]] if drop_remainder else [data[0:4], data[4:8], data[8:10]]
+    itr = data1.create_dict_iterator(num_epochs=3, output_numpy=True)
+    for _ in range(3):
+        batches = [item["col"] for item in itr]
+        assert len(batches) == len(expected)
+        for batch, expect in zip(batches, expected):
+            assert batch.dtype == np.int32
+            np.testing.assert_array_equal(batch, expect)
+
+
+def test_batch_map_slots_drop_remainder():
+    """
+    Test batch: map under batch with a partial last batch dropped, its slots are released at the end of the epoch
+    """
+    logger.info("test_batch_map_slots_drop_remainder")
+    map_batch_into_slots(True)
+
+
+def test_batch_map_slots_keep_remainder():
+    """
+    Test batch: map under batch with a partial last batch kept
+    """
+    logger.info("test_batch_map_slots_keep_remainder")
+    map_batch_into_slots(False)
+
+
 if __name__ == '__main__':
     test_batch_01()
     test_batch_02()
@@ -489,6 +527,8 @@ if __name__ == '__main__':
     test_batch_10()
     test_batch_11()
     test_batch_12()
+    test_batch_map_slots_drop_remainder()
+    test_batch_map_slots_keep_remainder()
     test_batch_exception_01()
     test_batch_exception_02()
     test_batch_exception_03()
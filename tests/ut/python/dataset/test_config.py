@@ -357,6 +357,159 @@ def test_deterministic_python_seed_multi_thread():
     ds.config.set_seed(seed_original)
 
 
+
+def test_autotune():
+    """
+    Test the autotune configuration, the output of an autotuned pipeline keeps its order
+    """
+    # Save original configuration values
+    autotune_steps_original = ds.config.get_autotune_steps()
+    autotune_memory_budget_original = ds.config.get_autotune_memory_budget()
+    monitor_sampling_interval_original = ds.config.get_monitor_sampling_interval()
+
+    ds.config.set_autotune_steps(200)
+    ds.config.set_autotune_memory_budget(256)
+    ds.config.set_monitor_sampling_interval(1)
+    assert ds.config.get_autotune_steps() == 200
+    assert ds.config.get_autotune_memory_budget() == 256
+
+    def gen():
+        for i in range(512):
+            yield (np.array([i], dtype=np.int32),)
+
+    data = ds.GeneratorDataset(gen, ["col"], shuffle=False)
+    data = data.map(operations=[(lambda x: x * 2)], input_columns=["col"], num_parallel_workers=2)
+    data = data.batch(4, num_parallel_workers=2)
+    expected = 0
+    for item in data.create_dict_iterator(num_epochs=1, output_numpy=True):
+        np.testing.assert_array_equal(item["col"], np.arange(expected, expected + 8, 2).reshape(4, 1))
+        expected += 8
+    assert expected == 1024
+
+    try:
+        ds.config.set_autotune_steps(-1)
+        assert False
+    except ValueError as e:
+        assert "Steps given is not within the required range" in str(e)
+
+    # Restore original configuration values
+    ds.config.set_autotune_steps(autotune_steps_original)
+    ds.config.set_autotune_memory_budget(autotune_memory_budget_original)
+    ds.config.set_monitor_sampling_interval(monitor_sampling_interval_original)
+
+
+def test_lock_free_connector():
+    """
+    Test the lock free connector configuration, the output of the pipeline keeps its order
+    """
+    lock_free_original = ds.config.get_lock_free_connector()
+
+    ds.config.set_lock_free_connector(True)
+    assert ds.config.get_lock_free_connector()
+
+    def gen():
+        for i in range(256):
+            yield (np.array([i], dtype=np.int32),)
+
+    data = ds.GeneratorDataset(gen, ["col"], shuffle=False)
+    data = data.map(operations=[(lambda x: x + 1)], input_columns=["col"], num_parallel_workers=4)
+    data = data.batch(2, num_parallel_workers=2)
+    expected = 1
+    for item in data.create_dict_iterator(num_epochs=1, output_numpy=True):
+        np.testing.assert_array_equal(item["col"], np.array([[expected], [expected + 1]]))
+        expected += 2
+    assert expected == 257
+
+    try:
+        ds.config.set_lock_free_connector(1)
+        assert False
+    except TypeError as e:
+        assert "lock_free isn't of type bool" in str(e)
+
+    ds.config.set_lock_free_connector(lock_free_original)
+
+
+def test_shuffle_partitions():
+    """
+    Test the shuffle partitions configuration, the shuffle is the same from run to run for a given seed
+    """
+    partitions_original = ds.config.get_shuffle_partitions()
+    seed_original = ds.config.get_seed()
+
+    ds.config.set_shuffle_partitions(3)
+    assert ds.config.get_shuffle_partitions() == 3
+
+    def gen():
+        for i in range(100):
+            yield (np.array([i], dtype=np.int32),)
+
+    def run():
+        ds.config.set_seed(5)
+        data = ds.GeneratorDataset(gen, ["col"], shuffle=False)
+        data = data.shuffle(10)
+        return [item["col"][0] for item in data.create_dict_iterator(num_epochs=1, output_numpy=True)]
+
+    first_run = run()
+    assert first_run == run()
+    assert first_run != list(range(100))
+    assert sorted(first_run) == list(range(100))
+
+    try:
+        ds.config.set_shuffle_partitions(0)
+        assert False
+    except ValueError as e:
+        assert "Partitions given is not within the required range" in str(e)
+
+    ds.config.set_shuffle_partitions(partitions_original)
+    ds.config.set_seed(seed_original)
+
+
+def test_tensor_pool():
+    """
+    Test the tensor pool configuration, the pipeline gives the same rows with the pool on and off
+    """
+    tensor_pool_original = ds.config.get_tensor_pool()
+    thread_cache_original = ds.config.get_tensor_pool_thread_cache_size()
+    central_cache_original = ds.config.get_tensor_pool_central_cache_size()
+
+    def gen():
+        for i in range(64):
+            yield (np.full((32, 32, 3), i, dtype=np.uint8),)
+
+    def run():
+        data = ds.GeneratorDataset(gen, ["col"], shuffle=False)
+        data = data.map(operations=[(lambda x: x + 1)], input_columns=["col"], num_parallel_workers=4)
+        return [item["col"][0][0][0] for item in data.create_dict_iterator(num_epochs=1, output_numpy=True)]
+
+    ds.config.set_tensor_pool(False)
+    assert not ds.config.get_tensor_pool()
+    assert run() == list(range(1, 65))
+
+    ds.config.set_tensor_pool(True)
+    ds.config.set_tensor_pool_thread_cache_size(1)
+    ds.config.set_tensor_pool_central_cache_size(0)
+    assert ds.config.get_tensor_pool()
+    assert ds.config.get_tensor_pool_thread_cache_size() == 1
+    assert ds.config.get_tensor_pool_central_cache_size() == 0
+    assert run() == list(range(1, 65))
+
+    try:
+        ds.config.set_tensor_pool(1)
+        assert False
+    except TypeError as e:
+        assert "enable isn't of type bool" in str(e)
+
+    try:
+        ds.config.set_tensor_pool_central_cache_size(-1)
+        assert False
+    except ValueError as e:
+        assert "Size given is not within the required range" in str(e)
+
+    ds.config.set_tensor_pool(tensor_pool_original)
+    ds.config.set_tensor_pool_thread_cache_size(thread_cache_original)
+    ds.config.set_tensor_pool_central_cache_size(central_cache_original)
+
+
 if __name__ == '__main__':
     test_basic()
     test_get_seed()
@@ -367,3 +520,7 @@ if __name__ == '__main__':
     test_deterministic_run_distribution()
     test_deterministic_python_seed()
     test_deterministic_python_seed_multi_thread()
+    test_autotune()
+    test_lock_free_connector()
+    test_shuffle_partitions()
+    test_tensor_pool()
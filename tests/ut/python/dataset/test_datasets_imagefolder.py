@@ -440,6 +440,25 @@ def test_imagefolder_zip():
     assert num_iter == 10
 
 
+def test_imagefolder_read_ahead():
+    logger.info("Test Case read ahead")
+    read_ahead_original = ds.config.get_file_read_ahead()
+
+    def read_rows(read_ahead):
+        ds.config.set_file_read_ahead(read_ahead)
+        data1 = ds.ImageFolderDataset(DATA_DIR, shuffle=False, num_parallel_workers=2)
+        data1 = data1.repeat(2)
+        return [(item["image"].tobytes(), int(item["label"]))
+                for item in data1.create_dict_iterator(num_epochs=1, output_numpy=True)]
+
+    # The files read ahead are the same as the ones read by the workers
+    expected = read_rows(0)
+    assert len(expected) == 88
+    assert read_rows(8) == expected
+
+    ds.config.set_file_read_ahead(read_ahead_original)
+
+
 if __name__ == '__main__':
     test_imagefolder_basic()
     logger.info('test_imagefolder_basic Ended.\n')
@@ -494,3 +513,6 @@ if __name__ == '__main__':
 
     test_imagefolder_zip()
     logger.info('test_imagefolder_zip Ended.\n')
+
+    test_imagefolder_read_ahead()
+    logger.info('test_imagefolder_read_ahead Ended.\n')
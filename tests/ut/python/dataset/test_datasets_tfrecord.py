@@ -15,6 +15,8 @@
 """
 Test TFRecordDataset Ops
 """
+import os
+
 import numpy as np
 import pytest
 
@@ -294,6 +296,40 @@ def test_tfrecord_invalid_files():
     assert nonexistent_file in str(info.value)
 
 
+def test_tfrecord_verify_crc():
+    logger.info("test_tfrecord_verify_crc")
+    verify_crc_original = ds.config.get_tfrecord_verify_crc()
+
+    ds.config.set_tfrecord_verify_crc(False)
+    data1 = ds.TFRecordDataset(FILES, SCHEMA_FILE, shuffle=False)
+    ds.config.set_tfrecord_verify_crc(True)
+    data2 = ds.TFRecordDataset(FILES, SCHEMA_FILE, shuffle=False)
+    num_rows = 0
+    for d1, d2 in zip(data1.create_tuple_iterator(num_epochs=1, output_numpy=True),
+                      data2.create_tuple_iterator(num_epochs=1, output_numpy=True)):
+        for t1, t2 in zip(d1, d2):
+            np.testing.assert_array_equal(t1, t2)
+        num_rows += 1
+    assert num_rows == 12
+
+    # Flip a byte in the data of the first record, after its length and the crc of its length
+    corrupted_file = "./tfrecord_verify_crc.data"
+    with open(FILES[0], "rb") as f:
+        content = bytearray(f.read())
+    content[12 + 5] ^= 0xFF
+    with open(corrupted_file, "wb") as f:
+        f.write(content)
+    try:
+        data3 = ds.TFRecordDataset([corrupted_file], SCHEMA_FILE, shuffle=False)
+        with pytest.raises(RuntimeError) as info:
+            for _ in data3.create_tuple_iterator(num_epochs=1, output_numpy=True):
+                pass
+        assert "failed to verify the crc" in str(info.value)
+    finally:
+        os.remove(corrupted_file)
+        ds.config.set_tfrecord_verify_crc(verify_crc_original)
+
+
 if __name__ == '__main__':
     test_tfrecord_shape()
     test_tfrecord_read_all_dataset()
@@ -312,3 +348,4 @@ if __name__ == '__main__':
     test_tfrecord_no_schema_columns_list()
     test_tfrecord_schema_columns_list()
     test_tfrecord_invalid_files()
+    test_tfrecord_verify_crc()
@@ -180,8 +180,32 @@ def test_tree_copy():
     itr.release()
 
 
+def test_iterator_zero_copy():
+    """
+    Test numpy arrays of the iterator share the tensor buffers and outlive the pipeline
+    """
+    data = np.arange(24, dtype=np.float32).reshape(2, 3, 4)
+    data1 = ds.NumpySlicesDataset({"col": data}, shuffle=False)
+
+    itr = data1.create_dict_iterator(num_epochs=1, output_numpy=True)
+    zero_copy = itr.depipeline.GetNextAsMap()["col"]
+    assert not zero_copy.flags.owndata
+    assert not zero_copy.flags.writeable
+    assert zero_copy.base is not None
+    with pytest.raises(ValueError):
+        zero_copy[0][0] = 0
+    copied = itr.depipeline.GetNextAsMap(zero_copy=False)["col"]
+    assert copied.flags.owndata
+    assert copied.flags.writeable
+    itr.stop()
+    del itr
+    np.testing.assert_array_equal(zero_copy, data[0])
+    np.testing.assert_array_equal(copied, data[1])
+
+
 if __name__ == '__main__':
     test_iterator_create_tuple_numpy()
     test_iterator_weak_ref()
     test_iterator_exception()
     test_tree_copy()
+    test_iterator_zero_copy()
@@ -52,6 +52,8 @@ def add_and_remove_cv_file():
                 os.remove("{}".format(x))
             if os.path.exists("{}.db".format(x)):
                 os.remove("{}.db".format(x))
+            if os.path.exists("{}.idx".format(x)):
+                os.remove("{}.idx".format(x))
         writer = FileWriter(CV_FILE_NAME, FILES_NUM)
         data = get_data(CV_DIR_NAME)
         cv_schema_json = {"id": {"type": "int32"},
@@ -67,11 +69,15 @@ def add_and_remove_cv_file():
         for x in paths:
             os.remove("{}".format(x))
             os.remove("{}.db".format(x))
+            if os.path.exists("{}.idx".format(x)):
+                os.remove("{}.idx".format(x))
         raise error
     else:
         for x in paths:
             os.remove("{}".format(x))
             os.remove("{}.db".format(x))
+            if os.path.exists("{}.idx".format(x)):
+                os.remove("{}.idx".format(x))
 
 
 @pytest.fixture
@@ -85,6 +91,8 @@ def add_and_remove_nlp_file():
                 os.remove("{}".format(x))
             if os.path.exists("{}.db".format(x)):
                 os.remove("{}.db".format(x))
+            if os.path.exists("{}.idx".format(x)):
+                os.remove("{}.idx".format(x))
         writer = FileWriter(NLP_FILE_NAME, FILES_NUM)
         data = [x for x in get_nlp_data(NLP_FILE_POS, NLP_FILE_VOCAB, 10)]
         nlp_schema_json = {"id": {"type": "string"}, "label": {"type": "int32"},
@@ -107,11 +115,15 @@ def add_and_remove_nlp_file():
         for x in paths:
             os.remove("{}".format(x))
             os.remove("{}.db".format(x))
+            if os.path.exists("{}.idx".format(x)):
+                os.remove("{}.idx".format(x))
         raise error
     else:
         for x in paths:
             os.remove("{}".format(x))
             os.remove("{}.db".format(x))
+            if os.path.exists("{}.idx".format(x)):
+                os.remove("{}.idx".format(x))
 
 
 @pytest.fixture
@@ -125,6 +137,8 @@ def add_and_remove_nlp_compress_file():
                 os.remove("{}".format(x))
             if os.path.exists("{}.db".format(x)):
                 os.remove("{}.db".format(x))
+            if os.path.exists("{}.idx".format(x)):
+                os.remove("{}.idx".format(x))
         writer = FileWriter(NLP_FILE_NAME, FILES_NUM)
         data = []
         for row_id in range(16):
@@ -159,11 +173,15 @@ def add_and_remove_nlp_compress_file():
         for x in paths:
             os.remove("{}".format(x))
             os.remove("{}.db".format(x))
+            if os.path.exists("{}.idx".format(x)):
+                os.remove("{}.idx".format(x))
         raise error
     else:
         for x in paths:
             os.remove("{}".format(x))
             os.remove("{}.db".format(x))
+            if os.path.exists("{}.idx".format(x)):
+                os.remove("{}.idx".format(x))
 
 
 def test_nlp_compress_data(add_and_remove_nlp_compress_file):
@@ -227,6 +245,8 @@ def test_cv_minddataset_writer_tutorial():
                 os.remove("{}".format(x))
             if os.path.exists("{}.db".format(x)):
                 os.remove("{}.db".format(x))
+            if os.path.exists("{}.idx".format(x)):
+                os.remove("{}.idx".format(x))
         writer = FileWriter(CV_FILE_NAME, FILES_NUM)
         data = get_data(CV_DIR_NAME)
         cv_schema_json = {"file_name": {"type": "string"}, "label": {"type": "int32"},
@@ -239,11 +259,15 @@ def test_cv_minddataset_writer_tutorial():
         for x in paths:
             os.remove("{}".format(x))
             os.remove("{}.db".format(x))
+            if os.path.exists("{}.idx".format(x)):
+                os.remove("{}.idx".format(x))
         raise error
     else:
         for x in paths:
             os.remove("{}".format(x))
             os.remove("{}.db".format(x))
+            if os.path.exists("{}.idx".format(x)):
+                os.remove("{}.idx".format(x))
 
 
 def test_cv_minddataset_partition_tutorial(add_and_remove_cv_file):
@@ -549,6 +573,25 @@ def test_cv_minddataset_dataset_size(add_and_remove_cv_file):
     assert data_set.get_dataset_size() == 3
 
 
+def test_cv_minddataset_read_ahead(add_and_remove_cv_file):
+    """tutorial for cv minddataset reading ahead the rows of its workers."""
+    read_ahead_original = ds.config.get_file_read_ahead()
+
+    def read_rows(read_ahead):
+        ds.config.set_file_read_ahead(read_ahead)
+        data_set = ds.MindDataset([CV_FILE_NAME + str(x) for x in range(FILES_NUM)], ["data", "file_name", "label"],
+                                  num_parallel_workers=4, shuffle=False)
+        data_set = data_set.repeat(2)
+        return [(item["data"].tobytes(), str(item["file_name"]), int(item["label"]))
+                for item in data_set.create_dict_iterator(num_epochs=1, output_numpy=True)]
+
+    expected = read_rows(0)
+    assert len(expected) == 20
+    assert read_rows(3) == expected
+
+    ds.config.set_file_read_ahead(read_ahead_original)
+
+
 def test_cv_minddataset_repeat_reshuffle(add_and_remove_cv_file):
     """tutorial for cv minddataset."""
     columns_list = ["data", "label"]
@@ -669,10 +712,14 @@ def test_cv_minddataset_reader_two_dataset(add_and_remove_cv_file):
             os.remove(CV1_FILE_NAME)
         if os.path.exists("{}.db".format(CV1_FILE_NAME)):
             os.remove("{}.db".format(CV1_FILE_NAME))
+        if os.path.exists("{}.idx".format(CV1_FILE_NAME)):
+            os.remove("{}.idx".format(CV1_FILE_NAME))
         if os.path.exists(CV2_FILE_NAME):
             os.remove(CV2_FILE_NAME)
         if os.path.exists("{}.db".format(CV2_FILE_NAME)):
             os.remove("{}.db".format(CV2_FILE_NAME))
+        if os.path.exists("{}.idx".format(CV2_FILE_NAME)):
+            os.remove("{}.idx".format(CV2_FILE_NAME))
         writer = FileWriter(CV1_FILE_NAME, 1)
         data = get_data(CV_DIR_NAME)
         cv_schema_json = {"id": {"type": "int32"},
@@ -718,20 +765,28 @@ def test_cv_minddataset_reader_two_dataset(add_and_remove_cv_file):
             os.remove(CV1_FILE_NAME)
         if os.path.exists("{}.db".format(CV1_FILE_NAME)):
             os.remove("{}.db".format(CV1_FILE_NAME))
+        if os.path.exists("{}.idx".format(CV1_FILE_NAME)):
+            os.remove("{}.idx".format(CV1_FILE_NAME))
         if os.path.exists(CV2_FILE_NAME):
             os.remove(CV2_FILE_NAME)
         if os.path.exists("{}.db".format(CV2_FILE_NAME)):
             os.remove("{}.db".format(CV2_FILE_NAME))
+        if os.path.exists("{}.idx".format(CV2_FILE_NAME)):
+            os.remove("{}.idx".format(CV2_FILE_NAME))
         raise error
     else:
         if os.path.exists(CV1_FILE_NAME):
             os.remove(CV1_FILE_NAME)
         if os.path.exists("{}.db".format(CV1_FILE_NAME)):
             os.remove("{}.db".format(CV1_FILE_NAME))
+        if os.path.exists("{}.idx".format(CV1_FILE_NAME)):
+            os.remove("{}.idx".format(CV1_FILE_NAME))
         if os.path.exists(CV2_FILE_NAME):
             os.remove(CV2_FILE_NAME)
         if os.path.exists("{}.db".format(CV2_FILE_NAME)):
             os.remove("{}.db".format(CV2_FILE_NAME))
+        if os.path.exists("{}.idx".format(CV2_FILE_NAME)):
+            os.remove("{}.idx".format(CV2_FILE_NAME))
 
 
 def test_cv_minddataset_reader_two_dataset_partition(add_and_remove_cv_file):
@@ -743,6 +798,8 @@ def test_cv_minddataset_reader_two_dataset_partition(add_and_remove_cv_file):
                 os.remove("{}".format(x))
             if os.path.exists("{}.db".format(x)):
                 os.remove("{}.db".format(x))
+            if os.path.exists("{}.idx".format(x)):
+                os.remove("{}.idx".format(x))
         writer = FileWriter(CV1_FILE_NAME, FILES_NUM)
         data = get_data(CV_DIR_NAME)
         cv_schema_json = {"id": {"type": "int32"},
@@ -778,11 +835,15 @@ def test_cv_minddataset_reader_two_dataset_partition(add_and_remove_cv_file):
         for x in paths:
             os.remove("{}".format(x))
             os.remove("{}.db".format(x))
+            if os.path.exists("{}.idx".format(x)):
+                os.remove("{}.idx".format(x))
         raise error
     else:
         for x in paths:
             os.remove("{}".format(x))
             os.remove("{}.db".format(x))
+            if os.path.exists("{}.idx".format(x)):
+                os.remove("{}.idx".format(x))
 
 
 def test_cv_minddataset_reader_basic_tutorial(add_and_remove_cv_file):
@@ -1119,6 +1180,8 @@ def test_write_with_multi_bytes_and_array_and_read_by_MindDataset():
             os.remove("{}".format(mindrecord_file_name))
         if os.path.exists("{}.db".format(mindrecord_file_name)):
             os.remove("{}.db".format(mindrecord_file_name))
+        if os.path.exists("{}.idx".format(mindrecord_file_name)):
+            os.remove("{}.idx".format(mindrecord_file_name))
         data = [{"file_name": "001.jpg", "label": 4,
                  "image1": bytes("image1 bytes abc", encoding='UTF-8'),
                  "image2": bytes("image1 bytes def", encoding='UTF-8'),
@@ -1362,10 +1425,14 @@ def test_write_with_multi_bytes_and_array_and_read_by_MindDataset():
     except Exception as error:
         os.remove("{}".format(mindrecord_file_name))
         os.remove("{}.db".format(mindrecord_file_name))
+        if os.path.exists("{}.idx".format(mindrecord_file_name)):
+            os.remove("{}.idx".format(mindrecord_file_name))
         raise error
     else:
         os.remove("{}".format(mindrecord_file_name))
         os.remove("{}.db".format(mindrecord_file_name))
+        if os.path.exists("{}.idx".format(mindrecord_file_name)):
+            os.remove("{}.idx".format(mindrecord_file_name))
 
 
 def test_write_with_multi_bytes_and_MindDataset():
@@ -1543,10 +1610,14 @@ def test_write_with_multi_bytes_and_MindDataset():
     except Exception as error:
         os.remove("{}".format(mindrecord_file_name))
         os.remove("{}.db".format(mindrecord_file_name))
+        if os.path.exists("{}.idx".format(mindrecord_file_name)):
+            os.remove("{}.idx".format(mindrecord_file_name))
         raise error
     else:
         os.remove("{}".format(mindrecord_file_name))
         os.remove("{}.db".format(mindrecord_file_name))
+        if os.path.exists("{}.idx".format(mindrecord_file_name)):
+            os.remove("{}.idx".format(mindrecord_file_name))
 
 
 def test_write_with_multi_array_and_MindDataset():
@@ -1746,10 +1817,14 @@ def test_write_with_multi_array_and_MindDataset():
     except Exception as error:
         os.remove("{}".format(mindrecord_file_name))
         os.remove("{}.db".format(mindrecord_file_name))
+        if os.path.exists("{}.idx".format(mindrecord_file_name)):
+            os.remove("{}.idx".format(mindrecord_file_name))
         raise error
     else:
         os.remove("{}".format(mindrecord_file_name))
         os.remove("{}.db".format(mindrecord_file_name))
+        if os.path.exists("{}.idx".format(mindrecord_file_name)):
+            os.remove("{}.idx".format(mindrecord_file_name))
 
 
 def test_numpy_generic():
@@ -1761,6 +1836,8 @@ def test_numpy_generic():
                 os.remove("{}".format(x))
             if os.path.exists("{}.db".format(x)):
                 os.remove("{}.db".format(x))
+            if os.path.exists("{}.idx".format(x)):
+                os.remove("{}.idx".format(x))
         writer = FileWriter(CV_FILE_NAME, FILES_NUM)
         cv_schema_json = {"label1": {"type": "int32"}, "label2": {"type": "int64"},
                           "label3": {"type": "float32"}, "label4": {"type": "float64"}}
@@ -1791,11 +1868,15 @@ def test_numpy_generic():
         for x in paths:
             os.remove("{}".format(x))
             os.remove("{}.db".format(x))
+            if os.path.exists("{}.idx".format(x)):
+                os.remove("{}.idx".format(x))
         raise error
     else:
         for x in paths:
             os.remove("{}".format(x))
             os.remove("{}.db".format(x))
+            if os.path.exists("{}.idx".format(x)):
+                os.remove("{}.idx".format(x))
 
 
 def test_write_with_float32_float64_float32_array_float64_array_and_MindDataset():
@@ -1945,10 +2026,71 @@ def test_write_with_float32_float64_float32_array_float64_array_and_MindDataset(
     except Exception as error:
         os.remove("{}".format(mindrecord_file_name))
         os.remove("{}.db".format(mindrecord_file_name))
+        if os.path.exists("{}.idx".format(mindrecord_file_name)):
+            os.remove("{}.idx".format(mindrecord_file_name))
+        raise error
+    else:
+        os.remove("{}".format(mindrecord_file_name))
+        os.remove("{}.db".format(mindrecord_file_name))
+        if os.path.exists("{}.idx".format(mindrecord_file_name)):
+            os.remove("{}.idx".format(mindrecord_file_name))
+
+
+def test_write_with_columnar_label_and_MindDataset():
+    mindrecord_file_name = "test_columnar_label.mindrecord"
+    try:
+        data = [{"file_name": "{:03d}.jpg".format(i), "int32": i, "int64": i * 1000000007,
+                 "float32": np.float32(i / 4.0), "float64": i / 3.0,
+                 "int64_array": np.array([i, i + 1], dtype=np.int64),
+                 "data": bytes("image bytes {}".format(i), encoding='UTF-8')} for i in range(100)]
+        writer = FileWriter(mindrecord_file_name)
+        writer.set_columnar_label(True)
+        schema = {"file_name": {"type": "string"},
+                  "int32": {"type": "int32"},
+                  "int64": {"type": "int64"},
+                  "float32": {"type": "float32"},
+                  "float64": {"type": "float64"},
+                  "int64_array": {"type": "int64", "shape": [-1]},
+                  "data": {"type": "bytes"}}
+        writer.add_schema(schema, "data is so cool")
+        writer.write_raw_data(data)
+        writer.commit()
+
+        data_set = ds.MindDataset(dataset_file=mindrecord_file_name, num_parallel_workers=2, shuffle=False)
+        assert data_set.get_dataset_size() == 100
+        num_iter = 0
+        for item in data_set.create_dict_iterator(num_epochs=1, output_numpy=True):
+            assert len(item) == 7
+            for field in item:
+                if field == "file_name":
+                    assert item[field] == data[num_iter][field]
+                elif isinstance(data[num_iter][field], bytes):
+                    assert item[field].tobytes() == data[num_iter][field]
+                else:
+                    assert (item[field] == data[num_iter][field]).all()
+            num_iter += 1
+        assert num_iter == 100
+
+        data_set = ds.MindDataset(dataset_file=mindrecord_file_name, columns_list=["float64", "int32"],
+                                  num_parallel_workers=2, shuffle=False)
+        num_iter = 0
+        for item in data_set.create_dict_iterator(num_epochs=1, output_numpy=True):
+            assert len(item) == 2
+            assert item["float64"] == data[num_iter]["float64"]
+            assert item["int32"] == data[num_iter]["int32"]
+            num_iter += 1
+        assert num_iter == 100
+    except Exception as error:
+        os.remove("{}".format(mindrecord_file_name))
+        os.remove("{}.db".format(mindrecord_file_name))
+        if os.path.exists("{}.idx".format(mindrecord_file_name)):
+            os.remove("{}.idx".format(mindrecord_file_name))
         raise error
     else:
         os.remove("{}".format(mindrecord_file_name))
         os.remove("{}.db".format(mindrecord_file_name))
+        if os.path.exists("{}.idx".format(mindrecord_file_name)):
+            os.remove("{}.idx".format(mindrecord_file_name))
 
 
 if __name__ == '__main__':
@@ -1963,6 +2105,7 @@ if __name__ == '__main__':
     test_cv_minddataset_partition_tutorial_check_whole_reshuffle_result_per_epoch(add_and_remove_cv_file)
     test_cv_minddataset_check_shuffle_result(add_and_remove_cv_file)
     test_cv_minddataset_dataset_size(add_and_remove_cv_file)
+    test_cv_minddataset_read_ahead(add_and_remove_cv_file)
     test_cv_minddataset_repeat_reshuffle(add_and_remove_cv_file)
     test_cv_minddataset_batch_size_larger_than_records(add_and_remove_cv_file)
     test_cv_minddataset_issue_888(add_and_remove_cv_file)
@@ -1983,3 +2126,4 @@ if __name__ == '__main__':
     test_write_with_multi_array_and_MindDataset()
     test_numpy_generic()
     test_write_with_float32_float64_float32_array_float64_array_and_MindDataset()
+    test_write_with_columnar_label_and_MindDataset()
@@ -40,6 +40,8 @@ def add_and_remove_cv_file():
                 os.remove("{}".format(x))
             if os.path.exists("{}.db".format(x)):
                 os.remove("{}.db".format(x))
+            if os.path.exists("{}.idx".format(x)):
+                os.remove("{}.idx".format(x))
         writer = FileWriter(CV_FILE_NAME, FILES_NUM)
         data = get_data(CV_DIR_NAME, True)
         cv_schema_json = {"id": {"type": "int32"},
@@ -55,11 +57,15 @@ def add_and_remove_cv_file():
         for x in paths:
             os.remove("{}".format(x))
             os.remove("{}.db".format(x))
+            if os.path.exists("{}.idx".format(x)):
+                os.remove("{}.idx".format(x))
         raise error
     else:
         for x in paths:
             os.remove("{}".format(x))
             os.remove("{}.db".format(x))
+            if os.path.exists("{}.idx".format(x)):
+                os.remove("{}.idx".format(x))
 
 def test_cv_minddataset_pk_sample_no_column(add_and_remove_cv_file):
     """tutorial for cv minderdataset."""
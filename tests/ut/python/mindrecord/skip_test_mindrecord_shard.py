@@ -106,6 +106,8 @@ def test_nlp_page_reader():
     for x in paths:
         os.remove("{}".format(x))
         os.remove("{}.db".format(x))
+        if os.path.exists("{}.idx".format(x)):
+            os.remove("{}.idx".format(x))
 
 
 def test_cv_file_writer():
@@ -182,6 +184,8 @@ def test_cv_page_reader():
     for x in paths:
         os.remove("{}".format(x))
         os.remove("{}.db".format(x))
+        if os.path.exists("{}.idx".format(x)):
+            os.remove("{}.idx".format(x))
 
 
 def test_mkv_file_writer():
@@ -257,6 +261,8 @@ def test_mkv_page_reader_random():
     for x in paths:
         os.remove("{}".format(x))
         os.remove("{}.db".format(x))
+        if os.path.exists("{}.idx".format(x)):
+            os.remove("{}.idx".format(x))
 
 
 def test_mkv_file_writer_with_exactly_schema():
@@ -348,3 +354,5 @@ def test_mkv_file_reader_with_exactly_schema():
     for x in paths:
         os.remove("{}".format(x))
         os.remove("{}.db".format(x))
+        if os.path.exists("{}.idx".format(x)):
+            os.remove("{}.idx".format(x))
@@ -33,10 +33,14 @@ def fixture_file():
             os.remove("{}".format(x))
         if os.path.exists("{}.db".format(x)):
             os.remove("{}.db".format(x))
+        if os.path.exists("{}.idx".format(x)):
+            os.remove("{}.idx".format(x))
         if os.path.exists("{}_test".format(x)):
             os.remove("{}_test".format(x))
         if os.path.exists("{}_test.db".format(x)):
             os.remove("{}_test.db".format(x))
+        if os.path.exists("{}_test.idx".format(x)):
+            os.remove("{}_test.idx".format(x))
 
     remove_file(MINDRECORD_FILE)
     yield "yield_fixture_data"
@@ -36,11 +36,15 @@ def fixture_file():
         remove_one_file(x)
         x = MINDRECORD_FILE + ".db"
         remove_one_file(x)
+        x = MINDRECORD_FILE + ".idx"
+        remove_one_file(x)
         for i in range(PARTITION_NUMBER):
             x = MINDRECORD_FILE + str(i)
             remove_one_file(x)
             x = MINDRECORD_FILE + str(i) + ".db"
             remove_one_file(x)
+            x = MINDRECORD_FILE + str(i) + ".idx"
+            remove_one_file(x)
 
     remove_file()
     yield "yield_fixture_data"
@@ -14,6 +14,7 @@
 # ============================================================================
 """test mindrecord base"""
 import os
+import shutil
 import uuid
 import numpy as np
 from utils import get_data, get_nlp_data
@@ -77,6 +78,8 @@ def test_write_read_process():
 
     os.remove("{}".format(mindrecord_file_name))
     os.remove("{}.db".format(mindrecord_file_name))
+    if os.path.exists("{}.idx".format(mindrecord_file_name)):
+        os.remove("{}.idx".format(mindrecord_file_name))
 
 
 def test_write_read_process_with_define_index_field():
@@ -128,6 +131,8 @@ def test_write_read_process_with_define_index_field():
 
     os.remove("{}".format(mindrecord_file_name))
     os.remove("{}.db".format(mindrecord_file_name))
+    if os.path.exists("{}.idx".format(mindrecord_file_name)):
+        os.remove("{}.idx".format(mindrecord_file_name))
 
 
 def test_cv_file_writer_tutorial():
@@ -169,6 +174,8 @@ def test_cv_file_append_writer():
     for x in paths:
         os.remove("{}".format(x))
         os.remove("{}.db".format(x))
+        if os.path.exists("{}.idx".format(x)):
+            os.remove("{}.idx".format(x))
 
 
 def test_cv_file_append_writer_absolute_path():
@@ -198,6 +205,8 @@ def test_cv_file_append_writer_absolute_path():
     for x in paths:
         os.remove("{}".format(x))
         os.remove("{}.db".format(x))
+        if os.path.exists("{}.idx".format(x)):
+            os.remove("{}.idx".format(x))
 
 
 def test_cv_file_writer_loop_and_read():
@@ -226,6 +235,8 @@ def test_cv_file_writer_loop_and_read():
     for x in paths:
         os.remove("{}".format(x))
         os.remove("{}.db".format(x))
+        if os.path.exists("{}.idx".format(x)):
+            os.remove("{}.idx".format(x))
 
 
 def test_cv_file_reader_tutorial():
@@ -339,6 +350,8 @@ def test_cv_page_reader_tutorial_new_api():
     for x in paths:
         os.remove("{}".format(x))
         os.remove("{}.db".format(x))
+        if os.path.exists("{}.idx".format(x)):
+            os.remove("{}.idx".format(x))
 
 
 def test_nlp_file_writer_tutorial():
@@ -402,6 +415,8 @@ def test_nlp_page_reader_tutorial():
     for x in paths:
         os.remove("{}".format(x))
         os.remove("{}.db".format(x))
+        if os.path.exists("{}.idx".format(x)):
+            os.remove("{}.idx".format(x))
 
 
 def test_cv_file_writer_shard_num_10():
@@ -420,6 +435,8 @@ def test_cv_file_writer_shard_num_10():
     for x in paths:
         os.remove("{}".format(x))
         os.remove("{}.db".format(x))
+        if os.path.exists("{}.idx".format(x)):
+            os.remove("{}.idx".format(x))
 
 
 def test_cv_file_writer_absolute_path():
@@ -439,6 +456,8 @@ def test_cv_file_writer_absolute_path():
     for x in paths:
         os.remove("{}".format(x))
         os.remove("{}.db".format(x))
+        if os.path.exists("{}.idx".format(x)):
+            os.remove("{}.idx".format(x))
 
 
 def test_cv_file_writer_without_data():
@@ -458,6 +477,8 @@ def test_cv_file_writer_without_data():
     reader.close()
     os.remove(CV_FILE_NAME)
     os.remove("{}.db".format(CV_FILE_NAME))
+    if os.path.exists("{}.idx".format(CV_FILE_NAME)):
+        os.remove("{}.idx".format(CV_FILE_NAME))
 
 
 def test_cv_file_writer_no_blob():
@@ -480,6 +501,8 @@ def test_cv_file_writer_no_blob():
     reader.close()
     os.remove(CV_FILE_NAME)
     os.remove("{}.db".format(CV_FILE_NAME))
+    if os.path.exists("{}.idx".format(CV_FILE_NAME)):
+        os.remove("{}.idx".format(CV_FILE_NAME))
 
 
 def test_cv_file_writer_no_raw():
@@ -508,6 +531,8 @@ def test_cv_file_writer_no_raw():
     reader.close()
     os.remove(NLP_FILE_NAME)
     os.remove("{}.db".format(NLP_FILE_NAME))
+    if os.path.exists("{}.idx".format(NLP_FILE_NAME)):
+        os.remove("{}.idx".format(NLP_FILE_NAME))
 
 
 def test_write_read_process_with_multi_bytes():
@@ -633,6 +658,8 @@ def test_write_read_process_with_multi_bytes():
 
     os.remove("{}".format(mindrecord_file_name))
     os.remove("{}.db".format(mindrecord_file_name))
+    if os.path.exists("{}.idx".format(mindrecord_file_name)):
+        os.remove("{}.idx".format(mindrecord_file_name))
 
 
 def test_write_read_process_with_multi_array():
@@ -777,6 +804,8 @@ def test_write_read_process_with_multi_array():
 
     os.remove("{}".format(mindrecord_file_name))
     os.remove("{}.db".format(mindrecord_file_name))
+    if os.path.exists("{}.idx".format(mindrecord_file_name)):
+        os.remove("{}.idx".format(mindrecord_file_name))
 
 
 def test_write_read_process_with_multi_bytes_and_array():
@@ -964,3 +993,247 @@ def test_write_read_process_with_multi_bytes_and_array():
 
     os.remove("{}".format(mindrecord_file_name))
     os.remove("{}.db".format(mindrecord_file_name))
+    if os.path.exists("{}.idx".format(mindrecord_file_name)):
+        os.remove("{}.idx".format(mindrecord_file_name))
+
+
+def test_write_read_process_with_columnar_label():
+    mindrecord_file_name = "test_columnar_label.mindrecord"
+    data = [{"file_name": "{:05d}.jpg".format(i), "label": i % 1000, "score": i / 8.0,
+             "mask": np.array([i, i + 1, i + 2], dtype=np.int64),
+             "data": bytes("image bytes {}".format(i), encoding='UTF-8')} for i in range(4000)]
+    writer = FileWriter(mindrecord_file_name)
+    writer.set_page_size(1 << 15)
+    assert writer.set_columnar_label(True) == SUCCESS
+    schema = {"file_name": {"type": "string"},
+              "label": {"type": "int32"},
+              "score": {"type": "float64"},
+              "mask": {"type": "int64", "shape": [-1]},
+              "data": {"type": "bytes"}}
+    writer.add_schema(schema, "data is so cool")
+    writer.add_index(["file_name", "label"])
+    writer.write_raw_data(data[0:1500])
+    writer.write_raw_data(data[1500:3000])
+    writer.commit()
+
+    # the label pages of the file are filled up by the rows appended
+    write_append = FileWriter.open_for_append(mindrecord_file_name)
+    write_append.write_raw_data(data[3000:4000])
+    write_append.commit()
+
+    reader = FileReader(mindrecord_file_name)
+    count = 0
+    for index, x in enumerate(reader.get_next()):
+        assert len(x) == 5
+        for field in x:
+            if isinstance(x[field], np.ndarray):
+                assert (x[field] == data[count][field]).all()
+            else:
+                assert x[field] == data[count][field]
+        count = count + 1
+        logger.info("#item{}: {}".format(index, x))
+    assert count == 4000
+    reader.close()
+
+    reader = FileReader(file_name=mindrecord_file_name, columns=["label", "score"])
+    count = 0
+    for x in reader.get_next():
+        assert len(x) == 2
+        assert x["label"] == data[count]["label"]
+        assert x["score"] == data[count]["score"]
+        count = count + 1
+    assert count == 4000
+    reader.close()
+
+    reader = MindPage(mindrecord_file_name)
+    assert reader.set_category_field("label") == SUCCESS
+    info = reader.read_at_page_by_name("7", 0, 2)
+    assert len(info) == 2
+    assert info[0]["label"] == 7
+    assert info[0]["file_name"] == "00007.jpg"
+    assert info[0]["score"] == data[7]["score"]
+
+    os.remove("{}".format(mindrecord_file_name))
+    os.remove("{}.db".format(mindrecord_file_name))
+    if os.path.exists("{}.idx".format(mindrecord_file_name)):
+        os.remove("{}.idx".format(mindrecord_file_name))
+
+
+def test_write_read_process_with_binary_index():
+    mindrecord_file_name = "test_binary_index.mindrecord"
+    data = [{"file_name": "{:05d}.jpg".format(i), "label": i % 10, "score": (i % 4) / 8.0,
+             "data": bytes("image bytes {}".format(i), encoding='UTF-8')} for i in range(200)]
+    writer = FileWriter(mindrecord_file_name)
+    writer.set_page_size(1 << 15)
+    schema = {"file_name": {"type": "string"},
+              "label": {"type": "int32"},
+              "score": {"type": "float64"},
+              "data": {"type": "bytes"}}
+    writer.add_schema(schema, "data is so cool")
+    writer.add_index(["file_name", "label", "score"])
+    writer.write_raw_data(data)
+    writer.commit()
+    assert os.path.exists("{}.idx".format(mindrecord_file_name))
+
+    def read_pages():
+        reader = MindPage(mindrecord_file_name)
+        assert reader.get_category_fields() == ["file_name", "label", "score"]
+        pages = []
+        for field, name in [("label", "7"), ("score", "0.25"), ("file_name", "00042.jpg")]:
+            assert reader.set_category_field(field) == SUCCESS
+            pages.append(reader.read_category_info())
+            pages.append(reader.read_at_page_by_name(name, 0, 5))
+        return pages
+
+    # the sqlite index gives the same rows when there is no binary index
+    pages = read_pages()
+    assert [x["file_name"] for x in pages[1]] == ["00007.jpg", "00017.jpg", "00027.jpg", "00037.jpg", "00047.jpg"]
+    assert [x["label"] for x in pages[3]] == [2, 6, 0, 4, 8]
+    assert [x["label"] for x in pages[5]] == [2]
+    shutil.copyfile("{}.idx".format(mindrecord_file_name), "{}.idx.bak".format(mindrecord_file_name))
+    os.remove("{}.idx".format(mindrecord_file_name))
+    assert read_pages() == pages
+
+    # the binary index of a former file of the same name is not used for a new file, neither left by the
+    # writer nor put back afterwards
+    os.remove("{}".format(mindrecord_file_name))
+    os.remove("{}.db".format(mindrecord_file_name))
+    shutil.copyfile("{}.idx.bak".format(mindrecord_file_name), "{}.idx".format(mindrecord_file_name))
+    writer = FileWriter(mindrecord_file_name)
+    writer.set_page_size(1 << 15)
+    writer.add_schema(schema, "data is so cool")
+    writer.add_index(["file_name", "label", "score"])
+    writer.write_raw_data(data[0:150])
+    assert not os.path.exists("{}.idx".format(mindrecord_file_name))
+    writer.commit()
+    shutil.copyfile("{}.idx.bak".format(mindrecord_file_name), "{}.idx".format(mindrecord_file_name))
+    reader = MindPage(mindrecord_file_name)
+    assert reader.set_category_field("label") == SUCCESS
+    assert len(reader.read_at_page_by_name("7", 0, 20)) == 15
+    reader = FileReader(mindrecord_file_name)
+    assert len(list(reader.get_next())) == 150
+    reader.close()
+
+    os.remove("{}".format(mindrecord_file_name))
+    os.remove("{}.db".format(mindrecord_file_name))
+    os.remove("{}.idx.bak".format(mindrecord_file_name))
+    if os.path.exists("{}.idx".format(mindrecord_file_name)):
+        os.remove("{}.idx".format(mindrecord_file_name))
+
+
+def test_write_read_process_with_page_compression():
+    mindrecord_file_name = "test_page_compression.mindrecord"
+    # blobs compressible or not, some of them larger than a chunk of the compressed pages
+    data = [{"file_name": "{:05d}.jpg".format(i), "label": i % 10,
+             "mask": np.arange(i % 50, dtype=np.int64),
+             "data": bytes("image bytes {}".format(i), encoding='UTF-8') * (i % 2000) if i % 3 else
+                     np.random.randint(0, 256, (i % 5) * 100000, dtype=np.uint8).tobytes()} for i in range(300)]
+    writer = FileWriter(mindrecord_file_name)
+    writer.set_page_size(1 << 21)
+    assert writer.set_parallel_workers(4) == SUCCESS
+    assert writer.set_page_compression("zlib") == SUCCESS
+    schema = {"file_name": {"type": "string"},
+              "label": {"type": "int32"},
+              "mask": {"type": "int64", "shape": [-1]},
+              "data": {"type": "bytes"}}
+    writer.add_schema(schema, "data is so cool")
+    writer.add_index(["file_name", "label"])
+    writer.write_raw_data(data[0:100])
+    writer.write_raw_data(data[100:200])
+    writer.commit()
+
+    # the rows appended are compressed as the ones of the file
+    write_append = FileWriter.open_for_append(mindrecord_file_name)
+    write_append.write_raw_data(data[200:300])
+    write_append.commit()
+
+    reader = FileReader(file_name=mindrecord_file_name, num_consumer=4)
+    count = 0
+    for x in reader.get_next():
+        assert len(x) == 4
+        assert x["file_name"] == data[count]["file_name"]
+        assert (x["mask"] == data[count]["mask"]).all()
+        assert x["data"] == data[count]["data"]
+        count = count + 1
+    assert count == 300
+    reader.close()
+
+    reader = MindPage(mindrecord_file_name)
+    assert reader.set_category_field("label") == SUCCESS
+    info = reader.read_at_page_by_name("7", 2, 3)
+    assert [x["file_name"] for x in info] == ["00067.jpg", "00077.jpg", "00087.jpg"]
+    assert [x["data"] for x in info] == [data[67]["data"], data[77]["data"], data[87]["data"]]
+
+    os.remove("{}".format(mindrecord_file_name))
+    os.remove("{}.db".format(mindrecord_file_name))
+    if os.path.exists("{}.idx".format(mindrecord_file_name)):
+        os.remove("{}.idx".format(mindrecord_file_name))
+
+
+def test_page_compression_packs_pages():
+    plain_file_name = "test_page_compression_plain.mindrecord"
+    packed_file_name = "test_page_compression_packed.mindrecord"
+    data = [{"file_name": "{:05d}.jpg".format(i), "label": i % 10,
+             "data": bytes("image bytes {}".format(i), encoding='UTF-8') * 5000} for i in range(100)]
+    schema = {"file_name": {"type": "string"},
+              "label": {"type": "int32"},
+              "data": {"type": "bytes"}}
+    for file_name, compression in ((plain_file_name, "none"), (packed_file_name, "zlib")):
+        writer = FileWriter(file_name)
+        writer.set_page_size(1 << 21)
+        assert writer.set_page_compression(compression) == SUCCESS
+        writer.add_schema(schema, "data is so cool")
+        writer.add_index(["file_name", "label"])
+        writer.write_raw_data(data[0:50])
+        writer.write_raw_data(data[50:100])
+        writer.commit()
+
+    # the compressed pages are packed, so the apparent size of the file shrinks too
+    assert os.path.getsize(packed_file_name) < os.path.getsize(plain_file_name) / 2
+
+    reader = FileReader(file_name=packed_file_name, num_consumer=4)
+    count = 0
+    for x in reader.get_next():
+        assert x["file_name"] == data[count]["file_name"]
+        assert x["data"] == data[count]["data"]
+        count = count + 1
+    assert count == 100
+    reader.close()
+
+    for file_name in (plain_file_name, packed_file_name):
+        os.remove("{}".format(file_name))
+        os.remove("{}.db".format(file_name))
+        if os.path.exists("{}.idx".format(file_name)):
+            os.remove("{}.idx".format(file_name))
+
+
+def test_write_raw_data_in_many_calls():
+    mindrecord_file_name = "test_write_many_calls.mindrecord"
+    # the rows of a call are written while the next call checks and serializes its rows
+    data = [{"file_name": "{:05d}.jpg".format(i), "label": i % 10,
+             "data": bytes("image bytes {}".format(i), encoding='UTF-8') * (i % 100 + 1)} for i in range(1000)]
+    writer = FileWriter(mindrecord_file_name, 4)
+    writer.set_page_size(1 << 16)
+    assert writer.set_parallel_workers(2) == SUCCESS
+    schema = {"file_name": {"type": "string"},
+              "label": {"type": "int32"},
+              "data": {"type": "bytes"}}
+    writer.add_schema(schema, "data is so cool")
+    writer.add_index(["file_name", "label"])
+    for i in range(0, 1000, 10):
+        writer.write_raw_data(data[i:i + 10])
+    writer.commit()
+
+    reader = FileReader(file_name=mindrecord_file_name + "0", num_consumer=4)
+    rows = {x["file_name"]: x["data"] for x in reader.get_next()}
+    reader.close()
+    assert len(rows) == 1000
+    for x in data:
+        assert rows[x["file_name"]] == x["data"]
+
+    for i in range(4):
+        file_name = "{}{}".format(mindrecord_file_name, i)
+        os.remove(file_name)
+        os.remove("{}.db".format(file_name))
+        if os.path.exists("{}.idx".format(file_name)):
+            os.remove("{}.idx".format(file_name))
@@ -41,6 +41,8 @@ def test_write_two_images_mindrecord():
     """test two images to mindrecord"""
     if os.path.exists("{}".format(CV_FILE_NAME + ".db")):
         os.remove(CV_FILE_NAME + ".db")
+    if os.path.exists("{}".format(CV_FILE_NAME + ".idx")):
+        os.remove(CV_FILE_NAME + ".idx")
     if os.path.exists("{}".format(CV_FILE_NAME)):
         os.remove(CV_FILE_NAME)
     writer = FileWriter(CV_FILE_NAME, FILES_NUM)
@@ -55,6 +57,8 @@ def test_write_two_images_mindrecord():
 
     if os.path.exists("{}".format(CV_FILE_NAME + ".db")):
         os.remove(CV_FILE_NAME + ".db")
+    if os.path.exists("{}".format(CV_FILE_NAME + ".idx")):
+        os.remove(CV_FILE_NAME + ".idx")
     if os.path.exists("{}".format(CV_FILE_NAME)):
         os.remove(CV_FILE_NAME)
 
@@ -63,6 +67,8 @@ def test_write_two_images_mindrecord_whole_field():
     """test two images to mindrecord"""
     if os.path.exists("{}".format(CV_FILE_NAME + ".db")):
         os.remove(CV_FILE_NAME + ".db")
+    if os.path.exists("{}".format(CV_FILE_NAME + ".idx")):
+        os.remove(CV_FILE_NAME + ".idx")
     if os.path.exists("{}".format(CV_FILE_NAME)):
         os.remove(CV_FILE_NAME)
     writer = FileWriter(CV_FILE_NAME, FILES_NUM)
@@ -79,6 +85,8 @@ def test_write_two_images_mindrecord_whole_field():
 
     if os.path.exists("{}".format(CV_FILE_NAME + ".db")):
         os.remove(CV_FILE_NAME + ".db")
+    if os.path.exists("{}".format(CV_FILE_NAME + ".idx")):
+        os.remove(CV_FILE_NAME + ".idx")
     if os.path.exists("{}".format(CV_FILE_NAME)):
         os.remove(CV_FILE_NAME)
 
@@ -87,6 +95,8 @@ def test_write_two_diff_shape_images_mindrecord():
     """test two different shape images to mindrecord"""
     if os.path.exists("{}".format(CV_FILE_NAME + ".db")):
         os.remove(CV_FILE_NAME + ".db")
+    if os.path.exists("{}".format(CV_FILE_NAME + ".idx")):
+        os.remove(CV_FILE_NAME + ".idx")
     if os.path.exists("{}".format(CV_FILE_NAME)):
         os.remove(CV_FILE_NAME)
     bytes_num = 2
@@ -106,6 +116,8 @@ def test_write_multi_images_mindrecord():
     """test multiple images to mindrecord"""
     if os.path.exists("{}".format(CV_FILE_NAME + ".db")):
         os.remove(CV_FILE_NAME + ".db")
+    if os.path.exists("{}".format(CV_FILE_NAME + ".idx")):
+        os.remove(CV_FILE_NAME + ".idx")
     if os.path.exists("{}".format(CV_FILE_NAME)):
         os.remove(CV_FILE_NAME)
     bytes_num = 10
@@ -125,6 +137,8 @@ def test_write_two_images_and_array_mindrecord():
     """test two image images and array to mindrecord"""
     if os.path.exists("{}".format(CV_FILE_NAME + ".db")):
         os.remove(CV_FILE_NAME + ".db")
+    if os.path.exists("{}".format(CV_FILE_NAME + ".idx")):
+        os.remove(CV_FILE_NAME + ".idx")
     if os.path.exists("{}".format(CV_FILE_NAME)):
         os.remove(CV_FILE_NAME)
 
@@ -149,5 +163,7 @@ def test_write_two_images_and_array_mindrecord():
 
     if os.path.exists("{}".format(CV_FILE_NAME + ".db")):
         os.remove(CV_FILE_NAME + ".db")
+    if os.path.exists("{}".format(CV_FILE_NAME + ".idx")):
+        os.remove(CV_FILE_NAME + ".idx")
     if os.path.exists("{}".format(CV_FILE_NAME)):
         os.remove(CV_FILE_NAME)